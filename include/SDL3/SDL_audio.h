@@ -1073,6 +1073,23 @@ extern SDL_DECLSPEC SDL_AudioDeviceID SDLCALL SDL_GetAudioStreamDevice(SDL_Audio
  */
 extern SDL_DECLSPEC SDL_AudioStream * SDLCALL SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_AudioSpec *dst_spec);
 
+/**
+ * The quality of the resampler used by an audio stream.
+ *
+ * Higher quality resamplers produce less aliasing and distortion, but take
+ * more CPU time per converted frame.
+ *
+ * \since This enum is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetAudioStreamProperties
+ */
+typedef enum SDL_AudioResampleQuality
+{
+    SDL_AUDIO_RESAMPLE_QUALITY_LINEAR,  /**< Linear interpolation between neighboring frames. Fastest, but lets through a lot of aliasing. */
+    SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM,  /**< A windowed sinc filter. This is the default. */
+    SDL_AUDIO_RESAMPLE_QUALITY_HIGH     /**< A longer windowed sinc filter, which also filters out aliasing when downsampling. */
+} SDL_AudioResampleQuality;
+
 /**
  * Get the properties associated with an audio stream.
  *
@@ -1086,6 +1103,51 @@ extern SDL_DECLSPEC SDL_AudioStream * SDLCALL SDL_CreateAudioStream(const SDL_Au
  *   be cleaned up. Streams that are not cleaned up will still be unbound from
  *   devices when the audio subsystem quits. This property was added in SDL
  *   3.4.0.
+ * - `SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER`: an SDL_AudioResampleQuality
+ *   value, the quality of the resampler used when the input and output
+ *   sample rates differ. Defaults to SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM. This
+ *   can be changed at any time, and takes effect the next time data is
+ *   converted. This property was added in SDL 3.6.0.
+ * - `SDL_PROP_AUDIOSTREAM_SINGLE_PRODUCER_BOOLEAN`: if true, the app promises
+ *   that only one thread at a time puts data into the stream. Once the input
+ *   format is settled, SDL_PutAudioStreamData() then hands data to the stream
+ *   without locking it, so a device thread reading the stream never waits on
+ *   the producer, and the producer never waits on the device thread. Any
+ *   other call (changing the format, setting a put callback,
+ *   SDL_PutAudioStreamDataNoCopy(), etc) goes through the usual locked path,
+ *   and the next SDL_PutAudioStreamData() call after that locks the stream
+ *   once more before going back to the lock-free path. The property is only
+ *   read by those locked puts, so turning it off takes effect after one of
+ *   those other calls, or after the stream is bound to a device. Defaults to
+ *   false. This property was added in SDL 3.6.0.
+ * - `SDL_PROP_AUDIOSTREAM_QUEUE_CHUNK_SIZE_NUMBER`: the size, in bytes, of
+ *   the chunks the stream copies input data into. Defaults to 8192, and is
+ *   clamped between 1024 and 16 megabytes. A new size takes effect the next
+ *   time data is put into the stream while it is empty. This property was
+ *   added in SDL 3.6.0.
+ * - `SDL_PROP_AUDIOSTREAM_QUEUE_RESERVED_CHUNKS_NUMBER`: the number of chunks
+ *   to allocate ahead of time, so that putting up to this many chunks of data
+ *   into the stream doesn't need to allocate memory. Defaults to 0. This
+ *   takes effect the next time data is put into the stream. This property
+ *   was added in SDL 3.6.0.
+ * - `SDL_PROP_AUDIOSTREAM_QUEUE_MAX_FREE_CHUNKS_NUMBER`: the number of unused
+ *   chunks the stream keeps for reuse instead of freeing them. It is never
+ *   less than the number of reserved chunks. Defaults to 4. This takes effect
+ *   the next time data is put into the stream. This property was added in
+ *   SDL 3.6.0.
+ *
+ * These read-only properties are updated each time this function is called:
+ *
+ * - `SDL_PROP_AUDIOSTREAM_QUEUE_BLOCKS_ALLOCATED_NUMBER`: the number of
+ *   memory blocks the stream's queue has allocated so far. If this doesn't go
+ *   up while audio is playing, the queue isn't allocating any memory. This
+ *   property was added in SDL 3.6.0.
+ * - `SDL_PROP_AUDIOSTREAM_QUEUE_BLOCKS_RECYCLED_NUMBER`: the number of times
+ *   the stream's queue reused a block instead of allocating a new one. This
+ *   property was added in SDL 3.6.0.
+ * - `SDL_PROP_AUDIOSTREAM_QUEUE_BLOCKS_FREED_NUMBER`: the number of memory
+ *   blocks the stream's queue has freed so far. This property was added in
+ *   SDL 3.6.0.
  *
  * \param stream the SDL_AudioStream to query.
  * \returns a valid property ID on success or 0 on failure; call
@@ -1098,6 +1160,14 @@ extern SDL_DECLSPEC SDL_AudioStream * SDLCALL SDL_CreateAudioStream(const SDL_Au
 extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetAudioStreamProperties(SDL_AudioStream *stream);
 
 #define SDL_PROP_AUDIOSTREAM_AUTO_CLEANUP_BOOLEAN "SDL.audiostream.auto_cleanup"
+#define SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER "SDL.audiostream.resample_quality"
+#define SDL_PROP_AUDIOSTREAM_SINGLE_PRODUCER_BOOLEAN "SDL.audiostream.single_producer"
+#define SDL_PROP_AUDIOSTREAM_QUEUE_CHUNK_SIZE_NUMBER "SDL.audiostream.queue.chunk_size"
+#define SDL_PROP_AUDIOSTREAM_QUEUE_RESERVED_CHUNKS_NUMBER "SDL.audiostream.queue.reserved_chunks"
+#define SDL_PROP_AUDIOSTREAM_QUEUE_MAX_FREE_CHUNKS_NUMBER "SDL.audiostream.queue.max_free_chunks"
+#define SDL_PROP_AUDIOSTREAM_QUEUE_BLOCKS_ALLOCATED_NUMBER "SDL.audiostream.queue.blocks_allocated"
+#define SDL_PROP_AUDIOSTREAM_QUEUE_BLOCKS_RECYCLED_NUMBER "SDL.audiostream.queue.blocks_recycled"
+#define SDL_PROP_AUDIOSTREAM_QUEUE_BLOCKS_FREED_NUMBER "SDL.audiostream.queue.blocks_freed"
 
 
 /**
@@ -1527,8 +1597,8 @@ extern SDL_DECLSPEC bool SDLCALL SDL_PutAudioStreamDataNoCopy(SDL_AudioStream *s
  *
  * The data will be interleaved and queued. Note that SDL_AudioStream only
  * operates on interleaved data, so this is simply a convenience function for
- * easily queueing data from sources that provide separate arrays. There is no
- * equivalent function to retrieve planar data.
+ * easily queueing data from sources that provide separate arrays. Use
+ * SDL_GetAudioStreamPlanarData to retrieve planar data.
  *
  * The arrays in `channel_buffers` are ordered as they are to be interleaved;
  * the first array will be the first sample in the interleaved data. Any
@@ -1567,6 +1637,7 @@ extern SDL_DECLSPEC bool SDLCALL SDL_PutAudioStreamDataNoCopy(SDL_AudioStream *s
  * \sa SDL_ClearAudioStream
  * \sa SDL_FlushAudioStream
  * \sa SDL_GetAudioStreamData
+ * \sa SDL_GetAudioStreamPlanarData
  * \sa SDL_GetAudioStreamQueued
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_PutAudioStreamPlanarData(SDL_AudioStream *stream, const void * const *channel_buffers, int num_channels, int num_samples);
@@ -1601,6 +1672,79 @@ extern SDL_DECLSPEC bool SDLCALL SDL_PutAudioStreamPlanarData(SDL_AudioStream *s
  */
 extern SDL_DECLSPEC int SDLCALL SDL_GetAudioStreamData(SDL_AudioStream *stream, void *buf, int len);
 
+/**
+ * Get converted/resampled data from the stream with each channel in a
+ * separate array.
+ *
+ * This is the planar counterpart of SDL_GetAudioStreamData: the data is
+ * converted to the stream's output format and then split into one array per
+ * channel.
+ *
+ * `num_channels` specifies how many arrays are in `channel_buffers`. If more
+ * channels are specified than the current output spec, they are ignored. If
+ * less channels are specified, or any individual array is NULL, the data for
+ * those channels is discarded. If the count is -1, SDL will assume the array
+ * count matches the current output spec.
+ *
+ * Note that `num_samples` is the number of _samples per array_, which is the
+ * same as the number of _sample frames_, and so is the return value.
+ *
+ * \param stream the stream the audio is being requested from.
+ * \param channel_buffers a pointer to an array of arrays, one array per
+ *                        channel, each with room for `num_samples` samples.
+ * \param num_channels the number of arrays in `channel_buffers` or -1.
+ * \param num_samples the maximum number of _samples_ per array to fill.
+ * \returns the number of samples per array read from the stream or -1 on
+ *          failure; call SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread, but if the
+ *               stream has a callback set, the caller might need to manage
+ *               extra locking.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetAudioStreamData
+ * \sa SDL_GetAudioStreamPlanarPointers
+ * \sa SDL_PutAudioStreamPlanarData
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_GetAudioStreamPlanarData(SDL_AudioStream *stream, void * const *channel_buffers, int num_channels, int num_samples);
+
+/**
+ * Get converted/resampled planar data from the stream without copying it out.
+ *
+ * This works like SDL_GetAudioStreamPlanarData, but instead of filling arrays
+ * provided by the app, the data is left in a buffer owned by the stream, and
+ * `channel_buffers` is filled with a pointer to each channel's samples. This
+ * saves a copy when the app only needs to read the data, for example to feed
+ * it into further processing.
+ *
+ * Like SDL_GetAudioStreamPlanarData, this removes the data from the stream.
+ * The pointers stay valid until the next call to this function or
+ * SDL_GetAudioStreamPlanarData on the same stream, or until the stream is
+ * destroyed. If no data was available, the pointers are set to NULL.
+ *
+ * If `num_channels` is less than the channels of the current output spec,
+ * only that many pointers are provided, and the other channels are
+ * discarded. If it is -1, SDL will assume the array has room for every
+ * channel of the current output spec.
+ *
+ * \param stream the stream the audio is being requested from.
+ * \param channel_buffers an array of `num_channels` pointers to be filled in.
+ * \param num_channels the number of pointers in `channel_buffers` or -1.
+ * \param num_samples the maximum number of _samples_ per channel to get.
+ * \returns the number of samples per channel read from the stream or -1 on
+ *          failure; call SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread, but the
+ *               returned pointers must not be used while another thread
+ *               might be getting data from the same stream.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetAudioStreamPlanarData
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_GetAudioStreamPlanarPointers(SDL_AudioStream *stream, const void **channel_buffers, int num_channels, int num_samples);
+
 /**
  * Get the number of converted/resampled bytes available.
  *
@@ -2252,6 +2396,182 @@ extern SDL_DECLSPEC bool SDLCALL SDL_LoadWAV_IO(SDL_IOStream *src, bool closeio,
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_LoadWAV(const char *path, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len);
 
+/**
+ * An opaque handle for reading a WAVE file a piece at a time.
+ *
+ * \since This struct is available since SDL 3.6.0.
+ *
+ * \sa SDL_OpenWAVReader_IO
+ * \sa SDL_OpenWAVReader
+ */
+typedef struct SDL_WAVReader SDL_WAVReader;
+
+/**
+ * Open a WAVE file for streaming from a data source.
+ *
+ * Unlike SDL_LoadWAV_IO(), this only parses the headers of the file. The
+ * audio data is read and decoded on demand by SDL_ReadWAVFrames(), so long
+ * files can be played without holding all of the decoded samples in memory.
+ * The same formats and hints as SDL_LoadWAV_IO() are supported. ADPCM data
+ * is decoded a block at a time.
+ *
+ * The data source must support seeking and must stay valid until the reader
+ * is closed.
+ *
+ * \param src the data source for the WAVE data.
+ * \param closeio if true, calls SDL_CloseIO() on `src` when the reader is
+ *                closed, or before returning in the case of an error.
+ * \param spec a pointer to an SDL_AudioSpec that will be set to the format
+ *             of the frames returned by SDL_ReadWAVFrames(), may be NULL.
+ * \returns a new reader on success or NULL on failure; call SDL_GetError()
+ *          for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CloseWAVReader
+ * \sa SDL_OpenWAVReader
+ * \sa SDL_ReadWAVFrames
+ */
+extern SDL_DECLSPEC SDL_WAVReader * SDLCALL SDL_OpenWAVReader_IO(SDL_IOStream *src, bool closeio, SDL_AudioSpec *spec);
+
+/**
+ * Open a WAVE file for streaming from a file path.
+ *
+ * This is a convenience function that is effectively the same as:
+ *
+ * ```c
+ * SDL_OpenWAVReader_IO(SDL_IOFromFile(path, "rb"), true, spec);
+ * ```
+ *
+ * \param path the file path of the WAV file to open.
+ * \param spec a pointer to an SDL_AudioSpec that will be set to the format
+ *             of the frames returned by SDL_ReadWAVFrames(), may be NULL.
+ * \returns a new reader on success or NULL on failure; call SDL_GetError()
+ *          for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CloseWAVReader
+ * \sa SDL_OpenWAVReader_IO
+ */
+extern SDL_DECLSPEC SDL_WAVReader * SDLCALL SDL_OpenWAVReader(const char *path, SDL_AudioSpec *spec);
+
+/**
+ * Get the number of sample frames in a WAVE file.
+ *
+ * \param reader the reader to query.
+ * \returns the number of sample frames or -1 on failure; call SDL_GetError()
+ *          for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread, but not
+ *               concurrently with other calls on the same reader.
+ *
+ * \since This function is available since SDL 3.6.0.
+ */
+extern SDL_DECLSPEC Sint64 SDLCALL SDL_GetWAVReaderFrames(SDL_WAVReader *reader);
+
+/**
+ * Read and decode sample frames from a WAVE file.
+ *
+ * Frames are read from the current position, which is then advanced by the
+ * number of frames returned. The data has the format reported when the reader
+ * was opened.
+ *
+ * \param reader the reader to read from.
+ * \param buf a buffer that receives the decoded frames, large enough for
+ *            `num_frames` frames.
+ * \param num_frames the maximum number of sample frames to read.
+ * \returns the number of sample frames read, 0 at the end of the data, or -1
+ *          on failure; call SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread, but not
+ *               concurrently with other calls on the same reader.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_ReadWAVFramesToAudioStream
+ * \sa SDL_SeekWAVReader
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_ReadWAVFrames(SDL_WAVReader *reader, void *buf, int num_frames);
+
+/**
+ * Read and decode sample frames from a WAVE file into an audio stream.
+ *
+ * This is the same as SDL_ReadWAVFrames(), but the frames are put into
+ * `stream` with SDL_PutAudioStreamData(). The input format of the stream
+ * should match the format reported when the reader was opened.
+ *
+ * \param reader the reader to read from.
+ * \param stream the audio stream to put the frames into.
+ * \param num_frames the maximum number of sample frames to read.
+ * \returns the number of sample frames put into the stream, 0 at the end of
+ *          the data, or -1 on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, but not
+ *               concurrently with other calls on the same reader.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_ReadWAVFrames
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_ReadWAVFramesToAudioStream(SDL_WAVReader *reader, SDL_AudioStream *stream, int num_frames);
+
+/**
+ * Set the read position of a WAVE file.
+ *
+ * Positions past the end are clamped to the end of the data. For ADPCM data,
+ * the block containing the new position is decoded by the next read.
+ *
+ * \param reader the reader to seek.
+ * \param frame the sample frame to read next.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, but not
+ *               concurrently with other calls on the same reader.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_TellWAVReader
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SeekWAVReader(SDL_WAVReader *reader, Sint64 frame);
+
+/**
+ * Get the read position of a WAVE file.
+ *
+ * \param reader the reader to query.
+ * \returns the sample frame that will be read next or -1 on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread, but not
+ *               concurrently with other calls on the same reader.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_SeekWAVReader
+ */
+extern SDL_DECLSPEC Sint64 SDLCALL SDL_TellWAVReader(SDL_WAVReader *reader);
+
+/**
+ * Close a WAVE reader.
+ *
+ * \param reader the reader to close, may be NULL.
+ *
+ * \threadsafety It is safe to call this function from any thread, but not
+ *               concurrently with other calls on the same reader.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_OpenWAVReader_IO
+ * \sa SDL_OpenWAVReader
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_CloseWAVReader(SDL_WAVReader *reader);
+
 /**
  * Mix audio data in a specified format.
  *
@@ -404,6 +404,18 @@ extern SDL_DECLSPEC SDL_CameraID SDLCALL SDL_GetCameraID(SDL_Camera *camera);
 /**
  * Get the properties associated with an opened camera.
  *
+ * The application can hang any data it wants here, but the following
+ * properties are understood by SDL:
+ *
+ * - `SDL_PROP_CAMERA_DECODE_THREADS_NUMBER`: the number of threads that
+ *   decode compressed (MJPG) frames when the app asked for a different
+ *   format. With more than one thread, several frames are decoded at the same
+ *   time, and they are still handed to the app in the order they were
+ *   captured. 0 uses one thread per logical CPU core, up to 4, and 1 decodes
+ *   every frame on the camera's own thread. Defaults to 0. This can be
+ *   changed at any time, and takes effect with the next frame. This property
+ *   was added in SDL 3.6.0.
+ *
  * \param camera the SDL_Camera obtained from SDL_OpenCamera().
  * \returns a valid property ID on success or 0 on failure; call
  *          SDL_GetError() for more information.
@@ -414,6 +426,8 @@ extern SDL_DECLSPEC SDL_CameraID SDLCALL SDL_GetCameraID(SDL_Camera *camera);
  */
 extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetCameraProperties(SDL_Camera *camera);
 
+#define SDL_PROP_CAMERA_DECODE_THREADS_NUMBER "SDL.camera.decode_threads"
+
 /**
  * Get the spec that a camera is using when generating images.
  *
@@ -344,6 +344,31 @@ extern "C" {
  */
 #define SDL_HINT_AUDIO_DEVICE_SAMPLE_FRAMES "SDL_AUDIO_DEVICE_SAMPLE_FRAMES"
 
+/**
+ * A variable controlling how many threads pull data from the audio streams
+ * bound to a playback device.
+ *
+ * This hint is an integer. A value of 0 or 1 (the default) means all bound
+ * streams are converted and mixed on the device's audio thread, one after
+ * another. A larger value makes SDL start that many minus one extra worker
+ * threads per opened playback device, and spread the stream conversion work
+ * across them and the device thread. This can help when a very large number
+ * of streams are bound to a single device.
+ *
+ * The streams are still mixed together in the same order on the device
+ * thread, so the output is the same no matter how many threads are used.
+ *
+ * When this is enabled, audio stream callbacks for bound streams may run
+ * concurrently on different threads, and must not call functions that lock
+ * the audio device, like SDL_BindAudioStream() or SDL_CloseAudioDevice().
+ *
+ * This hint is checked each time a playback device is opened, and applies to
+ * the physical device it is opened on.
+ *
+ * \since This hint is available since SDL 3.6.0.
+ */
+#define SDL_HINT_AUDIO_DEVICE_MIX_THREADS "SDL_AUDIO_DEVICE_MIX_THREADS"
+
 /**
  * Specify an audio stream name for an audio device.
  *
@@ -609,6 +634,36 @@ extern "C" {
  */
 #define SDL_HINT_BMP_SAVE_LEGACY_FORMAT "SDL_BMP_SAVE_LEGACY_FORMAT"
 
+/**
+ * Specify the input file for the disk camera driver.
+ *
+ * The file is a recorded MJPG stream: JPEG images of the same size, one
+ * after another, like the raw output of a camera or `ffmpeg -f mjpeg`. It is
+ * loaded into memory when the camera subsystem is initialized, and played
+ * back in a loop. If the file can't be loaded, the driver has no cameras.
+ *
+ * This defaults to "sdlcamera-in.mjpg"
+ *
+ * This hint should be set before the camera subsystem is initialized.
+ *
+ * \since This hint is available since SDL 3.6.0.
+ */
+#define SDL_HINT_CAMERA_DISK_INPUT_FILE "SDL_CAMERA_DISK_INPUT_FILE"
+
+/**
+ * A variable controlling the frame rate when using the disk camera driver.
+ *
+ * The disk camera driver normally delivers 30 frames per second, but you can
+ * use this variable to scale the time between frames higher or lower, down
+ * to 0, which delivers frames as fast as they can be used. The default value
+ * is "1.0".
+ *
+ * This hint should be set before a camera is opened.
+ *
+ * \since This hint is available since SDL 3.6.0.
+ */
+#define SDL_HINT_CAMERA_DISK_TIMESCALE "SDL_CAMERA_DISK_TIMESCALE"
+
 /**
  * A variable that decides what camera backend to use.
  *
@@ -625,6 +680,24 @@ extern "C" {
  */
 #define SDL_HINT_CAMERA_DRIVER "SDL_CAMERA_DRIVER"
 
+/**
+ * A variable controlling how many frames a camera can queue for the app.
+ *
+ * Each opened camera keeps this many frames ready for SDL_AcquireCameraFrame()
+ * and in use by the app. When the queue is full, new frames are dropped until
+ * the app calls SDL_ReleaseCameraFrame(). If the app's format and size match
+ * the hardware, frames are passed to the app in the driver's buffers without
+ * being copied, and on some platforms SDL asks the driver for a matching
+ * number of buffers.
+ *
+ * The variable can be set to a number between 1 and 64. The default is 8.
+ *
+ * This hint should be set before a camera is opened.
+ *
+ * \since This hint is available since SDL 3.6.0.
+ */
+#define SDL_HINT_CAMERA_FRAME_QUEUE_DEPTH "SDL_CAMERA_FRAME_QUEUE_DEPTH"
+
 /**
  * A variable that limits what CPU features are available.
  *
@@ -654,6 +727,10 @@ extern "C" {
  *
  * The items can be prefixed by '+'/'-' to add/remove features.
  *
+ * This hint can be changed at any time, and affects the next CPU feature
+ * check. Code paths that SDL selected before the change (e.g. when a
+ * subsystem was initialized) keep using the features they selected.
+ *
  * \since This hint is available since SDL 3.2.0.
  */
 #define SDL_HINT_CPU_FEATURE_MASK "SDL_CPU_FEATURE_MASK"
@@ -3107,6 +3184,72 @@ extern "C" {
  */
 #define SDL_HINT_ORIENTATIONS "SDL_ORIENTATIONS"
 
+/**
+ * A variable controlling how much SDL_SavePNG() and SDL_SavePNG_IO() compress
+ * image data.
+ *
+ * The variable can be set to a number from "0" to "9", like the zlib
+ * compression levels: "0" stores the data without compressing it, "1" is the
+ * fastest and "9" compresses the most. The default is "6".
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.6.0.
+ */
+#define SDL_HINT_PNG_SAVE_COMPRESSION_LEVEL "SDL_PNG_SAVE_COMPRESSION_LEVEL"
+
+/**
+ * A variable controlling which filter SDL_SavePNG() and SDL_SavePNG_IO()
+ * apply to rows of pixels before compressing them.
+ *
+ * Filters store each byte as the difference from a prediction based on its
+ * neighbors, which usually makes photos and rendered images compress much
+ * better, at some cost in speed. Palette images are never filtered.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "none": Store the pixels as they are. (default)
+ * - "sub": Predict each byte from the pixel to the left.
+ * - "up": Predict each byte from the pixel above.
+ * - "average": Predict each byte from the average of the pixels to the left
+ *   and above.
+ * - "paeth": Predict each byte from the pixel to the left, above or above
+ *   left, whichever is closest to a linear estimate.
+ * - "adaptive": Try each filter on every row and keep the one that is likely
+ *   to compress best.
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.6.0.
+ */
+#define SDL_HINT_PNG_SAVE_FILTER "SDL_PNG_SAVE_FILTER"
+
+/**
+ * A variable controlling how many threads compress the image data in
+ * SDL_SavePNG() and SDL_SavePNG_IO().
+ *
+ * With more than one thread, the image is split into bands of rows that are
+ * compressed at the same time and written in order. The threads are started
+ * the first time they're needed and are shared with surface conversions (see
+ * SDL_HINT_SURFACE_CONVERT_THREADS). This makes the file slightly larger than
+ * compressing it on one thread. By
+ * default, images with at least 1 MiB of pixel data are compressed with one
+ * thread per logical CPU core (up to 16), and smaller images are compressed
+ * on the calling thread.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Choose the number of threads based on the size of the image.
+ *   (default)
+ * - "1": Always compress on the calling thread.
+ * - "N": Compress with up to N threads, regardless of the size of the image.
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.6.0.
+ */
+#define SDL_HINT_PNG_SAVE_THREADS "SDL_PNG_SAVE_THREADS"
+
 /**
  * A variable controlling the use of a sentinel event when polling the event
  * queue.
@@ -3326,6 +3469,43 @@ extern "C" {
  */
 #define SDL_HINT_RENDER_METAL_PREFER_LOW_POWER_DEVICE "SDL_RENDER_METAL_PREFER_LOW_POWER_DEVICE"
 
+/**
+ * A variable controlling whether the renderer may reorder draws that don't
+ * overlap, so draws with the same texture and state can be merged.
+ *
+ * This hint overrides SDL_PROP_RENDERER_CREATE_REORDER_DRAWS_BOOLEAN when
+ * creating a renderer.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Draws are submitted in the order they were made. (default)
+ * - "1": Draws that don't overlap may be reordered and merged.
+ *
+ * This hint should be set before creating a renderer.
+ *
+ * \since This hint is available since SDL 3.6.0.
+ */
+#define SDL_HINT_RENDER_REORDER_DRAWS "SDL_RENDER_REORDER_DRAWS"
+
+/**
+ * A variable controlling how many threads the software renderer draws with.
+ *
+ * When more than one thread is used, the render target is split into
+ * horizontal bands and each thread draws the queued commands that touch its
+ * band. The result is identical to drawing on a single thread.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Use one thread per logical CPU core.
+ * - "1": Draw on the thread that calls the render functions. (default)
+ * - "N": Draw with N threads.
+ *
+ * This hint should be set before creating a renderer.
+ *
+ * \since This hint is available since SDL 3.6.0.
+ */
+#define SDL_HINT_RENDER_SOFTWARE_THREADS "SDL_RENDER_SOFTWARE_THREADS"
+
 /**
  * A variable controlling whether updates to the SDL screen surface should be
  * synchronized with the vertical refresh, to avoid tearing.
@@ -3523,6 +3703,27 @@ extern "C" {
  */
 #define SDL_HINT_STORAGE_USER_DRIVER "SDL_STORAGE_USER_DRIVER"
 
+/**
+ * A variable controlling how many threads convert large images.
+ *
+ * When more than one thread is used, SDL_ConvertPixels(),
+ * SDL_ConvertSurface() and the related functions split large images into
+ * bands of rows that are converted at the same time. Scaling with
+ * SDL_SCALEMODE_AREA is split the same way. The result is identical to
+ * converting on a single thread.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Use one thread per logical CPU core.
+ * - "1": Convert on the calling thread. (default)
+ * - "N": Convert with N threads.
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.6.0.
+ */
+#define SDL_HINT_SURFACE_CONVERT_THREADS "SDL_SURFACE_CONVERT_THREADS"
+
 /**
  * Specifies whether SDL_THREAD_PRIORITY_TIME_CRITICAL should be treated as
  * realtime.
@@ -4321,6 +4522,27 @@ extern "C" {
  */
 #define SDL_HINT_WAVE_CHUNK_LIMIT "SDL_WAVE_CHUNK_LIMIT"
 
+/**
+ * A variable controlling how many threads decode an ADPCM WAVE file.
+ *
+ * MS and IMA ADPCM data is made of independent blocks, which can be decoded
+ * in parallel. By default, files with at least 256 KiB of ADPCM data are
+ * decoded with one thread per logical CPU core (up to 16), and smaller files
+ * are decoded on the calling thread.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0" - Choose the number of threads based on the size of the file.
+ *   (default)
+ * - "1" - Always decode on the calling thread.
+ * - "N" - Decode with up to N threads, regardless of the size of the file.
+ *
+ * This hint should be set before calling SDL_LoadWAV() or SDL_LoadWAV_IO()
+ *
+ * \since This hint is available since SDL 3.6.0.
+ */
+#define SDL_HINT_WAVE_DECODE_THREADS "SDL_WAVE_DECODE_THREADS"
+
 /**
  * A variable controlling how the size of the RIFF chunk affects the loading
  * of a WAVE file.
@@ -293,6 +293,18 @@ extern SDL_DECLSPEC SDL_Renderer * SDLCALL SDL_CreateRenderer(SDL_Window *window
  * - `SDL_PROP_RENDERER_CREATE_PRESENT_VSYNC_NUMBER`: non-zero if you want
  *   present synchronized with the refresh rate. This property can take any
  *   value that is supported by SDL_SetRenderVSync() for the renderer.
+ * - `SDL_PROP_RENDERER_CREATE_REORDER_DRAWS_BOOLEAN`: true if draws that
+ *   don't overlap may be reordered, so draws with the same texture and state
+ *   can be merged into fewer draw calls when the render commands are flushed,
+ *   defaults to false. (since SDL 3.6.0)
+ * - `SDL_PROP_RENDERER_CREATE_VERTEX_BUFFER_SIZE_NUMBER`: the number of bytes
+ *   to allocate up front for each of the buffers that hold queued vertex
+ *   data. The buffers grow as needed, but never shrink below this size,
+ *   defaults to 0. (since SDL 3.6.0)
+ * - `SDL_PROP_RENDERER_CREATE_VERTEX_BUFFER_DECAY_NUMBER`: the number of
+ *   frames after which memory for vertex data that recent frames haven't
+ *   needed is released, or 0 to keep the buffers at the largest size they've
+ *   ever needed, defaults to 300. (since SDL 3.6.0)
  *
  * With the SDL GPU renderer (since SDL 3.4.0):
  *
@@ -341,6 +353,9 @@ extern SDL_DECLSPEC SDL_Renderer * SDLCALL SDL_CreateRendererWithProperties(SDL_
 #define SDL_PROP_RENDERER_CREATE_SURFACE_POINTER                            "SDL.renderer.create.surface"
 #define SDL_PROP_RENDERER_CREATE_OUTPUT_COLORSPACE_NUMBER                   "SDL.renderer.create.output_colorspace"
 #define SDL_PROP_RENDERER_CREATE_PRESENT_VSYNC_NUMBER                       "SDL.renderer.create.present_vsync"
+#define SDL_PROP_RENDERER_CREATE_REORDER_DRAWS_BOOLEAN                      "SDL.renderer.create.reorder_draws"
+#define SDL_PROP_RENDERER_CREATE_VERTEX_BUFFER_SIZE_NUMBER                  "SDL.renderer.create.vertex_buffer_size"
+#define SDL_PROP_RENDERER_CREATE_VERTEX_BUFFER_DECAY_NUMBER                 "SDL.renderer.create.vertex_buffer_decay"
 #define SDL_PROP_RENDERER_CREATE_GPU_DEVICE_POINTER                         "SDL.renderer.create.gpu.device"
 #define SDL_PROP_RENDERER_CREATE_GPU_SHADERS_SPIRV_BOOLEAN                  "SDL.renderer.create.gpu.shaders_spirv"
 #define SDL_PROP_RENDERER_CREATE_GPU_SHADERS_DXIL_BOOLEAN                   "SDL.renderer.create.gpu.shaders_dxil"
@@ -495,6 +510,47 @@ extern SDL_DECLSPEC const char * SDLCALL SDL_GetRendererName(SDL_Renderer *rende
  *   that can be displayed, in terms of the SDR white point. When HDR is not
  *   enabled, this will be 1.0. This property can change dynamically when
  *   SDL_EVENT_WINDOW_HDR_STATE_CHANGED is sent.
+ * - `SDL_PROP_RENDERER_QUEUED_COMMANDS_NUMBER`: the number of render commands
+ *   queued since the renderer was created, updated when the render commands
+ *   are flushed. (since SDL 3.6.0)
+ * - `SDL_PROP_RENDERER_SUBMITTED_COMMANDS_NUMBER`: the number of render
+ *   commands passed to the rendering backend since the renderer was created,
+ *   which is lower than the queued commands when draws are merged by
+ *   SDL_PROP_RENDERER_CREATE_REORDER_DRAWS_BOOLEAN. (since SDL 3.6.0)
+ *
+ * The following read-only properties describe the work done for the last
+ * frame, from one call to SDL_RenderPresent() to the next, and are updated
+ * by SDL_RenderPresent() (since SDL 3.6.0):
+ *
+ * - `SDL_PROP_RENDERER_FRAME_STATE_COMMANDS_NUMBER`: the number of viewport,
+ *   clip rectangle and draw color changes passed to the rendering backend.
+ * - `SDL_PROP_RENDERER_FRAME_CLEAR_COMMANDS_NUMBER`: the number of clears
+ *   passed to the rendering backend.
+ * - `SDL_PROP_RENDERER_FRAME_POINT_COMMANDS_NUMBER`: the number of point
+ *   draws passed to the rendering backend.
+ * - `SDL_PROP_RENDERER_FRAME_LINE_COMMANDS_NUMBER`: the number of line draws
+ *   passed to the rendering backend.
+ * - `SDL_PROP_RENDERER_FRAME_RECT_COMMANDS_NUMBER`: the number of filled
+ *   rectangle draws passed to the rendering backend.
+ * - `SDL_PROP_RENDERER_FRAME_COPY_COMMANDS_NUMBER`: the number of texture
+ *   copies passed to the rendering backend.
+ * - `SDL_PROP_RENDERER_FRAME_GEOMETRY_COMMANDS_NUMBER`: the number of
+ *   geometry draws passed to the rendering backend.
+ * - `SDL_PROP_RENDERER_FRAME_VERTEX_BYTES_NUMBER`: the number of bytes of
+ *   vertex data passed to the rendering backend.
+ * - `SDL_PROP_RENDERER_FRAME_TEXTURE_UPLOAD_BYTES_NUMBER`: the number of
+ *   bytes of pixels passed to the rendering backend by SDL_UpdateTexture(),
+ *   SDL_UpdateYUVTexture(), SDL_UpdateNVTexture() and SDL_UnlockTexture().
+ * - `SDL_PROP_RENDERER_FRAME_FLUSHES_NUMBER`: the number of times the queued
+ *   render commands were passed to the rendering backend, including the
+ *   flush by SDL_RenderPresent().
+ * - `SDL_PROP_RENDERER_FRAME_DEPENDENCY_FLUSHES_NUMBER`: the number of those
+ *   flushes that happened because a texture, palette or GPU render state used
+ *   by the queued commands was changed.
+ * - `SDL_PROP_RENDERER_FRAME_SUBMIT_TIME_NS_NUMBER`: the time spent by the
+ *   rendering backend on the queued render commands, in nanoseconds.
+ * - `SDL_PROP_RENDERER_VERTEX_BUFFER_SIZE_NUMBER`: the number of bytes
+ *   allocated for queued vertex data.
  *
  * With the direct3d renderer:
  *
@@ -540,6 +596,14 @@ extern SDL_DECLSPEC const char * SDLCALL SDL_GetRendererName(SDL_Renderer *rende
  * - `SDL_PROP_RENDERER_GPU_DEVICE_POINTER`: the SDL_GPUDevice associated with
  *   the renderer
  *
+ * With the software renderer (since SDL 3.6.0):
+ *
+ * - `SDL_PROP_RENDERER_SOFTWARE_SCALE_CACHE_HITS_NUMBER`: the number of
+ *   scaled texture copies drawn from the renderer's cache of scaled textures,
+ *   updated when the render commands are flushed
+ * - `SDL_PROP_RENDERER_SOFTWARE_SCALE_CACHE_MISSES_NUMBER`: the number of
+ *   scaled texture copies that had to be scaled again
+ *
  * \param renderer the rendering context.
  * \returns a valid property ID on success or 0 on failure; call
  *          SDL_GetError() for more information.
@@ -561,6 +625,21 @@ extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetRendererProperties(SDL_Rende
 #define SDL_PROP_RENDERER_HDR_ENABLED_BOOLEAN                       "SDL.renderer.HDR_enabled"
 #define SDL_PROP_RENDERER_SDR_WHITE_POINT_FLOAT                     "SDL.renderer.SDR_white_point"
 #define SDL_PROP_RENDERER_HDR_HEADROOM_FLOAT                        "SDL.renderer.HDR_headroom"
+#define SDL_PROP_RENDERER_QUEUED_COMMANDS_NUMBER                    "SDL.renderer.queued_commands"
+#define SDL_PROP_RENDERER_SUBMITTED_COMMANDS_NUMBER                 "SDL.renderer.submitted_commands"
+#define SDL_PROP_RENDERER_FRAME_STATE_COMMANDS_NUMBER               "SDL.renderer.frame.state_commands"
+#define SDL_PROP_RENDERER_FRAME_CLEAR_COMMANDS_NUMBER               "SDL.renderer.frame.clear_commands"
+#define SDL_PROP_RENDERER_FRAME_POINT_COMMANDS_NUMBER               "SDL.renderer.frame.point_commands"
+#define SDL_PROP_RENDERER_FRAME_LINE_COMMANDS_NUMBER                "SDL.renderer.frame.line_commands"
+#define SDL_PROP_RENDERER_FRAME_RECT_COMMANDS_NUMBER                "SDL.renderer.frame.rect_commands"
+#define SDL_PROP_RENDERER_FRAME_COPY_COMMANDS_NUMBER                "SDL.renderer.frame.copy_commands"
+#define SDL_PROP_RENDERER_FRAME_GEOMETRY_COMMANDS_NUMBER            "SDL.renderer.frame.geometry_commands"
+#define SDL_PROP_RENDERER_FRAME_VERTEX_BYTES_NUMBER                 "SDL.renderer.frame.vertex_bytes"
+#define SDL_PROP_RENDERER_FRAME_TEXTURE_UPLOAD_BYTES_NUMBER         "SDL.renderer.frame.texture_upload_bytes"
+#define SDL_PROP_RENDERER_FRAME_FLUSHES_NUMBER                      "SDL.renderer.frame.flushes"
+#define SDL_PROP_RENDERER_FRAME_DEPENDENCY_FLUSHES_NUMBER           "SDL.renderer.frame.dependency_flushes"
+#define SDL_PROP_RENDERER_FRAME_SUBMIT_TIME_NS_NUMBER               "SDL.renderer.frame.submit_time_ns"
+#define SDL_PROP_RENDERER_VERTEX_BUFFER_SIZE_NUMBER                 "SDL.renderer.vertex_buffer_size"
 #define SDL_PROP_RENDERER_D3D9_DEVICE_POINTER                       "SDL.renderer.d3d9.device"
 #define SDL_PROP_RENDERER_D3D11_DEVICE_POINTER                      "SDL.renderer.d3d11.device"
 #define SDL_PROP_RENDERER_D3D11_SWAPCHAIN_POINTER                   "SDL.renderer.d3d11.swap_chain"
@@ -575,6 +654,8 @@ extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetRendererProperties(SDL_Rende
 #define SDL_PROP_RENDERER_VULKAN_PRESENT_QUEUE_FAMILY_INDEX_NUMBER  "SDL.renderer.vulkan.present_queue_family_index"
 #define SDL_PROP_RENDERER_VULKAN_SWAPCHAIN_IMAGE_COUNT_NUMBER       "SDL.renderer.vulkan.swapchain_image_count"
 #define SDL_PROP_RENDERER_GPU_DEVICE_POINTER                        "SDL.renderer.gpu.device"
+#define SDL_PROP_RENDERER_SOFTWARE_SCALE_CACHE_HITS_NUMBER          "SDL.renderer.software.scale_cache_hits"
+#define SDL_PROP_RENDERER_SOFTWARE_SCALE_CACHE_MISSES_NUMBER        "SDL.renderer.software.scale_cache_misses"
 
 /**
  * Get the output size in pixels of a rendering context.
@@ -89,7 +89,8 @@ typedef enum SDL_ScaleMode
     SDL_SCALEMODE_INVALID = -1,
     SDL_SCALEMODE_NEAREST,  /**< nearest pixel sampling */
     SDL_SCALEMODE_LINEAR,   /**< linear filtering */
-    SDL_SCALEMODE_PIXELART  /**< nearest pixel sampling with improved scaling for pixel art, available since SDL 3.4.0 */
+    SDL_SCALEMODE_PIXELART, /**< nearest pixel sampling with improved scaling for pixel art, available since SDL 3.4.0 */
+    SDL_SCALEMODE_AREA      /**< area-average filtering for high quality downscaling, surfaces only, available since SDL 3.6.0 */
 } SDL_ScaleMode;
 
 /**
@@ -248,6 +248,7 @@
 /* enable camera support */
 #define SDL_CAMERA_DRIVER_COREMEDIA 1
 #define SDL_CAMERA_DRIVER_DUMMY 1
+#define SDL_CAMERA_DRIVER_DISK 1
 
 /* Enable assembly routines */
 #ifdef __ppc__
@@ -302,5 +302,6 @@ typedef unsigned int uintptr_t;
 /* Enable the camera driver */
 #define SDL_CAMERA_DRIVER_MEDIAFOUNDATION 1
 #define SDL_CAMERA_DRIVER_DUMMY 1
+#define SDL_CAMERA_DRIVER_DISK 1
 
 #endif /* SDL_build_config_windows_h_ */
@@ -720,6 +720,8 @@ void SDL_Quit(void)
     SDL_AssertionsQuit();
 
     SDL_QuitPixelFormatDetails();
+    SDL_QuitConvertThreads();
+    SDL_QuitSlowBlitStats();
 
     SDL_QuitCPUInfo();
 
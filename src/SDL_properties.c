@@ -46,6 +46,7 @@ typedef struct
 {
     SDL_HashTable *props;
     SDL_Mutex *lock;
+    SDL_AtomicU32 version;  // incremented whenever a property is set, cleared or copied in
 } SDL_Properties;
 
 static SDL_InitState SDL_properties_init;
@@ -276,6 +277,7 @@ bool SDL_CopyProperties(SDL_PropertiesID src, SDL_PropertiesID dst)
         CopyOnePropertyData data = { dst_properties, true };
         SDL_IterateHashTable(src_properties->props, CopyOneProperty, &data);
         result = data.result;
+        SDL_AddAtomicU32(&dst_properties->version, 1);
     }
     SDL_UnlockMutex(dst_properties->lock);
     SDL_UnlockMutex(src_properties->lock);
@@ -346,6 +348,7 @@ static bool SDL_PrivateSetProperty(SDL_PropertiesID props, const char *name, SDL
                 result = false;
             }
         }
+        SDL_AddAtomicU32(&properties->version, 1);
     }
     SDL_UnlockMutex(properties->lock);
 
@@ -734,6 +737,21 @@ bool SDL_ClearProperty(SDL_PropertiesID props, const char *name)
     return SDL_PrivateSetProperty(props, name, NULL);
 }
 
+Uint32 SDL_GetPropertiesVersion(SDL_PropertiesID props)
+{
+    SDL_Properties *properties = NULL;
+
+    if (!props) {
+        return 0;
+    }
+
+    SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)props, (const void **)&properties);
+    if (!properties) {
+        return 0;
+    }
+    return SDL_GetAtomicU32(&properties->version);
+}
+
 typedef struct EnumerateOnePropertyData
 {
     SDL_EnumeratePropertiesCallback callback;
@@ -23,4 +23,6 @@ extern bool SDL_InitProperties(void);
 extern bool SDL_SetFreeableProperty(SDL_PropertiesID props, const char *name, void *value);
 extern bool SDL_SetSurfaceProperty(SDL_PropertiesID props, const char *name, SDL_Surface *surface);
 extern bool SDL_DumpProperties(SDL_PropertiesID props);
+// Returns a number that changes whenever any property in the group changes
+extern Uint32 SDL_GetPropertiesVersion(SDL_PropertiesID props);
 extern void SDL_QuitProperties(void);
@@ -1160,6 +1160,231 @@ static void MixFloat32Audio(float *dst, const float *src, const int buffer_size)
     }
 }
 
+// mix a bound stream's output, ramping the gain if SDL_GetAudioStreamDataForMixing asked for it.
+static void MixFloat32AudioFromStream(float *dst, const float *src, const int buffer_size, const int channels, const float *gain_ramp)
+{
+    if (gain_ramp[0] == gain_ramp[1]) {
+        SDL_assert(gain_ramp[0] == 1.0f);
+        MixFloat32Audio(dst, src, buffer_size);
+    } else {
+        SDL_MixFloat32AudioRamp(dst, src, buffer_size / (int) (sizeof (float) * channels), channels, gain_ramp[0], gain_ramp[1]);
+    }
+}
+
+// Optional worker pool for playback devices with lots of bound streams.
+//
+// The workers only pull converted float data out of the streams (and swizzle
+// channel maps); the device thread still does all the mixing, walking the
+// results in binding order, so the output is identical to the serial path.
+
+typedef struct SDL_AudioMixJob
+{
+    SDL_LogicalAudioDevice *logdev;
+    SDL_AudioStream *stream;
+    float *buffer;
+    float gain_ramp[2];
+    int bytes_read;
+} SDL_AudioMixJob;
+
+typedef struct SDL_AudioMixPool
+{
+    SDL_AudioDevice *device;
+    SDL_Thread **threads;
+    int num_threads;
+    SDL_Semaphore *start_sem;
+    SDL_Semaphore *done_sem;
+    SDL_AtomicInt quit;
+    SDL_AtomicInt next_job;
+    SDL_AudioMixJob *jobs;
+    int num_jobs;
+    int jobs_allocation;
+    Uint8 *job_buffers;
+    size_t job_buffers_allocation;
+    int job_buffer_size;
+} SDL_AudioMixPool;
+
+static int GetAudioDeviceMixThreads(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_AUDIO_DEVICE_MIX_THREADS);
+    if (hint) {
+        const int val = SDL_atoi(hint);
+        if (val > 1) {
+            return SDL_min(val, 64) - 1;  // the device thread does work too, so it counts as one of them.
+        }
+    }
+    return 0;
+}
+
+static void RunAudioMixJobs(SDL_AudioMixPool *pool)
+{
+    SDL_AudioDevice *device = pool->device;
+    int i;
+
+    while ((i = SDL_AddAtomicInt(&pool->next_job, 1)) < pool->num_jobs) {
+        SDL_AudioMixJob *job = &pool->jobs[i];
+        SDL_AudioStream *stream = job->stream;
+        const int br = SDL_GetAudioStreamDataForMixing(stream, job->buffer, pool->job_buffer_size, job->logdev->gain, job->gain_ramp);
+        if ((br > 0) && !SDL_AudioChannelMapsEqual(device->spec.channels, stream->dst_chmap, device->chmap)) {
+            ConvertAudio(br / (int)(sizeof (float) * device->spec.channels), job->buffer, SDL_AUDIO_F32, device->spec.channels, NULL,
+                         job->buffer, SDL_AUDIO_F32, device->spec.channels, device->chmap, NULL, 1.0f);
+        }
+        job->bytes_read = br;
+    }
+}
+
+static int SDLCALL AudioMixThread(void *data)
+{
+    SDL_AudioMixPool *pool = (SDL_AudioMixPool *) data;
+
+    SDL_SetCurrentThreadPriority(SDL_THREAD_PRIORITY_TIME_CRITICAL);
+
+    for (;;) {
+        SDL_WaitSemaphore(pool->start_sem);
+        if (SDL_GetAtomicInt(&pool->quit)) {
+            break;
+        }
+        RunAudioMixJobs(pool);
+        SDL_SignalSemaphore(pool->done_sem);
+    }
+
+    return 0;
+}
+
+static void DestroyAudioMixPool(SDL_AudioMixPool *pool)
+{
+    if (!pool) {
+        return;
+    }
+
+    SDL_SetAtomicInt(&pool->quit, 1);
+    for (int i = 0; i < pool->num_threads; i++) {
+        SDL_SignalSemaphore(pool->start_sem);
+    }
+    for (int i = 0; i < pool->num_threads; i++) {
+        SDL_WaitThread(pool->threads[i], NULL);
+    }
+
+    SDL_DestroySemaphore(pool->start_sem);
+    SDL_DestroySemaphore(pool->done_sem);
+    SDL_free(pool->threads);
+    SDL_free(pool->jobs);
+    SDL_aligned_free(pool->job_buffers);
+    SDL_free(pool);
+}
+
+static SDL_AudioMixPool *CreateAudioMixPool(SDL_AudioDevice *device, int num_threads)
+{
+    SDL_AudioMixPool *pool = (SDL_AudioMixPool *) SDL_calloc(1, sizeof (*pool));
+    if (!pool) {
+        return NULL;
+    }
+
+    pool->device = device;
+    pool->start_sem = SDL_CreateSemaphore(0);
+    pool->done_sem = SDL_CreateSemaphore(0);
+    pool->threads = (SDL_Thread **) SDL_calloc(num_threads, sizeof (SDL_Thread *));
+    if (!pool->start_sem || !pool->done_sem || !pool->threads) {
+        DestroyAudioMixPool(pool);
+        return NULL;
+    }
+
+    for (int i = 0; i < num_threads; i++) {
+        char threadname[64];
+        (void)SDL_snprintf(threadname, sizeof (threadname), "SDLAudioMix%d.%d", (int) device->instance_id, i);
+        pool->threads[i] = SDL_CreateThread(AudioMixThread, threadname, pool);
+        if (!pool->threads[i]) {
+            DestroyAudioMixPool(pool);
+            return NULL;
+        }
+        pool->num_threads++;
+    }
+
+    return pool;
+}
+
+// this expects the device lock to be held, so the device thread isn't using the pool right now.
+static void UpdateAudioMixPool(SDL_AudioDevice *device)
+{
+    if (device->recording) {
+        return;
+    }
+
+    const int num_threads = GetAudioDeviceMixThreads();
+    if (num_threads != (device->mix_pool ? device->mix_pool->num_threads : 0)) {
+        DestroyAudioMixPool(device->mix_pool);
+        device->mix_pool = (num_threads > 0) ? CreateAudioMixPool(device, num_threads) : NULL;  // if this fails, we just mix on the device thread.
+    }
+}
+
+// Fills in one job per bound stream of every unpaused logical device and runs them on all threads. Returns false if we should mix serially instead.
+static bool PrepareAudioMixJobs(SDL_AudioDevice *device, int work_buffer_size)
+{
+    SDL_AudioMixPool *pool = device->mix_pool;
+    int num_jobs = 0;
+
+    for (SDL_LogicalAudioDevice *logdev = device->logical_devices; logdev; logdev = logdev->next) {
+        if (!SDL_GetAtomicInt(&logdev->paused)) {
+            for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
+                num_jobs++;
+            }
+        }
+    }
+
+    if (num_jobs < 2) {
+        return false;  // not worth waking anyone up.
+    }
+
+    if (num_jobs > pool->jobs_allocation) {
+        SDL_AudioMixJob *jobs = (SDL_AudioMixJob *) SDL_realloc(pool->jobs, num_jobs * sizeof (SDL_AudioMixJob));
+        if (!jobs) {
+            return false;
+        }
+        pool->jobs = jobs;
+        pool->jobs_allocation = num_jobs;
+    }
+
+    const size_t alignment = SDL_GetSIMDAlignment();
+    const size_t stride = (((size_t) work_buffer_size) + (alignment - 1)) & ~(alignment - 1);
+    if ((stride * num_jobs) > pool->job_buffers_allocation) {
+        Uint8 *buffers = (Uint8 *) SDL_aligned_alloc(alignment, stride * num_jobs);
+        if (!buffers) {
+            return false;
+        }
+        SDL_aligned_free(pool->job_buffers);
+        pool->job_buffers = buffers;
+        pool->job_buffers_allocation = stride * num_jobs;
+    }
+
+    num_jobs = 0;
+    for (SDL_LogicalAudioDevice *logdev = device->logical_devices; logdev; logdev = logdev->next) {
+        if (!SDL_GetAtomicInt(&logdev->paused)) {
+            for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
+                SDL_AudioMixJob *job = &pool->jobs[num_jobs];
+                job->logdev = logdev;
+                job->stream = stream;
+                job->buffer = (float *) (pool->job_buffers + (stride * num_jobs));
+                job->bytes_read = 0;
+                num_jobs++;
+            }
+        }
+    }
+
+    pool->num_jobs = num_jobs;
+    pool->job_buffer_size = work_buffer_size;
+    SDL_SetAtomicInt(&pool->next_job, 0);
+
+    const int num_threads = SDL_min(pool->num_threads, num_jobs - 1);
+    for (int i = 0; i < num_threads; i++) {
+        SDL_SignalSemaphore(pool->start_sem);
+    }
+    RunAudioMixJobs(pool);  // this thread pitches in, too.
+    for (int i = 0; i < num_threads; i++) {
+        SDL_WaitSemaphore(pool->done_sem);
+    }
+
+    return true;
+}
+
 
 // Playback device thread. This is split into chunks, so backends that need to control this directly can use the pieces they need without duplicating effort.
 
@@ -1200,7 +1425,10 @@ bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
             SDL_assert(SDL_AudioSpecsEqual(&stream->dst_spec, &device->spec, NULL, NULL));
             SDL_assert(stream->src_spec.format != SDL_AUDIO_UNKNOWN);
 
-            const int br = SDL_GetAtomicInt(&logdev->paused) ? 0 : SDL_GetAudioStreamDataAdjustGain(stream, device_buffer, buffer_size, logdev->gain);
+            // we can only ramp gain changes here if the device wants floats; otherwise, the new gain just takes effect immediately.
+            float gain_ramp[2] = { 1.0f, 1.0f };
+            const bool can_ramp = (device->spec.format == SDL_AUDIO_F32);
+            const int br = SDL_GetAtomicInt(&logdev->paused) ? 0 : SDL_GetAudioStreamDataForMixing(stream, device_buffer, buffer_size, logdev->gain, can_ramp ? gain_ramp : NULL);
             if (br < 0) {  // Probably OOM. Kill the audio device; the whole thing is likely dying soon anyhow.
                 failed = true;
                 SDL_memset(device_buffer, device->silence_value, buffer_size);  // just supply silence to the device before we die.
@@ -1208,6 +1436,10 @@ bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
                 SDL_memset(device_buffer + br, device->silence_value, buffer_size - br);  // silence whatever we didn't write to.
             }
 
+            if ((br > 0) && (gain_ramp[0] != gain_ramp[1])) {
+                SDL_ApplyFloat32AudioRamp((float *) device_buffer, br / SDL_AUDIO_FRAMESIZE(device->spec), device->spec.channels, gain_ramp[0], gain_ramp[1]);
+            }
+
             // generally channel maps will line up, but if the audio stream's chmap has been explicitly changed, do a final swizzle to device layout.
             if ((br > 0) && (!SDL_AudioChannelMapsEqual(device->spec.channels, stream->dst_chmap, device->chmap))) {
                 ConvertAudio(br / SDL_AUDIO_FRAMESIZE(device->spec), device_buffer, device->spec.format, device->spec.channels, NULL,
@@ -1226,6 +1458,10 @@ bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
 
             SDL_memset(final_mix_buffer, '\0', work_buffer_size);  // start with silence.
 
+            // if there's a worker pool, pull every stream's data up front, in parallel; we still mix it in order below.
+            const bool parallel = device->mix_pool && PrepareAudioMixJobs(device, work_buffer_size);
+            const SDL_AudioMixJob *job = parallel ? device->mix_pool->jobs : NULL;
+
             for (SDL_LogicalAudioDevice *logdev = device->logical_devices; logdev; logdev = logdev->next) {
                 if (SDL_GetAtomicInt(&logdev->paused)) {
                     continue;  // paused? Skip this logical device.
@@ -1248,7 +1484,19 @@ bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
                        for iterating here because the binding linked list can only change while the device lock is held.
                        (we _do_ lock the stream during binding/unbinding to make sure that two threads can't try to bind
                        the same stream to different devices at the same time, though.) */
-                    const int br = SDL_GetAudioStreamDataAdjustGain(stream, device->work_buffer, work_buffer_size, logdev->gain);
+                    if (job) {
+                        const SDL_AudioMixJob *result = job++;
+                        SDL_assert(result->stream == stream);
+                        if (result->bytes_read < 0) {  // Probably OOM. Kill the audio device; the whole thing is likely dying soon anyhow.
+                            failed = true;
+                        } else if (result->bytes_read > 0) {  // already swizzled by the worker.
+                            MixFloat32AudioFromStream(mix_buffer, result->buffer, result->bytes_read, device->spec.channels, result->gain_ramp);
+                        }
+                        continue;
+                    }
+
+                    float gain_ramp[2];
+                    const int br = SDL_GetAudioStreamDataForMixing(stream, device->work_buffer, work_buffer_size, logdev->gain, gain_ramp);
                     if (br < 0) {  // Probably OOM. Kill the audio device; the whole thing is likely dying soon anyhow.
                         failed = true;
                         break;
@@ -1258,7 +1506,7 @@ bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
                             ConvertAudio(br / SDL_AUDIO_FRAMESIZE(device->spec), device->work_buffer, device->spec.format, device->spec.channels, NULL,
                                          device->work_buffer, device->spec.format, device->spec.channels, device->chmap, NULL, 1.0f);
                         }
-                        MixFloat32Audio(mix_buffer, (float *) device->work_buffer, br);
+                        MixFloat32AudioFromStream(mix_buffer, (float *) device->work_buffer, br, device->spec.channels, gain_ramp);
                     }
                 }
 
@@ -1678,6 +1926,9 @@ static void ClosePhysicalAudioDevice(SDL_AudioDevice *device)
         device->hidden = NULL;  // just in case.
     }
 
+    DestroyAudioMixPool(device->mix_pool);
+    device->mix_pool = NULL;
+
     SDL_LockMutex(device->lock);
     SDL_SetAtomicInt(&device->shutdown, 0);  // ready to go again.
     SDL_BroadcastCondition(device->close_cond);  // release anyone waiting in SerializePhysicalDeviceClose; they'll still block until we release device->lock, though.
@@ -1893,6 +2144,7 @@ SDL_AudioDeviceID SDL_OpenAudioDevice(SDL_AudioDeviceID devid, const SDL_AudioSp
         } else if (!OpenPhysicalAudioDevice(device, spec)) {  // if this is the first thing using this physical device, open at the OS level if necessary...
             SDL_free(logdev);
         } else {
+            UpdateAudioMixPool(device);
             RefPhysicalAudioDevice(device);  // unref'd on successful SDL_CloseAudioDevice
             SDL_SetAtomicInt(&logdev->paused, 0);
             result = logdev->instance_id = AssignAudioDeviceInstanceId(device->recording, /*islogical=*/true);
@@ -2079,6 +2331,8 @@ bool SDL_BindAudioStreams(SDL_AudioDeviceID devid, SDL_AudioStream * const *stre
                 }
 
                 stream->bound_device = logdev;
+                stream->mix_gain = -1.0f;  // don't ramp from whatever gain this stream had on another device.
+                SDL_SetAtomicInt(&stream->single_producer, 0);  // the next locked put rereads SDL_PROP_AUDIOSTREAM_SINGLE_PRODUCER_BOOLEAN.
                 stream->prev_binding = NULL;
                 stream->next_binding = logdev->bound_streams;
                 if (logdev->bound_streams) {
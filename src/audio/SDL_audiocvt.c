@@ -24,6 +24,7 @@
 
 #include "SDL_audioqueue.h"
 #include "SDL_audioresample.h"
+#include "../SDL_properties_c.h"
 
 #ifndef SDL_INT_MAX
 #define SDL_INT_MAX ((int)(~0u>>1))
@@ -399,9 +400,15 @@ static int CalculateMaxFrameSize(SDL_AudioFormat src_format, int src_channels, S
     return max_format_size * max_channels;
 }
 
+// The input sample rate, adjusted by SDL_SetAudioStreamFrequencyRatio()
+static int GetAudioStreamResampleFrequency(SDL_AudioStream *stream, int src_freq)
+{
+    return (int)((float)src_freq * stream->freq_ratio);
+}
+
 static Sint64 GetAudioStreamResampleRate(SDL_AudioStream *stream, int src_freq, Sint64 resample_offset)
 {
-    src_freq = (int)((float)src_freq * stream->freq_ratio);
+    src_freq = GetAudioStreamResampleFrequency(stream, src_freq);
 
     Sint64 resample_rate = SDL_GetResampleRate(src_freq, stream->dst_spec.freq);
 
@@ -413,6 +420,56 @@ static Sint64 GetAudioStreamResampleRate(SDL_AudioStream *stream, int src_freq,
     return resample_rate;
 }
 
+static SDL_AudioResampleQuality GetAudioStreamResampleQuality(SDL_AudioStream *stream)
+{
+    if (stream->props) {
+        const Sint64 quality = SDL_GetNumberProperty(stream->props, SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER, SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM);
+        if ((quality >= SDL_AUDIO_RESAMPLE_QUALITY_LINEAR) && (quality <= SDL_AUDIO_RESAMPLE_QUALITY_HIGH)) {
+            return (SDL_AudioResampleQuality)quality;
+        }
+    }
+    return SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM;
+}
+
+static bool IsAudioStreamSingleProducer(SDL_AudioStream *stream)
+{
+    return stream->props && SDL_GetBooleanProperty(stream->props, SDL_PROP_AUDIOSTREAM_SINGLE_PRODUCER_BOOLEAN, false);
+}
+
+// you MUST hold `stream->lock` when calling this! Moves anything the producer put without the lock into the queue.
+static bool CommitAudioStreamStaging(SDL_AudioStream *stream)
+{
+    return SDL_CommitAudioQueueStaging(stream->queue, &stream->staging_spec, stream->staging_chmap);
+}
+
+// you MUST hold `stream->lock` when calling this! Applies the queue's memory pool properties.
+static bool UpdateAudioStreamQueue(SDL_AudioStream *stream)
+{
+    if (!stream->props) {
+        return true;  // nothing was ever set, keep the defaults.
+    }
+
+    const Uint32 version = SDL_GetPropertiesVersion(stream->props);
+    if ((version == stream->queue_props_version) && !stream->queue_config_pending) {
+        return true;  // nothing changed since the last time.
+    }
+
+    Sint64 chunk_size = SDL_GetNumberProperty(stream->props, SDL_PROP_AUDIOSTREAM_QUEUE_CHUNK_SIZE_NUMBER, SDL_AUDIOQUEUE_DEFAULT_CHUNK_SIZE);
+    const Sint64 reserved_chunks = SDL_GetNumberProperty(stream->props, SDL_PROP_AUDIOSTREAM_QUEUE_RESERVED_CHUNKS_NUMBER, 0);
+    const Sint64 max_free_chunks = SDL_GetNumberProperty(stream->props, SDL_PROP_AUDIOSTREAM_QUEUE_MAX_FREE_CHUNKS_NUMBER, SDL_AUDIOQUEUE_DEFAULT_MAX_FREE_CHUNKS);
+
+    chunk_size = SDL_clamp(chunk_size, 1024, 16 * 1024 * 1024);
+
+    if (!SDL_ConfigureAudioQueue(stream->queue, (size_t)chunk_size, (size_t)SDL_max(reserved_chunks, 0), (size_t)SDL_max(max_free_chunks, 0))) {
+        return false;
+    }
+
+    // The chunk size only changes while the queue is empty, so keep trying until it does.
+    stream->queue_props_version = version;
+    stream->queue_config_pending = (SDL_GetAudioQueueChunkSize(stream->queue) != (size_t)chunk_size);
+    return true;
+}
+
 static bool UpdateAudioStreamInputSpec(SDL_AudioStream *stream, const SDL_AudioSpec *spec, const int *chmap)
 {
     if (SDL_AudioSpecsEqual(&stream->input_spec, spec, stream->input_chmap, chmap)) {
@@ -448,7 +505,8 @@ SDL_AudioStream *SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_
 
     result->freq_ratio = 1.0f;
     result->gain = 1.0f;
-    result->queue = SDL_CreateAudioQueue(8192);
+    result->mix_gain = -1.0f;
+    result->queue = SDL_CreateAudioQueue(SDL_AUDIOQUEUE_DEFAULT_CHUNK_SIZE);
 
     if (!result->queue) {
         SDL_free(result);
@@ -480,8 +538,20 @@ SDL_PropertiesID SDL_GetAudioStreamProperties(SDL_AudioStream *stream)
     }
 
     SDL_LockMutex(stream->lock);
+    bool publish = false;
     if (stream->props == 0) {
         stream->props = SDL_CreateProperties();
+        publish = true;
+    }
+    if (stream->props) {
+        Uint64 stats[3];
+        SDL_GetAudioQueueStats(stream->queue, &stats[0], &stats[1], &stats[2]);
+        if (publish || (SDL_memcmp(stats, stream->queue_stats, sizeof(stats)) != 0)) {  // don't touch the properties if nothing changed.
+            SDL_SetNumberProperty(stream->props, SDL_PROP_AUDIOSTREAM_QUEUE_BLOCKS_ALLOCATED_NUMBER, (Sint64)stats[0]);
+            SDL_SetNumberProperty(stream->props, SDL_PROP_AUDIOSTREAM_QUEUE_BLOCKS_RECYCLED_NUMBER, (Sint64)stats[1]);
+            SDL_SetNumberProperty(stream->props, SDL_PROP_AUDIOSTREAM_QUEUE_BLOCKS_FREED_NUMBER, (Sint64)stats[2]);
+            SDL_memcpy(stream->queue_stats, stats, sizeof(stats));
+        }
     }
     SDL_UnlockMutex(stream->lock);
     return stream->props;
@@ -509,6 +579,7 @@ bool SDL_SetAudioStreamPutCallback(SDL_AudioStream *stream, SDL_AudioStreamCallb
     SDL_LockMutex(stream->lock);
     stream->put_callback = callback;
     stream->put_callback_userdata = userdata;
+    SDL_SetAtomicInt(&stream->single_producer, 0);  // the put callback needs the lock held.
     SDL_UnlockMutex(stream->lock);
     return true;
 }
@@ -614,6 +685,7 @@ bool SDL_SetAudioStreamFormat(SDL_AudioStream *stream, const SDL_AudioSpec *src_
             stream->src_chmap = NULL;
         }
         SDL_copyp(&stream->src_spec, src_spec);
+        SDL_SetAtomicInt(&stream->single_producer, 0);  // the next locked put picks up the new format.
     }
 
     if (dst_spec) {
@@ -639,6 +711,10 @@ bool SetAudioStreamChannelMap(SDL_AudioStream *stream, const SDL_AudioSpec *spec
 
     SDL_LockMutex(stream->lock);
 
+    if (stream_chmap == &stream->src_chmap) {
+        SDL_SetAtomicInt(&stream->single_producer, 0);  // the next locked put picks up the new format.
+    }
+
     if (channels != spec->channels) {
         result = SDL_SetError("Wrong number of channels");
     } else if (!*stream_chmap && !chmap) {
@@ -798,6 +874,15 @@ static bool PutAudioStreamBufferInternal(SDL_AudioStream *stream, const SDL_Audi
 {
     SDL_AudioTrack *track = NULL;
 
+    if (!UpdateAudioStreamQueue(stream)) {
+        return false;
+    }
+
+    // anything put without the lock came first.
+    if (!CommitAudioStreamStaging(stream)) {
+        return false;
+    }
+
     if (callback) {
         track = SDL_CreateAudioTrack(stream->queue, spec, chmap, (Uint8 *)buf, len, len, callback, userdata);
         if (!track) {
@@ -822,6 +907,20 @@ static bool PutAudioStreamBufferInternal(SDL_AudioStream *stream, const SDL_Audi
         }
     }
 
+    // Once the format is known, later puts of plain data can skip the lock, if the app asked for that.
+    if (retval && !stream->put_callback && (spec == &stream->src_spec) && IsAudioStreamSingleProducer(stream)) {
+        SDL_copyp(&stream->staging_spec, spec);
+        if (chmap) {
+            SDL_memcpy(stream->staging_chmap_storage, chmap, sizeof (*chmap) * spec->channels);
+            stream->staging_chmap = stream->staging_chmap_storage;
+        } else {
+            stream->staging_chmap = NULL;
+        }
+        SDL_SetAtomicInt(&stream->single_producer, 1);
+    } else {
+        SDL_SetAtomicInt(&stream->single_producer, 0);
+    }
+
     return retval;
 }
 
@@ -871,6 +970,17 @@ bool SDL_PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len)
         return true; // nothing to do.
     }
 
+    // In single producer mode, once the format is settled, the data is published to the queue's staging list
+    // without taking the stream lock, so whoever is reading the stream never waits on us (or vice versa).
+    // The property is only read by locked puts, which cache the result in `single_producer`.
+    if (SDL_GetAtomicInt(&stream->single_producer)) {
+        // staging_spec only changes on this thread (in a locked put), so it's safe to read here.
+        if ((len % SDL_AUDIO_FRAMESIZE(stream->staging_spec)) != 0) {
+            return SDL_SetError("Can't add partial sample frames");
+        }
+        return SDL_WriteToAudioQueueStaging(stream->queue, (const Uint8 *)buf, len);
+    }
+
     // When copying in large amounts of data, try and do as much work as possible
     // outside of the stream lock, otherwise the output device is likely to be starved.
     const int large_input_thresh = 64 * 1024;
@@ -1084,10 +1194,11 @@ bool SDL_FlushAudioStream(SDL_AudioStream *stream)
     }
 
     SDL_LockMutex(stream->lock);
+    const bool result = CommitAudioStreamStaging(stream);
     SDL_FlushAudioQueue(stream->queue);
     SDL_UnlockMutex(stream->lock);
 
-    return true;
+    return result;
 }
 
 /* this does not save the previous contents of stream->work_buffer. It's a work buffer!!
@@ -1109,7 +1220,7 @@ static Uint8 *EnsureAudioStreamWorkBufferSize(SDL_AudioStream *stream, size_t ne
     return ptr;
 }
 
-static Sint64 NextAudioStreamIter(SDL_AudioStream *stream, void **inout_iter,
+static Sint64 NextAudioStreamIter(SDL_AudioStream *stream, void **inout_iter, SDL_AudioResampleQuality quality,
     Sint64 *inout_resample_offset, SDL_AudioSpec *out_spec, int **out_chmap, bool *out_flushed)
 {
     SDL_AudioSpec spec;
@@ -1145,7 +1256,7 @@ static Sint64 NextAudioStreamIter(SDL_AudioStream *stream, void **inout_iter,
         // Past the end of the track, the right padding is filled with silence.
         // But we only want to do that if the track is actually finished (flushed).
         if (!flushed) {
-            output_frames -= SDL_GetResamplerPaddingFrames(resample_rate);
+            output_frames -= SDL_GetResamplerPaddingFrames(resample_rate, quality);
         }
 
         output_frames = SDL_GetResamplerOutputFrames(output_frames, resample_rate, &resample_offset);
@@ -1164,7 +1275,7 @@ static Sint64 NextAudioStreamIter(SDL_AudioStream *stream, void **inout_iter,
     return output_frames;
 }
 
-static Sint64 GetAudioStreamAvailableFrames(SDL_AudioStream *stream, Sint64 *out_resample_offset)
+static Sint64 GetAudioStreamAvailableFrames(SDL_AudioStream *stream, SDL_AudioResampleQuality quality, Sint64 *out_resample_offset)
 {
     void *iter = SDL_BeginAudioQueueIter(stream->queue);
 
@@ -1172,7 +1283,7 @@ static Sint64 GetAudioStreamAvailableFrames(SDL_AudioStream *stream, Sint64 *out
     Sint64 output_frames = 0;
 
     while (iter) {
-        output_frames += NextAudioStreamIter(stream, &iter, &resample_offset, NULL, NULL, NULL);
+        output_frames += NextAudioStreamIter(stream, &iter, quality, &resample_offset, NULL, NULL, NULL);
 
         // Already got loads of frames. Just clamp it to something reasonable
         if (output_frames >= SDL_MAX_SINT32) {
@@ -1188,7 +1299,7 @@ static Sint64 GetAudioStreamAvailableFrames(SDL_AudioStream *stream, Sint64 *out
     return output_frames;
 }
 
-static Sint64 GetAudioStreamHead(SDL_AudioStream *stream, SDL_AudioSpec *out_spec, int **out_chmap, bool *out_flushed)
+static Sint64 GetAudioStreamHead(SDL_AudioStream *stream, SDL_AudioResampleQuality quality, SDL_AudioSpec *out_spec, int **out_chmap, bool *out_flushed)
 {
     void *iter = SDL_BeginAudioQueueIter(stream->queue);
 
@@ -1199,12 +1310,12 @@ static Sint64 GetAudioStreamHead(SDL_AudioStream *stream, SDL_AudioSpec *out_spe
     }
 
     Sint64 resample_offset = stream->resample_offset;
-    return NextAudioStreamIter(stream, &iter, &resample_offset, out_spec, out_chmap, out_flushed);
+    return NextAudioStreamIter(stream, &iter, quality, &resample_offset, out_spec, out_chmap, out_flushed);
 }
 
 // You must hold stream->lock and validate your parameters before calling this!
-// Enough input data MUST be available!
-static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int output_frames, float gain)
+// Enough input data MUST be available, with the padding `quality` needs!
+static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int output_frames, float gain, SDL_AudioResampleQuality quality)
 {
     const SDL_AudioSpec *src_spec = &stream->input_spec;
     const SDL_AudioSpec *dst_spec = &stream->dst_spec;
@@ -1252,7 +1363,18 @@ static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int o
     // In fact, input_frames can sometimes even be zero when upsampling.
     const int input_frames = (int) SDL_GetResamplerInputFrames(output_frames, resample_rate, stream->resample_offset);
 
-    const int padding_frames = SDL_GetResamplerPaddingFrames(resample_rate);
+    const int padding_frames = SDL_GetResamplerPaddingFrames(resample_rate, quality);
+
+    if (!stream->resampler) {
+        stream->resampler = SDL_CreateAudioResampler();
+        if (!stream->resampler) {
+            return false;
+        }
+    }
+
+    if (!SDL_UpdateAudioResampler(stream->resampler, quality, GetAudioStreamResampleFrequency(stream, src_spec->freq), dst_spec->freq)) {
+        return false;
+    }
 
     const SDL_AudioFormat resample_format = SDL_AUDIO_F32;
 
@@ -1322,7 +1444,7 @@ static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int o
     // Decide where the resampled output goes
     void *resample_buffer = (resample_buffer_offset != -1) ? (work_buffer + resample_buffer_offset) : buf;
 
-    SDL_ResampleAudio(resample_channels,
+    SDL_ResampleAudio(stream->resampler, resample_channels,
                   (const float *)input_buffer, input_frames,
                   (float *)resample_buffer, output_frames,
                   resample_rate, &stream->resample_offset);
@@ -1334,10 +1456,14 @@ static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int o
 }
 
 // get converted/resampled data from the stream
-int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int len, float extra_gain)
+static int GetAudioStreamData(SDL_AudioStream *stream, void *voidbuf, int len, float extra_gain, bool mixing, float *gain_ramp)
 {
     Uint8 *buf = (Uint8 *) voidbuf;
 
+    if (gain_ramp) {
+        gain_ramp[0] = gain_ramp[1] = 1.0f;
+    }
+
 #if DEBUG_AUDIOSTREAM
     SDL_Log("AUDIOSTREAM: want to get %d converted bytes", len);
 #endif
@@ -1366,18 +1492,34 @@ int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int
         return -1;
     }
 
-    const float gain = stream->gain * extra_gain;
+    // pick up anything a single producer put without the lock. If this fails, we'll get it next time.
+    CommitAudioStreamStaging(stream);
+
+    float gain = stream->gain * extra_gain;
+    if (mixing) {
+        const float mix_gain = gain;
+        if (gain_ramp && (stream->mix_gain >= 0.0f) && (stream->mix_gain != gain)) {
+            gain_ramp[0] = stream->mix_gain;
+            gain_ramp[1] = gain;
+            gain = 1.0f;  // the caller applies the gain while it mixes.
+        }
+        stream->mix_gain = mix_gain;
+    }
+
     const int dst_frame_size = SDL_AUDIO_FRAMESIZE(stream->dst_spec);
 
     len -= len % dst_frame_size;  // chop off any fractional sample frame.
 
+    // Look this up once, so the padding checked below is the padding the resampler uses.
+    const SDL_AudioResampleQuality quality = GetAudioStreamResampleQuality(stream);
+
     // give the callback a chance to fill in more stream data if it wants.
     if (stream->get_callback) {
         Sint64 total_request = len / dst_frame_size;  // start with sample frames desired
         Sint64 additional_request = total_request;
 
         Sint64 resample_offset = 0;
-        Sint64 available_frames = GetAudioStreamAvailableFrames(stream, &resample_offset);
+        Sint64 available_frames = GetAudioStreamAvailableFrames(stream, quality, &resample_offset);
 
         additional_request -= SDL_min(additional_request, available_frames);
 
@@ -1391,6 +1533,7 @@ int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int
         total_request *= SDL_AUDIO_FRAMESIZE(stream->src_spec);  // convert sample frames to bytes.
         additional_request *= SDL_AUDIO_FRAMESIZE(stream->src_spec);  // convert sample frames to bytes.
         stream->get_callback(stream->get_callback_userdata, stream, (int) SDL_min(additional_request, SDL_INT_MAX), (int) SDL_min(total_request, SDL_INT_MAX));
+        CommitAudioStreamStaging(stream);  // the callback might have put data without the lock.
     }
 
     // Process the data in chunks to avoid allocating too much memory (and potential integer overflows)
@@ -1403,7 +1546,7 @@ int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int
         SDL_AudioSpec input_spec;
         int *input_chmap;
         bool flushed;
-        const Sint64 available_frames = GetAudioStreamHead(stream, &input_spec, &input_chmap, &flushed);
+        const Sint64 available_frames = GetAudioStreamHead(stream, quality, &input_spec, &input_chmap, &flushed);
 
         if (available_frames == 0) {
             if (flushed) {
@@ -1428,7 +1571,7 @@ int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int
         output_frames = SDL_min(output_frames, chunk_size);
         output_frames = (int) SDL_min(output_frames, available_frames);
 
-        if (!GetAudioStreamDataInternal(stream, &buf[total], output_frames, gain)) {
+        if (!GetAudioStreamDataInternal(stream, &buf[total], output_frames, gain, quality)) {
             total = total ? total : -1;
             break;
         }
@@ -1445,11 +1588,205 @@ int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int
     return total;
 }
 
+int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int len, float extra_gain)
+{
+    return GetAudioStreamData(stream, voidbuf, len, extra_gain, false, NULL);
+}
+
+int SDL_GetAudioStreamDataForMixing(SDL_AudioStream *stream, void *voidbuf, int len, float extra_gain, float *gain_ramp)
+{
+    return GetAudioStreamData(stream, voidbuf, len, extra_gain, true, gain_ramp);
+}
+
 int SDL_GetAudioStreamData(SDL_AudioStream *stream, void *voidbuf, int len)
 {
     return SDL_GetAudioStreamDataAdjustGain(stream, voidbuf, len, 1.0f);
 }
 
+#define GENERIC_DEINTERLEAVE_FUNCTION(bits) \
+    static void DeinterleaveAudioChannelsGeneric##bits(void * const *channel_buffers, const void *input, const int channels, int num_samples) { \
+        const Uint##bits *src = (const Uint##bits *) input; \
+        Uint##bits * const *dsts = (Uint##bits * const *) channel_buffers; \
+        for (int channel = 0; channel < channels; channel++) { \
+            Uint##bits *dst = dsts[channel]; \
+            if (dst) { \
+                for (int frame = 0; frame < num_samples; frame++) { \
+                    dst[frame] = src[(frame * channels) + channel]; \
+                } \
+            } \
+        } \
+    }
+
+GENERIC_DEINTERLEAVE_FUNCTION(8)
+GENERIC_DEINTERLEAVE_FUNCTION(16)
+GENERIC_DEINTERLEAVE_FUNCTION(32)
+//GENERIC_DEINTERLEAVE_FUNCTION(64)   (we don't have any 64-bit audio data types at the moment.)
+#undef GENERIC_DEINTERLEAVE_FUNCTION
+
+/* Like the work buffer, this doesn't save the previous contents. The planar
+   data handed out by SDL_GetAudioStreamPlanarPointers lives here. */
+static Uint8 *EnsureAudioStreamPlanarBufferSize(SDL_AudioStream *stream, size_t newlen)
+{
+    if (stream->planar_buffer_allocation >= newlen) {
+        return stream->planar_buffer;
+    }
+
+    Uint8 *ptr = (Uint8 *) SDL_aligned_alloc(SDL_GetSIMDAlignment(), newlen);
+    if (!ptr) {
+        return NULL;
+    }
+
+    SDL_aligned_free(stream->planar_buffer);
+    stream->planar_buffer = ptr;
+    stream->planar_buffer_allocation = newlen;
+    return ptr;
+}
+
+// Gets `num_samples` frames in the stream's output format and splits them into `channel_buffers`, which has one entry (possibly NULL) per output channel. Stream must be locked.
+static int GetAudioStreamPlanarData(SDL_AudioStream *stream, void * const *channel_buffers, int num_samples)
+{
+    const SDL_AudioSpec *spec = &stream->dst_spec;
+    const int frame_size = SDL_AUDIO_FRAMESIZE(*spec);
+
+    if (num_samples > (SDL_INT_MAX / frame_size)) {
+        SDL_SetError("Requested too many samples");
+        return -1;
+    }
+
+    const int len = num_samples * frame_size;
+
+    if (spec->channels == 1 && channel_buffers[0]) {  // nothing to deinterleave, just use the usual function.
+        const int retval = SDL_GetAudioStreamData(stream, channel_buffers[0], len);
+        return (retval < 0) ? retval : (retval / frame_size);
+    }
+
+    // The interleaved data goes into the tail end of the planar buffer, so it doesn't overlap anything handed out by SDL_GetAudioStreamPlanarPointers.
+    if (!EnsureAudioStreamPlanarBufferSize(stream, (size_t)len * 2)) {
+        return -1;
+    }
+
+    Uint8 *interleaved = stream->planar_buffer + stream->planar_buffer_allocation - len;
+    const int retval = SDL_GetAudioStreamData(stream, interleaved, len);
+    if (retval <= 0) {
+        return retval;
+    }
+
+    const int frames = retval / frame_size;
+    switch (SDL_AUDIO_BITSIZE(spec->format)) {
+        case 8: DeinterleaveAudioChannelsGeneric8(channel_buffers, interleaved, spec->channels, frames); break;
+        case 16: DeinterleaveAudioChannelsGeneric16(channel_buffers, interleaved, spec->channels, frames); break;
+        case 32: DeinterleaveAudioChannelsGeneric32(channel_buffers, interleaved, spec->channels, frames); break;
+        //case 64: DeinterleaveAudioChannelsGeneric64(channel_buffers, interleaved, spec->channels, frames); break;  (we don't have any 64-bit audio data types at the moment.)
+        default: SDL_assert(!"Missing needed generic audio deinterleave function!"); break;
+    }
+
+    return frames;
+}
+
+int SDL_GetAudioStreamPlanarData(SDL_AudioStream *stream, void * const *channel_buffers, int num_channels, int num_samples)
+{
+    CHECK_PARAM(!stream) {
+        SDL_InvalidParamError("stream");
+        return -1;
+    }
+    CHECK_PARAM(!channel_buffers) {
+        SDL_InvalidParamError("channel_buffers");
+        return -1;
+    }
+    CHECK_PARAM(num_samples < 0) {
+        SDL_InvalidParamError("num_samples");
+        return -1;
+    }
+
+    if (num_samples == 0) {
+        return 0; // nothing to do.
+    }
+
+    // hold the lock for the whole thing, so the output format can't change between checking it and getting the data.
+    SDL_LockMutex(stream->lock);
+
+    if (!CheckAudioStreamIsFullySetup(stream)) {
+        SDL_UnlockMutex(stream->lock);
+        return -1;
+    }
+
+    // if didn't specify enough channels, the missing ones are dropped, like NULL arrays.
+    const int channels = stream->dst_spec.channels;
+    void *channels_full[SDL_MAX_CHANNELMAP_CHANNELS];
+    SDL_assert(channels <= SDL_arraysize(channels_full));
+    if ((num_channels < 0) || (num_channels > channels)) {
+        num_channels = channels;
+    }
+    SDL_memcpy(channels_full, channel_buffers, num_channels * sizeof (*channel_buffers));
+    SDL_memset(channels_full + num_channels, 0, (channels - num_channels) * sizeof (*channel_buffers));
+
+    const int retval = GetAudioStreamPlanarData(stream, channels_full, num_samples);
+
+    SDL_UnlockMutex(stream->lock);
+
+    return retval;
+}
+
+int SDL_GetAudioStreamPlanarPointers(SDL_AudioStream *stream, const void **channel_buffers, int num_channels, int num_samples)
+{
+    CHECK_PARAM(!stream) {
+        SDL_InvalidParamError("stream");
+        return -1;
+    }
+    CHECK_PARAM(!channel_buffers) {
+        SDL_InvalidParamError("channel_buffers");
+        return -1;
+    }
+    CHECK_PARAM(num_samples < 0) {
+        SDL_InvalidParamError("num_samples");
+        return -1;
+    }
+
+    SDL_LockMutex(stream->lock);
+
+    if (!CheckAudioStreamIsFullySetup(stream)) {
+        SDL_UnlockMutex(stream->lock);
+        return -1;
+    }
+
+    const int channels = stream->dst_spec.channels;
+    const int sample_size = SDL_AUDIO_BYTESIZE(stream->dst_spec.format);
+    void *channels_full[SDL_MAX_CHANNELMAP_CHANNELS];
+    SDL_assert(channels <= SDL_arraysize(channels_full));
+    if ((num_channels < 0) || (num_channels > channels)) {
+        num_channels = channels;
+    }
+
+    if (num_samples > (SDL_INT_MAX / (sample_size * channels))) {
+        SDL_UnlockMutex(stream->lock);
+        SDL_SetError("Requested too many samples");
+        return -1;
+    }
+
+    int retval = 0;
+    if (num_samples > 0) {
+        // make sure the buffer is big enough before handing out pointers into it; GetAudioStreamPlanarData won't reallocate it after this.
+        if (!EnsureAudioStreamPlanarBufferSize(stream, (size_t)num_samples * sample_size * channels * 2)) {
+            SDL_UnlockMutex(stream->lock);
+            return -1;
+        }
+
+        for (int i = 0; i < channels; i++) {
+            channels_full[i] = stream->planar_buffer + ((size_t)i * num_samples * sample_size);
+        }
+
+        retval = GetAudioStreamPlanarData(stream, channels_full, num_samples);
+    }
+
+    for (int i = 0; i < num_channels; i++) {
+        channel_buffers[i] = (retval > 0) ? channels_full[i] : NULL;
+    }
+
+    SDL_UnlockMutex(stream->lock);
+
+    return retval;
+}
+
 // number of converted/resampled bytes available for output
 int SDL_GetAudioStreamAvailable(SDL_AudioStream *stream)
 {
@@ -1465,7 +1802,9 @@ int SDL_GetAudioStreamAvailable(SDL_AudioStream *stream)
         return 0;
     }
 
-    Sint64 count = GetAudioStreamAvailableFrames(stream, NULL);
+    CommitAudioStreamStaging(stream);
+
+    Sint64 count = GetAudioStreamAvailableFrames(stream, GetAudioStreamResampleQuality(stream), NULL);
 
     // convert from sample frames to bytes in destination format.
     count *= SDL_AUDIO_FRAMESIZE(stream->dst_spec);
@@ -1486,6 +1825,8 @@ int SDL_GetAudioStreamQueued(SDL_AudioStream *stream)
 
     SDL_LockMutex(stream->lock);
 
+    CommitAudioStreamStaging(stream);
+
     size_t total = SDL_GetAudioQueueQueued(stream->queue);
 
     SDL_UnlockMutex(stream->lock);
@@ -1502,6 +1843,7 @@ bool SDL_ClearAudioStream(SDL_AudioStream *stream)
 
     SDL_LockMutex(stream->lock);
 
+    SDL_ClearAudioQueueStaging(stream->queue);
     SDL_ClearAudioQueue(stream->queue);
     SDL_zero(stream->input_spec);
     stream->input_chmap = NULL;
@@ -1532,7 +1874,9 @@ void SDL_DestroyAudioStream(SDL_AudioStream *stream)
     }
 
     SDL_aligned_free(stream->work_buffer);
+    SDL_aligned_free(stream->planar_buffer);
     SDL_DestroyAudioQueue(stream->queue);
+    SDL_DestroyAudioResampler(stream->resampler);
     SDL_DestroyMutex(stream->lock);
 
     SDL_free(stream);
@@ -23,6 +23,9 @@
 #include "SDL_audioqueue.h"
 #include "SDL_sysaudio.h"
 
+// How many unused tracks a queue holds on to, unless it has reserved more
+#define DEFAULT_MAX_FREE_TRACKS 8
+
 typedef struct SDL_MemoryPool SDL_MemoryPool;
 
 struct SDL_MemoryPool
@@ -31,6 +34,10 @@ struct SDL_MemoryPool
     size_t block_size;
     size_t num_free;
     size_t max_free;
+
+    Uint64 num_allocated;  // blocks that came from SDL_malloc
+    Uint64 num_recycled;   // blocks that came from the free list
+    Uint64 num_freed;      // blocks that went back to SDL_free
 };
 
 struct SDL_AudioTrack
@@ -51,6 +58,41 @@ struct SDL_AudioTrack
     int chmap_storage[SDL_MAX_CHANNELMAP_CHANNELS];  // !!! FIXME: this needs to grow if SDL ever supports more channels. But if it grows, we should probably be more clever about allocations.
 };
 
+// A chunk of the staging list. The data follows the header.
+typedef struct SDL_AudioStagingChunk SDL_AudioStagingChunk;
+
+struct SDL_AudioStagingChunk
+{
+    void *next;  // SDL_AudioStagingChunk, accessed atomically
+};
+
+#define STAGING_CHUNK_DATA(chunk) ((Uint8 *)((chunk) + 1))
+
+// The staging list is a single-producer/single-consumer queue of raw bytes.
+// The producer appends chunks and publishes how many bytes it has written,
+// the consumer publishes which chunk it is reading, and the producer recycles
+// the chunks before that one, so neither side ever waits on the other.
+typedef struct SDL_AudioStaging
+{
+    size_t chunk_size;
+
+    // Only touched by the producer
+    SDL_AudioStagingChunk *first;  // oldest chunk, the ones before `reading` can be reused
+    SDL_AudioStagingChunk *tail;
+    size_t tail_used;
+
+    // Only touched by the consumer
+    SDL_AudioStagingChunk *head;
+    size_t head_used;
+    Uint32 read;
+
+    SDL_AtomicInt num_allocated;  // producer statistics, read by the consumer
+    SDL_AtomicInt num_recycled;
+
+    SDL_AtomicU32 written;  // total bytes published by the producer (wraps around)
+    void *reading;  // the chunk the consumer is currently reading, accessed atomically
+} SDL_AudioStaging;
+
 struct SDL_AudioQueue
 {
     SDL_AudioTrack *head;
@@ -62,12 +104,21 @@ struct SDL_AudioQueue
 
     SDL_MemoryPool track_pool;
     SDL_MemoryPool chunk_pool;
+    size_t reserved_chunks;
+
+    SDL_AudioStaging staging;
 };
 
 // Allocate a new block, avoiding checking for ones already in the pool
-static void *AllocNewMemoryPoolBlock(const SDL_MemoryPool *pool)
+static void *AllocNewMemoryPoolBlock(SDL_MemoryPool *pool)
 {
-    return SDL_malloc(pool->block_size);
+    void *block = SDL_malloc(pool->block_size);
+
+    if (block) {
+        ++pool->num_allocated;
+    }
+
+    return block;
 }
 
 // Allocate a new block, first checking if there are any in the pool
@@ -80,6 +131,7 @@ static void *AllocMemoryPoolBlock(SDL_MemoryPool *pool)
     void *block = pool->free_blocks;
     pool->free_blocks = *(void **)block;
     --pool->num_free;
+    ++pool->num_recycled;
     return block;
 }
 
@@ -92,6 +144,19 @@ static void FreeMemoryPoolBlock(SDL_MemoryPool *pool, void *block)
         ++pool->num_free;
     } else {
         SDL_free(block);
+        ++pool->num_freed;
+    }
+}
+
+// Free blocks until there are no more than `max_free` in the pool
+static void TrimMemoryPool(SDL_MemoryPool *pool)
+{
+    while (pool->num_free > pool->max_free) {
+        void *block = pool->free_blocks;
+        pool->free_blocks = *(void **)block;
+        --pool->num_free;
+        SDL_free(block);
+        ++pool->num_freed;
     }
 }
 
@@ -105,6 +170,7 @@ static void DestroyMemoryPool(SDL_MemoryPool *pool)
     while (block) {
         void *next = *(void **)block;
         SDL_free(block);
+        ++pool->num_freed;
         block = next;
     }
 }
@@ -138,10 +204,23 @@ static bool ReserveMemoryPoolBlocks(SDL_MemoryPool *pool, size_t num_blocks)
     return true;
 }
 
+static void DestroyAudioStaging(SDL_AudioStaging *staging)
+{
+    SDL_AudioStagingChunk *chunk = staging->first;
+
+    while (chunk) {
+        SDL_AudioStagingChunk *next = (SDL_AudioStagingChunk *)SDL_GetAtomicPointer(&chunk->next);
+        SDL_free(chunk);
+        chunk = next;
+    }
+}
+
 void SDL_DestroyAudioQueue(SDL_AudioQueue *queue)
 {
     SDL_ClearAudioQueue(queue);
 
+    DestroyAudioStaging(&queue->staging);
+
     DestroyMemoryPool(&queue->track_pool);
     DestroyMemoryPool(&queue->chunk_pool);
     SDL_aligned_free(queue->history_buffer);
@@ -149,6 +228,58 @@ void SDL_DestroyAudioQueue(SDL_AudioQueue *queue)
     SDL_free(queue);
 }
 
+bool SDL_ConfigureAudioQueue(SDL_AudioQueue *queue, size_t chunk_size, size_t reserved_chunks, size_t max_free_chunks)
+{
+    SDL_MemoryPool *chunk_pool = &queue->chunk_pool;
+
+    // The chunk size can only change once every chunk of the old size is back in the pool.
+    if ((chunk_size != chunk_pool->block_size) && !queue->head) {
+        DestroyMemoryPool(chunk_pool);
+        chunk_pool->block_size = chunk_size;
+        queue->reserved_chunks = 0;
+
+        if (!queue->staging.tail) {
+            queue->staging.chunk_size = chunk_size;
+        }
+    }
+
+    // Every chunk needs a track, so keep as many of those around too.
+    chunk_pool->max_free = SDL_max(max_free_chunks, reserved_chunks);
+    queue->track_pool.max_free = SDL_max(DEFAULT_MAX_FREE_TRACKS, reserved_chunks);
+
+    if (reserved_chunks > queue->reserved_chunks) {
+        const size_t num_blocks = reserved_chunks - queue->reserved_chunks;
+
+        if (!ReserveMemoryPoolBlocks(chunk_pool, num_blocks) ||
+            !ReserveMemoryPoolBlocks(&queue->track_pool, num_blocks)) {
+            return false;
+        }
+    }
+
+    queue->reserved_chunks = reserved_chunks;
+
+    TrimMemoryPool(chunk_pool);
+    TrimMemoryPool(&queue->track_pool);
+
+    return true;
+}
+
+size_t SDL_GetAudioQueueChunkSize(SDL_AudioQueue *queue)
+{
+    return queue->chunk_pool.block_size;
+}
+
+void SDL_GetAudioQueueStats(SDL_AudioQueue *queue, Uint64 *out_allocated, Uint64 *out_recycled, Uint64 *out_freed)
+{
+    const SDL_MemoryPool *track_pool = &queue->track_pool;
+    const SDL_MemoryPool *chunk_pool = &queue->chunk_pool;
+    SDL_AudioStaging *staging = &queue->staging;
+
+    *out_allocated = track_pool->num_allocated + chunk_pool->num_allocated + (Uint32)SDL_GetAtomicInt(&staging->num_allocated);
+    *out_recycled = track_pool->num_recycled + chunk_pool->num_recycled + (Uint32)SDL_GetAtomicInt(&staging->num_recycled);
+    *out_freed = track_pool->num_freed + chunk_pool->num_freed;
+}
+
 SDL_AudioQueue *SDL_CreateAudioQueue(size_t chunk_size)
 {
     SDL_AudioQueue *queue = (SDL_AudioQueue *)SDL_calloc(1, sizeof(*queue));
@@ -157,8 +288,10 @@ SDL_AudioQueue *SDL_CreateAudioQueue(size_t chunk_size)
         return NULL;
     }
 
-    InitMemoryPool(&queue->track_pool, sizeof(SDL_AudioTrack), 8);
-    InitMemoryPool(&queue->chunk_pool, chunk_size, 4);
+    InitMemoryPool(&queue->track_pool, sizeof(SDL_AudioTrack), DEFAULT_MAX_FREE_TRACKS);
+    InitMemoryPool(&queue->chunk_pool, chunk_size, SDL_AUDIOQUEUE_DEFAULT_MAX_FREE_CHUNKS);
+
+    queue->staging.chunk_size = chunk_size;
 
     if (!ReserveMemoryPoolBlocks(&queue->track_pool, 2)) {
         SDL_DestroyAudioQueue(queue);
@@ -365,6 +498,149 @@ bool SDL_WriteToAudioQueue(SDL_AudioQueue *queue, const SDL_AudioSpec *spec, con
     return true;
 }
 
+// Get an empty chunk for the producer, reusing one the consumer has finished with if possible
+static SDL_AudioStagingChunk *AllocAudioStagingChunk(SDL_AudioStaging *staging)
+{
+    SDL_AudioStagingChunk *chunk = staging->first;
+
+    if (chunk && (chunk != (SDL_AudioStagingChunk *)SDL_GetAtomicPointer(&staging->reading))) {
+        staging->first = (SDL_AudioStagingChunk *)SDL_GetAtomicPointer(&chunk->next);
+        SDL_AddAtomicInt(&staging->num_recycled, 1);
+    } else {
+        chunk = (SDL_AudioStagingChunk *)SDL_malloc(sizeof(*chunk) + staging->chunk_size);
+
+        if (!chunk) {
+            return NULL;
+        }
+
+        SDL_AddAtomicInt(&staging->num_allocated, 1);
+    }
+
+    SDL_SetAtomicPointer(&chunk->next, NULL);
+    return chunk;
+}
+
+bool SDL_WriteToAudioQueueStaging(SDL_AudioQueue *queue, const Uint8 *data, size_t len)
+{
+    SDL_AudioStaging *staging = &queue->staging;
+
+    if (len == 0) {
+        return true;
+    }
+
+    if (len > SDL_MAX_SINT32) {
+        return SDL_SetError("Too much data to stage");
+    }
+
+    if (!staging->tail) {
+        SDL_AudioStagingChunk *chunk = AllocAudioStagingChunk(staging);
+
+        if (!chunk) {
+            return false;
+        }
+
+        // Nothing has been published yet, so the consumer isn't looking at any of this.
+        staging->first = chunk;
+        staging->tail = chunk;
+        staging->tail_used = 0;
+        staging->head = chunk;
+        staging->head_used = 0;
+        SDL_SetAtomicPointer(&staging->reading, chunk);
+    }
+
+    // Grab every chunk we need up front, so a failed allocation doesn't leave a partial write behind.
+    SDL_AudioStagingChunk *new_chunks = NULL;
+    SDL_AudioStagingChunk *last_new_chunk = NULL;
+    size_t space = staging->chunk_size - staging->tail_used;
+
+    while (space < len) {
+        SDL_AudioStagingChunk *chunk = AllocAudioStagingChunk(staging);
+
+        if (!chunk) {
+            while (new_chunks) {
+                SDL_AudioStagingChunk *next = (SDL_AudioStagingChunk *)SDL_GetAtomicPointer(&new_chunks->next);
+                SDL_free(new_chunks);
+                new_chunks = next;
+            }
+            return false;
+        }
+
+        if (last_new_chunk) {
+            SDL_SetAtomicPointer(&last_new_chunk->next, chunk);
+        } else {
+            new_chunks = chunk;
+        }
+
+        last_new_chunk = chunk;
+        space += staging->chunk_size;
+    }
+
+    if (new_chunks) {
+        SDL_SetAtomicPointer(&staging->tail->next, new_chunks);
+    }
+
+    const size_t total = len;
+
+    for (;;) {
+        const size_t avail = SDL_min(len, staging->chunk_size - staging->tail_used);
+        SDL_memcpy(STAGING_CHUNK_DATA(staging->tail) + staging->tail_used, data, avail);
+        staging->tail_used += avail;
+        data += avail;
+        len -= avail;
+
+        if (len == 0) {
+            break;
+        }
+
+        staging->tail = (SDL_AudioStagingChunk *)SDL_GetAtomicPointer(&staging->tail->next);
+        staging->tail_used = 0;
+    }
+
+    // Publish the data. Only this thread changes `written`, so there's no need for an atomic add.
+    SDL_SetAtomicU32(&staging->written, SDL_GetAtomicU32(&staging->written) + (Uint32)total);
+
+    return true;
+}
+
+static bool ReadFromAudioQueueStaging(SDL_AudioQueue *queue, const SDL_AudioSpec *spec, const int *chmap)
+{
+    SDL_AudioStaging *staging = &queue->staging;
+    Uint32 avail = SDL_GetAtomicU32(&staging->written) - staging->read;
+
+    while (avail) {
+        if (staging->head_used == staging->chunk_size) {
+            SDL_AudioStagingChunk *next = (SDL_AudioStagingChunk *)SDL_GetAtomicPointer(&staging->head->next);
+            SDL_assert(next != NULL);
+            staging->head = next;
+            staging->head_used = 0;
+            SDL_SetAtomicPointer(&staging->reading, next);
+        }
+
+        const size_t len = SDL_min(avail, staging->chunk_size - staging->head_used);
+
+        if (spec && !SDL_WriteToAudioQueue(queue, spec, chmap, STAGING_CHUNK_DATA(staging->head) + staging->head_used, len)) {
+            return false;
+        }
+
+        staging->head_used += len;
+        staging->read += (Uint32)len;
+        avail -= (Uint32)len;
+    }
+
+    return true;
+}
+
+bool SDL_CommitAudioQueueStaging(SDL_AudioQueue *queue, const SDL_AudioSpec *spec, const int *chmap)
+{
+    SDL_assert(spec != NULL);
+    return ReadFromAudioQueueStaging(queue, spec, chmap);
+}
+
+void SDL_ClearAudioQueueStaging(SDL_AudioQueue *queue)
+{
+    ReadFromAudioQueueStaging(queue, NULL, NULL);
+}
+
 void *SDL_BeginAudioQueueIter(SDL_AudioQueue *queue)
 {
     return queue->head;
@@ -30,9 +30,24 @@ typedef SDL_AudioStreamDataCompleteCallback SDL_ReleaseAudioBufferCallback;
 typedef struct SDL_AudioQueue SDL_AudioQueue;
 typedef struct SDL_AudioTrack SDL_AudioTrack;
 
+// The chunk size SDL_AudioStream uses, and how many unused chunks a queue holds on to, unless told otherwise
+#define SDL_AUDIOQUEUE_DEFAULT_CHUNK_SIZE 8192
+#define SDL_AUDIOQUEUE_DEFAULT_MAX_FREE_CHUNKS 4
+
 // Create a new audio queue
 extern SDL_AudioQueue *SDL_CreateAudioQueue(size_t chunk_size);
 
+// Change the size of the queue's chunks, keep at least `reserved_chunks` of them allocated, and
+// hold on to at most `max_free_chunks` unused ones (or `reserved_chunks`, if that's larger).
+// The chunk size only changes while the queue is empty; otherwise it is left alone.
+extern bool SDL_ConfigureAudioQueue(SDL_AudioQueue *queue, size_t chunk_size, size_t reserved_chunks, size_t max_free_chunks);
+
+// Get the size of the queue's chunks, which may not have caught up with SDL_ConfigureAudioQueue yet
+extern size_t SDL_GetAudioQueueChunkSize(SDL_AudioQueue *queue);
+
+// Get the number of memory blocks the queue has allocated, reused from its pools and freed
+extern void SDL_GetAudioQueueStats(SDL_AudioQueue *queue, Uint64 *out_allocated, Uint64 *out_recycled, Uint64 *out_freed);
+
 // Destroy an audio queue
 extern void SDL_DestroyAudioQueue(SDL_AudioQueue *queue);
 
@@ -59,6 +74,17 @@ extern SDL_AudioTrack *SDL_CreateAudioTrack(SDL_AudioQueue *queue,
 // REQUIRES: `track != NULL`
 extern void SDL_AddTrackToAudioQueue(SDL_AudioQueue *queue, SDL_AudioTrack *track);
 
+// Write data to the staging list, without touching the rest of the queue. The staging list is lock-free:
+// one thread may write to it while another thread, holding whatever lock protects the queue, commits it.
+// REQUIRES: Only one thread writes to the staging list at a time
+extern bool SDL_WriteToAudioQueueStaging(SDL_AudioQueue *queue, const Uint8 *data, size_t len);
+
+// Move any data published to the staging list onto the end of the queue
+extern bool SDL_CommitAudioQueueStaging(SDL_AudioQueue *queue, const SDL_AudioSpec *spec, const int *chmap);
+
+// Discard any data published to the staging list
+extern void SDL_ClearAudioQueueStaging(SDL_AudioQueue *queue);
+
 // Iterate over the tracks in the queue
 extern void *SDL_BeginAudioQueueIter(SDL_AudioQueue *queue);
 
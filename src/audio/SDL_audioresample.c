@@ -42,6 +42,32 @@
 // Note, when upsampling, it is also possible to start sampling from `srcpos = -1`.
 #define RESAMPLER_MAX_PADDING_FRAMES (RESAMPLER_ZERO_CROSSINGS + 1)
 
+// The high quality filter is longer, and its padding sets how much history each stream keeps.
+#define RESAMPLER_HQ_ZERO_CROSSINGS    16
+#define RESAMPLER_HQ_SAMPLES_PER_FRAME (RESAMPLER_HQ_ZERO_CROSSINGS * 2)
+#define RESAMPLER_HQ_PADDING_FRAMES    (RESAMPLER_HQ_ZERO_CROSSINGS + 1)
+
+// When downsampling, the high quality filter cuts off a little below the output's Nyquist frequency.
+#define RESAMPLER_HQ_ROLLOFF 0.95f
+
+// Linear interpolation only ever samples `srcpos` and `srcpos + 1`.
+#define RESAMPLER_LINEAR_PADDING_FRAMES 1
+
+// Sample rate pairs with at most this many distinct output positions between input frames
+// (e.g. 160 for 44100->48000, 147 for 48000->44100) get an exact polyphase table.
+#define RESAMPLER_MAX_EXACT_PHASES 512
+
+// Otherwise, the high quality filter is linearly interpolated between this many phases.
+#define RESAMPLER_HQ_INTERP_PHASES 256
+
+// Exact tables are subdivided to at least this many phases, so that positions off the exact grid
+// (e.g. after the frequency ratio changes) can still be linearly interpolated between nearby phases.
+#define RESAMPLER_MIN_PHASES 256
+
+// Positions within this many 1/2^32ths of a phase use that phase's row directly.
+// This covers the rounding of the resample rate, accumulated over a block of frames.
+#define RESAMPLER_PHASE_TOLERANCE (1u << 24)
+
 // More bits gives more precision, at the cost of a larger table.
 #define RESAMPLER_BITS_PER_ZERO_CROSSING    3
 #define RESAMPLER_SAMPLES_PER_ZERO_CROSSING (1 << RESAMPLER_BITS_PER_ZERO_CROSSING)
@@ -516,6 +542,339 @@ static void GenerateResamplerFilter(void)
 typedef void (*ResampleFrameFunc)(const float *src, float *dst, const Cubic *filter, float frac, int chans);
 static ResampleFrameFunc ResampleFrame[8];
 
+struct SDL_AudioResampler
+{
+    SDL_AudioResampleQuality quality;
+    int src_rate;
+    int dst_rate;
+
+    // Polyphase filter: (num_phases + 1) rows of num_taps coefficients, for output positions [0, 1] between input frames.
+    // Not used (num_phases == 0) for linear interpolation, or for the medium quality filter with irregular ratios.
+    int num_phases;
+    int num_taps;
+    bool interpolate_phases;
+    float *phase_table;
+    size_t phase_table_allocation;
+};
+
+// Kaiser windowed sinc, where `x` is the distance from the output position in input frames
+static float KaiserSinc(double x, int zero_crossings, float cutoff, float beta, float bessel_beta)
+{
+    const float t = (float)(x / zero_crossings);
+
+    if ((t <= -1.0f) || (t >= 1.0f)) {
+        return 0.0f;
+    }
+
+    const float window = BesselI0(beta * SDL_sqrtf(1.0f - (t * t))) / bessel_beta;
+    const float y = (float)(SDL_PI_D * cutoff * x);
+
+    return cutoff * window * ((y == 0.0f) ? 1.0f : (SDL_sinf(y) / y));
+}
+
+static bool GeneratePolyphaseTable(SDL_AudioResampler *resampler, int zero_crossings, int num_phases, bool interpolate_phases, float cutoff)
+{
+    // Same attenuation as the medium quality filter
+    const float dB = 80.0f;
+    const float beta = 0.1102f * (dB - 8.7f);
+    const float bessel_beta = BesselI0(beta);
+
+    const int num_taps = zero_crossings * 2;
+    const size_t allocation = (size_t)(num_phases + 1) * num_taps * sizeof(float);
+
+    int i, j;
+
+    if (allocation > resampler->phase_table_allocation) {
+        float *table = (float *)SDL_aligned_alloc(SDL_GetSIMDAlignment(), allocation);
+        if (!table) {
+            return false;
+        }
+        SDL_aligned_free(resampler->phase_table);
+        resampler->phase_table = table;
+        resampler->phase_table_allocation = allocation;
+    }
+
+    for (i = 0; i <= num_phases; ++i) {
+        float *row = &resampler->phase_table[i * num_taps];
+
+        if ((cutoff == 1.0f) && ((i == 0) || (i == num_phases))) {
+            // Exactly on an input frame, every other tap is a zero crossing.
+            // SDL_sinf(n * pi) isn't quite zero, so keep this lossless explicitly.
+            SDL_memset(row, 0, num_taps * sizeof(float));
+            row[(i == 0) ? (zero_crossings - 1) : zero_crossings] = 1.0f;
+            continue;
+        }
+
+        // Tap j samples input frame `srcindex - (zero_crossings - 1) + j`, for an output at `srcindex + i / num_phases`
+        for (j = 0; j < num_taps; ++j) {
+            const double x = (double)(j - (zero_crossings - 1)) - ((double)i / num_phases);
+            row[j] = KaiserSinc(x, zero_crossings, cutoff, beta, bessel_beta);
+        }
+    }
+
+    resampler->num_phases = num_phases;
+    resampler->num_taps = num_taps;
+    resampler->interpolate_phases = interpolate_phases;
+    return true;
+}
+
+SDL_FORCE_INLINE const float *GetPolyphaseFilter(const SDL_AudioResampler *resampler, Uint32 srcfraction, float *scratch)
+{
+    const Uint64 pos = (Uint64)srcfraction * (Uint32)resampler->num_phases;
+    const int num_taps = resampler->num_taps;
+    const Uint32 phase = (Uint32)(pos >> 32);
+    const Uint32 remainder = (Uint32)(pos & 0xFFFFFFFF);
+
+    if (!resampler->interpolate_phases) {
+        // For exact ratios, positions only miss the grid by the rounding of the resample rate.
+        if (remainder < RESAMPLER_PHASE_TOLERANCE) {
+            return &resampler->phase_table[phase * num_taps];
+        } else if (remainder > (Uint32)-RESAMPLER_PHASE_TOLERANCE) {
+            return &resampler->phase_table[(phase + 1) * num_taps];
+        }
+    }
+
+    const float t = (float)remainder * (1.0f / 4294967296.0f);
+    const float *a = &resampler->phase_table[phase * num_taps];
+    const float *b = a + num_taps;
+    int i;
+
+    for (i = 0; i < num_taps; ++i) {
+        scratch[i] = a[i] + ((b[i] - a[i]) * t);
+    }
+
+    return scratch;
+}
+
+typedef void (*ResamplePolyphaseFunc)(const SDL_AudioResampler *resampler, int chans, const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate);
+static ResamplePolyphaseFunc ResamplePolyphase;
+
+static void ResamplePolyphase_Scalar(const SDL_AudioResampler *resampler, int chans, const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate)
+{
+    const int num_taps = resampler->num_taps;
+    float scratch[RESAMPLER_HQ_SAMPLES_PER_FRAME];
+    int i, j, chan;
+
+    src -= ((num_taps / 2) - 1) * chans;
+
+    for (i = 0; i < outframes; ++i) {
+        const int srcindex = (int)(Sint32)(srcpos >> 32);
+        const Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
+        const float *filter = GetPolyphaseFilter(resampler, srcfraction, scratch);
+        const float *frame = &src[srcindex * chans];
+
+        srcpos += resample_rate;
+
+        if (chans == 1) {
+            float out = 0.0f;
+            for (j = 0; j < num_taps; ++j) {
+                out += frame[j] * filter[j];
+            }
+            dst[0] = out;
+        } else if (chans == 2) {
+            float out0 = 0.0f;
+            float out1 = 0.0f;
+            for (j = 0; j < num_taps; ++j) {
+                out0 += frame[j * 2 + 0] * filter[j];
+                out1 += frame[j * 2 + 1] * filter[j];
+            }
+            dst[0] = out0;
+            dst[1] = out1;
+        } else {
+            for (chan = 0; chan < chans; ++chan) {
+                float out = 0.0f;
+                for (j = 0; j < num_taps; ++j) {
+                    out += frame[j * chans + chan] * filter[j];
+                }
+                dst[chan] = out;
+            }
+        }
+
+        dst += chans;
+    }
+}
+
+#ifdef SDL_SSE_INTRINSICS
+#define sdl_madd_ps(a, b, c) _mm_add_ps(a, _mm_mul_ps(b, c)) // Not-so-fused multiply-add
+
+// REQUIRES: num_taps is a multiple of 4
+static void SDL_TARGETING("sse") ResamplePolyphase_SSE(const SDL_AudioResampler *resampler, int chans, const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate)
+{
+    const int num_taps = resampler->num_taps;
+    float scratch[RESAMPLER_HQ_SAMPLES_PER_FRAME];
+    int i, j, chan;
+
+    src -= ((num_taps / 2) - 1) * chans;
+
+    for (i = 0; i < outframes; ++i) {
+        const int srcindex = (int)(Sint32)(srcpos >> 32);
+        const Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
+        const float *filter = GetPolyphaseFilter(resampler, srcfraction, scratch);
+        const float *frame = &src[srcindex * chans];
+
+        srcpos += resample_rate;
+
+        if (chans == 1) {
+            __m128 out = _mm_setzero_ps();
+
+            for (j = 0; j < num_taps; j += 4) {
+                out = sdl_madd_ps(out, _mm_loadu_ps(&filter[j]), _mm_loadu_ps(&frame[j]));
+            }
+
+            // Horizontal sum
+            __m128 shuf = _mm_shuffle_ps(out, out, _MM_SHUFFLE(2, 3, 0, 1));
+            out = _mm_add_ps(out, shuf);
+            out = _mm_add_ss(out, _mm_movehl_ps(shuf, out));
+
+            _mm_store_ss(dst, out);
+        } else if (chans == 2) {
+            // Duplicate each of the filter elements and multiply by the input
+            __m128 out0 = _mm_setzero_ps();
+            __m128 out1 = _mm_setzero_ps();
+
+            for (j = 0; j < num_taps; j += 4) {
+                const __m128 f = _mm_loadu_ps(&filter[j]);
+                out0 = sdl_madd_ps(out0, _mm_loadu_ps(&frame[j * 2]), _mm_unpacklo_ps(f, f));
+                out1 = sdl_madd_ps(out1, _mm_loadu_ps(&frame[j * 2 + 4]), _mm_unpackhi_ps(f, f));
+            }
+
+            // Add the accumulators together, then the lower and upper pairs
+            __m128 out = _mm_add_ps(out0, out1);
+            out = _mm_add_ps(out, _mm_movehl_ps(out, out));
+
+            _mm_storel_pi((__m64 *)dst, out);
+        } else {
+            // Process 4 channels at once
+            for (chan = 0; chan + 4 <= chans; chan += 4) {
+                const float *in = &frame[chan];
+                __m128 out = _mm_setzero_ps();
+
+                for (j = 0; j < num_taps; ++j, in += chans) {
+                    out = sdl_madd_ps(out, _mm_loadu_ps(in), _mm_set1_ps(filter[j]));
+                }
+
+                _mm_storeu_ps(&dst[chan], out);
+            }
+
+            // Process the remaining channels one at a time.
+            for (; chan < chans; ++chan) {
+                float out = 0.0f;
+                for (j = 0; j < num_taps; ++j) {
+                    out += frame[j * chans + chan] * filter[j];
+                }
+                dst[chan] = out;
+            }
+        }
+
+        dst += chans;
+    }
+}
+
+#undef sdl_madd_ps
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+// REQUIRES: num_taps is a multiple of 4
+static void ResamplePolyphase_NEON(const SDL_AudioResampler *resampler, int chans, const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate)
+{
+    const int num_taps = resampler->num_taps;
+    float scratch[RESAMPLER_HQ_SAMPLES_PER_FRAME];
+    int i, j, chan;
+
+    src -= ((num_taps / 2) - 1) * chans;
+
+    for (i = 0; i < outframes; ++i) {
+        const int srcindex = (int)(Sint32)(srcpos >> 32);
+        const Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
+        const float *filter = GetPolyphaseFilter(resampler, srcfraction, scratch);
+        const float *frame = &src[srcindex * chans];
+
+        srcpos += resample_rate;
+
+        if (chans == 1) {
+            float32x4_t out = vdupq_n_f32(0);
+
+            for (j = 0; j < num_taps; j += 4) {
+                out = vmlaq_f32(out, vld1q_f32(&filter[j]), vld1q_f32(&frame[j]));
+            }
+
+            // Horizontal sum
+            float32x2_t sum = vadd_f32(vget_low_f32(out), vget_high_f32(out));
+            sum = vpadd_f32(sum, sum);
+
+            vst1_lane_f32(dst, sum, 0);
+        } else if (chans == 2) {
+            // Duplicate each of the filter elements and multiply by the input
+            float32x4_t out0 = vdupq_n_f32(0);
+            float32x4_t out1 = vdupq_n_f32(0);
+
+            for (j = 0; j < num_taps; j += 4) {
+                const float32x4_t f = vld1q_f32(&filter[j]);
+                const float32x4x2_t g = vzipq_f32(f, f);
+                out0 = vmlaq_f32(out0, vld1q_f32(&frame[j * 2]), g.val[0]);
+                out1 = vmlaq_f32(out1, vld1q_f32(&frame[j * 2 + 4]), g.val[1]);
+            }
+
+            // Add the accumulators together, then the lower and upper pairs
+            out0 = vaddq_f32(out0, out1);
+            vst1_f32(dst, vadd_f32(vget_low_f32(out0), vget_high_f32(out0)));
+        } else {
+            // Process 4 channels at once
+            for (chan = 0; chan + 4 <= chans; chan += 4) {
+                const float *in = &frame[chan];
+                float32x4_t out = vdupq_n_f32(0);
+
+                for (j = 0; j < num_taps; ++j, in += chans) {
+                    out = vmlaq_n_f32(out, vld1q_f32(in), filter[j]);
+                }
+
+                vst1q_f32(&dst[chan], out);
+            }
+
+            // Process the remaining channels one at a time.
+            for (; chan < chans; ++chan) {
+                float out = 0.0f;
+                for (j = 0; j < num_taps; ++j) {
+                    out += frame[j * chans + chan] * filter[j];
+                }
+                dst[chan] = out;
+            }
+        }
+
+        dst += chans;
+    }
+}
+#endif
+
+static void ResampleLinear(int chans, const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate)
+{
+    int i, chan;
+
+    for (i = 0; i < outframes; ++i) {
+        const int srcindex = (int)(Sint32)(srcpos >> 32);
+        const Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
+        // Only keep 24 bits, so the fraction can't round up to 1.0f
+        const float frac = (float)(srcfraction >> 8) * (1.0f / 16777216.0f);
+        const float *a = &src[srcindex * chans];
+        const float *b = a + chans;
+
+        srcpos += resample_rate;
+
+        if (chans == 1) {
+            dst[0] = a[0] + ((b[0] - a[0]) * frac);
+        } else if (chans == 2) {
+            dst[0] = a[0] + ((b[0] - a[0]) * frac);
+            dst[1] = a[1] + ((b[1] - a[1]) * frac);
+        } else {
+            for (chan = 0; chan < chans; ++chan) {
+                dst[chan] = a[chan] + ((b[chan] - a[chan]) * frac);
+            }
+        }
+
+        dst += chans;
+    }
+}
+
 // Transpose 4x4 floats
 static void Transpose4x4(Cubic *data)
 {
@@ -542,6 +901,7 @@ static void SetupAudioResampler(void)
         for (i = 0; i < 8; ++i) {
             ResampleFrame[i] = ResampleFrame_Generic_SSE;
         }
+        ResamplePolyphase = ResamplePolyphase_SSE;
         transpose = true;
     } else
 #endif
@@ -550,6 +910,7 @@ static void SetupAudioResampler(void)
         for (i = 0; i < 8; ++i) {
             ResampleFrame[i] = ResampleFrame_Generic_NEON;
         }
+        ResamplePolyphase = ResamplePolyphase_NEON;
         transpose = true;
     } else
 #endif
@@ -560,6 +921,7 @@ static void SetupAudioResampler(void)
 
         ResampleFrame[0] = ResampleFrame_Mono;
         ResampleFrame[1] = ResampleFrame_Stereo;
+        ResamplePolyphase = ResamplePolyphase_Scalar;
     }
 
     if (transpose) {
@@ -582,6 +944,83 @@ void SDL_SetupAudioResampler(void)
     }
 }
 
+SDL_AudioResampler *SDL_CreateAudioResampler(void)
+{
+    return (SDL_AudioResampler *)SDL_calloc(1, sizeof(SDL_AudioResampler));
+}
+
+void SDL_DestroyAudioResampler(SDL_AudioResampler *resampler)
+{
+    if (resampler) {
+        SDL_aligned_free(resampler->phase_table);
+        SDL_free(resampler);
+    }
+}
+
+static int GreatestCommonDivisor(int a, int b)
+{
+    while (b != 0) {
+        const int t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+bool SDL_UpdateAudioResampler(SDL_AudioResampler *resampler, SDL_AudioResampleQuality quality, int src_rate, int dst_rate)
+{
+    SDL_assert(src_rate > 0);
+    SDL_assert(dst_rate > 0);
+
+    if ((resampler->quality == quality) && (resampler->src_rate == src_rate) && (resampler->dst_rate == dst_rate)) {
+        return true;
+    }
+
+    // Output positions repeat every `dst_rate / gcd` frames, so that many phases cover every position exactly.
+    int num_phases = dst_rate / GreatestCommonDivisor(src_rate, dst_rate);
+    const int subdivisions = (RESAMPLER_MIN_PHASES + num_phases - 1) / num_phases;
+    bool result = true;
+
+    resampler->num_phases = 0;
+
+    switch (quality) {
+    case SDL_AUDIO_RESAMPLE_QUALITY_LINEAR:
+        break;
+
+    case SDL_AUDIO_RESAMPLE_QUALITY_HIGH:
+    {
+        const float cutoff = (dst_rate < src_rate) ? (RESAMPLER_HQ_ROLLOFF * dst_rate / src_rate) : 1.0f;
+        const bool interpolate_phases = (num_phases > RESAMPLER_MAX_EXACT_PHASES);
+
+        if (interpolate_phases) {
+            num_phases = RESAMPLER_HQ_INTERP_PHASES;
+        } else {
+            num_phases *= subdivisions;
+        }
+        result = GeneratePolyphaseTable(resampler, RESAMPLER_HQ_ZERO_CROSSINGS, num_phases, interpolate_phases, cutoff);
+        break;
+    }
+
+    default:
+        // Irregular ratios keep using the cubic-interpolated filter, rather than building a huge table.
+        if (num_phases <= RESAMPLER_MAX_EXACT_PHASES) {
+            result = GeneratePolyphaseTable(resampler, RESAMPLER_ZERO_CROSSINGS, num_phases * subdivisions, false, 1.0f);
+        }
+        break;
+    }
+
+    if (!result) {
+        resampler->num_phases = 0;
+        resampler->src_rate = 0;
+        return false;
+    }
+
+    resampler->quality = quality;
+    resampler->src_rate = src_rate;
+    resampler->dst_rate = dst_rate;
+    return true;
+}
+
 Sint64 SDL_GetResampleRate(int src_rate, int dst_rate)
 {
     SDL_assert(src_rate > 0);
@@ -607,15 +1046,27 @@ Sint64 SDL_GetResampleRate(int src_rate, int dst_rate)
 int SDL_GetResamplerHistoryFrames(void)
 {
     // Even if we aren't currently resampling, make sure to keep enough history in case we need to later.
+    // The resampler quality can also change at any time, so keep enough for the longest filter.
 
-    return RESAMPLER_MAX_PADDING_FRAMES;
+    return RESAMPLER_HQ_PADDING_FRAMES;
 }
 
-int SDL_GetResamplerPaddingFrames(Sint64 resample_rate)
+int SDL_GetResamplerPaddingFrames(Sint64 resample_rate, SDL_AudioResampleQuality quality)
 {
     // This must always be <= SDL_GetResamplerHistoryFrames()
 
-    return resample_rate ? RESAMPLER_MAX_PADDING_FRAMES : 0;
+    if (!resample_rate) {
+        return 0;
+    }
+
+    switch (quality) {
+    case SDL_AUDIO_RESAMPLE_QUALITY_LINEAR:
+        return RESAMPLER_LINEAR_PADDING_FRAMES;
+    case SDL_AUDIO_RESAMPLE_QUALITY_HIGH:
+        return RESAMPLER_HQ_PADDING_FRAMES;
+    default:
+        return RESAMPLER_MAX_PADDING_FRAMES;
+    }
 }
 
 // These are not general purpose. They do not check for all possible underflow/overflow
@@ -675,7 +1126,31 @@ Sint64 SDL_GetResamplerOutputFrames(Sint64 input_frames, Sint64 resample_rate, S
     return output_frames;
 }
 
-void SDL_ResampleAudio(int chans, const float *src, int inframes, float *dst, int outframes,
+// Moves an offset that is within tolerance of an exact phase back onto it, so that the rounding
+// of the resample rate doesn't accumulate across blocks and push later frames off the grid.
+static Sint64 SnapToPhase(const SDL_AudioResampler *resampler, Sint64 offset)
+{
+    if (resampler->interpolate_phases) {
+        return offset;
+    }
+
+    const Uint32 num_phases = (Uint32)resampler->num_phases;
+    const Uint64 pos = (Uint64)(Uint32)(offset & 0xFFFFFFFF) * num_phases;
+    const Uint32 remainder = (Uint32)(pos & 0xFFFFFFFF);
+    Uint64 phase = pos >> 32;
+
+    if (remainder > (Uint32)-RESAMPLER_PHASE_TOLERANCE) {
+        ++phase;
+    } else if (remainder >= RESAMPLER_PHASE_TOLERANCE) {
+        return offset;
+    }
+
+    // Round up, so that the phase is found again by truncation
+    const Uint64 fraction = ((phase << 32) + num_phases - 1) / num_phases;
+    return (offset & ~(Sint64)0xFFFFFFFF) + (Sint64)fraction;
+}
+
+void SDL_ResampleAudio(const SDL_AudioResampler *resampler, int chans, const float *src, int inframes, float *dst, int outframes,
                        Sint64 resample_rate, Sint64 *inout_resample_offset)
 {
     int i;
@@ -683,6 +1158,19 @@ void SDL_ResampleAudio(int chans, const float *src, int inframes, float *dst, in
     ResampleFrameFunc resample_frame = ResampleFrame[chans - 1];
 
     SDL_assert(resample_rate > 0);
+    SDL_assert(outframes <= 0 || (int)(Sint32)(srcpos >> 32) >= -1);
+    SDL_assert(outframes <= 0 || (int)(Sint32)((srcpos + (outframes - 1) * resample_rate) >> 32) < inframes);
+
+    // Whole blocks of frames are handled at once, without per-frame dispatch
+    if (resampler->quality == SDL_AUDIO_RESAMPLE_QUALITY_LINEAR) {
+        ResampleLinear(chans, src, dst, outframes, srcpos, resample_rate);
+        *inout_resample_offset = srcpos + (outframes * resample_rate) - ((Sint64)inframes << 32);
+        return;
+    } else if (resampler->num_phases) {
+        ResamplePolyphase(resampler, chans, src, dst, outframes, srcpos, resample_rate);
+        *inout_resample_offset = SnapToPhase(resampler, srcpos + (outframes * resample_rate) - ((Sint64)inframes << 32));
+        return;
+    }
 
     src -= (RESAMPLER_ZERO_CROSSINGS - 1) * chans;
 
@@ -26,18 +26,28 @@
 // Internal functions used by SDL_AudioStream for resampling audio.
 // The resampler uses 32:32 fixed-point arithmetic to track its position.
 
+// Per-stream resampler state, holding the filter tables for the current quality and sample rates.
+typedef struct SDL_AudioResampler SDL_AudioResampler;
+
+SDL_AudioResampler *SDL_CreateAudioResampler(void);
+void SDL_DestroyAudioResampler(SDL_AudioResampler *resampler);
+
+// Prepare the resampler for the given quality and sample rates. This is cheap if nothing changed.
+bool SDL_UpdateAudioResampler(SDL_AudioResampler *resampler, SDL_AudioResampleQuality quality, int src_rate, int dst_rate);
+
 Sint64 SDL_GetResampleRate(int src_rate, int dst_rate);
 
 int SDL_GetResamplerHistoryFrames(void);
-int SDL_GetResamplerPaddingFrames(Sint64 resample_rate);
+int SDL_GetResamplerPaddingFrames(Sint64 resample_rate, SDL_AudioResampleQuality quality);
 
 Sint64 SDL_GetResamplerInputFrames(Sint64 output_frames, Sint64 resample_rate, Sint64 resample_offset);
 Sint64 SDL_GetResamplerOutputFrames(Sint64 input_frames, Sint64 resample_rate, Sint64 *inout_resample_offset);
 
 // Resample some audio.
+// REQUIRES: `resampler` was updated with the quality and sample rates that `resample_rate` was calculated from
 // REQUIRES: `inframes >= SDL_GetResamplerInputFrames(outframes)`
 // REQUIRES: At least `SDL_GetResamplerPaddingFrames(...)` extra frames to the left of src, and right of src+inframes
-void SDL_ResampleAudio(int chans, const float *src, int inframes, float *dst, int outframes,
+void SDL_ResampleAudio(const SDL_AudioResampler *resampler, int chans, const float *src, int inframes, float *dst, int outframes,
                        Sint64 resample_rate, Sint64 *inout_resample_offset);
 
 #endif // SDL_audioresample_h_
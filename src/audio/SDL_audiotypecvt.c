@@ -530,6 +530,201 @@ static void SDL_TARGETING("ssse3") SDL_Convert_Swap32_SSSE3(Uint32 *dst, const U
 }
 #endif
 
+#ifdef SDL_AVX2_INTRINSICS
+
+// Convert forwards, 32 samples at a time, when sizeof(*src) >= sizeof(*dst)
+#define CONVERT_32_FWD(CVT1, CVT32)                          \
+    int i = 0;                                               \
+    if (num_samples >= 32) {                                 \
+        while ((uintptr_t)(&dst[i]) & 31) { CVT1  ++i;     } \
+        while ((i + 32) <= num_samples)   { CVT32 i += 32; } \
+    }                                                        \
+    while (i < num_samples)               { CVT1  ++i;     }
+
+// Convert backwards, 32 samples at a time, when sizeof(*src) <= sizeof(*dst)
+#define CONVERT_32_REV(CVT1, CVT32)                          \
+    int i = num_samples;                                     \
+    if (i >= 32) {                                           \
+        while ((uintptr_t)(&dst[i]) & 31) { --i;     CVT1  } \
+        while (i >= 32)                   { i -= 32; CVT32 } \
+    }                                                        \
+    while (i > 0)                         { --i;     CVT1  }
+
+static void SDL_TARGETING("avx2") SDL_Convert_S16_to_F32_AVX2(float *dst, const Sint16 *src, int num_samples)
+{
+    /* Same as the SSE2 version, but zero-extends to 32 bits first, since
+     * unpacking in 256-bit registers works per 128-bit lane.
+     * dst[i] = i2f((u16)src[i] ^ 0x43808000) - 257.0 */
+    const __m256i caster = _mm256_set1_epi32(0x43808000);
+    const __m256 offset = _mm256_set1_ps(-257.0f);
+
+    LOG_DEBUG_AUDIO_CONVERT("S16", "F32 (using AVX2)");
+
+    CONVERT_32_REV({
+        _mm_store_ss(&dst[i], _mm_add_ss(_mm_castsi128_ps(_mm_cvtsi32_si128((Uint16)src[i] ^ 0x43808000u)), _mm256_castps256_ps128(offset)));
+    }, {
+        const __m256i ints0 = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)&src[i]));
+        const __m256i ints1 = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)&src[i + 8]));
+        const __m256i ints2 = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)&src[i + 16]));
+        const __m256i ints3 = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)&src[i + 24]));
+
+        const __m256 floats0 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_xor_si256(ints0, caster)), offset);
+        const __m256 floats1 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_xor_si256(ints1, caster)), offset);
+        const __m256 floats2 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_xor_si256(ints2, caster)), offset);
+        const __m256 floats3 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_xor_si256(ints3, caster)), offset);
+
+        _mm256_store_ps(&dst[i], floats0);
+        _mm256_store_ps(&dst[i + 8], floats1);
+        _mm256_store_ps(&dst[i + 16], floats2);
+        _mm256_store_ps(&dst[i + 24], floats3);
+    })
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_S32_to_F32_AVX2(float *dst, const Sint32 *src, int num_samples)
+{
+    // dst[i] = f32(src[i]) / f32(0x80000000)
+    const __m256 scaler = _mm256_set1_ps(DIVBY2147483648);
+
+    LOG_DEBUG_AUDIO_CONVERT("S32", "F32 (using AVX2)");
+
+    CONVERT_32_FWD({
+        _mm_store_ss(&dst[i], _mm_mul_ss(_mm_cvt_si2ss(_mm_setzero_ps(), src[i]), _mm256_castps256_ps128(scaler)));
+    }, {
+        const __m256i ints0 = _mm256_loadu_si256((const __m256i *)&src[i]);
+        const __m256i ints1 = _mm256_loadu_si256((const __m256i *)&src[i + 8]);
+        const __m256i ints2 = _mm256_loadu_si256((const __m256i *)&src[i + 16]);
+        const __m256i ints3 = _mm256_loadu_si256((const __m256i *)&src[i + 24]);
+
+        const __m256 floats0 = _mm256_mul_ps(_mm256_cvtepi32_ps(ints0), scaler);
+        const __m256 floats1 = _mm256_mul_ps(_mm256_cvtepi32_ps(ints1), scaler);
+        const __m256 floats2 = _mm256_mul_ps(_mm256_cvtepi32_ps(ints2), scaler);
+        const __m256 floats3 = _mm256_mul_ps(_mm256_cvtepi32_ps(ints3), scaler);
+
+        _mm256_store_ps(&dst[i], floats0);
+        _mm256_store_ps(&dst[i + 8], floats1);
+        _mm256_store_ps(&dst[i + 16], floats2);
+        _mm256_store_ps(&dst[i + 24], floats3);
+    })
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_F32_to_S16_AVX2(Sint16 *dst, const float *src, int num_samples)
+{
+    /* Same as the SSE2 version, with the packed lanes put back in order afterwards.
+     * dst[i] = clamp(f2i(src[i] + 257.0) - 0x43808000, -32768, 32767) */
+    const __m256 offset = _mm256_set1_ps(257.0f);
+
+    LOG_DEBUG_AUDIO_CONVERT("F32", "S16 (using AVX2)");
+
+    CONVERT_32_FWD({
+        const __m128 offset1 = _mm256_castps256_ps128(offset);
+        const __m128i ints = _mm_sub_epi32(_mm_castps_si128(_mm_add_ss(_mm_load_ss(&src[i]), offset1)), _mm_castps_si128(offset1));
+        dst[i] = (Sint16)(_mm_cvtsi128_si32(_mm_packs_epi32(ints, ints)) & 0xFFFF);
+    }, {
+        const __m256 floats0 = _mm256_loadu_ps(&src[i]);
+        const __m256 floats1 = _mm256_loadu_ps(&src[i + 8]);
+        const __m256 floats2 = _mm256_loadu_ps(&src[i + 16]);
+        const __m256 floats3 = _mm256_loadu_ps(&src[i + 24]);
+
+        const __m256i ints0 = _mm256_sub_epi32(_mm256_castps_si256(_mm256_add_ps(floats0, offset)), _mm256_castps_si256(offset));
+        const __m256i ints1 = _mm256_sub_epi32(_mm256_castps_si256(_mm256_add_ps(floats1, offset)), _mm256_castps_si256(offset));
+        const __m256i ints2 = _mm256_sub_epi32(_mm256_castps_si256(_mm256_add_ps(floats2, offset)), _mm256_castps_si256(offset));
+        const __m256i ints3 = _mm256_sub_epi32(_mm256_castps_si256(_mm256_add_ps(floats3, offset)), _mm256_castps_si256(offset));
+
+        // _mm256_packs_epi32 interleaves the 128-bit lanes of its inputs, so swap the middle 64-bit quarters back
+        const __m256i shorts0 = _mm256_permute4x64_epi64(_mm256_packs_epi32(ints0, ints1), 0xD8);
+        const __m256i shorts1 = _mm256_permute4x64_epi64(_mm256_packs_epi32(ints2, ints3), 0xD8);
+
+        _mm256_store_si256((__m256i *)&dst[i], shorts0);
+        _mm256_store_si256((__m256i *)&dst[i + 16], shorts1);
+    })
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_F32_to_S32_AVX2(Sint32 *dst, const float *src, int num_samples)
+{
+    /* Same as the SSE2 version.
+     * dst[i] = i32(src[i] * 2147483648.0) ^ ((src[i] >= 2147483648.0) ? 0xFFFFFFFF : 0x00000000) */
+    const __m256 limit = _mm256_set1_ps(2147483648.0f);
+
+    LOG_DEBUG_AUDIO_CONVERT("F32", "S32 (using AVX2)");
+
+    CONVERT_32_FWD({
+        const __m128 limit1 = _mm256_castps256_ps128(limit);
+        const __m128 floats = _mm_load_ss(&src[i]);
+        const __m128 values = _mm_mul_ss(floats, limit1);
+        const __m128i ints = _mm_xor_si128(_mm_cvttps_epi32(values), _mm_castps_si128(_mm_cmpge_ss(values, limit1)));
+        dst[i] = (Sint32)_mm_cvtsi128_si32(ints);
+    }, {
+        const __m256 floats0 = _mm256_loadu_ps(&src[i]);
+        const __m256 floats1 = _mm256_loadu_ps(&src[i + 8]);
+        const __m256 floats2 = _mm256_loadu_ps(&src[i + 16]);
+        const __m256 floats3 = _mm256_loadu_ps(&src[i + 24]);
+
+        const __m256 values1 = _mm256_mul_ps(floats0, limit);
+        const __m256 values2 = _mm256_mul_ps(floats1, limit);
+        const __m256 values3 = _mm256_mul_ps(floats2, limit);
+        const __m256 values4 = _mm256_mul_ps(floats3, limit);
+
+        const __m256i ints0 = _mm256_xor_si256(_mm256_cvttps_epi32(values1), _mm256_castps_si256(_mm256_cmp_ps(values1, limit, _CMP_GE_OQ)));
+        const __m256i ints1 = _mm256_xor_si256(_mm256_cvttps_epi32(values2), _mm256_castps_si256(_mm256_cmp_ps(values2, limit, _CMP_GE_OQ)));
+        const __m256i ints2 = _mm256_xor_si256(_mm256_cvttps_epi32(values3), _mm256_castps_si256(_mm256_cmp_ps(values3, limit, _CMP_GE_OQ)));
+        const __m256i ints3 = _mm256_xor_si256(_mm256_cvttps_epi32(values4), _mm256_castps_si256(_mm256_cmp_ps(values4, limit, _CMP_GE_OQ)));
+
+        _mm256_store_si256((__m256i *)&dst[i], ints0);
+        _mm256_store_si256((__m256i *)&dst[i + 8], ints1);
+        _mm256_store_si256((__m256i *)&dst[i + 16], ints2);
+        _mm256_store_si256((__m256i *)&dst[i + 24], ints3);
+    })
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_Swap16_AVX2(Uint16 *dst, const Uint16 *src, int num_samples)
+{
+    // _mm256_shuffle_epi8 works within each 128-bit lane, so the same pattern is used for both lanes
+    const __m256i shuffle = _mm256_set_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1,
+                                            14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+
+    CONVERT_32_FWD({
+        dst[i] = SDL_Swap16(src[i]);
+    }, {
+        __m256i ints0 = _mm256_loadu_si256((const __m256i *)&src[i]);
+        __m256i ints1 = _mm256_loadu_si256((const __m256i *)&src[i + 16]);
+
+        ints0 = _mm256_shuffle_epi8(ints0, shuffle);
+        ints1 = _mm256_shuffle_epi8(ints1, shuffle);
+
+        _mm256_store_si256((__m256i *)&dst[i], ints0);
+        _mm256_store_si256((__m256i *)&dst[i + 16], ints1);
+    })
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_Swap32_AVX2(Uint32 *dst, const Uint32 *src, int num_samples)
+{
+    const __m256i shuffle = _mm256_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,
+                                            12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+
+    CONVERT_32_FWD({
+        dst[i] = SDL_Swap32(src[i]);
+    }, {
+        __m256i ints0 = _mm256_loadu_si256((const __m256i *)&src[i]);
+        __m256i ints1 = _mm256_loadu_si256((const __m256i *)&src[i + 8]);
+        __m256i ints2 = _mm256_loadu_si256((const __m256i *)&src[i + 16]);
+        __m256i ints3 = _mm256_loadu_si256((const __m256i *)&src[i + 24]);
+
+        ints0 = _mm256_shuffle_epi8(ints0, shuffle);
+        ints1 = _mm256_shuffle_epi8(ints1, shuffle);
+        ints2 = _mm256_shuffle_epi8(ints2, shuffle);
+        ints3 = _mm256_shuffle_epi8(ints3, shuffle);
+
+        _mm256_store_si256((__m256i *)&dst[i], ints0);
+        _mm256_store_si256((__m256i *)&dst[i + 8], ints1);
+        _mm256_store_si256((__m256i *)&dst[i + 16], ints2);
+        _mm256_store_si256((__m256i *)&dst[i + 24], ints3);
+    })
+}
+
+#undef CONVERT_32_FWD
+#undef CONVERT_32_REV
+#endif
+
 #ifdef SDL_NEON_INTRINSICS
 
 // C99 requires that all code modifying floating point environment should
@@ -940,6 +1135,11 @@ void SDL_ChooseAudioConverters(void)
     SDL_Convert_Swap16 = SDL_Convert_Swap16_##fntype; \
     SDL_Convert_Swap32 = SDL_Convert_Swap32_##fntype;
 
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        SET_CONVERTER_FUNCS(AVX2);
+    } else
+#endif
 #ifdef SDL_SSE4_1_INTRINSICS
     if (SDL_HasSSE41()) {
         SET_CONVERTER_FUNCS(SSSE3);
@@ -982,5 +1182,15 @@ void SDL_ChooseAudioConverters(void)
 
 #undef SET_CONVERTER_FUNCS
 
+    // The 8-bit converters are bound by the byte unpacking, so only the wider formats have AVX2 versions.
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        SDL_Convert_S16_to_F32 = SDL_Convert_S16_to_F32_AVX2;
+        SDL_Convert_S32_to_F32 = SDL_Convert_S32_to_F32_AVX2;
+        SDL_Convert_F32_to_S16 = SDL_Convert_F32_to_S16_AVX2;
+        SDL_Convert_F32_to_S32 = SDL_Convert_F32_to_S32_AVX2;
+    }
+#endif
+
     converters_chosen = true;
 }
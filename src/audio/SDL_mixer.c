@@ -82,8 +82,528 @@ static const Uint8 mix8[] = {
 #define ADJUST_VOLUME(type, s, v) ((s) = (type)(((s) * (v)) / MIX_MAXVOLUME))
 #define ADJUST_VOLUME_U8(s, v)    ((s) = (Uint8)(((((s) - 128) * (v)) / MIX_MAXVOLUME) + 128))
 
-// !!! FIXME: This needs some SIMD magic.
-// !!! FIXME: Add fast-path for volume = 1
+/* SIMD versions of the mixers below. These only handle native byte order, and
+ * the integer ones only volumes in (0, MIX_MAXVOLUME], where the scaled sample
+ * always fits back in its own type; everything else stays on the scalar path.
+ * The integer kernels divide by MIX_MAXVOLUME rounding toward zero, so they
+ * give exactly the same results as the scalar code. Each kernel returns the
+ * number of samples it mixed; the scalar code finishes the rest.
+ */
+
+#ifdef SDL_SSE2_INTRINSICS
+static int SDL_TARGETING("sse2") SDL_Mix_8bit_SSE2(Uint8 *dst, const Uint8 *src, int num_samples, int volume, Uint8 flip)
+{
+    const __m128i flipper = _mm_set1_epi8((char)flip);
+    const __m128i vol = _mm_set1_epi16((Sint16)volume);
+    int i;
+
+    for (i = 0; i + 16 <= num_samples; i += 16) {
+        __m128i s = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&src[i]), flipper);
+        const __m128i d = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&dst[i]), flipper);
+
+        if (volume != MIX_MAXVOLUME) {
+            __m128i s0 = _mm_mullo_epi16(_mm_srai_epi16(_mm_unpacklo_epi8(s, s), 8), vol);
+            __m128i s1 = _mm_mullo_epi16(_mm_srai_epi16(_mm_unpackhi_epi8(s, s), 8), vol);
+            s0 = _mm_srai_epi16(_mm_add_epi16(s0, _mm_srli_epi16(_mm_srai_epi16(s0, 15), 9)), 7);
+            s1 = _mm_srai_epi16(_mm_add_epi16(s1, _mm_srli_epi16(_mm_srai_epi16(s1, 15), 9)), 7);
+            s = _mm_packs_epi16(s0, s1);
+        }
+
+        _mm_storeu_si128((__m128i *)&dst[i], _mm_xor_si128(_mm_adds_epi8(s, d), flipper));
+    }
+
+    return i;
+}
+
+static int SDL_TARGETING("sse2") SDL_Mix_U8_SSE2(Uint8 *dst, const Uint8 *src, int num_samples, int volume)
+{
+    return SDL_Mix_8bit_SSE2(dst, src, num_samples, volume, 0x80);
+}
+
+static int SDL_TARGETING("sse2") SDL_Mix_S8_SSE2(Uint8 *dst, const Uint8 *src, int num_samples, int volume)
+{
+    return SDL_Mix_8bit_SSE2(dst, src, num_samples, volume, 0x00);
+}
+
+static int SDL_TARGETING("sse2") SDL_Mix_S16_SSE2(Sint16 *dst, const Sint16 *src, int num_samples, int volume)
+{
+    const __m128i vol = _mm_set1_epi16((Sint16)volume);
+    int i;
+
+    for (i = 0; i + 8 <= num_samples; i += 8) {
+        __m128i s = _mm_loadu_si128((const __m128i *)&src[i]);
+        const __m128i d = _mm_loadu_si128((const __m128i *)&dst[i]);
+
+        if (volume != MIX_MAXVOLUME) {
+            const __m128i lo = _mm_mullo_epi16(s, vol);
+            const __m128i hi = _mm_mulhi_epi16(s, vol);
+            __m128i p0 = _mm_unpacklo_epi16(lo, hi);
+            __m128i p1 = _mm_unpackhi_epi16(lo, hi);
+            p0 = _mm_srai_epi32(_mm_add_epi32(p0, _mm_srli_epi32(_mm_srai_epi32(p0, 31), 25)), 7);
+            p1 = _mm_srai_epi32(_mm_add_epi32(p1, _mm_srli_epi32(_mm_srai_epi32(p1, 31), 25)), 7);
+            s = _mm_packs_epi32(p0, p1);
+        }
+
+        _mm_storeu_si128((__m128i *)&dst[i], _mm_adds_epi16(s, d));
+    }
+
+    return i;
+}
+
+static int SDL_TARGETING("sse2") SDL_Mix_F32_SSE2(float *dst, const float *src, int num_samples, float volume)
+{
+    const __m128 vol = _mm_set1_ps(volume);
+    const __m128 max_audioval = _mm_set1_ps(1.0f);
+    const __m128 min_audioval = _mm_set1_ps(-1.0f);
+    int i;
+
+    for (i = 0; i + 8 <= num_samples; i += 8) {
+        __m128 s0 = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&src[i]), vol), _mm_loadu_ps(&dst[i]));
+        __m128 s1 = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&src[i + 4]), vol), _mm_loadu_ps(&dst[i + 4]));
+        s0 = _mm_min_ps(_mm_max_ps(s0, min_audioval), max_audioval);
+        s1 = _mm_min_ps(_mm_max_ps(s1, min_audioval), max_audioval);
+        _mm_storeu_ps(&dst[i], s0);
+        _mm_storeu_ps(&dst[i + 4], s1);
+    }
+
+    return i;
+}
+
+static int SDL_TARGETING("sse2") SDL_Mix_F32_Ramp_SSE2(float *dst, const float *src, int num_samples, int channels, float start_gain, float step)
+{
+    // After `channels` vectors, every lane is exactly 4 sample frames further along.
+    const __m128 start = _mm_set1_ps(start_gain);
+    const __m128 delta = _mm_set1_ps(step);
+    const __m128i advance = _mm_set1_epi32(4);
+    const __m128 max_audioval = _mm_set1_ps(1.0f);
+    const __m128 min_audioval = _mm_set1_ps(-1.0f);
+    __m128i frames[8];
+    int i, j;
+
+    if (channels > (int)SDL_arraysize(frames)) {
+        return 0;
+    }
+
+    for (j = 0; j < channels; j++) {
+        frames[j] = _mm_setr_epi32((j * 4 + 0) / channels, (j * 4 + 1) / channels, (j * 4 + 2) / channels, (j * 4 + 3) / channels);
+    }
+
+    for (i = 0; i + (channels * 4) <= num_samples;) {
+        for (j = 0; j < channels; j++, i += 4) {
+            const __m128 gain = _mm_add_ps(start, _mm_mul_ps(delta, _mm_cvtepi32_ps(frames[j])));
+            __m128 s = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&src[i]), gain), _mm_loadu_ps(&dst[i]));
+            s = _mm_min_ps(_mm_max_ps(s, min_audioval), max_audioval);
+            _mm_storeu_ps(&dst[i], s);
+            frames[j] = _mm_add_epi32(frames[j], advance);
+        }
+    }
+
+    return i;
+}
+#endif
+
+#ifdef SDL_SSE4_1_INTRINSICS
+static int SDL_TARGETING("sse4.1") SDL_Mix_S32_SSE4_1(Sint32 *dst, const Sint32 *src, int num_samples, int volume)
+{
+    const __m128i vol = _mm_set1_epi32(volume);
+    const __m128i lo_mask = _mm_set_epi32(0, -1, 0, -1);
+    const __m128i max_audioval = _mm_set1_epi32(SDL_MAX_SINT32);
+    int i;
+
+    for (i = 0; i + 4 <= num_samples; i += 4) {
+        __m128i s = _mm_loadu_si128((const __m128i *)&src[i]);
+        const __m128i d = _mm_loadu_si128((const __m128i *)&dst[i]);
+
+        if (volume != MIX_MAXVOLUME) {
+            // 64-bit products; the low 32 bits of a logical shift are the same as an arithmetic one.
+            const __m128i bias = _mm_srli_epi32(_mm_srai_epi32(s, 31), 25);
+            __m128i even = _mm_mul_epi32(s, vol);
+            __m128i odd = _mm_mul_epi32(_mm_srli_epi64(s, 32), vol);
+            even = _mm_srli_epi64(_mm_add_epi64(even, _mm_and_si128(bias, lo_mask)), 7);
+            odd = _mm_srli_epi64(_mm_add_epi64(odd, _mm_srli_epi64(bias, 32)), 7);
+            s = _mm_or_si128(_mm_and_si128(even, lo_mask), _mm_slli_epi64(odd, 32));
+        }
+
+        const __m128i sum = _mm_add_epi32(s, d);
+        const __m128i overflow = _mm_and_si128(_mm_xor_si128(sum, s), _mm_xor_si128(sum, d));
+        const __m128i saturated = _mm_xor_si128(_mm_srai_epi32(s, 31), max_audioval);
+        _mm_storeu_si128((__m128i *)&dst[i], _mm_blendv_epi8(sum, saturated, _mm_srai_epi32(overflow, 31)));
+    }
+
+    return i;
+}
+#endif
+
+#ifdef SDL_AVX2_INTRINSICS
+static int SDL_TARGETING("avx2") SDL_Mix_8bit_AVX2(Uint8 *dst, const Uint8 *src, int num_samples, int volume, Uint8 flip)
+{
+    const __m256i flipper = _mm256_set1_epi8((char)flip);
+    const __m256i vol = _mm256_set1_epi16((Sint16)volume);
+    int i;
+
+    for (i = 0; i + 32 <= num_samples; i += 32) {
+        __m256i s = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)&src[i]), flipper);
+        const __m256i d = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)&dst[i]), flipper);
+
+        if (volume != MIX_MAXVOLUME) {
+            // unpack and pack both work within 128-bit lanes, so the order comes back out the same.
+            __m256i s0 = _mm256_mullo_epi16(_mm256_srai_epi16(_mm256_unpacklo_epi8(s, s), 8), vol);
+            __m256i s1 = _mm256_mullo_epi16(_mm256_srai_epi16(_mm256_unpackhi_epi8(s, s), 8), vol);
+            s0 = _mm256_srai_epi16(_mm256_add_epi16(s0, _mm256_srli_epi16(_mm256_srai_epi16(s0, 15), 9)), 7);
+            s1 = _mm256_srai_epi16(_mm256_add_epi16(s1, _mm256_srli_epi16(_mm256_srai_epi16(s1, 15), 9)), 7);
+            s = _mm256_packs_epi16(s0, s1);
+        }
+
+        _mm256_storeu_si256((__m256i *)&dst[i], _mm256_xor_si256(_mm256_adds_epi8(s, d), flipper));
+    }
+
+    return i;
+}
+
+static int SDL_TARGETING("avx2") SDL_Mix_U8_AVX2(Uint8 *dst, const Uint8 *src, int num_samples, int volume)
+{
+    return SDL_Mix_8bit_AVX2(dst, src, num_samples, volume, 0x80);
+}
+
+static int SDL_TARGETING("avx2") SDL_Mix_S8_AVX2(Uint8 *dst, const Uint8 *src, int num_samples, int volume)
+{
+    return SDL_Mix_8bit_AVX2(dst, src, num_samples, volume, 0x00);
+}
+
+static int SDL_TARGETING("avx2") SDL_Mix_S16_AVX2(Sint16 *dst, const Sint16 *src, int num_samples, int volume)
+{
+    const __m256i vol = _mm256_set1_epi16((Sint16)volume);
+    int i;
+
+    for (i = 0; i + 16 <= num_samples; i += 16) {
+        __m256i s = _mm256_loadu_si256((const __m256i *)&src[i]);
+        const __m256i d = _mm256_loadu_si256((const __m256i *)&dst[i]);
+
+        if (volume != MIX_MAXVOLUME) {
+            const __m256i lo = _mm256_mullo_epi16(s, vol);
+            const __m256i hi = _mm256_mulhi_epi16(s, vol);
+            __m256i p0 = _mm256_unpacklo_epi16(lo, hi);
+            __m256i p1 = _mm256_unpackhi_epi16(lo, hi);
+            p0 = _mm256_srai_epi32(_mm256_add_epi32(p0, _mm256_srli_epi32(_mm256_srai_epi32(p0, 31), 25)), 7);
+            p1 = _mm256_srai_epi32(_mm256_add_epi32(p1, _mm256_srli_epi32(_mm256_srai_epi32(p1, 31), 25)), 7);
+            s = _mm256_packs_epi32(p0, p1);
+        }
+
+        _mm256_storeu_si256((__m256i *)&dst[i], _mm256_adds_epi16(s, d));
+    }
+
+    return i;
+}
+
+static int SDL_TARGETING("avx2") SDL_Mix_S32_AVX2(Sint32 *dst, const Sint32 *src, int num_samples, int volume)
+{
+    const __m256i vol = _mm256_set1_epi32(volume);
+    const __m256i lo_mask = _mm256_set1_epi64x(0xFFFFFFFF);
+    const __m256i max_audioval = _mm256_set1_epi32(SDL_MAX_SINT32);
+    int i;
+
+    for (i = 0; i + 8 <= num_samples; i += 8) {
+        __m256i s = _mm256_loadu_si256((const __m256i *)&src[i]);
+        const __m256i d = _mm256_loadu_si256((const __m256i *)&dst[i]);
+
+        if (volume != MIX_MAXVOLUME) {
+            const __m256i bias = _mm256_srli_epi32(_mm256_srai_epi32(s, 31), 25);
+            __m256i even = _mm256_mul_epi32(s, vol);
+            __m256i odd = _mm256_mul_epi32(_mm256_srli_epi64(s, 32), vol);
+            even = _mm256_srli_epi64(_mm256_add_epi64(even, _mm256_and_si256(bias, lo_mask)), 7);
+            odd = _mm256_srli_epi64(_mm256_add_epi64(odd, _mm256_srli_epi64(bias, 32)), 7);
+            s = _mm256_or_si256(_mm256_and_si256(even, lo_mask), _mm256_slli_epi64(odd, 32));
+        }
+
+        const __m256i sum = _mm256_add_epi32(s, d);
+        const __m256i overflow = _mm256_and_si256(_mm256_xor_si256(sum, s), _mm256_xor_si256(sum, d));
+        const __m256i saturated = _mm256_xor_si256(_mm256_srai_epi32(s, 31), max_audioval);
+        _mm256_storeu_si256((__m256i *)&dst[i], _mm256_blendv_epi8(sum, saturated, _mm256_srai_epi32(overflow, 31)));
+    }
+
+    return i;
+}
+
+static int SDL_TARGETING("avx2") SDL_Mix_F32_AVX2(float *dst, const float *src, int num_samples, float volume)
+{
+    const __m256 vol = _mm256_set1_ps(volume);
+    const __m256 max_audioval = _mm256_set1_ps(1.0f);
+    const __m256 min_audioval = _mm256_set1_ps(-1.0f);
+    int i;
+
+    for (i = 0; i + 16 <= num_samples; i += 16) {
+        __m256 s0 = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[i]), vol), _mm256_loadu_ps(&dst[i]));
+        __m256 s1 = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[i + 8]), vol), _mm256_loadu_ps(&dst[i + 8]));
+        s0 = _mm256_min_ps(_mm256_max_ps(s0, min_audioval), max_audioval);
+        s1 = _mm256_min_ps(_mm256_max_ps(s1, min_audioval), max_audioval);
+        _mm256_storeu_ps(&dst[i], s0);
+        _mm256_storeu_ps(&dst[i + 8], s1);
+    }
+
+    return i;
+}
+
+static int SDL_TARGETING("avx2") SDL_Mix_F32_Ramp_AVX2(float *dst, const float *src, int num_samples, int channels, float start_gain, float step)
+{
+    // After `channels` vectors, every lane is exactly 8 sample frames further along.
+    const __m256 start = _mm256_set1_ps(start_gain);
+    const __m256 delta = _mm256_set1_ps(step);
+    const __m256i advance = _mm256_set1_epi32(8);
+    const __m256 max_audioval = _mm256_set1_ps(1.0f);
+    const __m256 min_audioval = _mm256_set1_ps(-1.0f);
+    __m256i frames[8];
+    int i, j;
+
+    if (channels > (int)SDL_arraysize(frames)) {
+        return 0;
+    }
+
+    for (j = 0; j < channels; j++) {
+        frames[j] = _mm256_setr_epi32((j * 8 + 0) / channels, (j * 8 + 1) / channels, (j * 8 + 2) / channels, (j * 8 + 3) / channels,
+                                      (j * 8 + 4) / channels, (j * 8 + 5) / channels, (j * 8 + 6) / channels, (j * 8 + 7) / channels);
+    }
+
+    for (i = 0; i + (channels * 8) <= num_samples;) {
+        for (j = 0; j < channels; j++, i += 8) {
+            const __m256 gain = _mm256_add_ps(start, _mm256_mul_ps(delta, _mm256_cvtepi32_ps(frames[j])));
+            __m256 s = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[i]), gain), _mm256_loadu_ps(&dst[i]));
+            s = _mm256_min_ps(_mm256_max_ps(s, min_audioval), max_audioval);
+            _mm256_storeu_ps(&dst[i], s);
+            frames[j] = _mm256_add_epi32(frames[j], advance);
+        }
+    }
+
+    return i;
+}
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+static int SDL_Mix_8bit_NEON(Uint8 *dst, const Uint8 *src, int num_samples, int volume, Uint8 flip)
+{
+    const uint8x16_t flipper = vdupq_n_u8(flip);
+    int i;
+
+    for (i = 0; i + 16 <= num_samples; i += 16) {
+        int8x16_t s = vreinterpretq_s8_u8(veorq_u8(vld1q_u8(&src[i]), flipper));
+        const int8x16_t d = vreinterpretq_s8_u8(veorq_u8(vld1q_u8(&dst[i]), flipper));
+
+        if (volume != MIX_MAXVOLUME) {
+            const int8x8_t vol = vdup_n_s8((int8_t)volume);  // MIX_MAXVOLUME doesn't fit, but that one skips this.
+            int16x8_t s0 = vmull_s8(vget_low_s8(s), vol);
+            int16x8_t s1 = vmull_s8(vget_high_s8(s), vol);
+            s0 = vshrq_n_s16(vaddq_s16(s0, vreinterpretq_s16_u16(vshrq_n_u16(vreinterpretq_u16_s16(vshrq_n_s16(s0, 15)), 9))), 7);
+            s1 = vshrq_n_s16(vaddq_s16(s1, vreinterpretq_s16_u16(vshrq_n_u16(vreinterpretq_u16_s16(vshrq_n_s16(s1, 15)), 9))), 7);
+            s = vcombine_s8(vmovn_s16(s0), vmovn_s16(s1));
+        }
+
+        vst1q_u8(&dst[i], veorq_u8(vreinterpretq_u8_s8(vqaddq_s8(s, d)), flipper));
+    }
+
+    return i;
+}
+
+static int SDL_Mix_U8_NEON(Uint8 *dst, const Uint8 *src, int num_samples, int volume)
+{
+    return SDL_Mix_8bit_NEON(dst, src, num_samples, volume, 0x80);
+}
+
+static int SDL_Mix_S8_NEON(Uint8 *dst, const Uint8 *src, int num_samples, int volume)
+{
+    return SDL_Mix_8bit_NEON(dst, src, num_samples, volume, 0x00);
+}
+
+static int SDL_Mix_S16_NEON(Sint16 *dst, const Sint16 *src, int num_samples, int volume)
+{
+    const int16x4_t vol = vdup_n_s16((int16_t)volume);
+    int i;
+
+    for (i = 0; i + 8 <= num_samples; i += 8) {
+        int16x8_t s = vld1q_s16(&src[i]);
+        const int16x8_t d = vld1q_s16(&dst[i]);
+
+        if (volume != MIX_MAXVOLUME) {
+            int32x4_t p0 = vmull_s16(vget_low_s16(s), vol);
+            int32x4_t p1 = vmull_s16(vget_high_s16(s), vol);
+            p0 = vshrq_n_s32(vaddq_s32(p0, vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(vshrq_n_s32(p0, 31)), 25))), 7);
+            p1 = vshrq_n_s32(vaddq_s32(p1, vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(vshrq_n_s32(p1, 31)), 25))), 7);
+            s = vcombine_s16(vmovn_s32(p0), vmovn_s32(p1));
+        }
+
+        vst1q_s16(&dst[i], vqaddq_s16(s, d));
+    }
+
+    return i;
+}
+
+static int SDL_Mix_S32_NEON(Sint32 *dst, const Sint32 *src, int num_samples, int volume)
+{
+    const int32x2_t vol = vdup_n_s32(volume);
+    int i;
+
+    for (i = 0; i + 4 <= num_samples; i += 4) {
+        int32x4_t s = vld1q_s32(&src[i]);
+        const int32x4_t d = vld1q_s32(&dst[i]);
+
+        if (volume != MIX_MAXVOLUME) {
+            int64x2_t p0 = vmull_s32(vget_low_s32(s), vol);
+            int64x2_t p1 = vmull_s32(vget_high_s32(s), vol);
+            p0 = vshrq_n_s64(vaddq_s64(p0, vreinterpretq_s64_u64(vshrq_n_u64(vreinterpretq_u64_s64(vshrq_n_s64(p0, 63)), 57))), 7);
+            p1 = vshrq_n_s64(vaddq_s64(p1, vreinterpretq_s64_u64(vshrq_n_u64(vreinterpretq_u64_s64(vshrq_n_s64(p1, 63)), 57))), 7);
+            s = vcombine_s32(vmovn_s64(p0), vmovn_s64(p1));
+        }
+
+        vst1q_s32(&dst[i], vqaddq_s32(s, d));
+    }
+
+    return i;
+}
+
+static int SDL_Mix_F32_NEON(float *dst, const float *src, int num_samples, float volume)
+{
+    const float32x4_t vol = vdupq_n_f32(volume);
+    const float32x4_t max_audioval = vdupq_n_f32(1.0f);
+    const float32x4_t min_audioval = vdupq_n_f32(-1.0f);
+    int i;
+
+    for (i = 0; i + 8 <= num_samples; i += 8) {
+        float32x4_t s0 = vaddq_f32(vmulq_f32(vld1q_f32(&src[i]), vol), vld1q_f32(&dst[i]));
+        float32x4_t s1 = vaddq_f32(vmulq_f32(vld1q_f32(&src[i + 4]), vol), vld1q_f32(&dst[i + 4]));
+        s0 = vminq_f32(vmaxq_f32(s0, min_audioval), max_audioval);
+        s1 = vminq_f32(vmaxq_f32(s1, min_audioval), max_audioval);
+        vst1q_f32(&dst[i], s0);
+        vst1q_f32(&dst[i + 4], s1);
+    }
+
+    return i;
+}
+
+static int SDL_Mix_F32_Ramp_NEON(float *dst, const float *src, int num_samples, int channels, float start_gain, float step)
+{
+    // After `channels` vectors, every lane is exactly 4 sample frames further along.
+    const float32x4_t start = vdupq_n_f32(start_gain);
+    const float32x4_t delta = vdupq_n_f32(step);
+    const int32x4_t advance = vdupq_n_s32(4);
+    const float32x4_t max_audioval = vdupq_n_f32(1.0f);
+    const float32x4_t min_audioval = vdupq_n_f32(-1.0f);
+    int32x4_t frames[8];
+    int i, j;
+
+    if (channels > (int)SDL_arraysize(frames)) {
+        return 0;
+    }
+
+    for (j = 0; j < channels; j++) {
+        const int32_t lanes[4] = { (j * 4 + 0) / channels, (j * 4 + 1) / channels, (j * 4 + 2) / channels, (j * 4 + 3) / channels };
+        frames[j] = vld1q_s32(lanes);
+    }
+
+    for (i = 0; i + (channels * 4) <= num_samples;) {
+        for (j = 0; j < channels; j++, i += 4) {
+            const float32x4_t gain = vaddq_f32(start, vmulq_f32(delta, vcvtq_f32_s32(frames[j])));
+            float32x4_t s = vaddq_f32(vmulq_f32(vld1q_f32(&src[i]), gain), vld1q_f32(&dst[i]));
+            s = vminq_f32(vmaxq_f32(s, min_audioval), max_audioval);
+            vst1q_f32(&dst[i], s);
+            frames[j] = vaddq_s32(frames[j], advance);
+        }
+    }
+
+    return i;
+}
+#endif
+
+static int (*SDL_Mix_U8)(Uint8 *dst, const Uint8 *src, int num_samples, int volume) = NULL;
+static int (*SDL_Mix_S8)(Uint8 *dst, const Uint8 *src, int num_samples, int volume) = NULL;
+static int (*SDL_Mix_S16)(Sint16 *dst, const Sint16 *src, int num_samples, int volume) = NULL;
+static int (*SDL_Mix_S32)(Sint32 *dst, const Sint32 *src, int num_samples, int volume) = NULL;
+static int (*SDL_Mix_F32)(float *dst, const float *src, int num_samples, float volume) = NULL;
+static int (*SDL_Mix_F32_Ramp)(float *dst, const float *src, int num_samples, int channels, float start_gain, float step) = NULL;
+
+static void SDL_ChooseAudioMixers(void)
+{
+    static bool mixers_chosen = false;
+    if (mixers_chosen) {
+        return;
+    }
+
+#define SET_MIXER_FUNCS(fntype) \
+    SDL_Mix_U8 = SDL_Mix_U8_##fntype; \
+    SDL_Mix_S8 = SDL_Mix_S8_##fntype; \
+    SDL_Mix_S16 = SDL_Mix_S16_##fntype; \
+    SDL_Mix_F32 = SDL_Mix_F32_##fntype; \
+    SDL_Mix_F32_Ramp = SDL_Mix_F32_Ramp_##fntype;
+
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        SET_MIXER_FUNCS(AVX2);
+        SDL_Mix_S32 = SDL_Mix_S32_AVX2;
+    } else
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        SET_MIXER_FUNCS(SSE2);
+#ifdef SDL_SSE4_1_INTRINSICS
+        if (SDL_HasSSE41()) {
+            SDL_Mix_S32 = SDL_Mix_S32_SSE4_1;
+        }
+#endif
+    } else
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        SET_MIXER_FUNCS(NEON);
+        SDL_Mix_S32 = SDL_Mix_S32_NEON;
+    } else
+#endif
+    {
+        // no SIMD, everything uses the scalar code.
+    }
+
+#undef SET_MIXER_FUNCS
+
+    mixers_chosen = true;
+}
+
+// Returns the number of bytes mixed, if any, so the scalar code can finish the rest.
+static Uint32 MixAudioSIMD(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format, Uint32 len, int volume, float fvolume)
+{
+    const int num_samples = (int)SDL_min(len / SDL_AUDIO_BYTESIZE(format), (Uint32)SDL_MAX_SINT32);
+    const bool integer_volume_ok = (volume > 0) && (volume <= MIX_MAXVOLUME);
+
+    SDL_ChooseAudioMixers();
+
+    switch (format) {
+    case SDL_AUDIO_U8:
+        if (SDL_Mix_U8 && integer_volume_ok) {
+            return (Uint32)SDL_Mix_U8(dst, src, num_samples, volume);
+        }
+        break;
+    case SDL_AUDIO_S8:
+        if (SDL_Mix_S8 && integer_volume_ok) {
+            return (Uint32)SDL_Mix_S8(dst, src, num_samples, volume);
+        }
+        break;
+    case SDL_AUDIO_S16:
+        if (SDL_Mix_S16 && integer_volume_ok) {
+            return (Uint32)SDL_Mix_S16((Sint16 *)dst, (const Sint16 *)src, num_samples, volume) * 2;
+        }
+        break;
+    case SDL_AUDIO_S32:
+        if (SDL_Mix_S32 && integer_volume_ok) {
+            return (Uint32)SDL_Mix_S32((Sint32 *)dst, (const Sint32 *)src, num_samples, volume) * 4;
+        }
+        break;
+    case SDL_AUDIO_F32:
+        if (SDL_Mix_F32) {
+            return (Uint32)SDL_Mix_F32((float *)dst, (const float *)src, num_samples, fvolume) * 4;
+        }
+        break;
+    default:
+        break;
+    }
+
+    return 0;
+}
+
 // !!! FIXME: Use larger scales for 16-bit/32-bit integers
 
 bool SDL_MixAudio(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format, Uint32 len, float fvolume)
@@ -94,6 +614,11 @@ bool SDL_MixAudio(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format, Uint32 l
         return true;
     }
 
+    const Uint32 mixed = MixAudioSIMD(dst, src, format, len, volume, fvolume);
+    dst += mixed;
+    src += mixed;
+    len -= mixed;
+
     switch (format) {
 
     case SDL_AUDIO_U8:
@@ -288,3 +813,46 @@ bool SDL_MixAudio(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format, Uint32 l
 
     return true;
 }
+
+static void MixFloat32AudioRamp_Scalar(float *dst, const float *src, int first, int num_samples, int channels, float start_gain, float step)
+{
+    int i;
+
+    for (i = first; i < num_samples; i++) {
+        const float gain = start_gain + step * (float)(i / channels);
+        float dst_sample = src[i] * gain + dst[i];
+        if (dst_sample > 1.0f) {
+            dst_sample = 1.0f;
+        } else if (dst_sample < -1.0f) {
+            dst_sample = -1.0f;
+        }
+        dst[i] = dst_sample;
+    }
+}
+
+void SDL_MixFloat32AudioRamp(float *dst, const float *src, int num_frames, int channels, float start_gain, float end_gain)
+{
+    const int num_samples = num_frames * channels;
+    const float step = (num_frames > 0) ? ((end_gain - start_gain) / (float)num_frames) : 0.0f;
+    int i = 0;
+
+    SDL_ChooseAudioMixers();
+
+    if (SDL_Mix_F32_Ramp) {
+        i = SDL_Mix_F32_Ramp(dst, src, num_samples, channels, start_gain, step);
+    }
+    MixFloat32AudioRamp_Scalar(dst, src, i, num_samples, channels, start_gain, step);
+}
+
+void SDL_ApplyFloat32AudioRamp(float *buf, int num_frames, int channels, float start_gain, float end_gain)
+{
+    const float step = (num_frames > 0) ? ((end_gain - start_gain) / (float)num_frames) : 0.0f;
+    int i, j;
+
+    for (i = 0; i < num_frames; i++) {
+        const float gain = start_gain + step * (float)i;
+        for (j = 0; j < channels; j++) {
+            *(buf++) *= gain;
+        }
+    }
+}
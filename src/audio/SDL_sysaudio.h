@@ -142,6 +142,17 @@ extern void OnAudioStreamDestroy(SDL_AudioStream *stream);
 // This just lets audio playback apply logical device gain at the same time as audiostream gain, so it's one multiplication instead of thousands.
 extern int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int len, float extra_gain);
 
+/* This is what audio playback uses to pull from bound streams. If the total gain changed since the last call, and gain_ramp isn't NULL, the
+   data comes back with no gain applied at all, and gain_ramp[0] and gain_ramp[1] are set to the gain to ramp from and to while mixing it, to
+   avoid zipper noise. Otherwise the gain is applied as usual and both are set to 1.0f. */
+extern int SDL_GetAudioStreamDataForMixing(SDL_AudioStream *stream, void *voidbuf, int len, float extra_gain, float *gain_ramp);
+
+// Mix native-endian float32 audio, with the gain moving linearly from start_gain toward end_gain over the buffer's sample frames.
+extern void SDL_MixFloat32AudioRamp(float *dst, const float *src, int num_frames, int channels, float start_gain, float end_gain);
+
+// Same thing, but just scales a buffer in place, without mixing or clamping.
+extern void SDL_ApplyFloat32AudioRamp(float *buf, int num_frames, int channels, float start_gain, float end_gain);
+
 // This is the bulk of `SDL_SetAudioStream*putChannelMap`'s work, but it lets you skip the check about changing the device end of a stream if isinput==-1.
 extern bool SetAudioStreamChannelMap(SDL_AudioStream *stream, const SDL_AudioSpec *spec, int **stream_chmap, const int *chmap, int channels, int isinput);
 
@@ -217,17 +228,30 @@ struct SDL_AudioStream
     int *dst_chmap;
     float freq_ratio;
     float gain;
+    float mix_gain;  // total gain last used when a bound device mixed this stream, or negative if there isn't one yet.
 
     struct SDL_AudioQueue *queue;
+    Uint32 queue_props_version;  // the version of `props` the queue's memory pool settings were last applied from.
+    bool queue_config_pending;  // true if a new chunk size is waiting for the queue to empty.
+    Uint64 queue_stats[3];  // the queue statistics last published in `props`.
+
+    SDL_AtomicInt single_producer;  // nonzero if puts can go straight to the queue's staging list, without the lock. Caches SDL_PROP_AUDIOSTREAM_SINGLE_PRODUCER_BOOLEAN.
+    SDL_AudioSpec staging_spec;  // the format of the data in the queue's staging list.
+    int *staging_chmap;
+    int staging_chmap_storage[SDL_MAX_CHANNELMAP_CHANNELS];
 
     SDL_AudioSpec input_spec; // The spec of input data currently being processed
     int *input_chmap;
     int input_chmap_storage[SDL_MAX_CHANNELMAP_CHANNELS];  // !!! FIXME: this needs to grow if SDL ever supports more channels. But if it grows, we should probably be more clever about allocations.
     Sint64 resample_offset;
+    struct SDL_AudioResampler *resampler;  // created the first time the stream needs to resample.
 
     Uint8 *work_buffer;    // used for scratch space during data conversion/resampling.
     size_t work_buffer_allocation;
 
+    Uint8 *planar_buffer;  // deinterleaved output of SDL_GetAudioStreamPlanarPointers, and scratch space for SDL_GetAudioStreamPlanarData.
+    size_t planar_buffer_allocation;
+
     bool simplified;  // true if created via SDL_OpenAudioDeviceStream
 
     SDL_LogicalAudioDevice *bound_device;
@@ -345,6 +369,9 @@ struct SDL_AudioDevice
     // A thread to feed the audio device
     SDL_Thread *thread;
 
+    // Optional worker threads that pull from bound streams in parallel (see SDL_HINT_AUDIO_DEVICE_MIX_THREADS).
+    struct SDL_AudioMixPool *mix_pool;
+
     // true if this physical device is currently opened by the backend.
     bool currently_opened;
 
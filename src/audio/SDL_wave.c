@@ -496,7 +496,7 @@ static Sint16 MS_ADPCM_ProcessNibble(MS_ADPCM_ChannelState *cstate, Sint32 sampl
     const Sint32 max_audioval = 32767;
     const Sint32 min_audioval = -32768;
     const Uint16 max_deltaval = 65535;
-    const Uint16 adaptive[] = {
+    static const Uint16 adaptive[] = {
         230, 230, 230, 230, 307, 409, 512, 614,
         768, 614, 512, 409, 307, 230, 230, 230
     };
@@ -634,6 +634,154 @@ static bool MS_ADPCM_DecodeBlockData(ADPCM_DecoderState *state)
     return true;
 }
 
+/* Files with at least this much ADPCM data are decoded with multiple threads,
+ * unless SDL_HINT_WAVE_DECODE_THREADS says otherwise. Below that, starting
+ * the threads costs more than it saves.
+ */
+#define ADPCM_PARALLEL_THRESHOLD (256 * 1024)
+#define ADPCM_MAX_DECODE_THREADS 16
+
+typedef bool (*ADPCM_DecodeBlockFunc)(ADPCM_DecoderState *state);
+
+typedef struct ADPCM_DecodeTask
+{
+    ADPCM_DecoderState state;
+    ADPCM_DecodeBlockFunc decodeheader;
+    ADPCM_DecodeBlockFunc decodedata;
+    size_t firstblock;
+    size_t numblocks;
+    SDL_Thread *thread;
+    bool result;
+} ADPCM_DecodeTask;
+
+static int ADPCM_GetDecodeThreads(const WaveFile *file, size_t datalength, size_t numblocks)
+{
+    int threads = file->decodethreads;
+
+    if (threads <= 0) {
+        if (datalength < ADPCM_PARALLEL_THRESHOLD) {
+            return 1;
+        }
+        threads = SDL_GetNumLogicalCPUCores();
+    }
+    threads = SDL_min(threads, ADPCM_MAX_DECODE_THREADS);
+    if ((size_t)threads > numblocks) {
+        threads = (int)numblocks;
+    }
+    return SDL_max(threads, 1);
+}
+
+/* Decodes a run of complete blocks. The blocks don't depend on each other, so
+ * each task has its own channel state and writes to its own part of the output.
+ */
+static bool ADPCM_DecodeBlockRange(ADPCM_DecodeTask *task)
+{
+    ADPCM_DecoderState *state = &task->state;
+    size_t i;
+
+    state->input.pos = task->firstblock * state->blocksize;
+    state->output.pos = task->firstblock * state->samplesperblock * state->channels;
+
+    for (i = 0; i < task->numblocks; i++) {
+        state->block.data = state->input.data + state->input.pos;
+        state->block.size = state->blocksize;
+        state->block.pos = 0;
+        state->framesleft = state->samplesperblock;
+
+        if (!task->decodeheader(state) || !task->decodedata(state)) {
+            return false;
+        }
+
+        state->input.pos += state->blocksize;
+    }
+
+    return true;
+}
+
+static int SDLCALL ADPCM_DecodeThread(void *data)
+{
+    ADPCM_DecodeTask *task = (ADPCM_DecodeTask *)data;
+    task->result = ADPCM_DecodeBlockRange(task);
+    return 0;
+}
+
+/* Decodes the leading blocks that have all their bytes and frames on multiple
+ * threads and advances the state past them. Whatever is left, like a
+ * truncated last block, goes through the serial loop of the caller. If this
+ * returns false, nothing was decoded and the caller decodes everything itself,
+ * which is also how errors get reported exactly like the serial decoder does.
+ */
+static bool ADPCM_DecodeParallel(const WaveFile *file, ADPCM_DecoderState *state, size_t cstatesize, ADPCM_DecodeBlockFunc decodeheader, ADPCM_DecodeBlockFunc decodedata)
+{
+    ADPCM_DecodeTask tasks[ADPCM_MAX_DECODE_THREADS];
+    Uint8 *cstates;
+    size_t numblocks, blocksleft, firstblock;
+    bool result = true;
+    int numthreads, i;
+
+    if (state->samplesperblock == 0 || state->blocksize == 0) {
+        return false;
+    }
+
+    numblocks = state->input.size / state->blocksize;
+    if ((Uint64)numblocks > (Uint64)(state->framestotal / state->samplesperblock)) {
+        numblocks = (size_t)(state->framestotal / state->samplesperblock);
+    }
+
+    numthreads = ADPCM_GetDecodeThreads(file, state->input.size, numblocks);
+    if (numthreads <= 1) {
+        return false;
+    }
+
+    cstates = (Uint8 *)SDL_calloc(numthreads, cstatesize);
+    if (!cstates) {
+        return false;
+    }
+
+    firstblock = 0;
+    blocksleft = numblocks;
+    for (i = 0; i < numthreads; i++) {
+        ADPCM_DecodeTask *task = &tasks[i];
+        SDL_copyp(&task->state, state);
+        task->state.cstate = cstates + i * cstatesize;
+        task->decodeheader = decodeheader;
+        task->decodedata = decodedata;
+        task->firstblock = firstblock;
+        task->numblocks = blocksleft / (numthreads - i);
+        task->thread = NULL;
+        task->result = false;
+        firstblock += task->numblocks;
+        blocksleft -= task->numblocks;
+    }
+
+    // The calling thread takes the first range, the others go to new threads.
+    for (i = 1; i < numthreads; i++) {
+        tasks[i].thread = SDL_CreateThread(ADPCM_DecodeThread, "SDLWaveDecode", &tasks[i]);
+    }
+    tasks[0].result = ADPCM_DecodeBlockRange(&tasks[0]);
+    for (i = 1; i < numthreads; i++) {
+        if (tasks[i].thread) {
+            SDL_WaitThread(tasks[i].thread, NULL);
+        } else {
+            tasks[i].result = ADPCM_DecodeBlockRange(&tasks[i]);
+        }
+        result = result && tasks[i].result;
+    }
+    result = result && tasks[0].result;
+
+    SDL_free(cstates);
+
+    if (!result) {
+        return false;
+    }
+
+    state->input.pos = numblocks * state->blocksize;
+    state->output.pos = numblocks * state->samplesperblock * state->channels;
+    state->framesleft = state->framestotal - (Sint64)numblocks * state->samplesperblock;
+
+    return true;
+}
+
 static bool MS_ADPCM_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 {
     bool result;
@@ -689,6 +837,9 @@ static bool MS_ADPCM_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len
 
     state.cstate = cstate;
 
+    // Large files get most of their blocks decoded in parallel first.
+    ADPCM_DecodeParallel(file, &state, sizeof(cstate), MS_ADPCM_DecodeBlockHeader, MS_ADPCM_DecodeBlockData);
+
     // Decode block by block. A truncated block will stop the decoding.
     bytesleft = state.input.size - state.input.pos;
     while (state.framesleft > 0 && bytesleft >= state.blockheadersize) {
@@ -855,13 +1006,13 @@ static Sint16 IMA_ADPCM_ProcessNibble(Sint8 *cindex, Sint16 lastsample, Uint8 ny
 {
     const Sint32 max_audioval = 32767;
     const Sint32 min_audioval = -32768;
-    const Sint8 index_table_4b[16] = {
+    static const Sint8 index_table_4b[16] = {
         -1, -1, -1, -1,
         2, 4, 6, 8,
         -1, -1, -1, -1,
         2, 4, 6, 8
     };
-    const Uint16 step_table[89] = {
+    static const Uint16 step_table[89] = {
         7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
         34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130,
         143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408,
@@ -1085,6 +1236,9 @@ static bool IMA_ADPCM_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_le
     }
     state.cstate = cstate;
 
+    // Large files get most of their blocks decoded in parallel first.
+    ADPCM_DecodeParallel(file, &state, state.channels * sizeof(Sint8), IMA_ADPCM_DecodeBlockHeader, IMA_ADPCM_DecodeBlockData);
+
     // Decode block by block. A truncated block will stop the decoding.
     bytesleft = state.input.size - state.input.pos;
     while (state.framesleft > 0 && bytesleft >= state.blockheadersize) {
@@ -1159,7 +1313,10 @@ static bool LAW_Init(WaveFile *file, size_t datalength)
     return true;
 }
 
-static bool LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+/* Expands sample_count companded samples to 16-bit samples. This works
+ * backwards, so src and dst may start at the same address.
+ */
+static bool LAW_ExpandSamples(Uint16 encoding, Sint16 *dst, const Uint8 *src, size_t sample_count)
 {
 #ifdef SDL_WAVE_LAW_LUT
     const Sint16 alaw_lut[256] = {
@@ -1200,53 +1357,9 @@ static bool LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
     };
 #endif
 
-    WaveFormat *format = &file->format;
-    WaveChunk *chunk = &file->chunk;
-    size_t i, sample_count, expanded_len;
-    Uint8 *src;
-    Sint16 *dst;
-
-    if (chunk->length != chunk->size) {
-        file->sampleframes = WaveAdjustToFactValue(file, chunk->size / format->blockalign);
-        if (file->sampleframes < 0) {
-            return false;
-        }
-    }
-
-    // Nothing to decode, nothing to return.
-    if (file->sampleframes == 0) {
-        *audio_buf = NULL;
-        *audio_len = 0;
-        return true;
-    }
-
-    sample_count = (size_t)file->sampleframes;
-    if (SafeMult(&sample_count, format->channels)) {
-        return SDL_SetError("WAVE file too big");
-    }
-
-    expanded_len = sample_count;
-    if (SafeMult(&expanded_len, sizeof(Sint16))) {
-        return SDL_SetError("WAVE file too big");
-    } else if (expanded_len > SDL_MAX_UINT32 || file->sampleframes > SIZE_MAX) {
-        return SDL_SetError("WAVE file too big");
-    }
-
-    // 1 to avoid allocating zero bytes, to keep static analysis happy.
-    src = (Uint8 *)SDL_realloc(chunk->data, expanded_len ? expanded_len : 1);
-    if (!src) {
-        return false;
-    }
-    chunk->data = NULL;
-    chunk->size = 0;
-
-    dst = (Sint16 *)src;
+    size_t i = sample_count;
 
-    /* Work backwards, since we're expanding in-place. `format` will
-     * inform the caller about the byte order.
-     */
-    i = sample_count;
-    switch (file->format.encoding) {
+    switch (encoding) {
 #ifdef SDL_WAVE_LAW_LUT
     case ALAW_CODE:
         while (i--) {
@@ -1291,10 +1404,62 @@ static bool LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
         break;
 #endif
     default:
-        SDL_free(src);
         return SDL_SetError("Unknown companded encoding");
     }
 
+    return true;
+}
+
+static bool LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+    size_t sample_count, expanded_len;
+    Uint8 *src;
+    Sint16 *dst;
+
+    if (chunk->length != chunk->size) {
+        file->sampleframes = WaveAdjustToFactValue(file, chunk->size / format->blockalign);
+        if (file->sampleframes < 0) {
+            return false;
+        }
+    }
+
+    // Nothing to decode, nothing to return.
+    if (file->sampleframes == 0) {
+        *audio_buf = NULL;
+        *audio_len = 0;
+        return true;
+    }
+
+    sample_count = (size_t)file->sampleframes;
+    if (SafeMult(&sample_count, format->channels)) {
+        return SDL_SetError("WAVE file too big");
+    }
+
+    expanded_len = sample_count;
+    if (SafeMult(&expanded_len, sizeof(Sint16))) {
+        return SDL_SetError("WAVE file too big");
+    } else if (expanded_len > SDL_MAX_UINT32 || file->sampleframes > SIZE_MAX) {
+        return SDL_SetError("WAVE file too big");
+    }
+
+    // 1 to avoid allocating zero bytes, to keep static analysis happy.
+    src = (Uint8 *)SDL_realloc(chunk->data, expanded_len ? expanded_len : 1);
+    if (!src) {
+        return false;
+    }
+    chunk->data = NULL;
+    chunk->size = 0;
+
+    dst = (Sint16 *)src;
+
+    // Expand in-place. `format` will inform the caller about the byte order.
+    if (!LAW_ExpandSamples(file->format.encoding, dst, src, sample_count)) {
+        SDL_free(src);
+        return false;
+    }
+
     *audio_buf = src;
     *audio_len = (Uint32)expanded_len;
 
@@ -1344,11 +1509,32 @@ static bool PCM_Init(WaveFile *file, size_t datalength)
     return true;
 }
 
+// Shifts sample_count 24-bit samples to 32 bits, working from end to start to expand in-place.
+static void PCM_ExpandSint24ToSint32(Uint8 *ptr, size_t sample_count)
+{
+    size_t i;
+
+    for (i = sample_count; i > 0; i--) {
+        const size_t o = i - 1;
+        uint8_t b[4];
+
+        b[0] = 0;
+        b[1] = ptr[o * 3];
+        b[2] = ptr[o * 3 + 1];
+        b[3] = ptr[o * 3 + 2];
+
+        ptr[o * 4 + 0] = b[0];
+        ptr[o * 4 + 1] = b[1];
+        ptr[o * 4 + 2] = b[2];
+        ptr[o * 4 + 3] = b[3];
+    }
+}
+
 static bool PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 {
     WaveFormat *format = &file->format;
     WaveChunk *chunk = &file->chunk;
-    size_t i, expanded_len, sample_count;
+    size_t expanded_len, sample_count;
     Uint8 *ptr;
 
     sample_count = (size_t)file->sampleframes;
@@ -1376,21 +1562,7 @@ static bool PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32
     *audio_buf = ptr;
     *audio_len = (Uint32)expanded_len;
 
-    // work from end to start, since we're expanding in-place.
-    for (i = sample_count; i > 0; i--) {
-        const size_t o = i - 1;
-        uint8_t b[4];
-
-        b[0] = 0;
-        b[1] = ptr[o * 3];
-        b[2] = ptr[o * 3 + 1];
-        b[3] = ptr[o * 3 + 2];
-
-        ptr[o * 4 + 0] = b[0];
-        ptr[o * 4 + 1] = b[1];
-        ptr[o * 4 + 2] = b[2];
-        ptr[o * 4 + 3] = b[3];
-    }
+    PCM_ExpandSint24ToSint32(ptr, sample_count);
 
     return true;
 }
@@ -1475,6 +1647,20 @@ static WaveTruncationHint WaveGetTruncationHint(void)
     return TruncNoHint;
 }
 
+static int WaveGetDecodeThreadsHint(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_WAVE_DECODE_THREADS);
+
+    if (hint) {
+        const int threads = SDL_atoi(hint);
+        if (threads > 0) {
+            return threads;
+        }
+    }
+
+    return 0;
+}
+
 static WaveFactChunkHint WaveGetFactChunkHint(void)
 {
     const char *hint = SDL_GetHint(SDL_HINT_WAVE_FACT_CHUNK);
@@ -1770,7 +1956,11 @@ static bool WaveCheckFormat(WaveFile *file, size_t datalength)
     return true;
 }
 
-static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+/* Reads the chunk headers and the fmt chunk, and sets up the spec and the
+ * decoder. On return, file->chunk describes the data chunk, which has not
+ * been read yet. endposition is set to the position just past the WAVE data.
+ */
+static bool WaveParse(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Sint64 *endposition)
 {
     int result;
     Uint32 chunkcount = 0;
@@ -1990,9 +2180,63 @@ static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uin
 
     WaveFreeChunkData(chunk);
 
-    // Process data chunk.
+    /* Setting up the specs. All unsupported formats were filtered out
+     * by checks earlier in this function.
+     */
+    spec->freq = format->frequency;
+    spec->channels = (Uint8)format->channels;
+    spec->format = SDL_AUDIO_UNKNOWN;
+
+    switch (format->encoding) {
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+    case ALAW_CODE:
+    case MULAW_CODE:
+        // These can be easily stored in the byte order of the system.
+        spec->format = SDL_AUDIO_S16;
+        break;
+    case IEEE_FLOAT_CODE:
+        spec->format = SDL_AUDIO_F32LE;
+        break;
+    case PCM_CODE:
+        switch (format->bitspersample) {
+        case 8:
+            spec->format = SDL_AUDIO_U8;
+            break;
+        case 16:
+            spec->format = SDL_AUDIO_S16LE;
+            break;
+        case 24: // Has been shifted to 32 bits.
+        case 32:
+            spec->format = SDL_AUDIO_S32LE;
+            break;
+        default:
+            // Just in case something unexpected happened in the checks.
+            return SDL_SetError("Unexpected %u-bit PCM data format", (unsigned int)format->bitspersample);
+        }
+        break;
+    default:
+        return SDL_SetError("Unexpected data format");
+    }
+
     *chunk = datachunk;
+    *endposition = RIFFlengthknown ? RIFFend : lastchunkpos;
+
+    return true;
+}
+
+static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    int result;
+    Sint64 endposition;
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+
+    if (!WaveParse(src, file, spec, &endposition)) {
+        return false;
+    }
 
+    // Process data chunk.
     if (chunk->length > 0) {
         result = WaveReadChunkData(src, chunk);
         if (result < 0) {
@@ -2036,51 +2280,8 @@ static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uin
         break;
     }
 
-    /* Setting up the specs. All unsupported formats were filtered out
-     * by checks earlier in this function.
-     */
-    spec->freq = format->frequency;
-    spec->channels = (Uint8)format->channels;
-    spec->format = SDL_AUDIO_UNKNOWN;
-
-    switch (format->encoding) {
-    case MS_ADPCM_CODE:
-    case IMA_ADPCM_CODE:
-    case ALAW_CODE:
-    case MULAW_CODE:
-        // These can be easily stored in the byte order of the system.
-        spec->format = SDL_AUDIO_S16;
-        break;
-    case IEEE_FLOAT_CODE:
-        spec->format = SDL_AUDIO_F32LE;
-        break;
-    case PCM_CODE:
-        switch (format->bitspersample) {
-        case 8:
-            spec->format = SDL_AUDIO_U8;
-            break;
-        case 16:
-            spec->format = SDL_AUDIO_S16LE;
-            break;
-        case 24: // Has been shifted to 32 bits.
-        case 32:
-            spec->format = SDL_AUDIO_S32LE;
-            break;
-        default:
-            // Just in case something unexpected happened in the checks.
-            return SDL_SetError("Unexpected %u-bit PCM data format", (unsigned int)format->bitspersample);
-        }
-        break;
-    default:
-        return SDL_SetError("Unexpected data format");
-    }
-
     // Report the end position back to the cleanup code.
-    if (RIFFlengthknown) {
-        chunk->position = RIFFend;
-    } else {
-        chunk->position = lastchunkpos;
-    }
+    chunk->position = endposition;
 
     return true;
 }
@@ -2122,6 +2323,7 @@ bool SDL_LoadWAV_IO(SDL_IOStream *src, bool closeio, SDL_AudioSpec *spec, Uint8
     file.riffhint = WaveGetRiffSizeHint();
     file.trunchint = WaveGetTruncationHint();
     file.facthint = WaveGetFactChunkHint();
+    file.decodethreads = WaveGetDecodeThreadsHint();
 
     result = WaveLoad(src, &file, spec, audio_buf, audio_len);
     if (!result) {
@@ -2161,3 +2363,397 @@ bool SDL_LoadWAV(const char *path, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint3
     return SDL_LoadWAV_IO(stream, true, spec, audio_buf, audio_len);
 }
 
+
+// Streaming WAVE reader. This shares the parsing and block decoders with SDL_LoadWAV_IO.
+
+struct SDL_WAVReader
+{
+    SDL_IOStream *src;
+    bool closeio;
+    WaveFile file;           // file.chunk describes the data chunk.
+    SDL_AudioSpec spec;
+    size_t framesize;        // Size of a decoded sample frame in bytes.
+    Sint64 frame;            // Next sample frame to be read.
+
+    // ADPCM only.
+    ADPCM_DecoderState state;
+    MS_ADPCM_ChannelState ms_cstate[2];
+    Sint8 *ima_cstate;
+    Uint8 *block;            // Raw data of the current block.
+    Sint16 *decoded;         // Decoded sample frames of the current block.
+    Sint64 decodedblock;     // Index of the block in `decoded`, or -1 if none.
+    Sint64 decodedframes;    // Number of sample frames in `decoded`.
+};
+
+static bool WaveReaderIsADPCM(const SDL_WAVReader *reader)
+{
+    const Uint16 encoding = reader->file.format.encoding;
+    return (encoding == MS_ADPCM_CODE) || (encoding == IMA_ADPCM_CODE);
+}
+
+static bool WaveReaderInitADPCM(SDL_WAVReader *reader)
+{
+    WaveFile *file = &reader->file;
+    ADPCM_DecoderState *state = &reader->state;
+    size_t decodedsize;
+
+    state->channels = file->format.channels;
+    state->blocksize = file->format.blockalign;
+    state->samplesperblock = file->format.samplesperblock;
+    state->framesize = state->channels * sizeof(Sint16);
+    state->framestotal = file->sampleframes;
+    state->ddata = file->decoderdata;
+
+    if (file->format.encoding == MS_ADPCM_CODE) {
+        state->blockheadersize = (size_t)state->channels * 7;
+        state->cstate = reader->ms_cstate;
+    } else {
+        state->blockheadersize = (size_t)state->channels * 4;
+        reader->ima_cstate = (Sint8 *)SDL_calloc(state->channels, sizeof(Sint8));
+        if (!reader->ima_cstate) {
+            return false;
+        }
+        state->cstate = reader->ima_cstate;
+    }
+
+    decodedsize = state->samplesperblock;
+    if (SafeMult(&decodedsize, state->framesize)) {
+        return SDL_SetError("WAVE file too big");
+    }
+
+    reader->block = (Uint8 *)SDL_malloc(state->blocksize);
+    reader->decoded = (Sint16 *)SDL_malloc(decodedsize);
+    if (!reader->block || !reader->decoded) {
+        return false;
+    }
+    reader->decodedblock = -1;
+
+    return true;
+}
+
+/* Reads and decodes a single ADPCM block into reader->decoded. A truncated
+ * block is handled the same way as in MS_ADPCM_Decode and IMA_ADPCM_Decode.
+ */
+static bool WaveReaderDecodeBlock(SDL_WAVReader *reader, Sint64 blockindex)
+{
+    WaveFile *file = &reader->file;
+    ADPCM_DecoderState *state = &reader->state;
+    const Uint64 blockoffset = (Uint64)blockindex * state->blocksize;
+    const Sint64 firstframe = blockindex * (Sint64)state->samplesperblock;
+    size_t blocksize = state->blocksize;
+    bool result;
+
+    reader->decodedblock = blockindex;
+    reader->decodedframes = 0;
+
+    if (blockoffset >= file->chunk.length || firstframe >= file->sampleframes) {
+        return true;  // Past the end of the data.
+    } else if (file->chunk.length - blockoffset < blocksize) {
+        blocksize = (size_t)(file->chunk.length - blockoffset);
+    }
+
+    if (SDL_SeekIO(reader->src, file->chunk.position + (Sint64)blockoffset, SDL_IO_SEEK_SET) != file->chunk.position + (Sint64)blockoffset) {
+        return SDL_SetError("Could not seek data of WAVE data chunk");
+    }
+
+    state->block.data = reader->block;
+    state->block.size = SDL_ReadIO(reader->src, reader->block, blocksize);
+    state->block.pos = 0;
+    if (state->block.size < state->blockheadersize) {
+        if (file->trunchint == TruncVeryStrict || file->trunchint == TruncStrict) {
+            return SDL_SetError("Truncated data chunk");
+        }
+        return true;  // Not even a header, nothing to decode.
+    }
+
+    state->output.data = reader->decoded;
+    state->output.size = state->samplesperblock * state->channels;
+    state->output.pos = 0;
+    state->framesleft = SDL_min((Sint64)state->samplesperblock, file->sampleframes - firstframe);
+
+    if (file->format.encoding == MS_ADPCM_CODE) {
+        if (!MS_ADPCM_DecodeBlockHeader(state)) {
+            return false;
+        }
+        result = MS_ADPCM_DecodeBlockData(state);
+    } else {
+        result = IMA_ADPCM_DecodeBlockHeader(state) && IMA_ADPCM_DecodeBlockData(state);
+    }
+
+    if (!result) {
+        // Unexpected end. Only keep the partial block if the hint asks for it.
+        if (file->trunchint == TruncVeryStrict || file->trunchint == TruncStrict) {
+            return SDL_SetError("Truncated data chunk");
+        } else if (file->trunchint != TruncDropFrame) {
+            state->output.pos = 0;
+        }
+    }
+
+    reader->decodedframes = SDL_min((Sint64)(state->output.pos / state->channels), file->sampleframes - firstframe);
+
+    return true;
+}
+
+static int WaveReaderReadADPCM(SDL_WAVReader *reader, Uint8 *buf, int num_frames)
+{
+    const Sint64 samplesperblock = (Sint64)reader->state.samplesperblock;
+    int total = 0;
+
+    while (total < num_frames) {
+        const Sint64 blockindex = reader->frame / samplesperblock;
+        const Sint64 blockframe = reader->frame % samplesperblock;
+        Sint64 frames;
+
+        if (reader->decodedblock != blockindex && !WaveReaderDecodeBlock(reader, blockindex)) {
+            return total ? total : -1;
+        }
+
+        if (blockframe >= reader->decodedframes) {
+            break;  // End of the data.
+        }
+
+        frames = SDL_min(reader->decodedframes - blockframe, (Sint64)(num_frames - total));
+        SDL_memcpy(buf + (size_t)total * reader->framesize, reader->decoded + (size_t)blockframe * reader->state.channels, (size_t)frames * reader->framesize);
+        total += (int)frames;
+        reader->frame += frames;
+
+        if (reader->decodedframes < samplesperblock) {
+            break;  // The last block was short, there's nothing after it.
+        }
+    }
+
+    return total;
+}
+
+static int WaveReaderReadPCM(SDL_WAVReader *reader, Uint8 *buf, int num_frames)
+{
+    WaveFile *file = &reader->file;
+    const size_t blockalign = file->format.blockalign;
+    const Sint64 position = file->chunk.position + reader->frame * (Sint64)blockalign;
+    size_t length = (size_t)num_frames * blockalign;
+    size_t samplecount;
+    int frames;
+
+    if (SDL_SeekIO(reader->src, position, SDL_IO_SEEK_SET) != position) {
+        SDL_SetError("Could not seek data of WAVE data chunk");
+        return -1;
+    }
+
+    /* The data is read into the start of the buffer and then expanded in
+     * place, the same way PCM_Decode and LAW_Decode do it.
+     */
+    length = SDL_ReadIO(reader->src, buf, length);
+    frames = (int)(length / blockalign);
+    if (frames < num_frames && (file->trunchint == TruncVeryStrict || file->trunchint == TruncStrict)) {
+        SDL_SetError("Could not read data of WAVE data chunk");
+        return -1;
+    }
+
+    // Only expand what was actually read, the rest of the buffer is uninitialized
+    samplecount = (size_t)frames * file->format.channels;
+    switch (file->format.encoding) {
+    case ALAW_CODE:
+    case MULAW_CODE:
+        if (!LAW_ExpandSamples(file->format.encoding, (Sint16 *)buf, buf, samplecount)) {
+            return -1;
+        }
+        break;
+    case PCM_CODE:
+        if (file->format.bitspersample == 24) {
+            PCM_ExpandSint24ToSint32(buf, samplecount);
+        }
+        break;
+    default:
+        break;
+    }
+
+    reader->frame += frames;
+
+    return frames;
+}
+
+SDL_WAVReader *SDL_OpenWAVReader_IO(SDL_IOStream *src, bool closeio, SDL_AudioSpec *spec)
+{
+    SDL_WAVReader *reader = NULL;
+    Sint64 endposition;
+
+    if (spec) {
+        SDL_zerop(spec);
+    }
+
+    CHECK_PARAM(!src) {
+        SDL_InvalidParamError("src");
+        goto failed;
+    }
+
+    reader = (SDL_WAVReader *)SDL_calloc(1, sizeof(*reader));
+    if (!reader) {
+        goto failed;
+    }
+    reader->src = src;
+    reader->closeio = closeio;
+    reader->file.riffhint = WaveGetRiffSizeHint();
+    reader->file.trunchint = WaveGetTruncationHint();
+    reader->file.facthint = WaveGetFactChunkHint();
+
+    if (!WaveParse(src, &reader->file, &reader->spec, &endposition)) {
+        goto failed;
+    }
+
+    reader->framesize = SDL_AUDIO_FRAMESIZE(reader->spec);
+
+    if (WaveReaderIsADPCM(reader)) {
+        if (!WaveReaderInitADPCM(reader)) {
+            goto failed;
+        }
+    } else {
+        // The decoded frames have to fit in the buffer the encoded ones are read into.
+        const size_t blockalign = reader->file.format.blockalign;
+        const size_t samplesize = blockalign / reader->file.format.channels;
+        if (blockalign % reader->file.format.channels || samplesize * 8 != reader->file.format.bitspersample) {
+            SDL_SetError("Unsupported block alignment");
+            goto failed;
+        }
+    }
+
+    if (spec) {
+        SDL_copyp(spec, &reader->spec);
+    }
+
+    return reader;
+
+failed:
+    if (reader) {
+        reader->closeio = false;  // the caller's closeio is handled below.
+        SDL_CloseWAVReader(reader);
+    }
+    if (closeio && src) {
+        SDL_CloseIO(src);
+    }
+    return NULL;
+}
+
+SDL_WAVReader *SDL_OpenWAVReader(const char *path, SDL_AudioSpec *spec)
+{
+    SDL_IOStream *stream = SDL_IOFromFile(path, "rb");
+    if (!stream) {
+        if (spec) {
+            SDL_zerop(spec);
+        }
+        return NULL;
+    }
+    return SDL_OpenWAVReader_IO(stream, true, spec);
+}
+
+Sint64 SDL_GetWAVReaderFrames(SDL_WAVReader *reader)
+{
+    CHECK_PARAM(!reader) {
+        SDL_InvalidParamError("reader");
+        return -1;
+    }
+
+    return reader->file.sampleframes;
+}
+
+int SDL_ReadWAVFrames(SDL_WAVReader *reader, void *buf, int num_frames)
+{
+    CHECK_PARAM(!reader) {
+        SDL_InvalidParamError("reader");
+        return -1;
+    }
+    CHECK_PARAM(!buf) {
+        SDL_InvalidParamError("buf");
+        return -1;
+    }
+    CHECK_PARAM(num_frames < 0) {
+        SDL_InvalidParamError("num_frames");
+        return -1;
+    }
+
+    num_frames = (int)SDL_min((Sint64)num_frames, reader->file.sampleframes - reader->frame);
+    if (num_frames <= 0) {
+        return 0;
+    }
+
+    if (WaveReaderIsADPCM(reader)) {
+        return WaveReaderReadADPCM(reader, (Uint8 *)buf, num_frames);
+    }
+    return WaveReaderReadPCM(reader, (Uint8 *)buf, num_frames);
+}
+
+int SDL_ReadWAVFramesToAudioStream(SDL_WAVReader *reader, SDL_AudioStream *stream, int num_frames)
+{
+    Uint8 buf[4096];
+    int total = 0;
+
+    CHECK_PARAM(!reader) {
+        SDL_InvalidParamError("reader");
+        return -1;
+    }
+    CHECK_PARAM(!stream) {
+        SDL_InvalidParamError("stream");
+        return -1;
+    }
+    CHECK_PARAM(num_frames < 0) {
+        SDL_InvalidParamError("num_frames");
+        return -1;
+    }
+
+    // The stream copies the data, so decode a piece at a time through a small buffer.
+    const int buffer_frames = (int)(sizeof(buf) / reader->framesize);
+
+    while (total < num_frames) {
+        const int frames = SDL_ReadWAVFrames(reader, buf, SDL_min(buffer_frames, num_frames - total));
+        if (frames < 0) {
+            return total ? total : -1;
+        } else if (frames == 0) {
+            break;
+        } else if (!SDL_PutAudioStreamData(stream, buf, frames * (int)reader->framesize)) {
+            return total ? total : -1;
+        }
+        total += frames;
+    }
+
+    return total;
+}
+
+bool SDL_SeekWAVReader(SDL_WAVReader *reader, Sint64 frame)
+{
+    CHECK_PARAM(!reader) {
+        return SDL_InvalidParamError("reader");
+    }
+    CHECK_PARAM(frame < 0) {
+        return SDL_InvalidParamError("frame");
+    }
+
+    // Nothing is read until the next SDL_ReadWAVFrames call.
+    reader->frame = SDL_min(frame, reader->file.sampleframes);
+    return true;
+}
+
+Sint64 SDL_TellWAVReader(SDL_WAVReader *reader)
+{
+    CHECK_PARAM(!reader) {
+        SDL_InvalidParamError("reader");
+        return -1;
+    }
+
+    return reader->frame;
+}
+
+void SDL_CloseWAVReader(SDL_WAVReader *reader)
+{
+    if (!reader) {
+        return;
+    }
+
+    if (reader->closeio) {
+        SDL_CloseIO(reader->src);
+    }
+    WaveFreeChunkData(&reader->file.chunk);
+    SDL_free(reader->file.decoderdata);
+    SDL_free(reader->ima_cstate);
+    SDL_free(reader->block);
+    SDL_free(reader->decoded);
+    SDL_free(reader);
+}
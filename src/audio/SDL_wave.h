@@ -148,4 +148,5 @@ typedef struct WaveFile
     WaveRiffSizeHint riffhint;
     WaveTruncationHint trunchint;
     WaveFactChunkHint facthint;
+    int decodethreads; // Number of threads for decoding ADPCM blocks, 0 picks it by size.
 } WaveFile;
@@ -29,7 +29,9 @@ struct SDL_PrivateAudioData
 {
     // The file descriptor for the audio device
     SDL_IOStream *io;
-    Uint32 io_delay;
+    Uint64 io_delay;      // nanoseconds between buffers, or zero to not wait at all.
+    Uint64 next_deadline; // when the next buffer is due, in SDL_GetTicksNS() time.
+    int missed_deadlines;
     Uint8 *mixbuf;
 };
 
@@ -31,7 +31,23 @@
 
 static bool DUMMYAUDIO_WaitDevice(SDL_AudioDevice *device)
 {
-    SDL_Delay(device->hidden->io_delay);
+    struct SDL_PrivateAudioData *h = device->hidden;
+    if (h->io_delay == 0) {
+        return true;  // run as fast as we can.
+    }
+
+    // Wait for an absolute deadline, so the time spent mixing doesn't stretch the period.
+    const Uint64 now = SDL_GetTicksNS();
+    if (h->next_deadline == 0) {
+        h->next_deadline = now;
+    }
+    h->next_deadline += h->io_delay;
+    if (h->next_deadline > now) {
+        SDL_DelayNS(h->next_deadline - now);
+    } else {
+        h->missed_deadlines++;
+        h->next_deadline = now;  // don't try to catch up with a burst of buffers.
+    }
     return true;
 }
 
@@ -49,13 +65,13 @@ static bool DUMMYAUDIO_OpenDevice(SDL_AudioDevice *device)
         }
     }
 
-    device->hidden->io_delay = ((device->sample_frames * 1000) / device->spec.freq);
+    device->hidden->io_delay = ((device->sample_frames * SDL_NS_PER_SECOND) / device->spec.freq);
 
     const char *hint = SDL_GetHint(SDL_HINT_AUDIO_DUMMY_TIMESCALE);
     if (hint) {
         double scale = SDL_atof(hint);
         if (scale >= 0.0) {
-            device->hidden->io_delay = (Uint32)SDL_round(device->hidden->io_delay * scale);
+            device->hidden->io_delay = (Uint64)SDL_round(device->hidden->io_delay * scale);
         }
     }
 
@@ -74,6 +90,9 @@ static bool DUMMYAUDIO_OpenDevice(SDL_AudioDevice *device)
 static void DUMMYAUDIO_CloseDevice(SDL_AudioDevice *device)
 {
     if (device->hidden) {
+        if (device->hidden->missed_deadlines > 0) {
+            SDL_LogDebug(SDL_LOG_CATEGORY_AUDIO, "dummy audio device missed %d of its deadlines", device->hidden->missed_deadlines);
+        }
         // on Emscripten without threads, we just fire a repeating timer to consume audio.
         #if defined(SDL_PLATFORM_EMSCRIPTEN) && !defined(__EMSCRIPTEN_PTHREADS__)
         MAIN_THREAD_EM_ASM({
@@ -28,7 +28,9 @@
 struct SDL_PrivateAudioData
 {
     Uint8 *mixbuf;   // The file descriptor for the audio device
-    Uint32 io_delay; // milliseconds to sleep in WaitDevice.
+    Uint64 io_delay;      // nanoseconds between buffers in WaitDevice, or zero to not wait at all.
+    Uint64 next_deadline; // when the next buffer is due, in SDL_GetTicksNS() time.
+    int missed_deadlines; // times we were already late for a buffer when WaitDevice was called.
 };
 
 #endif // SDL_dummyaudio_h_
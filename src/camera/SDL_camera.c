@@ -24,6 +24,7 @@
 #include "SDL_camera_c.h"
 #include "../video/SDL_pixels_c.h"
 #include "../video/SDL_surface_c.h"
+#include "../video/SDL_yuv_c.h"
 #include "../thread/SDL_systhread.h"
 
 
@@ -53,6 +54,9 @@ static const CameraBootStrap *const bootstrap[] = {
 #ifdef SDL_CAMERA_DRIVER_VITA
     &VITACAMERA_bootstrap,
 #endif
+#ifdef SDL_CAMERA_DRIVER_DISK
+    &DISKCAMERA_bootstrap,
+#endif
 #ifdef SDL_CAMERA_DRIVER_DUMMY
     &DUMMYCAMERA_bootstrap,
 #endif
@@ -230,6 +234,232 @@ static void ZombieReleaseFrame(SDL_Camera *device, SDL_Surface *frame) // Reclai
 }
 
 
+// Compressed frames (MJPG) can be decoded on worker threads, several at a time. Each frame that is being decoded
+//  holds one of the device's output surfaces, and finished frames are handed to the app in the order they were captured.
+
+#define DEFAULT_CAMERA_DECODE_THREADS 4
+#define MAX_CAMERA_DECODE_THREADS 16
+
+typedef struct CameraDecodeJob
+{
+    SurfaceList *slist;  // the output surface this frame is decoded into.
+    void *data;  // a copy of the compressed frame, so the driver gets its buffer back right away.
+    int datalen;
+    size_t allocated;
+    float rotation;
+    bool done;
+    struct CameraDecodeJob *next_queued;  // next frame waiting for a worker thread.
+    struct CameraDecodeJob *next_pending;  // next frame in capture order that hasn't gone to the app yet.
+} CameraDecodeJob;
+
+typedef struct CameraDecodePool
+{
+    SDL_Camera *device;
+    SDL_Mutex *lock;  // protects the queue and the quit flag. The pending list is protected by device->lock.
+    SDL_Condition *cond;
+    SDL_Thread **threads;
+    int num_threads;
+    int requested_threads;
+    bool quit;
+    CameraDecodeJob *jobs;  // one per output surface.
+    CameraDecodeJob *queue_head;
+    CameraDecodeJob *queue_tail;
+    CameraDecodeJob *pending_head;
+    CameraDecodeJob *pending_tail;
+} CameraDecodePool;
+
+static int GetCameraDecodeThreads(SDL_Camera *device)
+{
+    int threads = (int)SDL_GetNumberProperty(device->props, SDL_PROP_CAMERA_DECODE_THREADS_NUMBER, 0);
+    if (threads <= 0) {
+        threads = SDL_min(SDL_GetNumLogicalCPUCores(), DEFAULT_CAMERA_DECODE_THREADS);
+    }
+    return SDL_clamp(threads, 1, MAX_CAMERA_DECODE_THREADS);
+}
+
+// Must be called with device->lock held.
+static void PublishDecodedCameraFrames(SDL_Camera *device, CameraDecodePool *pool)
+{
+    while (pool->pending_head && pool->pending_head->done) {
+        CameraDecodeJob *job = pool->pending_head;
+        pool->pending_head = job->next_pending;
+        if (!pool->pending_head) {
+            pool->pending_tail = NULL;
+        }
+
+        SDL_SetFloatProperty(SDL_GetSurfaceProperties(job->slist->surface), SDL_PROP_SURFACE_ROTATION_FLOAT, job->rotation);
+
+        // make the filled output surface available to the app.
+        job->slist->next = device->filled_output_surfaces.next;
+        device->filled_output_surfaces.next = job->slist;
+    }
+}
+
+static int SDLCALL CameraDecodeThread(void *userdata)
+{
+    CameraDecodePool *pool = (CameraDecodePool *)userdata;
+    SDL_Camera *device = pool->device;
+
+    for (;;) {
+        SDL_LockMutex(pool->lock);
+        while (!pool->queue_head && !pool->quit) {
+            SDL_WaitCondition(pool->cond, pool->lock);
+        }
+        CameraDecodeJob *job = pool->queue_head;
+        if (!job) {  // told to quit, and nothing is left to decode.
+            SDL_UnlockMutex(pool->lock);
+            break;
+        }
+        pool->queue_head = job->next_queued;
+        if (!pool->queue_head) {
+            pool->queue_tail = NULL;
+        }
+        SDL_UnlockMutex(pool->lock);
+
+        SDL_Surface *output_surface = job->slist->surface;
+        SDL_ConvertPixels(output_surface->w, output_surface->h,
+                          device->acquire_surface->format, job->data, job->datalen,
+                          output_surface->format, output_surface->pixels, output_surface->pitch);
+
+        SDL_LockMutex(device->lock);
+        job->done = true;
+        PublishDecodedCameraFrames(device, pool);
+        SDL_UnlockMutex(device->lock);
+    }
+    return 0;
+}
+
+static void DestroyCameraDecodePool(CameraDecodePool *pool)
+{
+    if (pool->jobs) {
+        for (int i = 0; i < pool->device->num_output_surfaces; i++) {
+            SDL_free(pool->jobs[i].data);
+        }
+        SDL_free(pool->jobs);
+    }
+    SDL_free(pool->threads);
+    SDL_DestroyCondition(pool->cond);
+    SDL_DestroyMutex(pool->lock);
+    SDL_free(pool);
+}
+
+// Don't hold device->lock when calling this, the worker threads need it to finish their frames!
+static void StopCameraDecodeThreads(SDL_Camera *device)
+{
+    CameraDecodePool *pool = device->decode_pool;
+    if (!pool) {
+        return;
+    }
+
+    SDL_LockMutex(pool->lock);
+    pool->quit = true;
+    SDL_BroadcastCondition(pool->cond);
+    SDL_UnlockMutex(pool->lock);
+
+    // the threads finish everything that was queued before they exit, so every frame has gone to the app now.
+    for (int i = 0; i < pool->num_threads; i++) {
+        SDL_WaitThread(pool->threads[i], NULL);
+    }
+    SDL_assert(pool->pending_head == NULL);
+
+    device->decode_pool = NULL;
+    DestroyCameraDecodePool(pool);
+}
+
+static bool StartCameraDecodeThreads(SDL_Camera *device, int num_threads)
+{
+    CameraDecodePool *pool = (CameraDecodePool *)SDL_calloc(1, sizeof(*pool));
+    if (!pool) {
+        return false;
+    }
+
+    pool->device = device;
+    pool->requested_threads = num_threads;
+    pool->lock = SDL_CreateMutex();
+    pool->cond = SDL_CreateCondition();
+    pool->jobs = (CameraDecodeJob *)SDL_calloc(device->num_output_surfaces, sizeof(*pool->jobs));
+    pool->threads = (SDL_Thread **)SDL_calloc(num_threads, sizeof(*pool->threads));
+    if (!pool->lock || !pool->cond || !pool->jobs || !pool->threads) {
+        DestroyCameraDecodePool(pool);
+        return false;
+    }
+
+    for (int i = 0; i < num_threads; i++) {
+        pool->threads[i] = SDL_CreateThread(CameraDecodeThread, "SDLCameraDecode", pool);
+        if (!pool->threads[i]) {
+            break;
+        }
+        pool->num_threads++;
+    }
+
+    if (pool->num_threads == 0) {
+        DestroyCameraDecodePool(pool);
+        return false;
+    }
+
+    device->decode_pool = pool;
+    return true;
+}
+
+// Returns false if the frame should be decoded on the calling thread instead.
+static bool QueueCameraFrameForDecode(SDL_Camera *device, SurfaceList *slist, SDL_Surface *acquired, float rotation)
+{
+    const int num_threads = GetCameraDecodeThreads(device);
+
+    // if the thread count changed, let the current threads finish first, so frames still reach the app in order.
+    if (device->decode_pool && device->decode_pool->requested_threads != num_threads) {
+        StopCameraDecodeThreads(device);
+    }
+
+    if ((num_threads <= 1) || SDL_GetAtomicInt(&device->shutdown)) {
+        return false;
+    } else if (!device->decode_pool && !StartCameraDecodeThreads(device, num_threads)) {
+        return false;
+    }
+
+    CameraDecodePool *pool = device->decode_pool;
+    CameraDecodeJob *job = &pool->jobs[slist - device->output_surfaces];
+    const size_t datalen = (size_t)acquired->pitch;  // compressed frames use the pitch as the size of the data.
+    if (job->allocated < datalen) {
+        void *ptr = SDL_realloc(job->data, datalen);
+        if (!ptr) {
+            StopCameraDecodeThreads(device);  // we'll decode this one ourselves, after the ones that are already queued.
+            return false;
+        }
+        job->data = ptr;
+        job->allocated = datalen;
+    }
+    SDL_memcpy(job->data, acquired->pixels, datalen);
+    job->datalen = (int)datalen;
+    job->slist = slist;
+    job->rotation = rotation;
+    job->done = false;
+    job->next_queued = NULL;
+    job->next_pending = NULL;
+
+    SDL_LockMutex(device->lock);
+    if (pool->pending_tail) {
+        pool->pending_tail->next_pending = job;
+    } else {
+        pool->pending_head = job;
+    }
+    pool->pending_tail = job;
+    SDL_UnlockMutex(device->lock);
+
+    SDL_LockMutex(pool->lock);
+    if (pool->queue_tail) {
+        pool->queue_tail->next_queued = job;
+    } else {
+        pool->queue_head = job;
+    }
+    pool->queue_tail = job;
+    SDL_SignalCondition(pool->cond);
+    SDL_UnlockMutex(pool->lock);
+
+    return true;
+}
+
+
 static void ObtainPhysicalCameraObj(SDL_Camera *device);
 static void ReleaseCamera(SDL_Camera *device);
 
@@ -249,6 +479,9 @@ static void ClosePhysicalCamera(SDL_Camera *device)
         device->thread = NULL;
     }
 
+    // let any frames still being decoded finish before we tear down the surfaces they're decoding into.
+    StopCameraDecodeThreads(device);
+
     ObtainPhysicalCameraObj(device);
 
     // release frames that are queued up somewhere...
@@ -271,10 +504,13 @@ static void ClosePhysicalCamera(SDL_Camera *device)
     SDL_DestroySurface(device->conversion_surface);
     device->conversion_surface = NULL;
 
-    for (int i = 0; i < SDL_arraysize(device->output_surfaces); i++) {
-        SDL_DestroySurface(device->output_surfaces[i].surface);
+    if (device->output_surfaces) {
+        for (int i = 0; i < device->num_output_surfaces; i++) {
+            SDL_DestroySurface(device->output_surfaces[i].surface);
+        }
+        SDL_free(device->output_surfaces);
+        device->output_surfaces = NULL;
     }
-    SDL_zeroa(device->output_surfaces);
 
     SDL_aligned_free(device->zombie_pixels);
 
@@ -900,25 +1136,37 @@ bool SDL_CameraThreadIterate(SDL_Camera *device)
             output_surface->h = acquired->h;
             output_surface->pixels = acquired->pixels;
             output_surface->pitch = acquired->pitch;
+        } else if (device->parallel_decode && QueueCameraFrameForDecode(device, slist, acquired, rotation)) {
+            #if DEBUG_CAMERA
+            SDL_Log("CAMERA: Frame is getting decoded on a worker thread!");
+            #endif
+            // we made a copy, so we can give the driver back its resources. The worker thread queues the frame for the app.
+            device->ReleaseFrame(device, acquired);
+            slist = NULL;
         } else {  // convert/scale into a different surface.
             #if DEBUG_CAMERA
             SDL_Log("CAMERA: Frame is getting converted!");
             #endif
             SDL_Surface *srcsurf = acquired;
-            if (device->needs_scaling == -1) {  // downscaling? Do it first.  -1: downscale, 0: no scaling, 1: upscale
-                SDL_Surface *dstsurf = device->needs_conversion ? device->conversion_surface : output_surface;
-                SDL_StretchSurface(srcsurf, NULL, dstsurf, NULL, SDL_SCALEMODE_NEAREST);  // !!! FIXME: linear scale? letterboxing?
-                srcsurf = dstsurf;
-            }
-            if (device->needs_conversion) {
-                SDL_Surface *dstsurf = (device->needs_scaling == 1) ? device->conversion_surface : output_surface;
-                SDL_ConvertPixels(srcsurf->w, srcsurf->h,
-                                  srcsurf->format, srcsurf->pixels, srcsurf->pitch,
-                                  dstsurf->format, dstsurf->pixels, dstsurf->pitch);
-                srcsurf = dstsurf;
-            }
-            if (device->needs_scaling == 1) {  // upscaling? Do it last.  -1: downscale, 0: no scaling, 1: upscale
-                SDL_StretchSurface(srcsurf, NULL, output_surface, NULL, SDL_SCALEMODE_NEAREST);  // !!! FIXME: linear scale? letterboxing?
+            if (device->scale_and_convert) {  // YUV to YUV? Scale and convert in a single pass, no middleman surface.
+                SDL_StretchPixels_YUV(srcsurf->w, srcsurf->h, srcsurf->format, srcsurf->pixels, srcsurf->pitch,
+                                      output_surface->w, output_surface->h, output_surface->format, output_surface->pixels, output_surface->pitch);
+            } else {
+                if (device->needs_scaling == -1) {  // downscaling? Do it first.  -1: downscale, 0: no scaling, 1: upscale
+                    SDL_Surface *dstsurf = device->needs_conversion ? device->conversion_surface : output_surface;
+                    SDL_StretchSurface(srcsurf, NULL, dstsurf, NULL, SDL_SCALEMODE_NEAREST);  // !!! FIXME: linear scale? letterboxing?
+                    srcsurf = dstsurf;
+                }
+                if (device->needs_conversion) {
+                    SDL_Surface *dstsurf = (device->needs_scaling == 1) ? device->conversion_surface : output_surface;
+                    SDL_ConvertPixels(srcsurf->w, srcsurf->h,
+                                      srcsurf->format, srcsurf->pixels, srcsurf->pitch,
+                                      dstsurf->format, dstsurf->pixels, dstsurf->pitch);
+                    srcsurf = dstsurf;
+                }
+                if (device->needs_scaling == 1) {  // upscaling? Do it last.  -1: downscale, 0: no scaling, 1: upscale
+                    SDL_StretchSurface(srcsurf, NULL, output_surface, NULL, SDL_SCALEMODE_NEAREST);  // !!! FIXME: linear scale? letterboxing?
+                }
             }
 
             // we made a copy, so we can give the driver back its resources.
@@ -929,13 +1177,15 @@ bool SDL_CameraThreadIterate(SDL_Camera *device)
         acquired->pixels = NULL;
         acquired->pitch = 0;
 
-        SDL_SetFloatProperty(SDL_GetSurfaceProperties(output_surface), SDL_PROP_SURFACE_ROTATION_FLOAT, rotation);
+        if (slist) {
+            SDL_SetFloatProperty(SDL_GetSurfaceProperties(output_surface), SDL_PROP_SURFACE_ROTATION_FLOAT, rotation);
 
-        // make the filled output surface available to the app.
-        SDL_LockMutex(device->lock);
-        slist->next = device->filled_output_surfaces.next;
-        device->filled_output_surfaces.next = slist;
-        SDL_UnlockMutex(device->lock);
+            // make the filled output surface available to the app.
+            SDL_LockMutex(device->lock);
+            slist->next = device->filled_output_surfaces.next;
+            device->filled_output_surfaces.next = slist;
+            SDL_UnlockMutex(device->lock);
+        }
     }
 
     return true;  // always go on if not shutting down, even if device failed.
@@ -1017,14 +1267,20 @@ bool SDL_PrepareCameraSurfaces(SDL_Camera *device)
 
     device->needs_conversion = (devspec->format != appspec->format);
 
+    // nearest neighbor scaling between YUV formats can change the layout at the same time, like YUYV to a smaller NV12.
+    device->scale_and_convert = (device->needs_scaling && device->needs_conversion && SDL_CanStretchPixels_YUV(devspec->format, appspec->format));
+
+    // compressed frames that only need decoding can be decoded several at a time, see QueueCameraFrameForDecode().
+    device->parallel_decode = (devspec->format == SDL_PIXELFORMAT_MJPG && device->needs_conversion && !device->needs_scaling);
+
     device->acquire_surface = SDL_CreateSurfaceFrom(devspec->width, devspec->height, devspec->format, NULL, 0);
     if (!device->acquire_surface) {
         goto failed;
     }
     SDL_SetSurfaceColorspace(device->acquire_surface, devspec->colorspace);
 
-    // if we have to scale _and_ convert, we need a middleman surface, since we can't do both changes at once.
-    if (device->needs_scaling && device->needs_conversion) {
+    // if we have to scale _and_ convert, we need a middleman surface, unless we can do both changes at once.
+    if (device->needs_scaling && device->needs_conversion && !device->scale_and_convert) {
         const bool downscaling_first = (device->needs_scaling < 0);
         const SDL_CameraSpec *s = downscaling_first ? appspec : devspec;
         const SDL_PixelFormat fmt = downscaling_first ? devspec->format : appspec->format;
@@ -1039,12 +1295,17 @@ bool SDL_PrepareCameraSurfaces(SDL_Camera *device)
     // the backend fills into acquired_surface, and you can get all the way from DMA access in the camera hardware
     // to the app without a single copy. Otherwise, these will be full surfaces that hold converted/scaled copies.
 
-    for (int i = 0; i < (SDL_arraysize(device->output_surfaces) - 1); i++) {
+    device->output_surfaces = (SurfaceList *)SDL_calloc(device->num_output_surfaces, sizeof(*device->output_surfaces));
+    if (!device->output_surfaces) {
+        goto failed;
+    }
+
+    for (int i = 0; i < (device->num_output_surfaces - 1); i++) {
         device->output_surfaces[i].next = &device->output_surfaces[i + 1];
     }
     device->empty_output_surfaces.next = device->output_surfaces;
 
-    for (int i = 0; i < SDL_arraysize(device->output_surfaces); i++) {
+    for (int i = 0; i < device->num_output_surfaces; i++) {
         SDL_Surface *surf;
         if (device->needs_scaling || device->needs_conversion) {
             surf = SDL_CreateSurface(appspec->width, appspec->height, appspec->format);
@@ -1072,13 +1333,17 @@ failed:
         device->conversion_surface = NULL;
     }
 
-    for (int i = 0; i < SDL_arraysize(device->output_surfaces); i++) {
-        SDL_Surface *surf = device->output_surfaces[i].surface;
-        if (surf) {
-            SDL_DestroySurface(surf);
+    if (device->output_surfaces) {
+        for (int i = 0; i < device->num_output_surfaces; i++) {
+            SDL_Surface *surf = device->output_surfaces[i].surface;
+            if (surf) {
+                SDL_DestroySurface(surf);
+            }
         }
+        SDL_free(device->output_surfaces);
+        device->output_surfaces = NULL;
     }
-    SDL_zeroa(device->output_surfaces);
+    device->empty_output_surfaces.next = NULL;
 
     return false;
 }
@@ -1199,6 +1464,18 @@ static void ChooseBestCameraSpec(SDL_Camera *device, const SDL_CameraSpec *spec,
     SDL_assert(closest->format != SDL_PIXELFORMAT_UNKNOWN);
 }
 
+static int GetCameraFrameQueueDepth(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_CAMERA_FRAME_QUEUE_DEPTH);
+    if (hint && *hint) {
+        const int depth = SDL_atoi(hint);
+        if (depth > 0) {
+            return SDL_min(depth, 64);
+        }
+    }
+    return 8;
+}
+
 SDL_Camera *SDL_OpenCamera(SDL_CameraID instance_id, const SDL_CameraSpec *spec)
 {
     SDL_Camera *device = ObtainPhysicalCamera(instance_id);
@@ -1222,6 +1499,9 @@ SDL_Camera *SDL_OpenCamera(SDL_CameraID instance_id, const SDL_CameraSpec *spec)
     SDL_CameraSpec closest;
     ChooseBestCameraSpec(device, spec, &closest);
 
+    // the backend can use this to decide how many buffers it needs, so set it before opening.
+    device->num_output_surfaces = GetCameraFrameQueueDepth();
+
     #if DEBUG_CAMERA
     SDL_Log("CAMERA: App wanted [(%dx%d) fmt=%s framerate=%d/%d], chose [(%dx%d) fmt=%s framerate=%d/%d]",
             spec ? spec->width : -1, spec ? spec->height : -1, spec ? SDL_GetPixelFormatName(spec->format) : "(null)", spec ? spec->framerate_numerator : -1, spec ? spec->framerate_denominator : -1,
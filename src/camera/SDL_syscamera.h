@@ -136,7 +136,8 @@ struct SDL_Camera
     SDL_Surface *conversion_surface;
 
     // A queue of surfaces that buffer converted/scaled frames of video until the app claims them.
-    SurfaceList output_surfaces[8];
+    SurfaceList *output_surfaces;
+    int num_output_surfaces;
     SurfaceList filled_output_surfaces;        // this is FIFO
     SurfaceList empty_output_surfaces;         // this is LIFO
     SurfaceList app_held_output_surfaces;
@@ -150,6 +151,15 @@ struct SDL_Camera
     // true if acquire_surface needs to be converted for final output.
     bool needs_conversion;
 
+    // true if acquire_surface can be scaled and converted for final output in a single pass.
+    bool scale_and_convert;
+
+    // true if acquire_surface holds compressed frames that can be decoded on worker threads.
+    bool parallel_decode;
+
+    // Worker threads decoding compressed frames, NULL if frames are decoded on the camera thread.
+    struct CameraDecodePool *decode_pool;
+
     // Current state flags
     SDL_AtomicInt shutdown;
     SDL_AtomicInt zombie;
@@ -218,6 +228,7 @@ typedef struct CameraBootStrap
 
 // Not all of these are available in a given build. Use #ifdefs, etc.
 extern CameraBootStrap DUMMYCAMERA_bootstrap;
+extern CameraBootStrap DISKCAMERA_bootstrap;
 extern CameraBootStrap PIPEWIRECAMERA_bootstrap;
 extern CameraBootStrap V4L2_bootstrap;
 extern CameraBootStrap COREMEDIA_bootstrap;
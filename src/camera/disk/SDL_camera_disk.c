@@ -0,0 +1,292 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#ifdef SDL_CAMERA_DRIVER_DISK
+
+// Play back a recorded MJPG stream (a file of JPEG images, one after another) as a camera.
+
+#include "../SDL_syscamera.h"
+
+#define DISKCAMERA_DEFAULT_INFILE "sdlcamera-in.mjpg"
+#define DISKCAMERA_FRAMERATE 30
+
+typedef struct DiskCameraFrame
+{
+    size_t offset;
+    size_t size;
+} DiskCameraFrame;
+
+// The device handle: the whole file is loaded at detection time, along with where each frame lives in it.
+typedef struct DiskCameraFile
+{
+    Uint8 *data;
+    DiskCameraFrame *frames;
+    int num_frames;
+} DiskCameraFile;
+
+struct SDL_PrivateCameraData
+{
+    int next_frame;
+    Uint64 frame_delay;
+    Uint64 next_deadline;
+};
+
+// Returns the size of the JPEG image at the start of data, or 0 if it isn't a complete image.
+static size_t GetJPEGImageSize(const Uint8 *data, size_t datalen, int *w, int *h)
+{
+    size_t i = 2;
+
+    if (datalen < 4 || data[0] != 0xFF || data[1] != 0xD8) {  // SOI
+        return 0;
+    }
+
+    while (i + 4 <= datalen) {
+        if (data[i] != 0xFF) {
+            return 0;
+        }
+
+        const Uint8 marker = data[i + 1];
+        if (marker == 0xFF) {  // fill byte.
+            i++;
+            continue;
+        } else if (marker == 0xD9) {  // EOI
+            return i + 2;
+        } else if ((marker >= 0xD0 && marker <= 0xD7) || marker == 0x01) {  // RSTn and TEM have no payload.
+            i += 2;
+            continue;
+        }
+
+        const size_t seglen = ((size_t)data[i + 2] << 8) | data[i + 3];
+        if (seglen < 2 || (i + 2 + seglen) > datalen) {
+            return 0;
+        }
+
+        // SOFn (but not DHT, JPG or DAC, which share the range) has the image size.
+        if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC && seglen >= 7) {
+            *h = (data[i + 5] << 8) | data[i + 6];
+            *w = (data[i + 7] << 8) | data[i + 8];
+        }
+
+        i += 2 + seglen;
+
+        if (marker == 0xDA) {  // SOS: entropy-coded data follows, up to the next marker that isn't a stuffed 0xFF00 or a RSTn.
+            while (i + 1 < datalen) {
+                if (data[i] == 0xFF && data[i + 1] != 0x00 && !(data[i + 1] >= 0xD0 && data[i + 1] <= 0xD7)) {
+                    break;
+                }
+                i++;
+            }
+        }
+    }
+
+    return 0;
+}
+
+static void FreeDiskCameraFile(DiskCameraFile *file)
+{
+    if (file) {
+        SDL_free(file->frames);
+        SDL_free(file->data);
+        SDL_free(file);
+    }
+}
+
+static DiskCameraFile *LoadDiskCameraFile(const char *fname, int *w, int *h)
+{
+    DiskCameraFile *file = (DiskCameraFile *)SDL_calloc(1, sizeof(*file));
+    if (!file) {
+        return NULL;
+    }
+
+    size_t datalen = 0;
+    file->data = (Uint8 *)SDL_LoadFile(fname, &datalen);
+    if (!file->data) {
+        FreeDiskCameraFile(file);
+        return NULL;
+    }
+
+    // every frame has to be the size of the first one, anything else (including junk between frames) is skipped.
+    int allocated = 0;
+    size_t pos = 0;
+    *w = *h = 0;
+    while (pos + 1 < datalen) {
+        int frame_w = 0, frame_h = 0;
+        const size_t size = GetJPEGImageSize(file->data + pos, datalen - pos, &frame_w, &frame_h);
+        if (size == 0 || frame_w <= 0 || frame_h <= 0 || (file->num_frames > 0 && (frame_w != *w || frame_h != *h))) {
+            pos++;
+            continue;
+        }
+
+        if (file->num_frames == allocated) {
+            const int newalloc = allocated ? (allocated * 2) : 64;
+            void *ptr = SDL_realloc(file->frames, newalloc * sizeof(*file->frames));
+            if (!ptr) {
+                FreeDiskCameraFile(file);
+                return NULL;
+            }
+            file->frames = (DiskCameraFrame *)ptr;
+            allocated = newalloc;
+        }
+
+        file->frames[file->num_frames].offset = pos;
+        file->frames[file->num_frames].size = size;
+        file->num_frames++;
+        *w = frame_w;
+        *h = frame_h;
+        pos += size;
+    }
+
+    if (file->num_frames == 0) {
+        SDL_SetError("No JPEG images found in '%s'", fname);
+        FreeDiskCameraFile(file);
+        return NULL;
+    }
+
+    return file;
+}
+
+static bool DISKCAMERA_OpenDevice(SDL_Camera *device, const SDL_CameraSpec *spec)
+{
+    device->hidden = (struct SDL_PrivateCameraData *)SDL_calloc(1, sizeof(*device->hidden));
+    if (!device->hidden) {
+        return false;
+    }
+
+    device->hidden->frame_delay = SDL_NS_PER_SECOND / DISKCAMERA_FRAMERATE;
+
+    const char *hint = SDL_GetHint(SDL_HINT_CAMERA_DISK_TIMESCALE);
+    if (hint) {
+        double scale = SDL_atof(hint);
+        if (scale >= 0.0) {
+            device->hidden->frame_delay = (Uint64)SDL_round(device->hidden->frame_delay * scale);
+        }
+    }
+
+    SDL_CameraPermissionOutcome(device, true);  // nothing to approve, it's just a file.
+
+    return true;
+}
+
+static void DISKCAMERA_CloseDevice(SDL_Camera *device)
+{
+    if (device->hidden) {
+        SDL_free(device->hidden);
+        device->hidden = NULL;
+    }
+}
+
+static bool DISKCAMERA_WaitDevice(SDL_Camera *device)
+{
+    struct SDL_PrivateCameraData *h = device->hidden;
+    if (h->frame_delay == 0) {
+        return true;  // run as fast as we can.
+    }
+
+    // Wait for an absolute deadline, so the time spent converting frames doesn't stretch the frame rate.
+    const Uint64 now = SDL_GetTicksNS();
+    if (h->next_deadline == 0) {
+        h->next_deadline = now;
+    }
+    h->next_deadline += h->frame_delay;
+    if (h->next_deadline > now) {
+        SDL_DelayNS(h->next_deadline - now);
+    } else {
+        h->next_deadline = now;  // don't try to catch up with a burst of frames.
+    }
+    return true;
+}
+
+static SDL_CameraFrameResult DISKCAMERA_AcquireFrame(SDL_Camera *device, SDL_Surface *frame, Uint64 *timestampNS, float *rotation)
+{
+    const DiskCameraFile *file = (const DiskCameraFile *)device->handle;
+    const DiskCameraFrame *f = &file->frames[device->hidden->next_frame];
+
+    // the file loops forever.
+    device->hidden->next_frame = (device->hidden->next_frame + 1) % file->num_frames;
+
+    *timestampNS = SDL_GetTicksNS();
+    frame->pixels = file->data + f->offset;
+    frame->pitch = (int)f->size;  // compressed frames use the pitch as the size of the data.
+
+    return SDL_CAMERA_FRAME_READY;
+}
+
+static void DISKCAMERA_ReleaseFrame(SDL_Camera *device, SDL_Surface *frame)
+{
+    // nothing to do, the frames point into the loaded file.
+}
+
+static void DISKCAMERA_DetectDevices(void)
+{
+    const char *fname = SDL_GetHint(SDL_HINT_CAMERA_DISK_INPUT_FILE);
+    if (!fname) {
+        fname = DISKCAMERA_DEFAULT_INFILE;
+    }
+
+    int w = 0, h = 0;
+    DiskCameraFile *file = LoadDiskCameraFile(fname, &w, &h);
+    if (!file) {
+        return;  // no file, no camera.
+    }
+
+    SDL_CameraSpec spec;
+    SDL_zero(spec);
+    spec.format = SDL_PIXELFORMAT_MJPG;
+    spec.colorspace = SDL_COLORSPACE_SRGB;
+    spec.width = w;
+    spec.height = h;
+    spec.framerate_numerator = DISKCAMERA_FRAMERATE;
+    spec.framerate_denominator = 1;
+
+    if (!SDL_AddCamera(fname, SDL_CAMERA_POSITION_UNKNOWN, 1, &spec, file)) {
+        FreeDiskCameraFile(file);
+    }
+}
+
+static void DISKCAMERA_FreeDeviceHandle(SDL_Camera *device)
+{
+    FreeDiskCameraFile((DiskCameraFile *)device->handle);
+}
+
+static void DISKCAMERA_Deinitialize(void)
+{
+}
+
+static bool DISKCAMERA_Init(SDL_CameraDriverImpl *impl)
+{
+    impl->DetectDevices = DISKCAMERA_DetectDevices;
+    impl->OpenDevice = DISKCAMERA_OpenDevice;
+    impl->CloseDevice = DISKCAMERA_CloseDevice;
+    impl->WaitDevice = DISKCAMERA_WaitDevice;
+    impl->AcquireFrame = DISKCAMERA_AcquireFrame;
+    impl->ReleaseFrame = DISKCAMERA_ReleaseFrame;
+    impl->FreeDeviceHandle = DISKCAMERA_FreeDeviceHandle;
+    impl->Deinitialize = DISKCAMERA_Deinitialize;
+
+    return true;
+}
+
+CameraBootStrap DISKCAMERA_bootstrap = {
+    "disk", "direct-from-disk camera", DISKCAMERA_Init, true
+};
+
+#endif  // SDL_CAMERA_DRIVER_DISK
@@ -593,11 +593,15 @@ static bool V4L2_OpenDevice(SDL_Camera *device, const SDL_CameraSpec *spec)
     }
     device->hidden->driver_pitch = fmt.fmt.pix.bytesperline;
 
+    // Frames that don't need conversion are handed to the app in the mapped buffers themselves, so keep
+    // enough buffers to fill every queued frame and still have a couple left for the driver to capture into.
+    const int nb_buffers = device->num_output_surfaces + 2;
+
     io_method io = IO_METHOD_INVALID;
     if ((io == IO_METHOD_INVALID) && (cap.device_caps & V4L2_CAP_STREAMING)) {
         struct v4l2_requestbuffers req;
         SDL_zero(req);
-        req.count = 8;
+        req.count = nb_buffers;
         req.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
         req.memory = V4L2_MEMORY_MMAP;
         if ((xioctl(fd, VIDIOC_REQBUFS, &req) == 0) && (req.count >= 2)) {
@@ -605,12 +609,12 @@ static bool V4L2_OpenDevice(SDL_Camera *device, const SDL_CameraSpec *spec)
             device->hidden->nb_buffers = req.count;
         } else {  // mmap didn't work out? Try USERPTR.
             SDL_zero(req);
-            req.count = 8;
+            req.count = nb_buffers;
             req.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
             req.memory = V4L2_MEMORY_USERPTR;
             if (xioctl(fd, VIDIOC_REQBUFS, &req) == 0) {
                 io = IO_METHOD_USERPTR;
-                device->hidden->nb_buffers = 8;
+                device->hidden->nb_buffers = nb_buffers;
             }
         }
     }
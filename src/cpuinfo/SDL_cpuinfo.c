@@ -899,6 +899,7 @@ int SDL_GetCPUCacheLineSize(void)
 
 static Uint32 SDL_CPUFeatures = SDL_CPUFEATURES_RESET_VALUE;
 static Uint32 SDL_SIMDAlignment = 0xFFFFFFFF;
+static bool SDL_CPUFeatureMaskWatched = false;
 
 static bool ref_string_equals(const char *ref, const char *test, const char *end_test) {
     size_t len_test = end_test - test;
@@ -974,9 +975,20 @@ static Uint32 SDLCALL SDL_CPUFeatureMaskFromHint(void)
     return result_mask;
 }
 
+static void SDLCALL SDL_CPUFeatureMaskChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    // Features are detected again, with the new mask, the next time they're checked
+    SDL_CPUFeatures = SDL_CPUFEATURES_RESET_VALUE;
+}
+
 static Uint32 SDL_GetCPUFeatures(void)
 {
     if (SDL_CPUFeatures == SDL_CPUFEATURES_RESET_VALUE) {
+        if (!SDL_CPUFeatureMaskWatched) {
+            SDL_CPUFeatureMaskWatched = true;
+            SDL_AddHintCallback(SDL_HINT_CPU_FEATURE_MASK, SDL_CPUFeatureMaskChanged, NULL);
+        }
+
         CPU_calcCPUIDFeatures();
         SDL_CPUFeatures = 0;
         SDL_SIMDAlignment = sizeof(void *); // a good safe base value
@@ -1042,6 +1054,10 @@ static Uint32 SDL_GetCPUFeatures(void)
 }
 
 void SDL_QuitCPUInfo(void) {
+    if (SDL_CPUFeatureMaskWatched) {
+        SDL_RemoveHintCallback(SDL_HINT_CPU_FEATURE_MASK, SDL_CPUFeatureMaskChanged, NULL);
+        SDL_CPUFeatureMaskWatched = false;
+    }
     SDL_CPUFeatures = SDL_CPUFEATURES_RESET_VALUE;
 }
 
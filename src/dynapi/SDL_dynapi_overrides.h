@@ -1306,3 +1306,13 @@
 #define SDL_OpenXR_UnloadLibrary SDL_OpenXR_UnloadLibrary_REAL
 #define SDL_OpenXR_GetXrGetInstanceProcAddr SDL_OpenXR_GetXrGetInstanceProcAddr_REAL
 #define SDL_CreateTrayWithProperties SDL_CreateTrayWithProperties_REAL
+#define SDL_OpenWAVReader_IO SDL_OpenWAVReader_IO_REAL
+#define SDL_OpenWAVReader SDL_OpenWAVReader_REAL
+#define SDL_GetWAVReaderFrames SDL_GetWAVReaderFrames_REAL
+#define SDL_ReadWAVFrames SDL_ReadWAVFrames_REAL
+#define SDL_ReadWAVFramesToAudioStream SDL_ReadWAVFramesToAudioStream_REAL
+#define SDL_SeekWAVReader SDL_SeekWAVReader_REAL
+#define SDL_TellWAVReader SDL_TellWAVReader_REAL
+#define SDL_CloseWAVReader SDL_CloseWAVReader_REAL
+#define SDL_GetAudioStreamPlanarData SDL_GetAudioStreamPlanarData_REAL
+#define SDL_GetAudioStreamPlanarPointers SDL_GetAudioStreamPlanarPointers_REAL
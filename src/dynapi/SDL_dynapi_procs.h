@@ -1314,3 +1314,13 @@ SDL_DYNAPI_PROC(bool,SDL_OpenXR_LoadLibrary,(void),(),return)
 SDL_DYNAPI_PROC(void,SDL_OpenXR_UnloadLibrary,(void),(),)
 SDL_DYNAPI_PROC(PFN_xrGetInstanceProcAddr,SDL_OpenXR_GetXrGetInstanceProcAddr,(void),(),return)
 SDL_DYNAPI_PROC(SDL_Tray*,SDL_CreateTrayWithProperties,(SDL_PropertiesID a),(a),return)
+SDL_DYNAPI_PROC(SDL_WAVReader*,SDL_OpenWAVReader_IO,(SDL_IOStream *a,bool b,SDL_AudioSpec *c),(a,b,c),return)
+SDL_DYNAPI_PROC(SDL_WAVReader*,SDL_OpenWAVReader,(const char *a,SDL_AudioSpec *b),(a,b),return)
+SDL_DYNAPI_PROC(Sint64,SDL_GetWAVReaderFrames,(SDL_WAVReader *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_ReadWAVFrames,(SDL_WAVReader *a,void *b,int c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_ReadWAVFramesToAudioStream,(SDL_WAVReader *a,SDL_AudioStream *b,int c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_SeekWAVReader,(SDL_WAVReader *a,Sint64 b),(a,b),return)
+SDL_DYNAPI_PROC(Sint64,SDL_TellWAVReader,(SDL_WAVReader *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_CloseWAVReader,(SDL_WAVReader *a),(a),)
+SDL_DYNAPI_PROC(int,SDL_GetAudioStreamPlanarData,(SDL_AudioStream *a,void * const*b,int c,int d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(int,SDL_GetAudioStreamPlanarPointers,(SDL_AudioStream *a,const void **b,int c,int d),(a,b,c,d),return)
@@ -307,9 +307,349 @@ static SDL_INLINE void DebugLogRenderCommands(const SDL_RenderCommand *cmd)
 #endif
 }
 
+/* Draws that don't overlap can be drawn in any order, so before the queue is
+ * flushed, runs of draws are sorted into batches with the same texture and
+ * state, and consecutive geometry with the same state is merged into a single
+ * command. A draw is only moved in front of draws that it doesn't overlap.
+ */
+#define SDL_RENDER_REORDER_SEARCH_DEPTH 64
+
+typedef struct SDL_RenderBatch
+{
+    SDL_RenderCommand *head;
+    SDL_RenderCommand *tail;
+    SDL_FRect bounds;
+} SDL_RenderBatch;
+
+static bool IsReorderableDraw(const SDL_RenderCommand *cmd)
+{
+    switch (cmd->command) {
+    case SDL_RENDERCMD_DRAW_POINTS:
+    case SDL_RENDERCMD_DRAW_LINES:
+    case SDL_RENDERCMD_FILL_RECTS:
+    case SDL_RENDERCMD_COPY:
+    case SDL_RENDERCMD_COPY_EX:
+    case SDL_RENDERCMD_GEOMETRY:
+        return cmd->data.draw.reorderable;
+    default:
+        return false;
+    }
+}
+
+// Draws that only touch don't overlap, since the bounds cover whole pixels
+static bool DrawBoundsOverlap(const SDL_FRect *a, const SDL_FRect *b)
+{
+    return a->x < b->x + b->w && b->x < a->x + a->w &&
+           a->y < b->y + b->h && b->y < a->y + a->h;
+}
+
+static bool SameDrawState(const SDL_RenderCommand *a, const SDL_RenderCommand *b)
+{
+    return a->command == b->command &&
+           a->data.draw.texture == b->data.draw.texture &&
+           (!a->data.draw.texture || a->data.draw.texture_scale_mode == b->data.draw.texture_scale_mode) &&
+           a->data.draw.texture_address_mode_u == b->data.draw.texture_address_mode_u &&
+           a->data.draw.texture_address_mode_v == b->data.draw.texture_address_mode_v &&
+           a->data.draw.blend == b->data.draw.blend &&
+           a->data.draw.gpu_render_state == b->data.draw.gpu_render_state &&
+           a->data.draw.color_scale == b->data.draw.color_scale &&
+           a->data.draw.color.r == b->data.draw.color.r &&
+           a->data.draw.color.g == b->data.draw.color.g &&
+           a->data.draw.color.b == b->data.draw.color.b &&
+           a->data.draw.color.a == b->data.draw.color.a;
+}
+
+// Sorts the draws from first up to end into batches, returning the new order in head and tail
+static void SortRenderCommandRun(SDL_Renderer *renderer, SDL_RenderCommand *first, SDL_RenderCommand *end, SDL_RenderCommand **head, SDL_RenderCommand **tail)
+{
+    SDL_RenderBatch *batches = renderer->reorder_batches;
+    const size_t vertex_start = first->data.draw.first;
+    const size_t vertex_size = (*tail)->data.draw.vertex_end - vertex_start;
+    size_t offset;
+    SDL_RenderCommand *cmd, *next;
+    int num_batches = 0;
+    int i;
+
+    for (cmd = first; cmd != end; cmd = next) {
+        const int lowest = SDL_max(num_batches - SDL_RENDER_REORDER_SEARCH_DEPTH, 0);
+        int batch = -1;
+
+        next = cmd->next;
+        cmd->next = end;
+
+        for (i = num_batches - 1; i >= lowest; --i) {
+            if (SameDrawState(batches[i].head, cmd)) {
+                batch = i;
+                break;
+            }
+            if (DrawBoundsOverlap(&batches[i].bounds, &cmd->data.draw.bounds)) {
+                break;
+            }
+        }
+
+        if (batch < 0) {
+            batch = num_batches++;
+            batches[batch].head = cmd;
+            batches[batch].bounds = cmd->data.draw.bounds;
+        } else {
+            batches[batch].tail->next = cmd;
+            SDL_GetRectUnionFloat(&batches[batch].bounds, &cmd->data.draw.bounds, &batches[batch].bounds);
+        }
+        batches[batch].tail = cmd;
+    }
+
+    for (i = 0; i < num_batches - 1; ++i) {
+        batches[i].tail->next = batches[i + 1].head;
+    }
+    *head = batches[0].head;
+    *tail = batches[num_batches - 1].tail;
+
+    // Lay out the vertex data in the new order, so consecutive draws stay contiguous
+    SDL_memcpy(renderer->reorder_vertex_data, (Uint8 *)renderer->vertex_data + vertex_start, vertex_size);
+    offset = vertex_start;
+    for (cmd = *head; cmd != end; cmd = cmd->next) {
+        const size_t size = cmd->data.draw.vertex_end - cmd->data.draw.first;
+        SDL_memcpy((Uint8 *)renderer->vertex_data + offset, (Uint8 *)renderer->reorder_vertex_data + (cmd->data.draw.first - vertex_start), size);
+        cmd->data.draw.first = offset;
+        cmd->data.draw.vertex_end = offset + size;
+        offset += size;
+    }
+}
+
+// Merges consecutive geometry with the same state, the vertex counts of geometry commands add up
+static void MergeRenderCommandRun(SDL_Renderer *renderer, SDL_RenderCommand *head, SDL_RenderCommand *end, SDL_RenderCommand **tail)
+{
+    SDL_RenderCommand *cmd = head;
+
+    while (cmd->next != end) {
+        SDL_RenderCommand *next = cmd->next;
+
+        if (cmd->command == SDL_RENDERCMD_GEOMETRY && SameDrawState(cmd, next) &&
+            cmd->data.draw.vertex_end == next->data.draw.first) {
+            cmd->data.draw.count += next->data.draw.count;
+            cmd->data.draw.vertex_end = next->data.draw.vertex_end;
+            SDL_GetRectUnionFloat(&cmd->data.draw.bounds, &next->data.draw.bounds, &cmd->data.draw.bounds);
+            cmd->next = next->next;
+
+            next->command = SDL_RENDERCMD_NO_OP;
+            next->next = renderer->render_commands_pool;
+            renderer->render_commands_pool = next;
+            ++renderer->merged_commands;
+        } else {
+            cmd = next;
+        }
+    }
+    *tail = cmd;
+}
+
+static void ReorderRenderCommands(SDL_Renderer *renderer)
+{
+    SDL_RenderCommand *prev = NULL;
+    SDL_RenderCommand *cmd = renderer->render_commands;
+
+    if (renderer->reorder_vertex_data_allocation < renderer->vertex_data_used) {
+        void *ptr = SDL_realloc(renderer->reorder_vertex_data, renderer->vertex_data_allocation);
+        if (!ptr) {
+            return; // the draws are still correct, just not reordered
+        }
+        renderer->reorder_vertex_data = ptr;
+        renderer->reorder_vertex_data_allocation = renderer->vertex_data_allocation;
+    }
+
+    while (cmd) {
+        SDL_RenderCommand *first = cmd;
+        SDL_RenderCommand *last = cmd;
+        SDL_RenderCommand *end;
+        SDL_RenderCommand *head;
+        SDL_RenderCommand *tail;
+        int count = 1;
+
+        if (!IsReorderableDraw(cmd)) {
+            prev = cmd;
+            cmd = cmd->next;
+            continue;
+        }
+
+        // Find the run of draws with contiguous vertex data that starts here
+        for (end = cmd->next; end && IsReorderableDraw(end) && end->data.draw.first == last->data.draw.vertex_end; end = end->next) {
+            last = end;
+            ++count;
+        }
+        if (count < 2) {
+            prev = cmd;
+            cmd = end;
+            continue;
+        }
+
+        if (renderer->reorder_batches_allocation < count) {
+            SDL_RenderBatch *batches = (SDL_RenderBatch *)SDL_realloc(renderer->reorder_batches, count * sizeof(*batches));
+            if (!batches) {
+                return;
+            }
+            renderer->reorder_batches = batches;
+            renderer->reorder_batches_allocation = count;
+        }
+
+        tail = last;
+        SortRenderCommandRun(renderer, first, end, &head, &tail);
+        MergeRenderCommandRun(renderer, head, end, &tail);
+
+        if (prev) {
+            prev->next = head;
+        } else {
+            renderer->render_commands = head;
+        }
+        if (!end) {
+            renderer->render_commands_tail = tail;
+        }
+        prev = tail;
+        cmd = end;
+    }
+}
+
+static void UpdateRenderCommandStats(SDL_Renderer *renderer)
+{
+    SDL_PropertiesID props = SDL_GetRendererProperties(renderer);
+
+    SDL_SetNumberProperty(props, SDL_PROP_RENDERER_QUEUED_COMMANDS_NUMBER, (Sint64)renderer->queued_commands);
+    SDL_SetNumberProperty(props, SDL_PROP_RENDERER_SUBMITTED_COMMANDS_NUMBER, (Sint64)(renderer->queued_commands - renderer->merged_commands));
+}
+
+static size_t GetRenderVertexBufferSize(SDL_Renderer *renderer, size_t needed)
+{
+    size_t size = 2048;
+
+    while (size < needed) {
+        size *= 2;
+    }
+    return SDL_max(size, renderer->vertex_buffer_min_size);
+}
+
+static void AllocateRenderVertexBuffers(SDL_Renderer *renderer)
+{
+    int i;
+
+    if (renderer->vertex_buffer_min_size == 0) {
+        return;
+    }
+
+    for (i = 0; i < SDL_RENDER_VERTEX_BUFFER_COUNT; ++i) {
+        // If this fails, the buffers are allocated as they're needed instead
+        renderer->vertex_buffers[i].data = SDL_malloc(renderer->vertex_buffer_min_size);
+        if (renderer->vertex_buffers[i].data) {
+            renderer->vertex_buffers[i].allocation = renderer->vertex_buffer_min_size;
+        }
+    }
+    renderer->vertex_data = renderer->vertex_buffers[renderer->vertex_buffer].data;
+    renderer->vertex_data_allocation = renderer->vertex_buffers[renderer->vertex_buffer].allocation;
+}
+
+// Moves on to the next vertex buffer, releasing the memory it no longer needs
+static void SwapRenderVertexBuffers(SDL_Renderer *renderer)
+{
+    SDL_RenderVertexBuffer *buffer = &renderer->vertex_buffers[renderer->vertex_buffer];
+
+    buffer->data = renderer->vertex_data;
+    buffer->allocation = renderer->vertex_data_allocation;
+
+    renderer->vertex_buffer = (renderer->vertex_buffer + 1) % SDL_RENDER_VERTEX_BUFFER_COUNT;
+    buffer = &renderer->vertex_buffers[renderer->vertex_buffer];
+
+    if (renderer->vertex_buffer_decay_frames > 0 &&
+        (renderer->frame_count - buffer->decay_start) >= renderer->vertex_buffer_decay_frames) {
+        // Nothing in this buffer is in use anymore, so it can be resized to what recent frames needed
+        const size_t size = buffer->peak ? GetRenderVertexBufferSize(renderer, buffer->peak) : renderer->vertex_buffer_min_size;
+
+        if (size == 0) {
+            SDL_free(buffer->data);
+            buffer->data = NULL;
+            buffer->allocation = 0;
+        } else if (size < buffer->allocation) {
+            void *ptr = SDL_realloc(buffer->data, size);
+            if (ptr) {
+                buffer->data = ptr;
+                buffer->allocation = size;
+            }
+        }
+        if (renderer->reorder_vertex_data_allocation > buffer->allocation) {
+            SDL_free(renderer->reorder_vertex_data);
+            renderer->reorder_vertex_data = NULL;
+            renderer->reorder_vertex_data_allocation = 0;
+        }
+        buffer->peak = 0;
+        buffer->decay_start = renderer->frame_count;
+    }
+
+    renderer->vertex_data = buffer->data;
+    renderer->vertex_data_allocation = buffer->allocation;
+}
+
+static void CountRenderCommands(SDL_Renderer *renderer, const SDL_RenderCommand *cmd)
+{
+    SDL_RenderStats *stats = &renderer->frame_stats;
+
+    while (cmd) {
+        ++stats->commands[cmd->command];
+        cmd = cmd->next;
+    }
+    stats->vertex_bytes += renderer->vertex_data_used;
+    ++stats->flushes;
+}
+
+static void CountTextureUpload(SDL_Texture *texture, const SDL_Rect *rect)
+{
+    size_t size = 0;
+
+    if (SDL_CalculateSurfaceSize(texture->format, rect->w, rect->h, &size, NULL, true)) {
+        texture->renderer->frame_stats.texture_upload_bytes += size;
+    }
+}
+
+static size_t GetRenderVertexBufferAllocation(SDL_Renderer *renderer)
+{
+    size_t total = renderer->vertex_data_allocation;
+    int i;
+
+    for (i = 0; i < SDL_RENDER_VERTEX_BUFFER_COUNT; ++i) {
+        if (i != renderer->vertex_buffer) {
+            total += renderer->vertex_buffers[i].allocation;
+        }
+    }
+    return total;
+}
+
+// Publishes the statistics for the frame that was just presented, and starts counting the next one
+static void UpdateRenderFrameStats(SDL_Renderer *renderer)
+{
+    SDL_PropertiesID props = SDL_GetRendererProperties(renderer);
+    const SDL_RenderStats *stats = &renderer->frame_stats;
+
+    SDL_SetNumberProperty(props, SDL_PROP_RENDERER_FRAME_STATE_COMMANDS_NUMBER,
+                          (Sint64)(stats->commands[SDL_RENDERCMD_SETVIEWPORT] +
+                                   stats->commands[SDL_RENDERCMD_SETCLIPRECT] +
+                                   stats->commands[SDL_RENDERCMD_SETDRAWCOLOR]));
+    SDL_SetNumberProperty(props, SDL_PROP_RENDERER_FRAME_CLEAR_COMMANDS_NUMBER, (Sint64)stats->commands[SDL_RENDERCMD_CLEAR]);
+    SDL_SetNumberProperty(props, SDL_PROP_RENDERER_FRAME_POINT_COMMANDS_NUMBER, (Sint64)stats->commands[SDL_RENDERCMD_DRAW_POINTS]);
+    SDL_SetNumberProperty(props, SDL_PROP_RENDERER_FRAME_LINE_COMMANDS_NUMBER, (Sint64)stats->commands[SDL_RENDERCMD_DRAW_LINES]);
+    SDL_SetNumberProperty(props, SDL_PROP_RENDERER_FRAME_RECT_COMMANDS_NUMBER, (Sint64)stats->commands[SDL_RENDERCMD_FILL_RECTS]);
+    SDL_SetNumberProperty(props, SDL_PROP_RENDERER_FRAME_COPY_COMMANDS_NUMBER,
+                          (Sint64)(stats->commands[SDL_RENDERCMD_COPY] + stats->commands[SDL_RENDERCMD_COPY_EX]));
+    SDL_SetNumberProperty(props, SDL_PROP_RENDERER_FRAME_GEOMETRY_COMMANDS_NUMBER, (Sint64)stats->commands[SDL_RENDERCMD_GEOMETRY]);
+    SDL_SetNumberProperty(props, SDL_PROP_RENDERER_FRAME_VERTEX_BYTES_NUMBER, (Sint64)stats->vertex_bytes);
+    SDL_SetNumberProperty(props, SDL_PROP_RENDERER_FRAME_TEXTURE_UPLOAD_BYTES_NUMBER, (Sint64)stats->texture_upload_bytes);
+    SDL_SetNumberProperty(props, SDL_PROP_RENDERER_FRAME_FLUSHES_NUMBER, (Sint64)stats->flushes);
+    SDL_SetNumberProperty(props, SDL_PROP_RENDERER_FRAME_DEPENDENCY_FLUSHES_NUMBER, (Sint64)stats->dependency_flushes);
+    SDL_SetNumberProperty(props, SDL_PROP_RENDERER_FRAME_SUBMIT_TIME_NS_NUMBER, (Sint64)stats->run_ns);
+    SDL_SetNumberProperty(props, SDL_PROP_RENDERER_VERTEX_BUFFER_SIZE_NUMBER, (Sint64)GetRenderVertexBufferAllocation(renderer));
+
+    SDL_zero(renderer->frame_stats);
+    ++renderer->frame_count;
+}
+
 static bool FlushRenderCommands(SDL_Renderer *renderer)
 {
     bool result;
+    Uint64 start;
 
     SDL_assert((renderer->render_commands == NULL) == (renderer->render_commands_tail == NULL));
 
@@ -318,9 +658,16 @@ static bool FlushRenderCommands(SDL_Renderer *renderer)
         return true;
     }
 
+    if (renderer->reorder_draws) {
+        ReorderRenderCommands(renderer);
+    }
+
     DebugLogRenderCommands(renderer->render_commands);
+    CountRenderCommands(renderer, renderer->render_commands);
 
+    start = SDL_GetTicksNS();
     result = renderer->RunCommandQueue(renderer, renderer->render_commands, renderer->vertex_data, renderer->vertex_data_used);
+    renderer->frame_stats.run_ns += SDL_GetTicksNS() - start;
 
     // Move the whole render command queue to the unused pool so we can reuse them next time.
     if (renderer->render_commands_tail) {
@@ -329,11 +676,16 @@ static bool FlushRenderCommands(SDL_Renderer *renderer)
         renderer->render_commands_tail = NULL;
         renderer->render_commands = NULL;
     }
+    if (renderer->vertex_data_used > renderer->vertex_buffers[renderer->vertex_buffer].peak) {
+        renderer->vertex_buffers[renderer->vertex_buffer].peak = renderer->vertex_data_used;
+    }
     renderer->vertex_data_used = 0;
+    SwapRenderVertexBuffers(renderer);
     renderer->render_command_generation++;
     renderer->color_queued = false;
     renderer->viewport_queued = false;
     renderer->cliprect_queued = false;
+    UpdateRenderCommandStats(renderer);
     return result;
 }
 
@@ -342,6 +694,7 @@ static bool FlushRenderCommandsIfTextureNeeded(SDL_Texture *texture)
     SDL_Renderer *renderer = texture->renderer;
     if (texture->last_command_generation == renderer->render_command_generation) {
         // the current command queue depends on this texture, flush the queue now before it changes
+        ++renderer->frame_stats.dependency_flushes;
         return FlushRenderCommands(renderer);
     }
     return true;
@@ -351,6 +704,7 @@ static bool FlushRenderCommandsIfPaletteNeeded(SDL_Renderer *renderer, SDL_Textu
 {
     if (palette->last_command_generation == renderer->render_command_generation) {
         // the current command queue depends on this palette, flush the queue now before it changes
+        ++renderer->frame_stats.dependency_flushes;
         return FlushRenderCommands(renderer);
     }
     return true;
@@ -361,6 +715,7 @@ static bool FlushRenderCommandsIfGPURenderStateNeeded(SDL_GPURenderState *state)
     SDL_Renderer *renderer = state->renderer;
     if (state->last_command_generation == renderer->render_command_generation) {
         // the current command queue depends on this state, flush the queue now before it changes
+        ++renderer->frame_stats.dependency_flushes;
         return FlushRenderCommands(renderer);
     }
     return true;
@@ -383,15 +738,13 @@ void *SDL_AllocateRenderVertices(SDL_Renderer *renderer, size_t numbytes, size_t
     const size_t aligner = (alignment && ((current_offset & (alignment - 1)) != 0)) ? (alignment - (current_offset & (alignment - 1))) : 0;
     const size_t aligned = current_offset + aligner;
 
-    if (renderer->vertex_data_allocation < needed) {
-        const size_t current_allocation = renderer->vertex_data ? renderer->vertex_data_allocation : 1024;
-        size_t newsize = current_allocation * 2;
-        void *ptr;
-        while (newsize < needed) {
-            newsize *= 2;
-        }
+    if (alignment > renderer->vertex_data_alignment) {
+        renderer->vertex_data_alignment = alignment;
+    }
 
-        ptr = SDL_realloc(renderer->vertex_data, newsize);
+    if (renderer->vertex_data_allocation < needed) {
+        const size_t newsize = GetRenderVertexBufferSize(renderer, needed);
+        void *ptr = SDL_realloc(renderer->vertex_data, newsize);
 
         if (!ptr) {
             return NULL;
@@ -431,6 +784,7 @@ static SDL_RenderCommand *AllocateRenderCommand(SDL_Renderer *renderer)
         renderer->render_commands = result;
     }
     renderer->render_commands_tail = result;
+    ++renderer->queued_commands;
 
     return result;
 }
@@ -599,6 +953,7 @@ static SDL_RenderCommand *PrepQueueCmdDraw(SDL_Renderer *renderer, const SDL_Ren
             cmd->data.draw.texture_address_mode_u = SDL_TEXTURE_ADDRESS_CLAMP;
             cmd->data.draw.texture_address_mode_v = SDL_TEXTURE_ADDRESS_CLAMP;
             cmd->data.draw.gpu_render_state = renderer->gpu_render_state;
+            cmd->data.draw.reorderable = false;
             if (renderer->gpu_render_state) {
                 renderer->gpu_render_state->last_command_generation = renderer->render_command_generation;
             }
@@ -607,14 +962,63 @@ static SDL_RenderCommand *PrepQueueCmdDraw(SDL_Renderer *renderer, const SDL_Ren
     return cmd;
 }
 
+static void GetPointBounds(const float *xy, int xy_stride, int count, float scale_x, float scale_y, SDL_FRect *bounds)
+{
+    float minx = xy[0], miny = xy[1];
+    float maxx = minx, maxy = miny;
+    int i;
+
+    for (i = 1; i < count; ++i) {
+        const float *p = (const float *)((const Uint8 *)xy + i * xy_stride);
+        minx = SDL_min(minx, p[0]);
+        miny = SDL_min(miny, p[1]);
+        maxx = SDL_max(maxx, p[0]);
+        maxy = SDL_max(maxy, p[1]);
+    }
+    bounds->x = minx * scale_x;
+    bounds->y = miny * scale_y;
+    bounds->w = (maxx - minx) * scale_x;
+    bounds->h = (maxy - miny) * scale_y;
+}
+
+// Lets a queued draw be reordered, if its vertex data can be moved around with the others
+static void SetDrawReorderable(SDL_Renderer *renderer, SDL_RenderCommand *cmd, size_t vertex_start, const SDL_FRect *bounds)
+{
+    const size_t alignment = SDL_max(renderer->vertex_data_alignment, 1);
+    const size_t vertex_end = renderer->vertex_data_used;
+
+    if (cmd->data.draw.first != vertex_start || vertex_end <= vertex_start || ((vertex_end - vertex_start) % alignment) != 0) {
+        return;
+    }
+    if (!(bounds->w >= 0.0f && bounds->h >= 0.0f && bounds->x > -SDL_MAX_SINT32 && bounds->y > -SDL_MAX_SINT32 &&
+          bounds->w < SDL_MAX_SINT32 && bounds->h < SDL_MAX_SINT32)) {
+        return; // negative scales, or coordinates that aren't finite
+    }
+
+    // Round out to the pixels that the draw can touch
+    cmd->data.draw.bounds.x = SDL_floorf(bounds->x);
+    cmd->data.draw.bounds.y = SDL_floorf(bounds->y);
+    cmd->data.draw.bounds.w = SDL_ceilf(bounds->x + bounds->w) - cmd->data.draw.bounds.x;
+    cmd->data.draw.bounds.h = SDL_ceilf(bounds->y + bounds->h) - cmd->data.draw.bounds.y;
+    cmd->data.draw.vertex_end = vertex_end;
+    cmd->data.draw.reorderable = true;
+}
+
 static bool QueueCmdDrawPoints(SDL_Renderer *renderer, const SDL_FPoint *points, const int count)
 {
     SDL_RenderCommand *cmd = PrepQueueCmdDraw(renderer, SDL_RENDERCMD_DRAW_POINTS, NULL);
     bool result = false;
     if (cmd) {
+        const size_t vertex_start = renderer->vertex_data_used;
         result = renderer->QueueDrawPoints(renderer, cmd, points, count);
         if (!result) {
             cmd->command = SDL_RENDERCMD_NO_OP;
+        } else if (renderer->reorder_draws && count > 0) {
+            SDL_FRect bounds;
+            GetPointBounds(&points[0].x, sizeof(*points), count, 1.0f, 1.0f, &bounds);
+            bounds.w += 1.0f; // the pixels right of and below each point are drawn
+            bounds.h += 1.0f;
+            SetDrawReorderable(renderer, cmd, vertex_start, &bounds);
         }
     }
     return result;
@@ -625,9 +1029,16 @@ static bool QueueCmdDrawLines(SDL_Renderer *renderer, const SDL_FPoint *points,
     SDL_RenderCommand *cmd = PrepQueueCmdDraw(renderer, SDL_RENDERCMD_DRAW_LINES, NULL);
     bool result = false;
     if (cmd) {
+        const size_t vertex_start = renderer->vertex_data_used;
         result = renderer->QueueDrawLines(renderer, cmd, points, count);
         if (!result) {
             cmd->command = SDL_RENDERCMD_NO_OP;
+        } else if (renderer->reorder_draws && count > 0) {
+            SDL_FRect bounds;
+            GetPointBounds(&points[0].x, sizeof(*points), count, 1.0f, 1.0f, &bounds);
+            bounds.w += 1.0f; // the pixels right of and below each point are drawn
+            bounds.h += 1.0f;
+            SetDrawReorderable(renderer, cmd, vertex_start, &bounds);
         }
     }
     return result;
@@ -638,10 +1049,12 @@ static bool QueueCmdFillRects(SDL_Renderer *renderer, const SDL_FRect *rects, co
     SDL_RenderCommand *cmd;
     bool result = false;
     const int use_rendergeometry = (!renderer->QueueFillRects);
+    size_t vertex_start;
 
     cmd = PrepQueueCmdDraw(renderer, (use_rendergeometry ? SDL_RENDERCMD_GEOMETRY : SDL_RENDERCMD_FILL_RECTS), NULL);
 
     if (cmd) {
+        vertex_start = renderer->vertex_data_used;
         if (use_rendergeometry) {
             bool isstack1;
             bool isstack2;
@@ -702,6 +1115,25 @@ static bool QueueCmdFillRects(SDL_Renderer *renderer, const SDL_FRect *rects, co
                 cmd->command = SDL_RENDERCMD_NO_OP;
             }
         }
+
+        if (result && renderer->reorder_draws && count > 0) {
+            float minx = rects[0].x, miny = rects[0].y;
+            float maxx = minx, maxy = miny;
+            SDL_FRect bounds;
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                minx = SDL_min(minx, SDL_min(rects[i].x, rects[i].x + rects[i].w));
+                miny = SDL_min(miny, SDL_min(rects[i].y, rects[i].y + rects[i].h));
+                maxx = SDL_max(maxx, SDL_max(rects[i].x, rects[i].x + rects[i].w));
+                maxy = SDL_max(maxy, SDL_max(rects[i].y, rects[i].y + rects[i].h));
+            }
+            bounds.x = minx;
+            bounds.y = miny;
+            bounds.w = maxx - minx;
+            bounds.h = maxy - miny;
+            SetDrawReorderable(renderer, cmd, vertex_start, &bounds);
+        }
     }
     return result;
 }
@@ -765,9 +1197,12 @@ static bool QueueCmdCopy(SDL_Renderer *renderer, SDL_Texture *texture, const SDL
     SDL_RenderCommand *cmd = PrepQueueCmdDraw(renderer, SDL_RENDERCMD_COPY, texture);
     bool result = false;
     if (cmd) {
+        const size_t vertex_start = renderer->vertex_data_used;
         result = renderer->QueueCopy(renderer, cmd, texture, srcrect, dstrect);
         if (!result) {
             cmd->command = SDL_RENDERCMD_NO_OP;
+        } else if (renderer->reorder_draws) {
+            SetDrawReorderable(renderer, cmd, vertex_start, dstrect);
         }
     }
     return result;
@@ -780,9 +1215,24 @@ static bool QueueCmdCopyEx(SDL_Renderer *renderer, SDL_Texture *texture,
     SDL_RenderCommand *cmd = PrepQueueCmdDraw(renderer, SDL_RENDERCMD_COPY_EX, texture);
     bool result = false;
     if (cmd) {
+        const size_t vertex_start = renderer->vertex_data_used;
         result = renderer->QueueCopyEx(renderer, cmd, texture, srcquad, dstrect, angle, center, flip, scale_x, scale_y);
         if (!result) {
             cmd->command = SDL_RENDERCMD_NO_OP;
+        } else if (renderer->reorder_draws) {
+            // Any rotation stays within the distance of the farthest corner from the center
+            const float cx = dstrect->x + center->x;
+            const float cy = dstrect->y + center->y;
+            const float dx = SDL_max(center->x, dstrect->w - center->x);
+            const float dy = SDL_max(center->y, dstrect->h - center->y);
+            const float radius = SDL_sqrtf(dx * dx + dy * dy);
+            SDL_FRect bounds;
+
+            bounds.x = (cx - radius) * scale_x;
+            bounds.y = (cy - radius) * scale_y;
+            bounds.w = 2.0f * radius * scale_x;
+            bounds.h = 2.0f * radius * scale_y;
+            SetDrawReorderable(renderer, cmd, vertex_start, &bounds);
         }
     }
     return result;
@@ -801,6 +1251,7 @@ static bool QueueCmdGeometry(SDL_Renderer *renderer, SDL_Texture *texture,
     bool result = false;
     cmd = PrepQueueCmdDraw(renderer, SDL_RENDERCMD_GEOMETRY, texture);
     if (cmd) {
+        const size_t vertex_start = renderer->vertex_data_used;
         cmd->data.draw.texture_address_mode_u = texture_address_mode_u;
         cmd->data.draw.texture_address_mode_v = texture_address_mode_v;
         result = renderer->QueueGeometry(renderer, cmd, texture,
@@ -810,6 +1261,10 @@ static bool QueueCmdGeometry(SDL_Renderer *renderer, SDL_Texture *texture,
                                          scale_x, scale_y);
         if (!result) {
             cmd->command = SDL_RENDERCMD_NO_OP;
+        } else if (renderer->reorder_draws && num_vertices > 0) {
+            SDL_FRect bounds;
+            GetPointBounds(xy, xy_stride, num_vertices, scale_x, scale_y, &bounds);
+            SetDrawReorderable(renderer, cmd, vertex_start, &bounds);
         }
     }
     return result;
@@ -1086,6 +1541,16 @@ SDL_Renderer *SDL_CreateRendererWithProperties(SDL_PropertiesID props)
         SDL_SetNumberProperty(props, SDL_PROP_RENDERER_CREATE_PRESENT_VSYNC_NUMBER, SDL_GetHintBoolean(SDL_HINT_RENDER_VSYNC, true));
     }
 
+    hint = SDL_GetHint(SDL_HINT_RENDER_REORDER_DRAWS);
+    if (hint && *hint) {
+        SDL_SetBooleanProperty(props, SDL_PROP_RENDERER_CREATE_REORDER_DRAWS_BOOLEAN, SDL_GetHintBoolean(SDL_HINT_RENDER_REORDER_DRAWS, false));
+    }
+    renderer->reorder_draws = SDL_GetBooleanProperty(props, SDL_PROP_RENDERER_CREATE_REORDER_DRAWS_BOOLEAN, false);
+
+    renderer->vertex_buffer_min_size = (size_t)SDL_max(SDL_GetNumberProperty(props, SDL_PROP_RENDERER_CREATE_VERTEX_BUFFER_SIZE_NUMBER, 0), 0);
+    renderer->vertex_buffer_decay_frames = (Uint64)SDL_max(SDL_GetNumberProperty(props, SDL_PROP_RENDERER_CREATE_VERTEX_BUFFER_DECAY_NUMBER, 300), 0);
+    AllocateRenderVertexBuffers(renderer);
+
     if (surface) {
 #ifdef SDL_VIDEO_RENDER_SW
         const bool rc = SW_CreateRendererForSurface(renderer, surface, props);
@@ -2351,6 +2816,7 @@ bool SDL_UpdateTexture(SDL_Texture *texture, const SDL_Rect *rect, const void *p
         if (!FlushRenderCommandsIfTextureNeeded(texture)) {
             return false;
         }
+        CountTextureUpload(texture, &real_rect);
         return renderer->UpdateTexture(renderer, texture, &real_rect, pixels, pitch);
     }
 }
@@ -2518,6 +2984,7 @@ bool SDL_UpdateYUVTexture(SDL_Texture *texture, const SDL_Rect *rect,
             if (!FlushRenderCommandsIfTextureNeeded(texture)) {
                 return false;
             }
+            CountTextureUpload(texture, &real_rect);
             return renderer->UpdateTextureYUV(renderer, texture, &real_rect, Yplane, Ypitch, Uplane, Upitch, Vplane, Vpitch);
         } else {
             return SDL_Unsupported();
@@ -2579,6 +3046,7 @@ bool SDL_UpdateNVTexture(SDL_Texture *texture, const SDL_Rect *rect,
             if (!FlushRenderCommandsIfTextureNeeded(texture)) {
                 return false;
             }
+            CountTextureUpload(texture, &real_rect);
             return renderer->UpdateTextureNV(renderer, texture, &real_rect, Yplane, Ypitch, UVplane, UVpitch);
         } else {
             return SDL_Unsupported();
@@ -2652,6 +3120,7 @@ bool SDL_LockTexture(SDL_Texture *texture, const SDL_Rect *rect, void **pixels,
         if (!FlushRenderCommandsIfTextureNeeded(texture)) {
             return false;
         }
+        texture->locked_rect = *rect;
         return renderer->LockTexture(renderer, texture, rect, pixels, pitch);
     }
 }
@@ -2759,6 +3228,7 @@ void SDL_UnlockTexture(SDL_Texture *texture)
         SDL_UnlockTextureNative(texture);
     } else {
         SDL_Renderer *renderer = texture->renderer;
+        CountTextureUpload(texture, &texture->locked_rect);
         renderer->UnlockTexture(renderer, texture);
     }
 
@@ -5586,6 +6056,7 @@ bool SDL_RenderPresent(SDL_Renderer *renderer)
     }
 
     FlushRenderCommands(renderer); // time to send everything to the GPU!
+    UpdateRenderFrameStats(renderer);
 
 #if DONT_DRAW_WHILE_HIDDEN
     // Don't present while we're hidden
@@ -5696,6 +6167,8 @@ static void SDL_DiscardAllCommands(SDL_Renderer *renderer)
 
 void SDL_DestroyRendererWithoutFreeing(SDL_Renderer *renderer)
 {
+    int i;
+
     SDL_assert(renderer != NULL);
     SDL_assert(!renderer->destroyed);
 
@@ -5745,10 +6218,24 @@ void SDL_DestroyRendererWithoutFreeing(SDL_Renderer *renderer)
         SDL_DestroyMutex(renderer->target_mutex);
         renderer->target_mutex = NULL;
     }
+    for (i = 0; i < SDL_RENDER_VERTEX_BUFFER_COUNT; ++i) {
+        if (i != renderer->vertex_buffer) {
+            SDL_free(renderer->vertex_buffers[i].data);
+        }
+        renderer->vertex_buffers[i].data = NULL;
+    }
     if (renderer->vertex_data) {
         SDL_free(renderer->vertex_data);
         renderer->vertex_data = NULL;
     }
+    if (renderer->reorder_vertex_data) {
+        SDL_free(renderer->reorder_vertex_data);
+        renderer->reorder_vertex_data = NULL;
+    }
+    if (renderer->reorder_batches) {
+        SDL_free(renderer->reorder_batches);
+        renderer->reorder_batches = NULL;
+    }
     if (renderer->texture_formats) {
         SDL_free(renderer->texture_formats);
         renderer->texture_formats = NULL;
@@ -6124,6 +6611,15 @@ bool SDL_SetDefaultTextureScaleMode(SDL_Renderer *renderer, SDL_ScaleMode scale_
 {
     CHECK_RENDERER_MAGIC(renderer, false);
 
+    switch (scale_mode) {
+    case SDL_SCALEMODE_NEAREST:
+    case SDL_SCALEMODE_PIXELART:
+    case SDL_SCALEMODE_LINEAR:
+        break;
+    default:
+        return SDL_InvalidParamError("scale_mode");
+    }
+
     renderer->scale_mode = scale_mode;
 
     return true;
@@ -167,6 +167,29 @@ typedef enum
     SDL_RENDERCMD_GEOMETRY
 } SDL_RenderCommandType;
 
+#define SDL_RENDERCMD_COUNT (SDL_RENDERCMD_GEOMETRY + 1)
+
+#define SDL_RENDER_VERTEX_BUFFER_COUNT 2
+
+typedef struct SDL_RenderVertexBuffer
+{
+    void *data;
+    size_t allocation;
+    size_t peak;        // the most vertex data used since decay_start
+    Uint64 decay_start; // the frame when the peak started being tracked
+} SDL_RenderVertexBuffer;
+
+// Counts of the work done by a renderer between calls to SDL_RenderPresent()
+typedef struct SDL_RenderStats
+{
+    Uint64 commands[SDL_RENDERCMD_COUNT];
+    Uint64 vertex_bytes;
+    Uint64 texture_upload_bytes;
+    Uint64 flushes;
+    Uint64 dependency_flushes;
+    Uint64 run_ns;
+} SDL_RenderStats;
+
 typedef struct SDL_RenderCommand
 {
     SDL_RenderCommandType command;
@@ -194,6 +217,9 @@ typedef struct SDL_RenderCommand
             SDL_TextureAddressMode texture_address_mode_u;
             SDL_TextureAddressMode texture_address_mode_v;
             SDL_GPURenderState *gpu_render_state;
+            bool reorderable;       // the draw can be moved among other draws when reordering
+            SDL_FRect bounds;       // the area touched by the draw, if it's reorderable
+            size_t vertex_end;      // the end of the vertex data of the draw, if it's reorderable
         } draw;
         struct
         {
@@ -345,6 +371,29 @@ struct SDL_Renderer
     void *vertex_data;
     size_t vertex_data_used;
     size_t vertex_data_allocation;
+    size_t vertex_data_alignment;
+
+    /* The queue alternates between vertex buffers each time it's flushed, so
+     * the vertex data passed to RunCommandQueue stays valid until the next
+     * flush, and buffers that have been larger than needed for a while shrink.
+     */
+    SDL_RenderVertexBuffer vertex_buffers[SDL_RENDER_VERTEX_BUFFER_COUNT];
+    int vertex_buffer;
+    size_t vertex_buffer_min_size;
+    Uint64 vertex_buffer_decay_frames;
+    Uint64 frame_count;
+
+    // Reordering and merging of draws before they're flushed
+    bool reorder_draws;
+    Uint64 queued_commands;
+    Uint64 merged_commands;
+    void *reorder_vertex_data;
+    size_t reorder_vertex_data_allocation;
+    struct SDL_RenderBatch *reorder_batches;
+    int reorder_batches_allocation;
+
+    // Statistics for the frame being drawn
+    SDL_RenderStats frame_stats;
 
     // Shaped window support
     bool transparent_window;
@@ -37,20 +37,308 @@
 
 // SDL surface based renderer implementation
 
+/* Scaled copy cache
+ *
+ * Scaled copies that can't be stretched straight onto the target are scaled
+ * into an intermediate surface first, which is then blended onto the target.
+ * The intermediate surfaces are kept, least recently used first out, so a
+ * sprite drawn at the same size every frame only costs the blend. Each tile
+ * worker keeps its own cache, so the byte budget is split between them.
+ */
+#define SW_SCALE_CACHE_MAX_ENTRIES 64
+#define SW_SCALE_CACHE_MAX_BYTES   (16 * 1024 * 1024)
+
+typedef struct SW_ScaledCopy
+{
+    SDL_Surface *texture;
+    SDL_Palette *palette;
+    Uint32 palette_version;
+    SDL_Rect srcrect;
+    int w;
+    int h;
+    SDL_ScaleMode scale_mode;
+    SDL_PixelFormat format;
+    Uint64 last_used;
+    SDL_Surface *surface;
+} SW_ScaledCopy;
+
+typedef struct SW_ScaleCache
+{
+    SW_ScaledCopy entries[SW_SCALE_CACHE_MAX_ENTRIES];
+    int num_entries;
+    size_t bytes;
+    size_t max_bytes;
+    Uint64 clock;
+    Uint64 hits;
+    Uint64 misses;
+} SW_ScaleCache;
+
 typedef struct
 {
     const SDL_Rect *viewport;
     const SDL_Rect *cliprect;
+    const SDL_Rect *tile;
+    SW_ScaleCache *scale_cache;
     bool surface_cliprect_dirty;
     SDL_Color color;
 } SW_DrawStateCache;
 
-typedef struct
+/* Tiled rendering, enabled with SDL_HINT_RENDER_SOFTWARE_THREADS
+ *
+ * The target is split into horizontal bands, each drawn on its own thread
+ * with the clip rect narrowed to the band. Before the threads start, every
+ * draw command is binned into the bands it overlaps, and state changes go to
+ * every band. Commands that don't draw the same pixels when clipped (scaled
+ * blits and lines) are drawn by the one band that contains them, or on their
+ * own between two barriers when they straddle bands.
+ */
+#define SW_MAX_TILE_THREADS 32
+#define SW_MIN_TILE_ROWS    16
+
+#define SW_PROP_SURFACE_TILE_VIEWS_POINTER "SDL.internal.render.sw.tile_views"
+
+typedef struct SW_TileCommand
+{
+    SDL_RenderCommand *cmd;
+    SDL_Surface **views;
+} SW_TileCommand;
+
+typedef struct SW_TileWorker
+{
+    struct SW_RenderData *data;
+    SDL_Thread *thread;
+    int index;
+    SDL_Rect tile;
+    SDL_Surface *surface;
+    SW_ScaleCache scale_cache;
+    const SW_TileCommand **commands; // the commands this tile draws, NULL is a barrier
+    int num_commands;
+    int max_commands;
+} SW_TileWorker;
+
+typedef struct SW_RenderData
 {
     SDL_Surface *surface;
     SDL_Surface *window;
+
+    int num_threads;
+    SW_TileWorker *workers;
+    SDL_Mutex *tile_lock;
+    SDL_Condition *tile_cond;
+    Uint32 tile_frame;
+    Uint32 tile_phase;
+    int tile_arrived;
+    bool tile_quit;
+    SW_TileCommand *tile_commands;
+    int max_tile_commands;
+    void *tile_vertices;
+
+    SW_ScaleCache scale_cache;
+    Uint64 scale_cache_hits;
+    Uint64 scale_cache_misses;
 } SW_RenderData;
 
+static void SDLCALL SW_DestroyTileViews(void *userdata, void *value)
+{
+    SDL_Surface **views = (SDL_Surface **)value;
+    int i;
+
+    for (i = 0; views[i]; ++i) {
+        SDL_DestroySurface(views[i]);
+    }
+    SDL_free(views);
+}
+
+static void SW_InvalidateTileViews(SDL_Surface *surface)
+{
+    if (surface->props) {
+        SDL_ClearProperty(surface->props, SW_PROP_SURFACE_TILE_VIEWS_POINTER);
+    }
+}
+
+/* Each tile thread blits from its own surface sharing the texture pixels, so
+ * the blend mode, color modulation and blit mapping can change without locks.
+ * RLE encoded textures are encoded once per view, so the views are kept until
+ * the texture changes.
+ */
+static SDL_Surface **SW_GetTileViews(SW_RenderData *data, SDL_Surface *surface)
+{
+    SDL_PropertiesID props = SDL_GetSurfaceProperties(surface);
+    SDL_Surface **views = (SDL_Surface **)SDL_GetPointerProperty(props, SW_PROP_SURFACE_TILE_VIEWS_POINTER, NULL);
+    void *pixels;
+    int i;
+
+    if (views) {
+        return views;
+    }
+
+    views = (SDL_Surface **)SDL_calloc(data->num_threads + 1, sizeof(*views));
+    if (!views) {
+        return NULL;
+    }
+
+    pixels = surface->pixels ? surface->pixels : surface->saved_pixels;
+    for (i = 0; i < data->num_threads; ++i) {
+        views[i] = SDL_CreateSurfaceFrom(surface->w, surface->h, surface->format, pixels, surface->pitch);
+        if (!views[i]) {
+            SW_DestroyTileViews(NULL, views);
+            return NULL;
+        }
+        if (surface->palette) {
+            SDL_SetSurfacePalette(views[i], surface->palette);
+        }
+        SDL_SetSurfaceRLE(views[i], SDL_SurfaceHasRLE(surface));
+    }
+
+    if (!SDL_SetPointerPropertyWithCleanup(props, SW_PROP_SURFACE_TILE_VIEWS_POINTER, views, SW_DestroyTileViews, NULL)) {
+        return NULL;
+    }
+    return views;
+}
+
+static void SW_RemoveScaledCopy(SW_ScaleCache *cache, int index)
+{
+    SW_ScaledCopy *entry = &cache->entries[index];
+
+    cache->bytes -= (size_t)entry->surface->pitch * entry->surface->h;
+    SDL_DestroySurface(entry->surface);
+    cache->entries[index] = cache->entries[--cache->num_entries];
+}
+
+// Drops the scaled copies of a texture surface, or all of them if texture is NULL
+static void SW_PurgeScaleCache(SW_ScaleCache *cache, SDL_Surface *texture)
+{
+    int i = 0;
+
+    while (i < cache->num_entries) {
+        if (!texture || cache->entries[i].texture == texture) {
+            SW_RemoveScaledCopy(cache, i);
+        } else {
+            ++i;
+        }
+    }
+}
+
+static void SW_InvalidateScaledCopies(SW_RenderData *data, SDL_Surface *texture)
+{
+    int i;
+
+    SW_PurgeScaleCache(&data->scale_cache, texture);
+    if (data->workers) {
+        for (i = 0; i < data->num_threads; ++i) {
+            SW_PurgeScaleCache(&data->workers[i].scale_cache, texture);
+        }
+    }
+}
+
+static void SW_UpdateScaleCacheStats(SDL_Renderer *renderer)
+{
+    SW_RenderData *data = (SW_RenderData *)renderer->internal;
+    Uint64 hits = data->scale_cache.hits;
+    Uint64 misses = data->scale_cache.misses;
+    int i;
+
+    if (data->workers) {
+        for (i = 0; i < data->num_threads; ++i) {
+            hits += data->workers[i].scale_cache.hits;
+            misses += data->workers[i].scale_cache.misses;
+        }
+    }
+
+    if (hits != data->scale_cache_hits || misses != data->scale_cache_misses) {
+        SDL_PropertiesID props = SDL_GetRendererProperties(renderer);
+        SDL_SetNumberProperty(props, SDL_PROP_RENDERER_SOFTWARE_SCALE_CACHE_HITS_NUMBER, (Sint64)hits);
+        SDL_SetNumberProperty(props, SDL_PROP_RENDERER_SOFTWARE_SCALE_CACHE_MISSES_NUMBER, (Sint64)misses);
+        data->scale_cache_hits = hits;
+        data->scale_cache_misses = misses;
+    }
+}
+
+/* Returns src scaled to w x h in the given format, with no blending or color
+ * modulation. Copies of textures that can't be drawn to are cached, and
+ * *cached is set when the caller mustn't free the result.
+ */
+static SDL_Surface *SW_GetScaledCopy(SW_ScaleCache *cache, SDL_Texture *texture, SDL_Surface *src, const SDL_Rect *srcrect,
+                                     int w, int h, SDL_PixelFormat format, SDL_ScaleMode scale_mode, bool *cached)
+{
+    SDL_Surface *key = (SDL_Surface *)texture->internal;
+    SDL_Palette *palette = src->palette;
+    const Uint32 palette_version = palette ? palette->version : 0;
+    SDL_Surface *surface;
+    SDL_Rect r;
+    size_t bytes;
+    int i;
+
+    *cached = false;
+
+    if (cache && texture->access != SDL_TEXTUREACCESS_TARGET) {
+        for (i = 0; i < cache->num_entries; ++i) {
+            SW_ScaledCopy *entry = &cache->entries[i];
+            if (entry->texture == key && entry->w == w && entry->h == h &&
+                entry->format == format && entry->scale_mode == scale_mode &&
+                entry->palette == palette && entry->palette_version == palette_version &&
+                SDL_RectsEqual(&entry->srcrect, srcrect)) {
+                entry->last_used = ++cache->clock;
+                ++cache->hits;
+                *cached = true;
+                return entry->surface;
+            }
+        }
+        ++cache->misses;
+    } else {
+        cache = NULL;
+    }
+
+    surface = SDL_CreateSurface(w, h, format);
+    if (!surface) {
+        return NULL;
+    }
+
+    r.x = 0;
+    r.y = 0;
+    r.w = w;
+    r.h = h;
+
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+    SDL_SetSurfaceColorMod(src, 255, 255, 255);
+    SDL_SetSurfaceAlphaMod(src, 255);
+
+    if (!SDL_BlitSurfaceScaled(src, srcrect, surface, &r, scale_mode)) {
+        return surface;
+    }
+
+    bytes = (size_t)surface->pitch * surface->h;
+    if (!cache || bytes > cache->max_bytes) {
+        return surface;
+    }
+
+    while (cache->num_entries == SW_SCALE_CACHE_MAX_ENTRIES || cache->bytes + bytes > cache->max_bytes) {
+        int oldest = 0;
+        for (i = 1; i < cache->num_entries; ++i) {
+            if (cache->entries[i].last_used < cache->entries[oldest].last_used) {
+                oldest = i;
+            }
+        }
+        SW_RemoveScaledCopy(cache, oldest);
+    }
+
+    SW_ScaledCopy *entry = &cache->entries[cache->num_entries++];
+    entry->texture = key;
+    entry->palette = palette;
+    entry->palette_version = palette_version;
+    entry->srcrect = *srcrect;
+    entry->w = w;
+    entry->h = h;
+    entry->scale_mode = scale_mode;
+    entry->format = format;
+    entry->last_used = ++cache->clock;
+    entry->surface = surface;
+    cache->bytes += bytes;
+
+    *cached = true;
+    return surface;
+}
+
 static SDL_Surface *SW_ActivateRenderer(SDL_Renderer *renderer)
 {
     SW_RenderData *data = (SW_RenderData *)renderer->internal;
@@ -128,6 +416,8 @@ static bool SW_ChangeTexturePalette(SDL_Renderer *renderer, SDL_Texture *texture
     if (texture->palette) {
         surface_palette = (SDL_Palette *)texture->palette->internal;
     }
+    SW_InvalidateTileViews(surface);
+    SW_InvalidateScaledCopies((SW_RenderData *)renderer->internal, surface);
     return SDL_SetSurfacePalette(surface, surface_palette);
 }
 
@@ -187,6 +477,11 @@ static bool SW_UpdateTexture(SDL_Renderer *renderer, SDL_Texture *texture,
     if (SDL_MUSTLOCK(surface)) {
         SDL_UnlockSurface(surface);
     }
+    // The tile views have their own RLE encoding of the old pixels
+    if (SDL_SurfaceHasRLE(surface)) {
+        SW_InvalidateTileViews(surface);
+    }
+    SW_InvalidateScaledCopies((SW_RenderData *)renderer->internal, surface);
     return true;
 }
 
@@ -204,6 +499,9 @@ static bool SW_LockTexture(SDL_Renderer *renderer, SDL_Texture *texture,
 
 static void SW_UnlockTexture(SDL_Renderer *renderer, SDL_Texture *texture)
 {
+    SDL_Surface *surface = (SDL_Surface *)texture->internal;
+
+    SW_InvalidateScaledCopies((SW_RenderData *)renderer->internal, surface);
 }
 
 static bool SW_SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture)
@@ -354,11 +652,10 @@ static bool Blit_to_Screen(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *sur
     return result;
 }
 
-static bool SW_RenderCopyEx(SDL_Renderer *renderer, SDL_Surface *surface, SDL_Texture *texture,
+static bool SW_RenderCopyEx(SDL_Surface *surface, SDL_Surface *src,
                             const SDL_Rect *srcrect, const SDL_Rect *final_rect,
                             const double angle, const SDL_FPoint *center, const SDL_FlipMode flip, float scale_x, float scale_y, const SDL_ScaleMode scaleMode)
 {
-    SDL_Surface *src = (SDL_Surface *)texture->internal;
     SDL_Rect tmp_rect;
     SDL_Surface *src_clone, *src_rotated, *src_scaled;
     SDL_Surface *mask = NULL, *mask_rotated = NULL;
@@ -662,15 +959,13 @@ static bool SW_QueueGeometry(SDL_Renderer *renderer, SDL_RenderCommand *cmd, SDL
     return true;
 }
 
-static void PrepTextureForCopy(const SDL_RenderCommand *cmd, SW_DrawStateCache *drawstate)
+static void PrepTextureForCopy(const SDL_RenderCommand *cmd, SDL_Surface *surface, SW_DrawStateCache *drawstate)
 {
     const Uint8 r = drawstate->color.r;
     const Uint8 g = drawstate->color.g;
     const Uint8 b = drawstate->color.b;
     const Uint8 a = drawstate->color.a;
     const SDL_BlendMode blend = cmd->data.draw.blend;
-    SDL_Texture *texture = cmd->data.draw.texture;
-    SDL_Surface *surface = (SDL_Surface *)texture->internal;
 
     // !!! FIXME: we can probably avoid some of these calls.
     SDL_SetSurfaceColorMod(surface, r, g, b);
@@ -683,19 +978,22 @@ static void SetDrawState(SDL_Surface *surface, SW_DrawStateCache *drawstate)
     if (drawstate->surface_cliprect_dirty) {
         const SDL_Rect *viewport = drawstate->viewport;
         const SDL_Rect *cliprect = drawstate->cliprect;
+        SDL_Rect clip_rect;
         SDL_assert_release(viewport != NULL); // the higher level should have forced a SDL_RENDERCMD_SETVIEWPORT
 
         if (cliprect && viewport) {
-            SDL_Rect clip_rect;
             clip_rect.x = cliprect->x + viewport->x;
             clip_rect.y = cliprect->y + viewport->y;
             clip_rect.w = cliprect->w;
             clip_rect.h = cliprect->h;
             SDL_GetRectIntersection(viewport, &clip_rect, &clip_rect);
-            SDL_SetSurfaceClipRect(surface, &clip_rect);
         } else {
-            SDL_SetSurfaceClipRect(surface, drawstate->viewport);
+            clip_rect = *viewport;
+        }
+        if (drawstate->tile) {
+            SDL_GetRectIntersection(drawstate->tile, &clip_rect, &clip_rect);
         }
+        SDL_SetSurfaceClipRect(surface, &clip_rect);
         drawstate->surface_cliprect_dirty = false;
     }
 }
@@ -705,294 +1003,799 @@ static void SW_InvalidateCachedState(SDL_Renderer *renderer)
     // SW_DrawStateCache only lives during SW_RunCommandQueue, so nothing to do here!
 }
 
+static void SW_InitDrawState(SW_DrawStateCache *drawstate, const SDL_Rect *tile, SW_ScaleCache *scale_cache)
+{
+    drawstate->viewport = NULL;
+    drawstate->cliprect = NULL;
+    drawstate->tile = tile;
+    drawstate->scale_cache = scale_cache;
+    drawstate->surface_cliprect_dirty = true;
+    drawstate->color.r = 0;
+    drawstate->color.g = 0;
+    drawstate->color.b = 0;
+    drawstate->color.a = 0;
+}
 
-static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize)
+static SDL_Surface *SW_GetCommandTexture(const SDL_RenderCommand *cmd)
 {
-    SDL_Surface *surface = SW_ActivateRenderer(renderer);
-    SW_DrawStateCache drawstate;
+    switch (cmd->command) {
+    case SDL_RENDERCMD_COPY:
+    case SDL_RENDERCMD_COPY_EX:
+    case SDL_RENDERCMD_GEOMETRY:
+        if (cmd->data.draw.texture) {
+            return (SDL_Surface *)cmd->data.draw.texture->internal;
+        }
+        break;
+    default:
+        break;
+    }
+    return NULL;
+}
 
-    if (!SDL_SurfaceValid(surface)) {
-        return false;
+// Moves the vertices of a draw command into the viewport, this is done once per command
+static void SW_ApplyViewport(SDL_RenderCommand *cmd, void *vertices, const SDL_Rect *viewport)
+{
+    const int count = (int)cmd->data.draw.count;
+    int i;
+
+    if (!viewport || (!viewport->x && !viewport->y)) {
+        return;
     }
 
-    drawstate.viewport = NULL;
-    drawstate.cliprect = NULL;
-    drawstate.surface_cliprect_dirty = true;
-    drawstate.color.r = 0;
-    drawstate.color.g = 0;
-    drawstate.color.b = 0;
-    drawstate.color.a = 0;
+    switch (cmd->command) {
+    case SDL_RENDERCMD_DRAW_POINTS:
+    case SDL_RENDERCMD_DRAW_LINES:
+    {
+        SDL_Point *verts = (SDL_Point *)(((Uint8 *)vertices) + cmd->data.draw.first);
+        for (i = 0; i < count; i++) {
+            verts[i].x += viewport->x;
+            verts[i].y += viewport->y;
+        }
+        break;
+    }
 
-    while (cmd) {
-        switch (cmd->command) {
-        case SDL_RENDERCMD_SETDRAWCOLOR:
-        {
-            drawstate.color.r = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.r * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
-            drawstate.color.g = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.g * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
-            drawstate.color.b = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.b * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
-            drawstate.color.a = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.a, 0.0f, 1.0f) * 255.0f);
-            break;
+    case SDL_RENDERCMD_FILL_RECTS:
+    {
+        SDL_Rect *verts = (SDL_Rect *)(((Uint8 *)vertices) + cmd->data.draw.first);
+        for (i = 0; i < count; i++) {
+            verts[i].x += viewport->x;
+            verts[i].y += viewport->y;
         }
+        break;
+    }
 
-        case SDL_RENDERCMD_SETVIEWPORT:
-        {
-            drawstate.viewport = &cmd->data.viewport.rect;
-            drawstate.surface_cliprect_dirty = true;
-            break;
+    case SDL_RENDERCMD_COPY:
+    {
+        SDL_Rect *verts = (SDL_Rect *)(((Uint8 *)vertices) + cmd->data.draw.first);
+        SDL_Rect *dstrect = verts + 1;
+        dstrect->x += viewport->x;
+        dstrect->y += viewport->y;
+        break;
+    }
+
+    case SDL_RENDERCMD_COPY_EX:
+    {
+        CopyExData *copydata = (CopyExData *)(((Uint8 *)vertices) + cmd->data.draw.first);
+        if (copydata->scale_x > 0.0f && copydata->scale_y > 0.0f) {
+            copydata->dstrect.x += (int)(viewport->x / copydata->scale_x);
+            copydata->dstrect.y += (int)(viewport->y / copydata->scale_y);
         }
+        break;
+    }
 
-        case SDL_RENDERCMD_SETCLIPRECT:
-        {
-            drawstate.cliprect = cmd->data.cliprect.enabled ? &cmd->data.cliprect.rect : NULL;
-            drawstate.surface_cliprect_dirty = true;
-            break;
+    case SDL_RENDERCMD_GEOMETRY:
+    {
+        SDL_Point vp;
+        vp.x = viewport->x;
+        vp.y = viewport->y;
+        trianglepoint_2_fixedpoint(&vp);
+        if (cmd->data.draw.texture) {
+            GeometryCopyData *ptr = (GeometryCopyData *)(((Uint8 *)vertices) + cmd->data.draw.first);
+            for (i = 0; i < count; i++) {
+                ptr[i].dst.x += vp.x;
+                ptr[i].dst.y += vp.y;
+            }
+        } else {
+            GeometryFillData *ptr = (GeometryFillData *)(((Uint8 *)vertices) + cmd->data.draw.first);
+            for (i = 0; i < count; i++) {
+                ptr[i].dst.x += vp.x;
+                ptr[i].dst.y += vp.y;
+            }
         }
+        break;
+    }
 
-        case SDL_RENDERCMD_CLEAR:
-        {
-            const Uint8 r = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.r * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
-            const Uint8 g = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.g * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
-            const Uint8 b = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.b * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
-            const Uint8 a = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.a, 0.0f, 1.0f) * 255.0f);
-            // By definition the clear ignores the clip rect
-            SDL_SetSurfaceClipRect(surface, NULL);
-            SDL_FillSurfaceRect(surface, NULL, SDL_MapSurfaceRGBA(surface, r, g, b, a));
-            drawstate.surface_cliprect_dirty = true;
-            break;
+    default:
+        break;
+    }
+}
+
+/* Runs a command whose vertices are already in the viewport.
+ * 'src' is the surface to draw textures from.
+ */
+static void SW_BlitScaledCopy(SW_DrawStateCache *drawstate, const SDL_RenderCommand *cmd, SDL_Surface *src, const SDL_Rect *srcrect,
+                              SDL_Surface *surface, const SDL_Rect *dstrect, SDL_PixelFormat format)
+{
+    SDL_Surface *tmp;
+    SDL_BlendMode blendmode;
+    Uint8 alphaMod, rMod, gMod, bMod;
+    bool cached;
+
+    SDL_GetSurfaceBlendMode(src, &blendmode);
+    SDL_GetSurfaceAlphaMod(src, &alphaMod);
+    SDL_GetSurfaceColorMod(src, &rMod, &gMod, &bMod);
+
+    tmp = SW_GetScaledCopy(drawstate->scale_cache, cmd->data.draw.texture, src, srcrect,
+                           dstrect->w, dstrect->h, format, cmd->data.draw.texture_scale_mode, &cached);
+    if (tmp) {
+        SDL_Rect r = *dstrect;
+
+        SDL_SetSurfaceColorMod(tmp, rMod, gMod, bMod);
+        SDL_SetSurfaceAlphaMod(tmp, alphaMod);
+        SDL_SetSurfaceBlendMode(tmp, blendmode);
+
+        SDL_BlitSurface(tmp, NULL, surface, &r);
+        if (!cached) {
+            SDL_DestroySurface(tmp);
         }
+        // No need to set back r/g/b/a/blendmode to 'src' since it's done in PrepTextureForCopy()
+    }
+}
 
-        case SDL_RENDERCMD_DRAW_POINTS:
-        {
-            const Uint8 r = drawstate.color.r;
-            const Uint8 g = drawstate.color.g;
-            const Uint8 b = drawstate.color.b;
-            const Uint8 a = drawstate.color.a;
-            const int count = (int)cmd->data.draw.count;
-            SDL_Point *verts = (SDL_Point *)(((Uint8 *)vertices) + cmd->data.draw.first);
-            const SDL_BlendMode blend = cmd->data.draw.blend;
-            SetDrawState(surface, &drawstate);
-
-            // Apply viewport
-            if (drawstate.viewport && (drawstate.viewport->x || drawstate.viewport->y)) {
-                int i;
-                for (i = 0; i < count; i++) {
-                    verts[i].x += drawstate.viewport->x;
-                    verts[i].y += drawstate.viewport->y;
-                }
-            }
+/* SDL_BlitSurfaceScaled() does a linear scaled copy with blending, color
+ * modulation or a format change in two steps, stretching into a temporary
+ * surface and blitting that. This returns the format of that surface when
+ * the copy isn't clipped, so the stretched pixels can be cached instead.
+ */
+static bool SW_GetScaledCopyFormat(const SDL_RenderCommand *cmd, SDL_Surface *src, const SDL_Rect *srcrect,
+                                   SDL_Surface *surface, const SDL_Rect *dstrect, SDL_PixelFormat *format)
+{
+    SDL_Rect bounds;
+    SDL_BlendMode blendmode;
+    Uint8 alphaMod, rMod, gMod, bMod;
 
-            if (blend == SDL_BLENDMODE_NONE) {
-                SDL_DrawPoints(surface, verts, count, SDL_MapSurfaceRGBA(surface, r, g, b, a));
-            } else {
-                SDL_BlendPoints(surface, verts, count, blend, r, g, b, a);
-            }
-            break;
+    if (cmd->data.draw.texture_scale_mode != SDL_SCALEMODE_LINEAR ||
+        dstrect->w > SDL_MAX_UINT16 || dstrect->h > SDL_MAX_UINT16 ||
+        srcrect->w > SDL_MAX_UINT16 || srcrect->h > SDL_MAX_UINT16) {
+        return false;
+    }
+    bounds.x = 0;
+    bounds.y = 0;
+    bounds.w = src->w;
+    bounds.h = src->h;
+    if (srcrect->w <= 0 || srcrect->h <= 0 || !SDL_GetRectIntersection(srcrect, &bounds, &bounds) || !SDL_RectsEqual(srcrect, &bounds)) {
+        return false;
+    }
+    if (!SDL_GetRectIntersection(dstrect, &surface->clip_rect, &bounds) || !SDL_RectsEqual(dstrect, &bounds)) {
+        return false;
+    }
+
+    if (SDL_BITSPERPIXEL(src->format) < 8) {
+        return false;
+    }
+    if (SDL_BYTESPERPIXEL(src->format) == 4 && !SDL_ISPIXELFORMAT_INDEXED(src->format) && src->format != SDL_PIXELFORMAT_ARGB2101010) {
+        *format = src->format;
+    } else if (SDL_BYTESPERPIXEL(surface->format) == 4 && surface->format != SDL_PIXELFORMAT_ARGB2101010) {
+        *format = surface->format;
+    } else {
+        *format = SDL_PIXELFORMAT_ARGB8888;
+    }
+
+    SDL_GetSurfaceBlendMode(src, &blendmode);
+    SDL_GetSurfaceAlphaMod(src, &alphaMod);
+    SDL_GetSurfaceColorMod(src, &rMod, &gMod, &bMod);
+    if (blendmode == SDL_BLENDMODE_NONE && alphaMod == 255 && rMod == 255 && gMod == 255 && bMod == 255 &&
+        *format == surface->format) {
+        // This is stretched straight onto the target
+        return false;
+    }
+    return true;
+}
+
+static void SW_RunCommand(SDL_Surface *surface, SW_DrawStateCache *drawstate, const SDL_RenderCommand *cmd, void *vertices, SDL_Surface *src)
+{
+    switch (cmd->command) {
+    case SDL_RENDERCMD_SETDRAWCOLOR:
+    {
+        drawstate->color.r = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.r * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
+        drawstate->color.g = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.g * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
+        drawstate->color.b = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.b * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
+        drawstate->color.a = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.a, 0.0f, 1.0f) * 255.0f);
+        break;
+    }
+
+    case SDL_RENDERCMD_SETVIEWPORT:
+    {
+        drawstate->viewport = &cmd->data.viewport.rect;
+        drawstate->surface_cliprect_dirty = true;
+        break;
+    }
+
+    case SDL_RENDERCMD_SETCLIPRECT:
+    {
+        drawstate->cliprect = cmd->data.cliprect.enabled ? &cmd->data.cliprect.rect : NULL;
+        drawstate->surface_cliprect_dirty = true;
+        break;
+    }
+
+    case SDL_RENDERCMD_CLEAR:
+    {
+        const Uint8 r = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.r * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
+        const Uint8 g = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.g * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
+        const Uint8 b = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.b * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
+        const Uint8 a = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.a, 0.0f, 1.0f) * 255.0f);
+        // By definition the clear ignores the clip rect, but not the tile
+        SDL_SetSurfaceClipRect(surface, drawstate->tile);
+        SDL_FillSurfaceRect(surface, NULL, SDL_MapSurfaceRGBA(surface, r, g, b, a));
+        drawstate->surface_cliprect_dirty = true;
+        break;
+    }
+
+    case SDL_RENDERCMD_DRAW_POINTS:
+    {
+        const Uint8 r = drawstate->color.r;
+        const Uint8 g = drawstate->color.g;
+        const Uint8 b = drawstate->color.b;
+        const Uint8 a = drawstate->color.a;
+        const int count = (int)cmd->data.draw.count;
+        SDL_Point *verts = (SDL_Point *)(((Uint8 *)vertices) + cmd->data.draw.first);
+        const SDL_BlendMode blend = cmd->data.draw.blend;
+        SetDrawState(surface, drawstate);
+
+        if (blend == SDL_BLENDMODE_NONE) {
+            SDL_DrawPoints(surface, verts, count, SDL_MapSurfaceRGBA(surface, r, g, b, a));
+        } else {
+            SDL_BlendPoints(surface, verts, count, blend, r, g, b, a);
         }
+        break;
+    }
 
-        case SDL_RENDERCMD_DRAW_LINES:
-        {
-            const Uint8 r = drawstate.color.r;
-            const Uint8 g = drawstate.color.g;
-            const Uint8 b = drawstate.color.b;
-            const Uint8 a = drawstate.color.a;
-            const int count = (int)cmd->data.draw.count;
-            SDL_Point *verts = (SDL_Point *)(((Uint8 *)vertices) + cmd->data.draw.first);
-            const SDL_BlendMode blend = cmd->data.draw.blend;
-            SetDrawState(surface, &drawstate);
-
-            // Apply viewport
-            if (drawstate.viewport && (drawstate.viewport->x || drawstate.viewport->y)) {
-                int i;
-                for (i = 0; i < count; i++) {
-                    verts[i].x += drawstate.viewport->x;
-                    verts[i].y += drawstate.viewport->y;
-                }
-            }
+    case SDL_RENDERCMD_DRAW_LINES:
+    {
+        const Uint8 r = drawstate->color.r;
+        const Uint8 g = drawstate->color.g;
+        const Uint8 b = drawstate->color.b;
+        const Uint8 a = drawstate->color.a;
+        const int count = (int)cmd->data.draw.count;
+        SDL_Point *verts = (SDL_Point *)(((Uint8 *)vertices) + cmd->data.draw.first);
+        const SDL_BlendMode blend = cmd->data.draw.blend;
+        SetDrawState(surface, drawstate);
+
+        if (blend == SDL_BLENDMODE_NONE) {
+            SDL_DrawLines(surface, verts, count, SDL_MapSurfaceRGBA(surface, r, g, b, a));
+        } else {
+            SDL_BlendLines(surface, verts, count, blend, r, g, b, a);
+        }
+        break;
+    }
 
-            if (blend == SDL_BLENDMODE_NONE) {
-                SDL_DrawLines(surface, verts, count, SDL_MapSurfaceRGBA(surface, r, g, b, a));
+    case SDL_RENDERCMD_FILL_RECTS:
+    {
+        const Uint8 r = drawstate->color.r;
+        const Uint8 g = drawstate->color.g;
+        const Uint8 b = drawstate->color.b;
+        const Uint8 a = drawstate->color.a;
+        const int count = (int)cmd->data.draw.count;
+        SDL_Rect *verts = (SDL_Rect *)(((Uint8 *)vertices) + cmd->data.draw.first);
+        const SDL_BlendMode blend = cmd->data.draw.blend;
+        SetDrawState(surface, drawstate);
+
+        if (blend == SDL_BLENDMODE_NONE) {
+            SDL_FillSurfaceRects(surface, verts, count, SDL_MapSurfaceRGBA(surface, r, g, b, a));
+        } else {
+            SDL_BlendFillRects(surface, verts, count, blend, r, g, b, a);
+        }
+        break;
+    }
+
+    case SDL_RENDERCMD_COPY:
+    {
+        SDL_Rect *verts = (SDL_Rect *)(((Uint8 *)vertices) + cmd->data.draw.first);
+        const SDL_Rect *srcrect = verts;
+        SDL_Rect *dstrect = verts + 1;
+
+        SetDrawState(surface, drawstate);
+
+        PrepTextureForCopy(cmd, src, drawstate);
+
+        if (srcrect->w == dstrect->w && srcrect->h == dstrect->h) {
+            SDL_BlitSurface(src, srcrect, surface, dstrect);
+        } else {
+            SDL_PixelFormat format;
+
+            // Prevent to do scaling + clipping on viewport boundaries as it may lose proportion
+            if (dstrect->x < 0 || dstrect->y < 0 || dstrect->x + dstrect->w > surface->w || dstrect->y + dstrect->h > surface->h) {
+                // Scale to an intermediate surface, then blit
+                SW_BlitScaledCopy(drawstate, cmd, src, srcrect, surface, dstrect, surface->format);
+            } else if (SW_GetScaledCopyFormat(cmd, src, srcrect, surface, dstrect, &format)) {
+                SW_BlitScaledCopy(drawstate, cmd, src, srcrect, surface, dstrect, format);
             } else {
-                SDL_BlendLines(surface, verts, count, blend, r, g, b, a);
+                SDL_BlitSurfaceScaled(src, srcrect, surface, dstrect, cmd->data.draw.texture_scale_mode);
             }
-            break;
         }
+        break;
+    }
 
-        case SDL_RENDERCMD_FILL_RECTS:
-        {
-            const Uint8 r = drawstate.color.r;
-            const Uint8 g = drawstate.color.g;
-            const Uint8 b = drawstate.color.b;
-            const Uint8 a = drawstate.color.a;
-            const int count = (int)cmd->data.draw.count;
-            SDL_Rect *verts = (SDL_Rect *)(((Uint8 *)vertices) + cmd->data.draw.first);
-            const SDL_BlendMode blend = cmd->data.draw.blend;
-            SetDrawState(surface, &drawstate);
-
-            // Apply viewport
-            if (drawstate.viewport && (drawstate.viewport->x || drawstate.viewport->y)) {
-                int i;
-                for (i = 0; i < count; i++) {
-                    verts[i].x += drawstate.viewport->x;
-                    verts[i].y += drawstate.viewport->y;
-                }
+    case SDL_RENDERCMD_COPY_EX:
+    {
+        CopyExData *copydata = (CopyExData *)(((Uint8 *)vertices) + cmd->data.draw.first);
+        SetDrawState(surface, drawstate);
+        PrepTextureForCopy(cmd, src, drawstate);
+
+        SW_RenderCopyEx(surface, src, &copydata->srcrect,
+                        &copydata->dstrect, copydata->angle, &copydata->center, copydata->flip,
+                        copydata->scale_x, copydata->scale_y, cmd->data.draw.texture_scale_mode);
+        break;
+    }
+
+    case SDL_RENDERCMD_GEOMETRY:
+    {
+        int i;
+        SDL_Rect *verts = (SDL_Rect *)(((Uint8 *)vertices) + cmd->data.draw.first);
+        const int count = (int)cmd->data.draw.count;
+        const SDL_BlendMode blend = cmd->data.draw.blend;
+
+        SetDrawState(surface, drawstate);
+
+        if (src) {
+            GeometryCopyData *ptr = (GeometryCopyData *)verts;
+
+            PrepTextureForCopy(cmd, src, drawstate);
+
+            for (i = 0; i < count; i += 3, ptr += 3) {
+                SDL_SW_BlitTriangle(
+                    src,
+                    &(ptr[0].src), &(ptr[1].src), &(ptr[2].src),
+                    surface,
+                    &(ptr[0].dst), &(ptr[1].dst), &(ptr[2].dst),
+                    ptr[0].color, ptr[1].color, ptr[2].color,
+                    cmd->data.draw.texture_address_mode_u,
+                    cmd->data.draw.texture_address_mode_v);
             }
+        } else {
+            GeometryFillData *ptr = (GeometryFillData *)verts;
 
-            if (blend == SDL_BLENDMODE_NONE) {
-                SDL_FillSurfaceRects(surface, verts, count, SDL_MapSurfaceRGBA(surface, r, g, b, a));
-            } else {
-                SDL_BlendFillRects(surface, verts, count, blend, r, g, b, a);
+            for (i = 0; i < count; i += 3, ptr += 3) {
+                SDL_SW_FillTriangle(surface, &(ptr[0].dst), &(ptr[1].dst), &(ptr[2].dst), blend, ptr[0].color, ptr[1].color, ptr[2].color);
             }
-            break;
         }
+        break;
+    }
 
-        case SDL_RENDERCMD_COPY:
-        {
-            SDL_Rect *verts = (SDL_Rect *)(((Uint8 *)vertices) + cmd->data.draw.first);
-            const SDL_Rect *srcrect = verts;
-            SDL_Rect *dstrect = verts + 1;
-            SDL_Texture *texture = cmd->data.draw.texture;
-            SDL_Surface *src = (SDL_Surface *)texture->internal;
+    case SDL_RENDERCMD_NO_OP:
+        break;
+    }
+}
 
-            SetDrawState(surface, &drawstate);
+/* Gets the area a draw command may touch, with its vertices in the viewport.
+ * Returns true if the command draws the same pixels when the clip rect is
+ * narrowed, false if it has to be drawn with the clip rect it was given.
+ */
+static bool SW_GetCommandBounds(const SDL_RenderCommand *cmd, void *vertices, SDL_Surface *surface, SDL_Rect *bounds)
+{
+    const int count = (int)cmd->data.draw.count;
+    int i;
 
-            PrepTextureForCopy(cmd, &drawstate);
+    SDL_zerop(bounds);
 
-            // Apply viewport
-            if (drawstate.viewport && (drawstate.viewport->x || drawstate.viewport->y)) {
-                dstrect->x += drawstate.viewport->x;
-                dstrect->y += drawstate.viewport->y;
-            }
+    switch (cmd->command) {
+    case SDL_RENDERCMD_DRAW_POINTS:
+    case SDL_RENDERCMD_DRAW_LINES:
+    {
+        const SDL_Point *verts = (const SDL_Point *)(((Uint8 *)vertices) + cmd->data.draw.first);
+        SDL_GetRectEnclosingPoints(verts, count, NULL, bounds);
+        // Clipping moves the end points of lines, which changes their slope
+        return (cmd->command == SDL_RENDERCMD_DRAW_POINTS);
+    }
 
-            if (srcrect->w == dstrect->w && srcrect->h == dstrect->h) {
-                SDL_BlitSurface(src, srcrect, surface, dstrect);
-            } else {
-                // Prevent to do scaling + clipping on viewport boundaries as it may lose proportion
-                if (dstrect->x < 0 || dstrect->y < 0 || dstrect->x + dstrect->w > surface->w || dstrect->y + dstrect->h > surface->h) {
-                    SDL_Surface *tmp = SDL_CreateSurface(dstrect->w, dstrect->h, surface->format);
-                    // Scale to an intermediate surface, then blit
-                    if (tmp) {
-                        SDL_Rect r;
-                        SDL_BlendMode blendmode;
-                        Uint8 alphaMod, rMod, gMod, bMod;
-
-                        SDL_GetSurfaceBlendMode(src, &blendmode);
-                        SDL_GetSurfaceAlphaMod(src, &alphaMod);
-                        SDL_GetSurfaceColorMod(src, &rMod, &gMod, &bMod);
-
-                        r.x = 0;
-                        r.y = 0;
-                        r.w = dstrect->w;
-                        r.h = dstrect->h;
-
-                        SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
-                        SDL_SetSurfaceColorMod(src, 255, 255, 255);
-                        SDL_SetSurfaceAlphaMod(src, 255);
-
-                        SDL_BlitSurfaceScaled(src, srcrect, tmp, &r, cmd->data.draw.texture_scale_mode);
-
-                        SDL_SetSurfaceColorMod(tmp, rMod, gMod, bMod);
-                        SDL_SetSurfaceAlphaMod(tmp, alphaMod);
-                        SDL_SetSurfaceBlendMode(tmp, blendmode);
-
-                        SDL_BlitSurface(tmp, NULL, surface, dstrect);
-                        SDL_DestroySurface(tmp);
-                        // No need to set back r/g/b/a/blendmode to 'src' since it's done in PrepTextureForCopy()
-                    }
-                } else {
-                    SDL_BlitSurfaceScaled(src, srcrect, surface, dstrect, cmd->data.draw.texture_scale_mode);
-                }
-            }
-            break;
+    case SDL_RENDERCMD_FILL_RECTS:
+    {
+        const SDL_Rect *verts = (const SDL_Rect *)(((Uint8 *)vertices) + cmd->data.draw.first);
+        for (i = 0; i < count; i++) {
+            SDL_GetRectUnion(bounds, &verts[i], bounds);
+        }
+        return true;
+    }
+
+    case SDL_RENDERCMD_COPY:
+    {
+        const SDL_Rect *verts = (const SDL_Rect *)(((Uint8 *)vertices) + cmd->data.draw.first);
+        const SDL_Rect *srcrect = verts;
+        const SDL_Rect *dstrect = verts + 1;
+        *bounds = *dstrect;
+        // Clipping a scaled blit rounds the source rectangle differently
+        return (srcrect->w == dstrect->w && srcrect->h == dstrect->h);
+    }
+
+    case SDL_RENDERCMD_COPY_EX:
+    {
+        const CopyExData *copydata = (const CopyExData *)(((Uint8 *)vertices) + cmd->data.draw.first);
+        SDL_Rect rect_dest;
+        double cangle, sangle;
+
+        // This matches the rectangle that SW_RenderCopyEx() blits to
+        SDLgfx_rotozoomSurfaceSizeTrig(copydata->dstrect.w, copydata->dstrect.h, copydata->angle, &copydata->center,
+                                       &rect_dest, &cangle, &sangle);
+        bounds->x = copydata->dstrect.x + rect_dest.x;
+        bounds->y = copydata->dstrect.y + rect_dest.y;
+        bounds->w = rect_dest.w;
+        bounds->h = rect_dest.h;
+        if (copydata->scale_x != 1.0f || copydata->scale_y != 1.0f) {
+            bounds->x = (int)((float)bounds->x * copydata->scale_x) - 1;
+            bounds->y = (int)((float)bounds->y * copydata->scale_y) - 1;
+            bounds->w = (int)((float)bounds->w * copydata->scale_x) + 2;
+            bounds->h = (int)((float)bounds->h * copydata->scale_y) + 2;
+            return false;
         }
+        return true;
+    }
 
-        case SDL_RENDERCMD_COPY_EX:
-        {
-            CopyExData *copydata = (CopyExData *)(((Uint8 *)vertices) + cmd->data.draw.first);
-            SetDrawState(surface, &drawstate);
-            PrepTextureForCopy(cmd, &drawstate);
-
-            // Apply viewport
-            if (drawstate.viewport &&
-                (drawstate.viewport->x || drawstate.viewport->y) &&
-                (copydata->scale_x > 0.0f && copydata->scale_y > 0.0f)) {
-                copydata->dstrect.x += (int)(drawstate.viewport->x / copydata->scale_x);
-                copydata->dstrect.y += (int)(drawstate.viewport->y / copydata->scale_y);
-            }
+    case SDL_RENDERCMD_GEOMETRY:
+    {
+        const Uint8 *ptr = ((Uint8 *)vertices) + cmd->data.draw.first;
+        const size_t stride = cmd->data.draw.texture ? sizeof(GeometryCopyData) : sizeof(GeometryFillData);
+        const size_t offset = cmd->data.draw.texture ? offsetof(GeometryCopyData, dst) : offsetof(GeometryFillData, dst);
+        int min_x = SDL_MAX_SINT32, min_y = SDL_MAX_SINT32;
+        int max_x = SDL_MIN_SINT32, max_y = SDL_MIN_SINT32;
 
-            SW_RenderCopyEx(renderer, surface, cmd->data.draw.texture, &copydata->srcrect,
-                            &copydata->dstrect, copydata->angle, &copydata->center, copydata->flip,
-                            copydata->scale_x, copydata->scale_y, cmd->data.draw.texture_scale_mode);
+        if (count <= 0) {
+            return true;
+        }
+        for (i = 0; i < count; i++, ptr += stride) {
+            const SDL_Point *dst = (const SDL_Point *)(ptr + offset);
+            min_x = SDL_min(min_x, dst->x);
+            min_y = SDL_min(min_y, dst->y);
+            max_x = SDL_max(max_x, dst->x);
+            max_y = SDL_max(max_y, dst->y);
+        }
+        // points are in fixed point, shift back
+        bounds->x = min_x >> FP_BITS;
+        bounds->y = min_y >> FP_BITS;
+        bounds->w = (max_x >> FP_BITS) - bounds->x + 1;
+        bounds->h = (max_y >> FP_BITS) - bounds->y + 1;
+        return true;
+    }
+
+    default:
+        bounds->w = surface->w;
+        bounds->h = surface->h;
+        return true;
+    }
+}
+
+static void SW_WaitForTiles(SW_RenderData *data)
+{
+    Uint32 phase;
+
+    SDL_LockMutex(data->tile_lock);
+    phase = data->tile_phase;
+    if (++data->tile_arrived == data->num_threads) {
+        data->tile_arrived = 0;
+        ++data->tile_phase;
+        SDL_BroadcastCondition(data->tile_cond);
+    } else {
+        while (data->tile_phase == phase) {
+            SDL_WaitCondition(data->tile_cond, data->tile_lock);
+        }
+    }
+    SDL_UnlockMutex(data->tile_lock);
+}
+
+static void SW_RenderTile(SW_TileWorker *worker)
+{
+    SW_RenderData *data = worker->data;
+    const SDL_Rect *tile = &worker->tile;
+    SW_DrawStateCache drawstate;
+    bool serial = false;
+    int i;
+
+    SW_InitDrawState(&drawstate, tile, &worker->scale_cache);
+
+    for (i = 0; i < worker->num_commands; ++i) {
+        const SW_TileCommand *tc = worker->commands[i];
+
+        if (!tc) {
+            // Everything drawn so far has to land before (or after) the serial commands
+            SW_WaitForTiles(data);
+            serial = !serial;
+            drawstate.tile = serial ? NULL : tile;
+            drawstate.surface_cliprect_dirty = true;
+            continue;
+        }
+        SW_RunCommand(worker->surface, &drawstate, tc->cmd, data->tile_vertices, tc->views ? tc->views[worker->index] : NULL);
+    }
+
+    SW_WaitForTiles(data);
+}
+
+static int SDLCALL SW_TileThread(void *userdata)
+{
+    SW_TileWorker *worker = (SW_TileWorker *)userdata;
+    SW_RenderData *data = worker->data;
+    Uint32 frame = 0;
+
+    for (;;) {
+        bool quit;
+
+        SDL_LockMutex(data->tile_lock);
+        while (data->tile_frame == frame && !data->tile_quit) {
+            SDL_WaitCondition(data->tile_cond, data->tile_lock);
+        }
+        frame = data->tile_frame;
+        quit = data->tile_quit;
+        SDL_UnlockMutex(data->tile_lock);
+
+        if (quit) {
             break;
         }
+        SW_RenderTile(worker);
+    }
+    return 0;
+}
 
-        case SDL_RENDERCMD_GEOMETRY:
-        {
-            int i;
-            SDL_Rect *verts = (SDL_Rect *)(((Uint8 *)vertices) + cmd->data.draw.first);
-            const int count = (int)cmd->data.draw.count;
-            SDL_Texture *texture = cmd->data.draw.texture;
-            const SDL_BlendMode blend = cmd->data.draw.blend;
+static void SW_StopTileWorkers(SW_RenderData *data)
+{
+    int i;
 
-            SetDrawState(surface, &drawstate);
+    if (data->workers) {
+        SDL_LockMutex(data->tile_lock);
+        data->tile_quit = true;
+        SDL_BroadcastCondition(data->tile_cond);
+        SDL_UnlockMutex(data->tile_lock);
 
-            if (texture) {
-                SDL_Surface *src = (SDL_Surface *)texture->internal;
+        for (i = 1; i < data->num_threads; ++i) {
+            SDL_WaitThread(data->workers[i].thread, NULL);
+        }
+        for (i = 0; i < data->num_threads; ++i) {
+            SW_PurgeScaleCache(&data->workers[i].scale_cache, NULL);
+            SDL_DestroySurface(data->workers[i].surface);
+            SDL_free(data->workers[i].commands);
+        }
+        SDL_free(data->workers);
+        data->workers = NULL;
+    }
+    SDL_DestroyCondition(data->tile_cond);
+    data->tile_cond = NULL;
+    SDL_DestroyMutex(data->tile_lock);
+    data->tile_lock = NULL;
+    SDL_free(data->tile_commands);
+    data->tile_commands = NULL;
+    data->max_tile_commands = 0;
+}
 
-                GeometryCopyData *ptr = (GeometryCopyData *)verts;
+static bool SW_StartTileWorkers(SW_RenderData *data)
+{
+    int i;
 
-                PrepTextureForCopy(cmd, &drawstate);
+    data->tile_lock = SDL_CreateMutex();
+    data->tile_cond = SDL_CreateCondition();
+    if (!data->tile_lock || !data->tile_cond) {
+        SW_StopTileWorkers(data);
+        return false;
+    }
 
-                // Apply viewport
-                if (drawstate.viewport && (drawstate.viewport->x || drawstate.viewport->y)) {
-                    SDL_Point vp;
-                    vp.x = drawstate.viewport->x;
-                    vp.y = drawstate.viewport->y;
-                    trianglepoint_2_fixedpoint(&vp);
-                    for (i = 0; i < count; i++) {
-                        ptr[i].dst.x += vp.x;
-                        ptr[i].dst.y += vp.y;
-                    }
-                }
+    data->workers = (SW_TileWorker *)SDL_calloc(data->num_threads, sizeof(*data->workers));
+    if (!data->workers) {
+        SW_StopTileWorkers(data);
+        return false;
+    }
+    data->tile_quit = false;
+
+    // The calling thread renders the first tile
+    for (i = 0; i < data->num_threads; ++i) {
+        SW_TileWorker *worker = &data->workers[i];
+        worker->data = data;
+        worker->index = i;
+        worker->scale_cache.max_bytes = SW_SCALE_CACHE_MAX_BYTES / data->num_threads;
+        if (i > 0) {
+            worker->thread = SDL_CreateThread(SW_TileThread, "SDLRenderTile", worker);
+            if (!worker->thread) {
+                // Only wait on the threads that were started
+                data->num_threads = i;
+                SW_StopTileWorkers(data);
+                return false;
+            }
+        }
+    }
+    return true;
+}
 
-                for (i = 0; i < count; i += 3, ptr += 3) {
-                    SDL_SW_BlitTriangle(
-                        src,
-                        &(ptr[0].src), &(ptr[1].src), &(ptr[2].src),
-                        surface,
-                        &(ptr[0].dst), &(ptr[1].dst), &(ptr[2].dst),
-                        ptr[0].color, ptr[1].color, ptr[2].color,
-                        cmd->data.draw.texture_address_mode_u,
-                        cmd->data.draw.texture_address_mode_v);
-                }
-            } else {
-                GeometryFillData *ptr = (GeometryFillData *)verts;
-
-                // Apply viewport
-                if (drawstate.viewport && (drawstate.viewport->x || drawstate.viewport->y)) {
-                    SDL_Point vp;
-                    vp.x = drawstate.viewport->x;
-                    vp.y = drawstate.viewport->y;
-                    trianglepoint_2_fixedpoint(&vp);
-                    for (i = 0; i < count; i++) {
-                        ptr[i].dst.x += vp.x;
-                        ptr[i].dst.y += vp.y;
-                    }
-                }
+// Gets the surface a worker draws through, which shares the pixels of the target
+static bool SW_UpdateTileSurface(SW_TileWorker *worker, SDL_Surface *surface)
+{
+    SDL_Surface *view = worker->surface;
 
-                for (i = 0; i < count; i += 3, ptr += 3) {
-                    SDL_SW_FillTriangle(surface, &(ptr[0].dst), &(ptr[1].dst), &(ptr[2].dst), blend, ptr[0].color, ptr[1].color, ptr[2].color);
+    if (!view || view->w != surface->w || view->h != surface->h || view->format != surface->format ||
+        view->pixels != surface->pixels || view->pitch != surface->pitch) {
+        SDL_DestroySurface(view);
+        worker->surface = view = SDL_CreateSurfaceFrom(surface->w, surface->h, surface->format, surface->pixels, surface->pitch);
+        if (!view) {
+            return false;
+        }
+    }
+    if (view->palette != surface->palette) {
+        SDL_SetSurfacePalette(view, surface->palette);
+    }
+    return true;
+}
+
+static bool SW_RunCommandQueueTiled(SW_RenderData *data, SDL_Surface *surface, SDL_RenderCommand *cmd, void *vertices)
+{
+    const SDL_Rect *viewport = NULL;
+    SDL_Surface *last_texture = NULL;
+    SDL_Surface **last_views = NULL;
+    SDL_RenderCommand *it;
+    int num_tiles, tile_rows, last_tile;
+    int i, j, count;
+    bool serial = false;
+
+    if (SDL_MUSTLOCK(surface) || surface->h < 2 * SW_MIN_TILE_ROWS) {
+        return false;
+    }
+
+    if (!data->workers && !SW_StartTileWorkers(data)) {
+        // Don't try again, render everything on the calling thread
+        data->num_threads = 1;
+        return false;
+    }
+
+    count = 0;
+    for (it = cmd; it; it = it->next) {
+        ++count;
+    }
+    if (count > data->max_tile_commands) {
+        int max_tile_commands = SDL_max(count, 2 * data->max_tile_commands);
+        SW_TileCommand *tile_commands = (SW_TileCommand *)SDL_realloc(data->tile_commands, max_tile_commands * sizeof(*tile_commands));
+        if (!tile_commands) {
+            return false;
+        }
+        data->tile_commands = tile_commands;
+        data->max_tile_commands = max_tile_commands;
+    }
+
+    // Each tile gets every command at most once, plus a barrier before each command at most
+    for (i = 0; i < data->num_threads; ++i) {
+        SW_TileWorker *worker = &data->workers[i];
+
+        if (2 * count > worker->max_commands) {
+            int max_commands = SDL_max(2 * count, 2 * worker->max_commands);
+            const SW_TileCommand **commands = (const SW_TileCommand **)SDL_realloc(worker->commands, max_commands * sizeof(*commands));
+            if (!commands) {
+                return false;
+            }
+            worker->commands = commands;
+            worker->max_commands = max_commands;
+        }
+        worker->num_commands = 0;
+    }
+
+    // Nothing has been changed yet if this fails, so it can still be rendered on the calling thread
+    for (i = 0, it = cmd; it; it = it->next, ++i) {
+        SW_TileCommand *tc = &data->tile_commands[i];
+        SDL_Surface *texture = SW_GetCommandTexture(it);
+
+        tc->cmd = it;
+        tc->views = NULL;
+        if (texture) {
+            if (texture != last_texture) {
+                last_views = SW_GetTileViews(data, texture);
+                if (!last_views) {
+                    return false;
                 }
+                last_texture = texture;
             }
-            break;
+            tc->views = last_views;
         }
+    }
 
+    num_tiles = SDL_min(data->num_threads, surface->h / SW_MIN_TILE_ROWS);
+    tile_rows = (surface->h + num_tiles - 1) / num_tiles;
+    last_tile = (surface->h - 1) / tile_rows;
+    for (i = 0; i < data->num_threads; ++i) {
+        SW_TileWorker *worker = &data->workers[i];
+
+        if (!SW_UpdateTileSurface(worker, surface)) {
+            return false;
+        }
+        worker->tile.x = 0;
+        worker->tile.y = SDL_min(i * tile_rows, surface->h);
+        worker->tile.w = surface->w;
+        worker->tile.h = SDL_clamp(surface->h - worker->tile.y, 0, tile_rows);
+    }
+
+    for (i = 0; i < count; ++i) {
+        const SW_TileCommand *tc = &data->tile_commands[i];
+        SDL_RenderCommand *c = tc->cmd;
+        SDL_Rect bounds;
+        int first, last;
+        bool straddles = false;
+
+        switch (c->command) {
+        case SDL_RENDERCMD_SETVIEWPORT:
+            viewport = &c->data.viewport.rect;
+            SDL_FALLTHROUGH;
+        case SDL_RENDERCMD_SETDRAWCOLOR:
+        case SDL_RENDERCMD_SETCLIPRECT:
         case SDL_RENDERCMD_NO_OP:
+            // State changes are processed by every tile
+            for (j = 0; j < data->num_threads; ++j) {
+                SW_TileWorker *worker = &data->workers[j];
+                worker->commands[worker->num_commands++] = tc;
+            }
+            continue;
+
+        default:
             break;
         }
 
+        SW_ApplyViewport(c, vertices, viewport);
+        if (SW_GetCommandBounds(c, vertices, surface, &bounds)) {
+            // Drawn by every tile it overlaps
+            if (bounds.h <= 0 || bounds.y + bounds.h <= 0 || bounds.y >= surface->h) {
+                continue;
+            }
+            first = SDL_max(bounds.y, 0) / tile_rows;
+            last = (SDL_min(bounds.y + bounds.h, surface->h) - 1) / tile_rows;
+        } else {
+            // The first and last tiles extend past the edges of the surface
+            first = SDL_clamp(bounds.y / tile_rows, 0, last_tile);
+            last = SDL_clamp((bounds.y + SDL_max(bounds.h, 1) - 1) / tile_rows, 0, last_tile);
+            straddles = (first != last);
+        }
+
+        if (straddles != serial) {
+            // Everything drawn so far has to land before (or after) the serial commands
+            for (j = 0; j < data->num_threads; ++j) {
+                SW_TileWorker *worker = &data->workers[j];
+                worker->commands[worker->num_commands++] = NULL;
+            }
+            serial = !serial;
+        }
+        if (serial) {
+            // Drawn by the first thread, without narrowing the clip rect, while the others wait
+            first = last = 0;
+        }
+        for (j = first; j <= last; ++j) {
+            SW_TileWorker *worker = &data->workers[j];
+            worker->commands[worker->num_commands++] = tc;
+        }
+    }
+
+    data->tile_vertices = vertices;
+
+    SDL_LockMutex(data->tile_lock);
+    ++data->tile_frame;
+    SDL_BroadcastCondition(data->tile_cond);
+    SDL_UnlockMutex(data->tile_lock);
+
+    SW_RenderTile(&data->workers[0]);
+    return true;
+}
+
+static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize)
+{
+    SW_RenderData *data = (SW_RenderData *)renderer->internal;
+    SDL_Surface *surface = SW_ActivateRenderer(renderer);
+    SW_DrawStateCache drawstate;
+
+    if (!SDL_SurfaceValid(surface)) {
+        return false;
+    }
+
+    if (data->num_threads > 1 && SW_RunCommandQueueTiled(data, surface, cmd, vertices)) {
+        SW_UpdateScaleCacheStats(renderer);
+        return true;
+    }
+
+    SW_InitDrawState(&drawstate, NULL, &data->scale_cache);
+
+    while (cmd) {
+        SW_ApplyViewport(cmd, vertices, drawstate.viewport);
+        SW_RunCommand(surface, &drawstate, cmd, vertices, SW_GetCommandTexture(cmd));
         cmd = cmd->next;
     }
 
+    SW_UpdateScaleCacheStats(renderer);
     return true;
 }
 
@@ -1036,6 +1839,7 @@ static void SW_DestroyTexture(SDL_Renderer *renderer, SDL_Texture *texture)
 {
     SDL_Surface *surface = (SDL_Surface *)texture->internal;
 
+    SW_InvalidateScaledCopies((SW_RenderData *)renderer->internal, surface);
     SDL_DestroySurface(surface);
 }
 
@@ -1044,6 +1848,9 @@ static void SW_DestroyRenderer(SDL_Renderer *renderer)
     SDL_Window *window = renderer->window;
     SW_RenderData *data = (SW_RenderData *)renderer->internal;
 
+    SW_StopTileWorkers(data);
+    SW_PurgeScaleCache(&data->scale_cache, NULL);
+
     if (window) {
         SDL_DestroyWindowSurface(window);
     }
@@ -1148,6 +1955,20 @@ static void SW_SelectBestFormats(SDL_Renderer *renderer, SDL_PixelFormat format)
     SDL_AddSupportedTextureFormat(renderer, SDL_PIXELFORMAT_INDEX8);
 }
 
+static int SW_GetThreadsHint(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_RENDER_SOFTWARE_THREADS);
+    int threads = 1;
+
+    if (hint) {
+        threads = SDL_atoi(hint);
+        if (threads == 0) {
+            threads = SDL_GetNumLogicalCPUCores();
+        }
+    }
+    return SDL_clamp(threads, 1, SW_MAX_TILE_THREADS);
+}
+
 bool SW_CreateRendererForSurface(SDL_Renderer *renderer, SDL_Surface *surface, SDL_PropertiesID create_props)
 {
     SW_RenderData *data;
@@ -1175,6 +1996,8 @@ bool SW_CreateRendererForSurface(SDL_Renderer *renderer, SDL_Surface *surface, S
     }
     data->surface = surface;
     data->window = surface;
+    data->num_threads = SW_GetThreadsHint();
+    data->scale_cache.max_bytes = SW_SCALE_CACHE_MAX_BYTES;
 
     renderer->WindowEvent = SW_WindowEvent;
     renderer->GetOutputSize = SW_GetOutputSize;
@@ -28,14 +28,6 @@
 
 #include "../../video/SDL_surface_c.h"
 
-/* fixed points bits precision
- * Set to 1, so that it can start rendering with middle of a pixel precision.
- * It doesn't need to be increased.
- * But, if increased too much, it overflows (srcx, srcy) coordinates used for filling with texture.
- * (which could be turned to int64).
- */
-#define FP_BITS 1
-
 #define COLOR_EQ(c1, c2) ((c1).r == (c2).r && (c1).g == (c2).g && (c1).b == (c2).b && (c1).a == (c2).a)
 
 static void SDL_BlitTriangle_Slow(SDL_BlitInfo *info,
@@ -149,6 +141,43 @@ static void bounding_rect_fixedpoint(const SDL_Point *a, const SDL_Point *b, con
     r->h = (max_y - min_y) >> FP_BITS;
 }
 
+/* Narrows [*x_start, *x_end) to the pixels of a row where w + bias + x * step >= 0,
+ * so the edge functions don't have to be tested at each pixel.
+ */
+static void clip_span_to_edge(Sint64 w, int bias, int step, int *x_start, int *x_end)
+{
+    w += bias;
+    if (step > 0) {
+        if (w < 0) {
+            const Sint64 x = (-w + step - 1) / step;
+            if (x > *x_start) {
+                *x_start = (int)SDL_min(x, (Sint64)*x_end);
+            }
+        }
+    } else if (step < 0) {
+        if (w < 0) {
+            *x_end = *x_start;
+        } else {
+            const Sint64 x = w / -step + 1;
+            if (x < *x_end) {
+                *x_end = (int)x;
+            }
+        }
+    } else if (w < 0) {
+        *x_end = *x_start;
+    }
+}
+
+static void triangle_row_span(Sint64 w0, Sint64 w1, Sint64 w2, int bias_w0, int bias_w1, int bias_w2,
+                              int step_w0, int step_w1, int step_w2, int width, int *x_start, int *x_end)
+{
+    *x_start = 0;
+    *x_end = width;
+    clip_span_to_edge(w0, bias_w0, step_w0, x_start, x_end);
+    clip_span_to_edge(w1, bias_w1, step_w1, x_start, x_end);
+    clip_span_to_edge(w2, bias_w2, step_w2, x_start, x_end);
+}
+
 /* Triangle rendering, using Barycentric coordinates (w0, w1, w2)
  *
  * The cross product isn't computed from scratch at each iteration,
@@ -156,17 +185,22 @@ static void bounding_rect_fixedpoint(const SDL_Point *a, const SDL_Point *b, con
  *
  */
 
-#define TRIANGLE_BEGIN_LOOP                                                        \
-    {                                                                              \
-        int x, y;                                                                  \
-        for (y = 0; y < dstrect.h; y++) {                                          \
-            /* y start */                                                          \
-            Sint64 w0 = w0_row;                                                    \
-            Sint64 w1 = w1_row;                                                    \
-            Sint64 w2 = w2_row;                                                    \
-            for (x = 0; x < dstrect.w; x++) {                                      \
-                /* In triangle */                                                  \
-                if (w0 + bias_w0 >= 0 && w1 + bias_w1 >= 0 && w2 + bias_w2 >= 0) { \
+#define TRIANGLE_BEGIN_LOOP                                                                 \
+    {                                                                                       \
+        int x, y;                                                                           \
+        for (y = 0; y < dstrect.h; y++) {                                                   \
+            /* y start, at the first pixel inside the triangle */                           \
+            int x_start, x_end;                                                             \
+            Sint64 w0, w1, w2;                                                              \
+            triangle_row_span(w0_row, w1_row, w2_row, bias_w0, bias_w1, bias_w2,            \
+                              d2d1_y, d0d2_y, d1d0_y, dstrect.w, &x_start, &x_end);         \
+            w0 = w0_row + (Sint64)x_start * d2d1_y;                                         \
+            w1 = w1_row + (Sint64)x_start * d0d2_y;                                         \
+            w2 = w2_row + (Sint64)x_start * d1d0_y;                                         \
+            (void)w2;                                                                       \
+            for (x = x_start; x < x_end; x++, w0 += d2d1_y, w1 += d0d2_y, w2 += d1d0_y) {    \
+                /* In triangle */                                                           \
+                {                                                                           \
                     Uint8 *dptr = (Uint8 *)dst_ptr + x * dstbpp;
 
 // Use 64 bits precision to prevent overflow when interpolating color / texture with wide triangles
@@ -213,10 +247,6 @@ static void bounding_rect_fixedpoint(const SDL_Point *a, const SDL_Point *b, con
 
 #define TRIANGLE_END_LOOP \
     }                     \
-    /* x += 1 */          \
-    w0 += d2d1_y;         \
-    w1 += d0d2_y;         \
-    w2 += d1d0_y;         \
     }                     \
     /* y += 1 */          \
     w0_row += d1d2_x;     \
@@ -226,6 +256,611 @@ static void bounding_rect_fixedpoint(const SDL_Point *a, const SDL_Point *b, con
     }                     \
     }
 
+/* Exact stepping of (n / area) along a row, where n changes by the same amount
+ * at each pixel, so the texture coordinates and colors don't need a division
+ * per pixel.
+ */
+typedef struct
+{
+    Sint64 q;  // floor(n / area)
+    Sint64 r;  // n - q * area, in [0, area)
+    Sint64 dq;
+    Sint64 dr;
+} TriangleDDA;
+
+static void triangle_dda_init(TriangleDDA *dda, Sint64 n, Sint64 dn, Sint64 area)
+{
+    dda->q = n / area;
+    dda->r = n % area;
+    if (dda->r < 0) {
+        dda->q -= 1;
+        dda->r += area;
+    }
+    dda->dq = dn / area;
+    dda->dr = dn % area;
+    if (dda->dr < 0) {
+        dda->dq -= 1;
+        dda->dr += area;
+    }
+}
+
+#define TRIANGLE_DDA_STEP(dda) \
+    dda.q += dda.dq;           \
+    dda.r += dda.dr;           \
+    if (dda.r >= area) {       \
+        dda.q += 1;            \
+        dda.r -= area;         \
+    }
+
+// n / area rounded towards zero, like the divisions in TRIANGLE_GET_TEXTCOORD
+#define TRIANGLE_DDA_VALUE(dda) (int)(dda.q + (dda.q < 0 && dda.r != 0))
+
+// Same as the address modes of TRIANGLE_GET_TEXTCOORD
+static SDL_INLINE int triangle_texcoord(int coord, int size, SDL_TextureAddressMode mode)
+{
+    if (mode == SDL_TEXTURE_ADDRESS_CLAMP) {
+        if (coord < 0) {
+            coord = 0;
+        } else if (coord >= size) {
+            coord = size - 1;
+        }
+    } else if (mode == SDL_TEXTURE_ADDRESS_WRAP) {
+        if (coord < 0 || coord >= size) {
+            coord %= size;
+            if (coord < 0) {
+                coord += (size - 1);
+            }
+        }
+    }
+    return coord;
+}
+
+// Reads the 32-bit texels along a row span
+static void triangle_fetch_texels(Uint32 *texels, int count, TriangleDDA *u, TriangleDDA *v, Sint64 area,
+                                  const SDL_Surface *src, const Uint8 *src_ptr, int src_pitch,
+                                  SDL_TextureAddressMode texture_address_mode_u,
+                                  SDL_TextureAddressMode texture_address_mode_v)
+{
+    TriangleDDA du = *u;
+    TriangleDDA dv = *v;
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        const int srcx = triangle_texcoord(TRIANGLE_DDA_VALUE(du), src->w, texture_address_mode_u);
+        const int srcy = triangle_texcoord(TRIANGLE_DDA_VALUE(dv), src->h, texture_address_mode_v);
+        texels[i] = *(const Uint32 *)(src_ptr + srcy * src_pitch + srcx * 4);
+        TRIANGLE_DDA_STEP(du);
+        TRIANGLE_DDA_STEP(dv);
+    }
+    *u = du;
+    *v = dv;
+}
+
+/* Span shading for textures and targets with 8 bits per channel in 32-bit
+ * pixels, doing exactly what SDL_BlitTriangle_Slow() does for them.
+ *
+ * The SIMD versions move every pixel into ARGB8888 order with a byte shuffle,
+ * and use x / 255 == ((x + 1) * 257) >> 16, which holds for all x <= 65534.
+ */
+typedef struct
+{
+    const SDL_PixelFormatDetails *src_fmt;
+    const SDL_PixelFormatDetails *dst_fmt;
+    int flags;
+    Uint32 color;       // the modulation as ARGB8888, when there's no color per pixel
+    Uint32 mod_fill;    // the ARGB8888 channels that aren't modulated, set to 0xFF
+    Uint32 src_to_argb; // byte shuffles, 0x80 where there's no channel
+    Uint32 dst_to_argb;
+    Uint32 argb_to_dst;
+    Uint32 src_alpha;   // 0xFF000000 if the format has no alpha channel
+    Uint32 dst_alpha;
+} TriangleShade;
+
+typedef void (*TriangleShadeFunc)(const Uint32 *src, const Uint32 *colors, Uint32 *dst, int count, const TriangleShade *shade);
+
+static bool is_8888(const SDL_PixelFormatDetails *fmt)
+{
+    return fmt->bytes_per_pixel == 4 && !SDL_ISPIXELFORMAT_INDEXED(fmt->format) && !SDL_ISPIXELFORMAT_FOURCC(fmt->format) &&
+           fmt->Rbits == 8 && fmt->Gbits == 8 && fmt->Bbits == 8 && (fmt->Abits == 0 || fmt->Abits == 8) &&
+           (fmt->Rshift % 8) == 0 && (fmt->Gshift % 8) == 0 && (fmt->Bshift % 8) == 0 && (fmt->Ashift % 8) == 0;
+}
+
+static Uint32 shuffle_to_argb(const SDL_PixelFormatDetails *fmt)
+{
+    return ((Uint32)(fmt->Bshift / 8)) |
+           ((Uint32)(fmt->Gshift / 8) << 8) |
+           ((Uint32)(fmt->Rshift / 8) << 16) |
+           ((Uint32)(fmt->Amask ? fmt->Ashift / 8 : 0x80) << 24);
+}
+
+static Uint32 shuffle_from_argb(const SDL_PixelFormatDetails *fmt)
+{
+    Uint32 shuffle = 0x80808080;
+
+    shuffle &= ~(0xFFu << fmt->Bshift);
+    shuffle &= ~(0xFFu << fmt->Gshift);
+    shuffle |= 1u << fmt->Gshift;
+    shuffle &= ~(0xFFu << fmt->Rshift);
+    shuffle |= 2u << fmt->Rshift;
+    if (fmt->Amask) {
+        shuffle &= ~(0xFFu << fmt->Ashift);
+        shuffle |= 3u << fmt->Ashift;
+    }
+    return shuffle;
+}
+
+static void SDL_InitTriangleShade(TriangleShade *shade, const SDL_PixelFormatDetails *src_fmt, const SDL_PixelFormatDetails *dst_fmt, int flags, SDL_Color color)
+{
+    shade->src_fmt = src_fmt;
+    shade->dst_fmt = dst_fmt;
+    shade->flags = flags;
+    shade->color = ((Uint32)color.a << 24) | ((Uint32)color.r << 16) | ((Uint32)color.g << 8) | color.b;
+    shade->mod_fill = ((flags & SDL_COPY_MODULATE_COLOR) ? 0 : 0x00FFFFFF) | ((flags & SDL_COPY_MODULATE_ALPHA) ? 0 : 0xFF000000);
+    shade->src_to_argb = shuffle_to_argb(src_fmt);
+    shade->dst_to_argb = shuffle_to_argb(dst_fmt);
+    shade->argb_to_dst = shuffle_from_argb(dst_fmt);
+    shade->src_alpha = src_fmt->Amask ? 0 : 0xFF000000;
+    shade->dst_alpha = dst_fmt->Amask ? 0 : 0xFF000000;
+}
+
+static void SDL_TriangleShade8888_Scalar(const Uint32 *src, const Uint32 *colors, Uint32 *dst, int count, const TriangleShade *shade)
+{
+    const SDL_PixelFormatDetails *src_fmt = shade->src_fmt;
+    const SDL_PixelFormatDetails *dst_fmt = shade->dst_fmt;
+    const int flags = shade->flags;
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        const Uint32 srcpixel = src[i];
+        const Uint32 color = colors ? colors[i] : shade->color;
+        Uint32 srcR = (srcpixel >> src_fmt->Rshift) & 0xFF;
+        Uint32 srcG = (srcpixel >> src_fmt->Gshift) & 0xFF;
+        Uint32 srcB = (srcpixel >> src_fmt->Bshift) & 0xFF;
+        Uint32 srcA = src_fmt->Amask ? ((srcpixel >> src_fmt->Ashift) & 0xFF) : 0xFF;
+        Uint32 dstR, dstG, dstB, dstA;
+
+        if (flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL)) {
+            const Uint32 dstpixel = dst[i];
+            dstR = (dstpixel >> dst_fmt->Rshift) & 0xFF;
+            dstG = (dstpixel >> dst_fmt->Gshift) & 0xFF;
+            dstB = (dstpixel >> dst_fmt->Bshift) & 0xFF;
+            dstA = dst_fmt->Amask ? ((dstpixel >> dst_fmt->Ashift) & 0xFF) : 0xFF;
+        } else {
+            dstR = dstG = dstB = dstA = 0;
+        }
+
+        if (flags & SDL_COPY_MODULATE_COLOR) {
+            srcR = (srcR * ((color >> 16) & 0xFF)) / 255;
+            srcG = (srcG * ((color >> 8) & 0xFF)) / 255;
+            srcB = (srcB * (color & 0xFF)) / 255;
+        }
+        if (flags & SDL_COPY_MODULATE_ALPHA) {
+            srcA = (srcA * (color >> 24)) / 255;
+        }
+        if (flags & (SDL_COPY_BLEND | SDL_COPY_ADD)) {
+            if (srcA < 255) {
+                srcR = (srcR * srcA) / 255;
+                srcG = (srcG * srcA) / 255;
+                srcB = (srcB * srcA) / 255;
+            }
+        }
+        switch (flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL)) {
+        case 0:
+            dstR = srcR;
+            dstG = srcG;
+            dstB = srcB;
+            dstA = srcA;
+            break;
+        case SDL_COPY_BLEND:
+            dstR = srcR + ((255 - srcA) * dstR) / 255;
+            dstG = srcG + ((255 - srcA) * dstG) / 255;
+            dstB = srcB + ((255 - srcA) * dstB) / 255;
+            dstA = srcA + ((255 - srcA) * dstA) / 255;
+            break;
+        case SDL_COPY_ADD:
+            dstR = SDL_min(srcR + dstR, 255);
+            dstG = SDL_min(srcG + dstG, 255);
+            dstB = SDL_min(srcB + dstB, 255);
+            break;
+        case SDL_COPY_MOD:
+            dstR = (srcR * dstR) / 255;
+            dstG = (srcG * dstG) / 255;
+            dstB = (srcB * dstB) / 255;
+            break;
+        case SDL_COPY_MUL:
+            dstR = SDL_min(((srcR * dstR) + (dstR * (255 - srcA))) / 255, 255);
+            dstG = SDL_min(((srcG * dstG) + (dstG * (255 - srcA))) / 255, 255);
+            dstB = SDL_min(((srcB * dstB) + (dstB * (255 - srcA))) / 255, 255);
+            break;
+        }
+        dst[i] = (dstR << dst_fmt->Rshift) | (dstG << dst_fmt->Gshift) | (dstB << dst_fmt->Bshift) |
+                 (dst_fmt->Amask ? (dstA << dst_fmt->Ashift) : 0);
+    }
+}
+
+#ifdef SDL_SSE4_1_INTRINSICS
+
+#define DIV255_SSE(x) _mm_mulhi_epu16(_mm_add_epi16(x, _mm_set1_epi16(1)), _mm_set1_epi16(257))
+
+static void SDL_TARGETING("sse4.1") SDL_TriangleShade8888_SSE41(const Uint32 *src, const Uint32 *colors, Uint32 *dst, int count, const TriangleShade *shade)
+{
+    const int blend = shade->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD);
+    const bool modulate = (shade->flags & (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA)) != 0;
+    const bool premultiply = (shade->flags & (SDL_COPY_BLEND | SDL_COPY_ADD)) != 0;
+    const __m128i offsets = _mm_set_epi8(12, 12, 12, 12, 8, 8, 8, 8, 4, 4, 4, 4, 0, 0, 0, 0);
+    const __m128i src_to_argb = _mm_add_epi8(_mm_set1_epi32((int)shade->src_to_argb), offsets);
+    const __m128i dst_to_argb = _mm_add_epi8(_mm_set1_epi32((int)shade->dst_to_argb), offsets);
+    const __m128i argb_to_dst = _mm_add_epi8(_mm_set1_epi32((int)shade->argb_to_dst), offsets);
+    const __m128i src_alpha = _mm_set1_epi32((int)shade->src_alpha);
+    const __m128i dst_alpha = _mm_set1_epi32((int)shade->dst_alpha);
+    const __m128i mod_fill = _mm_set1_epi32((int)shade->mod_fill);
+    const __m128i color = _mm_set1_epi32((int)shade->color);
+    const __m128i alpha_mask = _mm_set1_epi32((int)0xFF000000);
+    const __m128i alpha_one = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+    const __m128i c255 = _mm_set1_epi16(255);
+    const __m128i zero = _mm_setzero_si128();
+    int i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        __m128i s = _mm_or_si128(_mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(src + i)), src_to_argb), src_alpha);
+        __m128i s_lo = _mm_unpacklo_epi8(s, zero);
+        __m128i s_hi = _mm_unpackhi_epi8(s, zero);
+        __m128i result;
+
+        if (modulate) {
+            __m128i m = colors ? _mm_loadu_si128((const __m128i *)(colors + i)) : color;
+            m = _mm_or_si128(m, mod_fill);
+            s_lo = DIV255_SSE(_mm_mullo_epi16(s_lo, _mm_unpacklo_epi8(m, zero)));
+            s_hi = DIV255_SSE(_mm_mullo_epi16(s_hi, _mm_unpackhi_epi8(m, zero)));
+        }
+        if (premultiply) {
+            // Multiply the color channels by alpha, leaving alpha as is
+            const __m128i a_lo = _mm_or_si128(_mm_shufflehi_epi16(_mm_shufflelo_epi16(s_lo, 0xFF), 0xFF), alpha_one);
+            const __m128i a_hi = _mm_or_si128(_mm_shufflehi_epi16(_mm_shufflelo_epi16(s_hi, 0xFF), 0xFF), alpha_one);
+            s_lo = DIV255_SSE(_mm_mullo_epi16(s_lo, a_lo));
+            s_hi = DIV255_SSE(_mm_mullo_epi16(s_hi, a_hi));
+        }
+
+        if (blend == 0) {
+            result = _mm_packus_epi16(s_lo, s_hi);
+        } else {
+            const __m128i d = _mm_or_si128(_mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(dst + i)), dst_to_argb), dst_alpha);
+            __m128i d_lo = _mm_unpacklo_epi8(d, zero);
+            __m128i d_hi = _mm_unpackhi_epi8(d, zero);
+
+            if (blend == SDL_COPY_BLEND) {
+                const __m128i inv_lo = _mm_sub_epi16(c255, _mm_shufflehi_epi16(_mm_shufflelo_epi16(s_lo, 0xFF), 0xFF));
+                const __m128i inv_hi = _mm_sub_epi16(c255, _mm_shufflehi_epi16(_mm_shufflelo_epi16(s_hi, 0xFF), 0xFF));
+                d_lo = _mm_add_epi16(s_lo, DIV255_SSE(_mm_mullo_epi16(d_lo, inv_lo)));
+                d_hi = _mm_add_epi16(s_hi, DIV255_SSE(_mm_mullo_epi16(d_hi, inv_hi)));
+                result = _mm_packus_epi16(d_lo, d_hi);
+            } else if (blend == SDL_COPY_ADD) {
+                result = _mm_adds_epu8(_mm_packus_epi16(s_lo, s_hi), d);
+                result = _mm_blendv_epi8(result, d, alpha_mask);
+            } else {
+                d_lo = DIV255_SSE(_mm_mullo_epi16(s_lo, d_lo));
+                d_hi = DIV255_SSE(_mm_mullo_epi16(s_hi, d_hi));
+                result = _mm_blendv_epi8(_mm_packus_epi16(d_lo, d_hi), d, alpha_mask);
+            }
+        }
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_shuffle_epi8(result, argb_to_dst));
+    }
+
+    if (i < count) {
+        SDL_TriangleShade8888_Scalar(src + i, colors ? colors + i : NULL, dst + i, count - i, shade);
+    }
+}
+
+#endif // SDL_SSE4_1_INTRINSICS
+
+#ifdef SDL_AVX2_INTRINSICS
+
+#define DIV255_AVX2(x) _mm256_mulhi_epu16(_mm256_add_epi16(x, _mm256_set1_epi16(1)), _mm256_set1_epi16(257))
+
+static void SDL_TARGETING("avx2") SDL_TriangleShade8888_AVX2(const Uint32 *src, const Uint32 *colors, Uint32 *dst, int count, const TriangleShade *shade)
+{
+    const int blend = shade->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD);
+    const bool modulate = (shade->flags & (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA)) != 0;
+    const bool premultiply = (shade->flags & (SDL_COPY_BLEND | SDL_COPY_ADD)) != 0;
+    // The shuffles work within each 128-bit lane
+    const __m256i offsets = _mm256_set_epi8(12, 12, 12, 12, 8, 8, 8, 8, 4, 4, 4, 4, 0, 0, 0, 0,
+                                            12, 12, 12, 12, 8, 8, 8, 8, 4, 4, 4, 4, 0, 0, 0, 0);
+    const __m256i src_to_argb = _mm256_add_epi8(_mm256_set1_epi32((int)shade->src_to_argb), offsets);
+    const __m256i dst_to_argb = _mm256_add_epi8(_mm256_set1_epi32((int)shade->dst_to_argb), offsets);
+    const __m256i argb_to_dst = _mm256_add_epi8(_mm256_set1_epi32((int)shade->argb_to_dst), offsets);
+    const __m256i src_alpha = _mm256_set1_epi32((int)shade->src_alpha);
+    const __m256i dst_alpha = _mm256_set1_epi32((int)shade->dst_alpha);
+    const __m256i mod_fill = _mm256_set1_epi32((int)shade->mod_fill);
+    const __m256i color = _mm256_set1_epi32((int)shade->color);
+    const __m256i alpha_mask = _mm256_set1_epi32((int)0xFF000000);
+    const __m256i alpha_one = _mm256_set_epi16(255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0);
+    const __m256i c255 = _mm256_set1_epi16(255);
+    const __m256i zero = _mm256_setzero_si256();
+    int i = 0;
+
+    for (; i + 8 <= count; i += 8) {
+        __m256i s = _mm256_or_si256(_mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(src + i)), src_to_argb), src_alpha);
+        __m256i s_lo = _mm256_unpacklo_epi8(s, zero);
+        __m256i s_hi = _mm256_unpackhi_epi8(s, zero);
+        __m256i result;
+
+        if (modulate) {
+            __m256i m = colors ? _mm256_loadu_si256((const __m256i *)(colors + i)) : color;
+            m = _mm256_or_si256(m, mod_fill);
+            s_lo = DIV255_AVX2(_mm256_mullo_epi16(s_lo, _mm256_unpacklo_epi8(m, zero)));
+            s_hi = DIV255_AVX2(_mm256_mullo_epi16(s_hi, _mm256_unpackhi_epi8(m, zero)));
+        }
+        if (premultiply) {
+            // Multiply the color channels by alpha, leaving alpha as is
+            const __m256i a_lo = _mm256_or_si256(_mm256_shufflehi_epi16(_mm256_shufflelo_epi16(s_lo, 0xFF), 0xFF), alpha_one);
+            const __m256i a_hi = _mm256_or_si256(_mm256_shufflehi_epi16(_mm256_shufflelo_epi16(s_hi, 0xFF), 0xFF), alpha_one);
+            s_lo = DIV255_AVX2(_mm256_mullo_epi16(s_lo, a_lo));
+            s_hi = DIV255_AVX2(_mm256_mullo_epi16(s_hi, a_hi));
+        }
+
+        // unpack and pack both work within 128-bit lanes, so the pixel order is preserved
+        if (blend == 0) {
+            result = _mm256_packus_epi16(s_lo, s_hi);
+        } else {
+            const __m256i d = _mm256_or_si256(_mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(dst + i)), dst_to_argb), dst_alpha);
+            __m256i d_lo = _mm256_unpacklo_epi8(d, zero);
+            __m256i d_hi = _mm256_unpackhi_epi8(d, zero);
+
+            if (blend == SDL_COPY_BLEND) {
+                const __m256i inv_lo = _mm256_sub_epi16(c255, _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(s_lo, 0xFF), 0xFF));
+                const __m256i inv_hi = _mm256_sub_epi16(c255, _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(s_hi, 0xFF), 0xFF));
+                d_lo = _mm256_add_epi16(s_lo, DIV255_AVX2(_mm256_mullo_epi16(d_lo, inv_lo)));
+                d_hi = _mm256_add_epi16(s_hi, DIV255_AVX2(_mm256_mullo_epi16(d_hi, inv_hi)));
+                result = _mm256_packus_epi16(d_lo, d_hi);
+            } else if (blend == SDL_COPY_ADD) {
+                result = _mm256_adds_epu8(_mm256_packus_epi16(s_lo, s_hi), d);
+                result = _mm256_blendv_epi8(result, d, alpha_mask);
+            } else {
+                d_lo = DIV255_AVX2(_mm256_mullo_epi16(s_lo, d_lo));
+                d_hi = DIV255_AVX2(_mm256_mullo_epi16(s_hi, d_hi));
+                result = _mm256_blendv_epi8(_mm256_packus_epi16(d_lo, d_hi), d, alpha_mask);
+            }
+        }
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_shuffle_epi8(result, argb_to_dst));
+    }
+
+    if (i < count) {
+        SDL_TriangleShade8888_Scalar(src + i, colors ? colors + i : NULL, dst + i, count - i, shade);
+    }
+}
+
+#endif // SDL_AVX2_INTRINSICS
+
+#if defined(SDL_NEON_INTRINSICS) && (defined(__aarch64__) || defined(_M_ARM64))
+
+static uint16x8_t Div255NEON(uint16x8_t x)
+{
+    // (x + 1 + (x >> 8)) >> 8
+    return vshrq_n_u16(vsraq_n_u16(vaddq_u16(x, vdupq_n_u16(1)), x, 8), 8);
+}
+
+static void SDL_TriangleShade8888_NEON(const Uint32 *src, const Uint32 *colors, Uint32 *dst, int count, const TriangleShade *shade)
+{
+    static const Uint8 offsets_bytes[16] = { 0, 0, 0, 0, 4, 4, 4, 4, 8, 8, 8, 8, 12, 12, 12, 12 };
+    static const Uint8 splat_alpha_bytes[16] = { 6, 7, 6, 7, 6, 7, 6, 7, 14, 15, 14, 15, 14, 15, 14, 15 };
+    static const Uint16 alpha_one_lanes[8] = { 0, 0, 0, 255, 0, 0, 0, 255 };
+    const int blend = shade->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD);
+    const bool modulate = (shade->flags & (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA)) != 0;
+    const bool premultiply = (shade->flags & (SDL_COPY_BLEND | SDL_COPY_ADD)) != 0;
+    const uint8x16_t offsets = vld1q_u8(offsets_bytes);
+    const uint8x16_t splat_alpha = vld1q_u8(splat_alpha_bytes);
+    const uint8x16_t src_to_argb = vaddq_u8(vreinterpretq_u8_u32(vdupq_n_u32(shade->src_to_argb)), offsets);
+    const uint8x16_t dst_to_argb = vaddq_u8(vreinterpretq_u8_u32(vdupq_n_u32(shade->dst_to_argb)), offsets);
+    const uint8x16_t argb_to_dst = vaddq_u8(vreinterpretq_u8_u32(vdupq_n_u32(shade->argb_to_dst)), offsets);
+    const uint8x16_t src_alpha = vreinterpretq_u8_u32(vdupq_n_u32(shade->src_alpha));
+    const uint8x16_t dst_alpha = vreinterpretq_u8_u32(vdupq_n_u32(shade->dst_alpha));
+    const uint8x16_t mod_fill = vreinterpretq_u8_u32(vdupq_n_u32(shade->mod_fill));
+    const uint8x16_t color = vreinterpretq_u8_u32(vdupq_n_u32(shade->color));
+    const uint8x16_t alpha_mask = vreinterpretq_u8_u32(vdupq_n_u32(0xFF000000));
+    const uint16x8_t alpha_one = vld1q_u16(alpha_one_lanes);
+    const uint16x8_t c255 = vdupq_n_u16(255);
+    int i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        const uint8x16_t s = vorrq_u8(vqtbl1q_u8(vld1q_u8((const Uint8 *)(src + i)), src_to_argb), src_alpha);
+        uint16x8_t s_lo = vmovl_u8(vget_low_u8(s));
+        uint16x8_t s_hi = vmovl_u8(vget_high_u8(s));
+        uint8x16_t result;
+
+        if (modulate) {
+            uint8x16_t m = colors ? vld1q_u8((const Uint8 *)(colors + i)) : color;
+            m = vorrq_u8(m, mod_fill);
+            s_lo = Div255NEON(vmulq_u16(s_lo, vmovl_u8(vget_low_u8(m))));
+            s_hi = Div255NEON(vmulq_u16(s_hi, vmovl_u8(vget_high_u8(m))));
+        }
+        if (premultiply) {
+            // Multiply the color channels by alpha, leaving alpha as is
+            const uint16x8_t a_lo = vorrq_u16(vreinterpretq_u16_u8(vqtbl1q_u8(vreinterpretq_u8_u16(s_lo), splat_alpha)), alpha_one);
+            const uint16x8_t a_hi = vorrq_u16(vreinterpretq_u16_u8(vqtbl1q_u8(vreinterpretq_u8_u16(s_hi), splat_alpha)), alpha_one);
+            s_lo = Div255NEON(vmulq_u16(s_lo, a_lo));
+            s_hi = Div255NEON(vmulq_u16(s_hi, a_hi));
+        }
+
+        if (blend == 0) {
+            result = vcombine_u8(vqmovn_u16(s_lo), vqmovn_u16(s_hi));
+        } else {
+            const uint8x16_t d = vorrq_u8(vqtbl1q_u8(vld1q_u8((const Uint8 *)(dst + i)), dst_to_argb), dst_alpha);
+            uint16x8_t d_lo = vmovl_u8(vget_low_u8(d));
+            uint16x8_t d_hi = vmovl_u8(vget_high_u8(d));
+
+            if (blend == SDL_COPY_BLEND) {
+                const uint16x8_t inv_lo = vsubq_u16(c255, vreinterpretq_u16_u8(vqtbl1q_u8(vreinterpretq_u8_u16(s_lo), splat_alpha)));
+                const uint16x8_t inv_hi = vsubq_u16(c255, vreinterpretq_u16_u8(vqtbl1q_u8(vreinterpretq_u8_u16(s_hi), splat_alpha)));
+                d_lo = vaddq_u16(s_lo, Div255NEON(vmulq_u16(d_lo, inv_lo)));
+                d_hi = vaddq_u16(s_hi, Div255NEON(vmulq_u16(d_hi, inv_hi)));
+                result = vcombine_u8(vqmovn_u16(d_lo), vqmovn_u16(d_hi));
+            } else if (blend == SDL_COPY_ADD) {
+                result = vqaddq_u8(vcombine_u8(vqmovn_u16(s_lo), vqmovn_u16(s_hi)), d);
+                result = vbslq_u8(alpha_mask, d, result);
+            } else {
+                d_lo = Div255NEON(vmulq_u16(s_lo, d_lo));
+                d_hi = Div255NEON(vmulq_u16(s_hi, d_hi));
+                result = vbslq_u8(alpha_mask, d, vcombine_u8(vqmovn_u16(d_lo), vqmovn_u16(d_hi)));
+            }
+        }
+        vst1q_u8((Uint8 *)(dst + i), vqtbl1q_u8(result, argb_to_dst));
+    }
+
+    if (i < count) {
+        SDL_TriangleShade8888_Scalar(src + i, colors ? colors + i : NULL, dst + i, count - i, shade);
+    }
+}
+
+#endif // SDL_NEON_INTRINSICS
+
+static TriangleShadeFunc SDL_GetTriangleShadeFunc(int flags)
+{
+    const int blend = flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+
+    // The multiply blend can overflow 16 bits, so it's only done one pixel at a time
+    if (blend == 0 || blend == SDL_COPY_BLEND || blend == SDL_COPY_ADD || blend == SDL_COPY_MOD) {
+#ifdef SDL_AVX2_INTRINSICS
+        if (SDL_HasAVX2()) {
+            return SDL_TriangleShade8888_AVX2;
+        }
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+        if (SDL_HasSSE41()) {
+            return SDL_TriangleShade8888_SSE41;
+        }
+#endif
+#if defined(SDL_NEON_INTRINSICS) && (defined(__aarch64__) || defined(_M_ARM64))
+        if (SDL_HasNEON()) {
+            return SDL_TriangleShade8888_NEON;
+        }
+#endif
+    }
+    return SDL_TriangleShade8888_Scalar;
+}
+
+// Number of pixels shaded at a time
+#define TRIANGLE_SPAN_LENGTH 64
+
+// Gradient fill of a target with 8 bits per channel in 32-bit pixels
+static void SDL_FillTriangle_8888(Uint8 *dst_ptr, int dst_pitch, const SDL_PixelFormatDetails *format,
+                                  SDL_Rect dstrect, Sint64 area, int bias_w0, int bias_w1, int bias_w2,
+                                  int d2d1_y, int d1d2_x, int d0d2_y, int d2d0_x, int d1d0_y, int d0d1_x,
+                                  Sint64 w0_row, Sint64 w1_row, Sint64 w2_row,
+                                  SDL_Color c0, SDL_Color c1, SDL_Color c2)
+{
+    const Uint32 Amask = format->Amask;
+    int y;
+
+    for (y = 0; y < dstrect.h; y++) {
+        int x, x_start, x_end;
+
+        triangle_row_span(w0_row, w1_row, w2_row, bias_w0, bias_w1, bias_w2,
+                          d2d1_y, d0d2_y, d1d0_y, dstrect.w, &x_start, &x_end);
+        if (x_start < x_end) {
+            const Sint64 w0 = w0_row + (Sint64)x_start * d2d1_y;
+            const Sint64 w1 = w1_row + (Sint64)x_start * d0d2_y;
+            const Sint64 w2 = w2_row + (Sint64)x_start * d1d0_y;
+            Uint32 *dst = (Uint32 *)dst_ptr;
+            TriangleDDA r, g, b, a;
+
+            triangle_dda_init(&r, w0 * c0.r + w1 * c1.r + w2 * c2.r, (Sint64)d2d1_y * c0.r + (Sint64)d0d2_y * c1.r + (Sint64)d1d0_y * c2.r, area);
+            triangle_dda_init(&g, w0 * c0.g + w1 * c1.g + w2 * c2.g, (Sint64)d2d1_y * c0.g + (Sint64)d0d2_y * c1.g + (Sint64)d1d0_y * c2.g, area);
+            triangle_dda_init(&b, w0 * c0.b + w1 * c1.b + w2 * c2.b, (Sint64)d2d1_y * c0.b + (Sint64)d0d2_y * c1.b + (Sint64)d1d0_y * c2.b, area);
+            triangle_dda_init(&a, w0 * c0.a + w1 * c1.a + w2 * c2.a, (Sint64)d2d1_y * c0.a + (Sint64)d0d2_y * c1.a + (Sint64)d1d0_y * c2.a, area);
+
+            for (x = x_start; x < x_end; x++) {
+                dst[x] = ((Uint32)r.q << format->Rshift) | ((Uint32)g.q << format->Gshift) | ((Uint32)b.q << format->Bshift) |
+                         (((Uint32)a.q << format->Ashift) & Amask);
+                TRIANGLE_DDA_STEP(r);
+                TRIANGLE_DDA_STEP(g);
+                TRIANGLE_DDA_STEP(b);
+                TRIANGLE_DDA_STEP(a);
+            }
+        }
+        w0_row += d1d2_x;
+        w1_row += d2d0_x;
+        w2_row += d0d1_x;
+        dst_ptr += dst_pitch;
+    }
+}
+
+// Textured triangles with 8 bits per channel in 32-bit pixels, shading a row span at a time
+static void SDL_BlitTriangle_8888(SDL_BlitInfo *info,
+                                  SDL_Point s2_x_area, SDL_Rect dstrect, int area, int bias_w0, int bias_w1, int bias_w2,
+                                  int d2d1_y, int d1d2_x, int d0d2_y, int d2d0_x, int d1d0_y, int d0d1_x,
+                                  int s2s0_x, int s2s1_x, int s2s0_y, int s2s1_y, int w0_row, int w1_row, int w2_row,
+                                  SDL_Color c0, SDL_Color c1, SDL_Color c2, bool is_uniform,
+                                  SDL_TextureAddressMode texture_address_mode_u,
+                                  SDL_TextureAddressMode texture_address_mode_v)
+{
+    const SDL_Surface *src_surface = info->src_surface;
+    const TriangleShadeFunc shade_span = SDL_GetTriangleShadeFunc(info->flags);
+    Uint32 texels[TRIANGLE_SPAN_LENGTH];
+    Uint32 colors[TRIANGLE_SPAN_LENGTH];
+    TriangleShade shade;
+    SDL_Color color;
+    Uint8 *dst_ptr = info->dst;
+    int y;
+
+    color.r = info->r;
+    color.g = info->g;
+    color.b = info->b;
+    color.a = info->a;
+    SDL_InitTriangleShade(&shade, info->src_fmt, info->dst_fmt, info->flags, color);
+
+    for (y = 0; y < dstrect.h; y++) {
+        int x_start, x_end;
+
+        triangle_row_span(w0_row, w1_row, w2_row, bias_w0, bias_w1, bias_w2,
+                          d2d1_y, d0d2_y, d1d0_y, dstrect.w, &x_start, &x_end);
+        if (x_start < x_end) {
+            const Sint64 w0 = (Sint64)w0_row + (Sint64)x_start * d2d1_y;
+            const Sint64 w1 = (Sint64)w1_row + (Sint64)x_start * d0d2_y;
+            const Sint64 w2 = (Sint64)w2_row + (Sint64)x_start * d1d0_y;
+            Uint32 *dst = (Uint32 *)dst_ptr + x_start;
+            TriangleDDA u, v, r, g, b, a;
+            int x;
+
+            SDL_zero(r);
+            SDL_zero(g);
+            SDL_zero(b);
+            SDL_zero(a);
+
+            triangle_dda_init(&u, w0 * s2s0_x + w1 * s2s1_x + s2_x_area.x, (Sint64)d2d1_y * s2s0_x + (Sint64)d0d2_y * s2s1_x, area);
+            triangle_dda_init(&v, w0 * s2s0_y + w1 * s2s1_y + s2_x_area.y, (Sint64)d2d1_y * s2s0_y + (Sint64)d0d2_y * s2s1_y, area);
+            if (!is_uniform) {
+                triangle_dda_init(&r, w0 * c0.r + w1 * c1.r + w2 * c2.r, (Sint64)d2d1_y * c0.r + (Sint64)d0d2_y * c1.r + (Sint64)d1d0_y * c2.r, area);
+                triangle_dda_init(&g, w0 * c0.g + w1 * c1.g + w2 * c2.g, (Sint64)d2d1_y * c0.g + (Sint64)d0d2_y * c1.g + (Sint64)d1d0_y * c2.g, area);
+                triangle_dda_init(&b, w0 * c0.b + w1 * c1.b + w2 * c2.b, (Sint64)d2d1_y * c0.b + (Sint64)d0d2_y * c1.b + (Sint64)d1d0_y * c2.b, area);
+                triangle_dda_init(&a, w0 * c0.a + w1 * c1.a + w2 * c2.a, (Sint64)d2d1_y * c0.a + (Sint64)d0d2_y * c1.a + (Sint64)d1d0_y * c2.a, area);
+            }
+
+            for (x = x_start; x < x_end; x += TRIANGLE_SPAN_LENGTH) {
+                const int count = SDL_min(x_end - x, TRIANGLE_SPAN_LENGTH);
+
+                triangle_fetch_texels(texels, count, &u, &v, area, src_surface, info->src, info->src_pitch,
+                                      texture_address_mode_u, texture_address_mode_v);
+                if (!is_uniform) {
+                    int i;
+                    for (i = 0; i < count; ++i) {
+                        colors[i] = ((Uint32)a.q << 24) | ((Uint32)r.q << 16) | ((Uint32)g.q << 8) | (Uint32)b.q;
+                        TRIANGLE_DDA_STEP(r);
+                        TRIANGLE_DDA_STEP(g);
+                        TRIANGLE_DDA_STEP(b);
+                        TRIANGLE_DDA_STEP(a);
+                    }
+                }
+                shade_span(texels, is_uniform ? NULL : colors, dst, count, &shade);
+                dst += count;
+            }
+        }
+        w0_row += d1d2_x;
+        w1_row += d2d0_x;
+        w2_row += d0d1_x;
+        dst_ptr += info->dst_pitch;
+    }
+}
+
 bool SDL_SW_FillTriangle(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Point *d2, SDL_BlendMode blend, SDL_Color c0, SDL_Color c1, SDL_Color c2)
 {
     bool result = true;
@@ -415,7 +1050,11 @@ bool SDL_SW_FillTriangle(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Poi
             format = dst->fmt;
             palette = dst->palette;
         }
-        if (dstbpp == 4) {
+        if (is_8888(format)) {
+            SDL_FillTriangle_8888(dst_ptr, dst_pitch, format, dstrect, area, bias_w0, bias_w1, bias_w2,
+                                  d2d1_y, d1d2_x, d0d2_y, d2d0_x, d1d0_y, d0d1_x,
+                                  w0_row, w1_row, w2_row, c0, c1, c2);
+        } else if (dstbpp == 4) {
             TRIANGLE_BEGIN_LOOP
             {
                 TRIANGLE_GET_MAPPED_COLOR
@@ -686,10 +1325,17 @@ bool SDL_SW_BlitTriangle(
         CHECK_INT_RANGE(w0_row);
         CHECK_INT_RANGE(w1_row);
         CHECK_INT_RANGE(w2_row);
-        SDL_BlitTriangle_Slow(&tmp_info, s2_x_area, dstrect, (int)area, bias_w0, bias_w1, bias_w2,
-                              d2d1_y, d1d2_x, d0d2_y, d2d0_x, d1d0_y, d0d1_x,
-                              s2s0_x, s2s1_x, s2s0_y, s2s1_y, (int)w0_row, (int)w1_row, (int)w2_row,
-                              c0, c1, c2, is_uniform, texture_address_mode_u, texture_address_mode_v);
+        if (!(tmp_info.flags & SDL_COPY_COLORKEY) && is_8888(src->fmt) && is_8888(dst->fmt)) {
+            SDL_BlitTriangle_8888(&tmp_info, s2_x_area, dstrect, (int)area, bias_w0, bias_w1, bias_w2,
+                                  d2d1_y, d1d2_x, d0d2_y, d2d0_x, d1d0_y, d0d1_x,
+                                  s2s0_x, s2s1_x, s2s0_y, s2s1_y, (int)w0_row, (int)w1_row, (int)w2_row,
+                                  c0, c1, c2, is_uniform, texture_address_mode_u, texture_address_mode_v);
+        } else {
+            SDL_BlitTriangle_Slow(&tmp_info, s2_x_area, dstrect, (int)area, bias_w0, bias_w1, bias_w2,
+                                  d2d1_y, d1d2_x, d0d2_y, d2d0_x, d1d0_y, d0d1_x,
+                                  s2s0_x, s2s1_x, s2s0_y, s2s1_y, (int)w0_row, (int)w1_row, (int)w2_row,
+                                  c0, c1, c2, is_uniform, texture_address_mode_u, texture_address_mode_v);
+        }
 
         goto end;
     }
@@ -28,6 +28,136 @@
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
 
+// Points the blit information at the source and destination rectangles
+static void SDL_SetupBlitInfo(SDL_BlitInfo *info, SDL_Surface *src, const SDL_Rect *srcrect,
+                              SDL_Surface *dst, const SDL_Rect *dstrect)
+{
+    if (info->src_fmt->bits_per_pixel >= 8) {
+        info->src = (Uint8 *)src->pixels +
+                    srcrect->y * src->pitch +
+                    srcrect->x * info->src_fmt->bytes_per_pixel;
+    } else {
+        info->src = (Uint8 *)src->pixels +
+                    srcrect->y * src->pitch +
+                    (srcrect->x * info->src_fmt->bits_per_pixel) / 8;
+        info->leading_skip =
+                    ((srcrect->x * info->src_fmt->bits_per_pixel) % 8) /
+                    info->src_fmt->bits_per_pixel;
+    }
+    info->src_w = srcrect->w;
+    info->src_h = srcrect->h;
+    info->src_pitch = src->pitch;
+    info->src_skip =
+        info->src_pitch - info->src_w * info->src_fmt->bytes_per_pixel;
+    info->dst = (Uint8 *)dst->pixels +
+                dstrect->y * dst->pitch +
+                dstrect->x * info->dst_fmt->bytes_per_pixel;
+    info->dst_w = dstrect->w;
+    info->dst_h = dstrect->h;
+    info->dst_pitch = dst->pitch;
+    info->dst_skip =
+        info->dst_pitch - info->dst_w * info->dst_fmt->bytes_per_pixel;
+}
+
+/* Blits that use SDL_Blit_Slow() or SDL_Blit_Slow_Float() are counted by
+ * format and flags, so it's easy to see which ones could use a faster path.
+ * Each combination is logged at debug priority when it's first chosen, and
+ * the counts are logged when SDL quits. Nothing is counted unless debug
+ * logging is enabled for the video category.
+ */
+typedef struct SDL_SlowBlitStats
+{
+    SDL_PixelFormat src_format;
+    SDL_PixelFormat dst_format;
+    int flags;
+    int blits;
+} SDL_SlowBlitStats;
+
+static SDL_SpinLock SDL_slow_blit_lock;
+static SDL_SlowBlitStats *SDL_slow_blit_stats;
+static int SDL_num_slow_blit_stats;
+static int SDL_max_slow_blit_stats;
+
+static bool SDL_SlowBlitStatsEnabled(void)
+{
+    return SDL_GetLogPriority(SDL_LOG_CATEGORY_VIDEO) <= SDL_LOG_PRIORITY_DEBUG;
+}
+
+static bool SDL_IsSlowBlit(SDL_BlitFunc blit)
+{
+    return blit == SDL_Blit_Slow || blit == SDL_Blit_Slow_Float;
+}
+
+static void SDL_CountSlowBlit(const SDL_BlitInfo *info, int blits)
+{
+    const SDL_PixelFormat src_format = info->src_fmt->format;
+    const SDL_PixelFormat dst_format = info->dst_fmt->format;
+    const int flags = (info->flags & (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_COLORKEY | SDL_COPY_NEAREST));
+    bool first = false;
+    int i;
+
+    SDL_LockSpinlock(&SDL_slow_blit_lock);
+    for (i = 0; i < SDL_num_slow_blit_stats; ++i) {
+        SDL_SlowBlitStats *stats = &SDL_slow_blit_stats[i];
+        if (stats->src_format == src_format && stats->dst_format == dst_format && stats->flags == flags) {
+            stats->blits += blits;
+            break;
+        }
+    }
+    if (i == SDL_num_slow_blit_stats && i == SDL_max_slow_blit_stats) {
+        const int max_stats = SDL_max_slow_blit_stats ? SDL_max_slow_blit_stats * 2 : 16;
+        SDL_SlowBlitStats *stats = (SDL_SlowBlitStats *)SDL_realloc(SDL_slow_blit_stats, max_stats * sizeof(*stats));
+        if (stats) {
+            SDL_slow_blit_stats = stats;
+            SDL_max_slow_blit_stats = max_stats;
+        }
+    }
+    if (i == SDL_num_slow_blit_stats && i < SDL_max_slow_blit_stats) {
+        SDL_SlowBlitStats *stats = &SDL_slow_blit_stats[i];
+        stats->src_format = src_format;
+        stats->dst_format = dst_format;
+        stats->flags = flags;
+        stats->blits = blits;
+        ++SDL_num_slow_blit_stats;
+        first = true;
+    }
+    SDL_UnlockSpinlock(&SDL_slow_blit_lock);
+
+    if (first) {
+        SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "Blits from %s to %s with flags 0x%.8x use the slow blitter",
+                     SDL_GetPixelFormatName(src_format), SDL_GetPixelFormatName(dst_format), flags);
+    }
+}
+
+// Count a blit that has been run, including float blits that fell back to the slow path
+static void SDL_CountBlit(SDL_BlitFunc blit, const SDL_BlitInfo *info)
+{
+    if (!SDL_SlowBlitStatsEnabled()) {
+        return;
+    }
+    if (SDL_IsSlowBlit(blit) || SDL_BlitFloatUsesSlowPath(blit, info)) {
+        SDL_CountSlowBlit(info, 1);
+    }
+}
+
+void SDL_QuitSlowBlitStats(void)
+{
+    int i;
+
+    SDL_LockSpinlock(&SDL_slow_blit_lock);
+    for (i = 0; i < SDL_num_slow_blit_stats; ++i) {
+        const SDL_SlowBlitStats *stats = &SDL_slow_blit_stats[i];
+
+        SDL_LogDebug(SDL_LOG_CATEGORY_VIDEO, "Slow blits from %s to %s with flags 0x%.8x: %d",
+                     SDL_GetPixelFormatName(stats->src_format), SDL_GetPixelFormatName(stats->dst_format), stats->flags, stats->blits);
+    }
+    SDL_free(SDL_slow_blit_stats);
+    SDL_slow_blit_stats = NULL;
+    SDL_num_slow_blit_stats = 0;
+    SDL_max_slow_blit_stats = 0;
+    SDL_UnlockSpinlock(&SDL_slow_blit_lock);
+}
+
 // The general purpose software blit routine
 static bool SDLCALL SDL_SoftBlit(SDL_Surface *src, const SDL_Rect *srcrect,
                                 SDL_Surface *dst, const SDL_Rect *dstrect)
@@ -64,32 +194,9 @@ static bool SDLCALL SDL_SoftBlit(SDL_Surface *src, const SDL_Rect *srcrect,
         SDL_BlitInfo *info = &src->map.info;
 
         // Set up the blit information
-        if (info->src_fmt->bits_per_pixel >= 8) {
-            info->src = (Uint8 *)src->pixels +
-                        srcrect->y * src->pitch +
-                        srcrect->x * info->src_fmt->bytes_per_pixel;
-        } else {
-            info->src = (Uint8 *)src->pixels +
-                        srcrect->y * src->pitch +
-                        (srcrect->x * info->src_fmt->bits_per_pixel) / 8;
-            info->leading_skip =
-                        ((srcrect->x * info->src_fmt->bits_per_pixel) % 8) /
-                        info->src_fmt->bits_per_pixel;
-        }
-        info->src_w = srcrect->w;
-        info->src_h = srcrect->h;
-        info->src_pitch = src->pitch;
-        info->src_skip =
-            info->src_pitch - info->src_w * info->src_fmt->bytes_per_pixel;
-        info->dst = (Uint8 *)dst->pixels +
-                    dstrect->y * dst->pitch +
-                    dstrect->x * info->dst_fmt->bytes_per_pixel;
-        info->dst_w = dstrect->w;
-        info->dst_h = dstrect->h;
-        info->dst_pitch = dst->pitch;
-        info->dst_skip =
-            info->dst_pitch - info->dst_w * info->dst_fmt->bytes_per_pixel;
+        SDL_SetupBlitInfo(info, src, srcrect, dst, dstrect);
         RunBlit = (SDL_BlitFunc)src->map.data;
+        SDL_CountBlit(RunBlit, info);
 
         // Run the actual software blit
         RunBlit(info);
@@ -106,6 +213,51 @@ static bool SDLCALL SDL_SoftBlit(SDL_Surface *src, const SDL_Rect *srcrect,
     return okay;
 }
 
+typedef struct SDL_BlitBands
+{
+    SDL_BlitFunc blit;
+    const SDL_BlitInfo *info;
+} SDL_BlitBands;
+
+static void SDL_BlitRows(void *userdata, int row, int num_rows)
+{
+    const SDL_BlitBands *bands = (const SDL_BlitBands *)userdata;
+    SDL_BlitInfo info = *bands->info;
+
+    info.src += row * info.src_pitch;
+    info.dst += row * info.dst_pitch;
+    info.src_h = num_rows;
+    info.dst_h = num_rows;
+    bands->blit(&info);
+}
+
+/* Like SDL_BlitSurfaceUnchecked(), but large unscaled software blits are
+ * split into bands of rows that are blitted on several threads
+ */
+bool SDL_BlitSurfaceUncheckedParallel(SDL_Surface *src, const SDL_Rect *srcrect,
+                                      SDL_Surface *dst, const SDL_Rect *dstrect)
+{
+    if (!SDL_ValidateMap(src, dst)) {
+        return false;
+    }
+
+    // The palette map is filled in as colors are looked up, so it can't be shared between threads
+    if (src->map.blit == SDL_SoftBlit && !SDL_MUSTLOCK(src) && !SDL_MUSTLOCK(dst) &&
+        !src->map.info.palette_map && srcrect->w == dstrect->w && srcrect->h == dstrect->h) {
+        SDL_BlitInfo info = src->map.info;
+        SDL_BlitBands bands;
+
+        SDL_SetupBlitInfo(&info, src, srcrect, dst, dstrect);
+        bands.blit = (SDL_BlitFunc)src->map.data;
+        bands.info = &info;
+        if (SDL_ConvertRowsInParallel(dstrect->w, dstrect->h, 1, SDL_BlitRows, &bands)) {
+            SDL_CountBlit(bands.blit, &info);
+            return true;
+        }
+    }
+    return src->map.blit(src, srcrect, dst, dstrect);
+}
+
 #ifdef SDL_HAVE_BLIT_AUTO
 
 #ifdef SDL_PLATFORM_MACOS
@@ -149,6 +301,15 @@ static SDL_BlitFunc SDL_ChooseBlitFunc(SDL_PixelFormat src_format, SDL_PixelForm
         if (SDL_HasSSE2()) {
             features |= SDL_CPU_SSE2;
         }
+        if (SDL_HasSSE41()) {
+            features |= SDL_CPU_SSE41;
+        }
+        if (SDL_HasAVX2()) {
+            features |= SDL_CPU_AVX2;
+        }
+        if (SDL_HasNEON()) {
+            features |= SDL_CPU_NEON;
+        }
         if (SDL_HasAltiVec()) {
             if (SDL_UseAltivecPrefetch()) {
                 features |= SDL_CPU_ALTIVEC_PREFETCH;
@@ -223,7 +384,7 @@ bool SDL_CalculateBlit(SDL_Surface *surface, SDL_Surface *dst)
         if (src_colorspace != dst_colorspace ||
             SDL_BYTESPERPIXEL(surface->format) > 4 ||
             SDL_BYTESPERPIXEL(dst->format) > 4) {
-            blit = SDL_Blit_Slow_Float;
+            blit = SDL_CalculateBlitFloat(surface);
         }
     }
     if (!blit) {
@@ -231,7 +392,13 @@ bool SDL_CalculateBlit(SDL_Surface *surface, SDL_Surface *dst)
             blit = SDL_BlitCopy;
         } else if (SDL_ISPIXELFORMAT_10BIT(surface->format) ||
                    SDL_ISPIXELFORMAT_10BIT(dst->format)) {
-            blit = SDL_Blit_Slow;
+#ifdef SDL_HAVE_BLIT_AUTO
+            blit = SDL_ChooseBlitFunc(surface->format, dst->format, map->info.flags,
+                                      SDL_GeneratedBlitFuncTable);
+#endif
+            if (!blit) {
+                blit = SDL_Blit_Slow;
+            }
         }
 #ifdef SDL_HAVE_BLIT_0
         else if (SDL_BITSPERPIXEL(surface->format) < 8 &&
@@ -291,5 +458,9 @@ bool SDL_CalculateBlit(SDL_Surface *surface, SDL_Surface *dst)
         return SDL_SetError("Blit combination not supported");
     }
 
+    if (SDL_SlowBlitStatsEnabled() && SDL_IsSlowBlit(blit)) {
+        SDL_CountSlowBlit(&map->info, 0);
+    }
+
     return true;
 }
@@ -52,6 +52,9 @@ extern const Uint16 SDL_expand_byte_10[];
 #define SDL_CPU_SSE2               0x00000004
 #define SDL_CPU_ALTIVEC_PREFETCH   0x00000008
 #define SDL_CPU_ALTIVEC_NOPREFETCH 0x00000010
+#define SDL_CPU_SSE41              0x00000020
+#define SDL_CPU_AVX2               0x00000040
+#define SDL_CPU_NEON               0x00000080
 
 typedef struct
 {
@@ -106,12 +109,16 @@ typedef struct SDL_BlitMap
 
 // Functions found in SDL_blit.c
 extern bool SDL_CalculateBlit(SDL_Surface *surface, SDL_Surface *dst);
+extern bool SDL_BlitSurfaceUncheckedParallel(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect);
+extern void SDL_QuitSlowBlitStats(void);
 
 /* Functions found in SDL_blit_*.c */
 extern SDL_BlitFunc SDL_CalculateBlit0(SDL_Surface *surface);
 extern SDL_BlitFunc SDL_CalculateBlit1(SDL_Surface *surface);
 extern SDL_BlitFunc SDL_CalculateBlitN(SDL_Surface *surface);
 extern SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface);
+extern SDL_BlitFunc SDL_CalculateBlitFloat(SDL_Surface *surface);
+extern bool SDL_BlitFloatUsesSlowPath(SDL_BlitFunc blit, const SDL_BlitInfo *info);
 
 /*
  * Useful macros for blitting routines
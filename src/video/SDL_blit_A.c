@@ -178,8 +178,10 @@ static void SDL_TARGETING("sse2") Blit888to888SurfaceAlphaSSE2(SDL_BlitInfo *inf
     Uint8 *dst = info->dst;
     int dstskip = info->dst_skip;
     Uint8 alpha = info->a;
+    // The byte that isn't red, green or blue gets filled, wherever it is
+    const Uint32 fill = ~(info->dst_fmt->Rmask | info->dst_fmt->Gmask | info->dst_fmt->Bmask);
 
-    const __m128i alpha_fill_mask = _mm_set1_epi32((int)0xff000000);
+    const __m128i alpha_fill_mask = _mm_set1_epi32((int)fill);
     const __m128i srcA = _mm_set1_epi16(alpha);
 
     while (height--) {
@@ -229,7 +231,7 @@ static void SDL_TARGETING("sse2") Blit888to888SurfaceAlphaSSE2(SDL_BlitInfo *inf
 
             FACTOR_BLEND_8888(src32, dst32, alpha);
 
-            *dst = dst32 | 0xff000000;
+            *(Uint32 *)dst = dst32 | fill;
 
             src += 4;
             dst += 4;
@@ -1419,6 +1421,457 @@ static void Blit8888to8888PixelAlphaSwizzleNEON(SDL_BlitInfo *info)
 
 #endif
 
+#ifdef SDL_AVX2_INTRINSICS
+
+// dst = src * alpha + dst * (1 - alpha) for each 8-bit channel, rounded like ALPHA_BLEND_CHANNEL
+static __m256i SDL_TARGETING("avx2") BlendChannels8888AVX2(__m256i src, __m256i dst, __m256i alpha)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi16(1);
+    __m256i src_lo = _mm256_unpacklo_epi8(src, zero);
+    __m256i src_hi = _mm256_unpackhi_epi8(src, zero);
+    __m256i dst_lo = _mm256_unpacklo_epi8(dst, zero);
+    __m256i dst_hi = _mm256_unpackhi_epi8(dst, zero);
+
+    // dst = ((src - dst) * srcA) + ((dst << 8) - dst) + 1
+    dst_lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(src_lo, dst_lo), alpha),
+                              _mm256_sub_epi16(_mm256_slli_epi16(dst_lo, 8), dst_lo));
+    dst_hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(src_hi, dst_hi), alpha),
+                              _mm256_sub_epi16(_mm256_slli_epi16(dst_hi, 8), dst_hi));
+    dst_lo = _mm256_add_epi16(dst_lo, one);
+    dst_hi = _mm256_add_epi16(dst_hi, one);
+
+    // dst = (dst + (dst >> 8)) >> 8
+    dst_lo = _mm256_srli_epi16(_mm256_add_epi16(dst_lo, _mm256_srli_epi16(dst_lo, 8)), 8);
+    dst_hi = _mm256_srli_epi16(_mm256_add_epi16(dst_hi, _mm256_srli_epi16(dst_hi, 8)), 8);
+
+    // unpack and pack both work within 128-bit lanes, so the pixel order is preserved
+    return _mm256_packus_epi16(dst_lo, dst_hi);
+}
+
+static void SDL_TARGETING("avx2") Blit888to888SurfaceAlphaAVX2(SDL_BlitInfo *info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    int srcskip = info->src_skip;
+    Uint8 *dst = info->dst;
+    int dstskip = info->dst_skip;
+    Uint8 alpha = info->a;
+    const Uint32 fill = ~(info->dst_fmt->Rmask | info->dst_fmt->Gmask | info->dst_fmt->Bmask);
+
+    const __m256i alpha_fill_mask = _mm256_set1_epi32((int)fill);
+    const __m256i srcA = _mm256_set1_epi16(alpha);
+
+    while (height--) {
+        int i = 0;
+
+        for (; i + 8 <= width; i += 8) {
+            __m256i src256 = _mm256_loadu_si256((__m256i *)src);
+            __m256i dst256 = _mm256_loadu_si256((__m256i *)dst);
+
+            dst256 = BlendChannels8888AVX2(src256, dst256, srcA);
+            dst256 = _mm256_or_si256(dst256, alpha_fill_mask);
+
+            _mm256_storeu_si256((__m256i *)dst, dst256);
+
+            src += 32;
+            dst += 32;
+        }
+
+        for (; i < width; ++i) {
+            Uint32 src32 = *(Uint32 *)src;
+            Uint32 dst32 = *(Uint32 *)dst;
+
+            FACTOR_BLEND_8888(src32, dst32, alpha);
+
+            *(Uint32 *)dst = dst32 | fill;
+
+            src += 4;
+            dst += 4;
+        }
+
+        src += srcskip;
+        dst += dstskip;
+    }
+}
+
+/* Matches BlitNtoNSurfaceAlphaKey for 8888 formats with the same RGB layout:
+   the source alpha byte is treated as opaque, and the destination keeps its
+   alpha byte only if it has one. */
+static void SDL_TARGETING("avx2") Blit8888to8888SurfaceAlphaKeyAVX2(SDL_BlitInfo *info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    int srcskip = info->src_skip;
+    Uint8 *dst = info->dst;
+    int dstskip = info->dst_skip;
+    const Uint32 ckey = info->colorkey;
+    const Uint32 rgbmask = info->src_fmt->Rmask | info->src_fmt->Gmask | info->src_fmt->Bmask;
+    const Uint32 keepmask = rgbmask | info->dst_fmt->Amask;
+    const Uint8 alpha = info->a;
+
+    const __m256i ckey256 = _mm256_set1_epi32((int)ckey);
+    const __m256i opaque256 = _mm256_set1_epi32((int)~rgbmask);
+    const __m256i keep256 = _mm256_set1_epi32((int)keepmask);
+    const __m256i srcA = _mm256_set1_epi16(alpha);
+
+    if (!alpha) {
+        return;
+    }
+
+    while (height--) {
+        int i = 0;
+
+        for (; i + 8 <= width; i += 8) {
+            __m256i src256 = _mm256_loadu_si256((__m256i *)src);
+            __m256i dst256 = _mm256_loadu_si256((__m256i *)dst);
+            __m256i keyed = _mm256_cmpeq_epi32(src256, ckey256);
+
+            __m256i blended = BlendChannels8888AVX2(_mm256_or_si256(src256, opaque256), dst256, srcA);
+            blended = _mm256_and_si256(blended, keep256);
+
+            _mm256_storeu_si256((__m256i *)dst, _mm256_blendv_epi8(blended, dst256, keyed));
+
+            src += 32;
+            dst += 32;
+        }
+
+        for (; i < width; ++i) {
+            Uint32 src32 = *(Uint32 *)src;
+            if (src32 != ckey) {
+                Uint32 dst32 = *(Uint32 *)dst;
+                src32 |= ~rgbmask;
+                FACTOR_BLEND_8888(src32, dst32, alpha);
+                *(Uint32 *)dst = dst32 & keepmask;
+            }
+            src += 4;
+            dst += 4;
+        }
+
+        src += srcskip;
+        dst += dstskip;
+    }
+}
+
+/* Vectorized BlitARGBto565PixelAlpha and BlitARGBto555PixelAlpha. The green
+   bits are moved above the red and blue bits, so the blend of all three
+   components fits in one 32-bit multiply, exactly like the scalar versions.
+   `gshift` is 5 for 565 and 6 for 555. */
+static void SDL_TARGETING("avx2") BlitARGBto16PixelAlphaAVX2(SDL_BlitInfo *info, const int gshift, const Uint32 spreadmask)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *)info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint16 *dstp = (Uint16 *)info->dst;
+    int dstskip = info->dst_skip >> 1;
+
+    // 565: red at 0xf800, green at 0x07e0. 555: red at 0x7c00, green at 0x03e0
+    const Uint32 rmask = (gshift == 5) ? 0xf800 : 0x7c00;
+    const Uint32 gmask = (gshift == 5) ? 0x07e0 : 0x03e0;
+    const Uint32 gsrcmask = (gshift == 5) ? 0xfc00 : 0xf800;
+    const __m128i rshift_opaque = _mm_cvtsi32_si128(gshift + 3);  // 8 for 565, 9 for 555
+    const __m128i gshift_opaque = _mm_cvtsi32_si128(gshift);
+    const __m128i gshift_spread = _mm_cvtsi32_si128(16 - gshift);  // 11 for 565, 10 for 555
+    const __m256i rmask256 = _mm256_set1_epi32((int)rmask);
+    const __m256i gmask256 = _mm256_set1_epi32((int)gmask);
+    const __m256i gsrcmask256 = _mm256_set1_epi32((int)gsrcmask);
+    const __m256i bmask256 = _mm256_set1_epi32(0x1f);
+    const __m256i spread256 = _mm256_set1_epi32((int)spreadmask);
+    const __m256i low16 = _mm256_set1_epi32(0xffff);
+    const __m256i opaque = _mm256_set1_epi32(SDL_ALPHA_OPAQUE >> 3);
+    const __m256i zero = _mm256_setzero_si256();
+
+    while (height--) {
+        int i = 0;
+
+        for (; i + 8 <= width; i += 8) {
+            __m256i s = _mm256_loadu_si256((__m256i *)srcp);
+            __m256i d = _mm256_cvtepu16_epi32(_mm_loadu_si128((__m128i *)dstp));
+            __m256i alpha = _mm256_srli_epi32(s, 27);
+            __m256i red = _mm256_and_si256(_mm256_srl_epi32(s, rshift_opaque), rmask256);
+            __m256i blue = _mm256_and_si256(_mm256_srli_epi32(s, 3), bmask256);
+
+            // Opaque pixels are just converted
+            __m256i converted = _mm256_add_epi32(_mm256_add_epi32(red, blue),
+                                                 _mm256_and_si256(_mm256_srl_epi32(s, gshift_opaque), gmask256));
+
+            // Everything else is blended in the spread out format
+            __m256i s2 = _mm256_add_epi32(_mm256_add_epi32(red, blue),
+                                          _mm256_sll_epi32(_mm256_and_si256(s, gsrcmask256), gshift_spread));
+            __m256i d2 = _mm256_and_si256(_mm256_or_si256(d, _mm256_slli_epi32(d, 16)), spread256);
+            d2 = _mm256_add_epi32(d2, _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(s2, d2), alpha), 5));
+            d2 = _mm256_and_si256(d2, spread256);
+            d2 = _mm256_and_si256(_mm256_or_si256(d2, _mm256_srli_epi32(d2, 16)), low16);
+
+            d2 = _mm256_blendv_epi8(d2, converted, _mm256_cmpeq_epi32(alpha, opaque));
+            d2 = _mm256_blendv_epi8(d2, d, _mm256_cmpeq_epi32(alpha, zero));
+
+            // Pack within each lane, then gather the two halves into the low 128 bits
+            d2 = _mm256_permute4x64_epi64(_mm256_packus_epi32(d2, d2), 0x08);
+            _mm_storeu_si128((__m128i *)dstp, _mm256_castsi256_si128(d2));
+
+            srcp += 8;
+            dstp += 8;
+        }
+
+        for (; i < width; ++i) {
+            Uint32 s = *srcp;
+            unsigned alpha = s >> 27;
+            if (alpha) {
+                const Uint32 red = (s >> (gshift + 3)) & rmask;
+                const Uint32 blue = (s >> 3) & 0x1f;
+                if (alpha == (SDL_ALPHA_OPAQUE >> 3)) {
+                    *dstp = (Uint16)(red + ((s >> gshift) & gmask) + blue);
+                } else {
+                    Uint32 d = *dstp;
+                    s = ((s & gsrcmask) << (16 - gshift)) + red + blue;
+                    d = (d | d << 16) & spreadmask;
+                    d += (s - d) * alpha >> 5;
+                    d &= spreadmask;
+                    *dstp = (Uint16)(d | d >> 16);
+                }
+            }
+            srcp++;
+            dstp++;
+        }
+
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+static void SDL_TARGETING("avx2") BlitARGBto565PixelAlphaAVX2(SDL_BlitInfo *info)
+{
+    BlitARGBto16PixelAlphaAVX2(info, 5, 0x07e0f81f);
+}
+
+static void SDL_TARGETING("avx2") BlitARGBto555PixelAlphaAVX2(SDL_BlitInfo *info)
+{
+    BlitARGBto16PixelAlphaAVX2(info, 6, 0x03e07c1f);
+}
+
+#endif // SDL_AVX2_INTRINSICS
+
+#ifdef SDL_NEON_INTRINSICS
+
+// dst = src * alpha + dst * (1 - alpha) for each 8-bit channel, rounded like ALPHA_BLEND_CHANNEL
+static uint8x16_t BlendChannels8888NEON(uint8x16_t src, uint8x16_t dst, uint16x8_t alpha)
+{
+    const uint16x8_t one = vdupq_n_u16(1);
+    uint16x8_t src_lo = vmovl_u8(vget_low_u8(src));
+    uint16x8_t src_hi = vmovl_u8(vget_high_u8(src));
+    uint16x8_t dst_lo = vmovl_u8(vget_low_u8(dst));
+    uint16x8_t dst_hi = vmovl_u8(vget_high_u8(dst));
+
+    // dst = ((src - dst) * srcA) + ((dst << 8) - dst) + 1
+    dst_lo = vaddq_u16(vmulq_u16(vsubq_u16(src_lo, dst_lo), alpha), vsubq_u16(vshlq_n_u16(dst_lo, 8), dst_lo));
+    dst_hi = vaddq_u16(vmulq_u16(vsubq_u16(src_hi, dst_hi), alpha), vsubq_u16(vshlq_n_u16(dst_hi, 8), dst_hi));
+    dst_lo = vaddq_u16(dst_lo, one);
+    dst_hi = vaddq_u16(dst_hi, one);
+
+    // dst = (dst + (dst >> 8)) >> 8
+    dst_lo = vshrq_n_u16(vaddq_u16(dst_lo, vshrq_n_u16(dst_lo, 8)), 8);
+    dst_hi = vshrq_n_u16(vaddq_u16(dst_hi, vshrq_n_u16(dst_hi, 8)), 8);
+
+    return vcombine_u8(vmovn_u16(dst_lo), vmovn_u16(dst_hi));
+}
+
+static void Blit888to888SurfaceAlphaNEON(SDL_BlitInfo *info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    int srcskip = info->src_skip;
+    Uint8 *dst = info->dst;
+    int dstskip = info->dst_skip;
+    Uint8 alpha = info->a;
+    const Uint32 fill = ~(info->dst_fmt->Rmask | info->dst_fmt->Gmask | info->dst_fmt->Bmask);
+
+    const uint8x16_t alpha_fill_mask = vreinterpretq_u8_u32(vdupq_n_u32(fill));
+    const uint16x8_t srcA = vdupq_n_u16(alpha);
+
+    while (height--) {
+        int i = 0;
+
+        for (; i + 4 <= width; i += 4) {
+            uint8x16_t src128 = vld1q_u8(src);
+            uint8x16_t dst128 = vld1q_u8(dst);
+
+            dst128 = BlendChannels8888NEON(src128, dst128, srcA);
+            vst1q_u8(dst, vorrq_u8(dst128, alpha_fill_mask));
+
+            src += 16;
+            dst += 16;
+        }
+
+        for (; i < width; ++i) {
+            Uint32 src32 = *(Uint32 *)src;
+            Uint32 dst32 = *(Uint32 *)dst;
+
+            FACTOR_BLEND_8888(src32, dst32, alpha);
+
+            *(Uint32 *)dst = dst32 | fill;
+
+            src += 4;
+            dst += 4;
+        }
+
+        src += srcskip;
+        dst += dstskip;
+    }
+}
+
+// See Blit8888to8888SurfaceAlphaKeyAVX2
+static void Blit8888to8888SurfaceAlphaKeyNEON(SDL_BlitInfo *info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    int srcskip = info->src_skip;
+    Uint8 *dst = info->dst;
+    int dstskip = info->dst_skip;
+    const Uint32 ckey = info->colorkey;
+    const Uint32 rgbmask = info->src_fmt->Rmask | info->src_fmt->Gmask | info->src_fmt->Bmask;
+    const Uint32 keepmask = rgbmask | info->dst_fmt->Amask;
+    const Uint8 alpha = info->a;
+
+    const uint32x4_t ckey128 = vdupq_n_u32(ckey);
+    const uint32x4_t opaque128 = vdupq_n_u32(~rgbmask);
+    const uint32x4_t keep128 = vdupq_n_u32(keepmask);
+    const uint16x8_t srcA = vdupq_n_u16(alpha);
+
+    if (!alpha) {
+        return;
+    }
+
+    while (height--) {
+        int i = 0;
+
+        for (; i + 4 <= width; i += 4) {
+            uint32x4_t src128 = vld1q_u32((const uint32_t *)src);
+            uint32x4_t dst128 = vld1q_u32((const uint32_t *)dst);
+            uint32x4_t keyed = vceqq_u32(src128, ckey128);
+
+            uint32x4_t blended = vreinterpretq_u32_u8(BlendChannels8888NEON(vreinterpretq_u8_u32(vorrq_u32(src128, opaque128)),
+                                                                            vreinterpretq_u8_u32(dst128), srcA));
+            blended = vandq_u32(blended, keep128);
+
+            vst1q_u32((uint32_t *)dst, vbslq_u32(keyed, dst128, blended));
+
+            src += 16;
+            dst += 16;
+        }
+
+        for (; i < width; ++i) {
+            Uint32 src32 = *(Uint32 *)src;
+            if (src32 != ckey) {
+                Uint32 dst32 = *(Uint32 *)dst;
+                src32 |= ~rgbmask;
+                FACTOR_BLEND_8888(src32, dst32, alpha);
+                *(Uint32 *)dst = dst32 & keepmask;
+            }
+            src += 4;
+            dst += 4;
+        }
+
+        src += srcskip;
+        dst += dstskip;
+    }
+}
+
+// See BlitARGBto16PixelAlphaAVX2
+static void BlitARGBto16PixelAlphaNEON(SDL_BlitInfo *info, const int gshift, const Uint32 spreadmask)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *)info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint16 *dstp = (Uint16 *)info->dst;
+    int dstskip = info->dst_skip >> 1;
+
+    const Uint32 rmask = (gshift == 5) ? 0xf800 : 0x7c00;
+    const Uint32 gmask = (gshift == 5) ? 0x07e0 : 0x03e0;
+    const Uint32 gsrcmask = (gshift == 5) ? 0xfc00 : 0xf800;
+    // Variable shifts are left shifts by a signed count
+    const int32x4_t rshift_opaque = vdupq_n_s32(-(gshift + 3));
+    const int32x4_t gshift_opaque = vdupq_n_s32(-gshift);
+    const int32x4_t gshift_spread = vdupq_n_s32(16 - gshift);
+    const uint32x4_t rmask128 = vdupq_n_u32(rmask);
+    const uint32x4_t gmask128 = vdupq_n_u32(gmask);
+    const uint32x4_t gsrcmask128 = vdupq_n_u32(gsrcmask);
+    const uint32x4_t bmask128 = vdupq_n_u32(0x1f);
+    const uint32x4_t spread128 = vdupq_n_u32(spreadmask);
+    const uint32x4_t opaque = vdupq_n_u32(SDL_ALPHA_OPAQUE >> 3);
+    const uint32x4_t zero = vdupq_n_u32(0);
+
+    while (height--) {
+        int i = 0;
+
+        for (; i + 4 <= width; i += 4) {
+            uint32x4_t s = vld1q_u32(srcp);
+            uint32x4_t d = vmovl_u16(vld1_u16(dstp));
+            uint32x4_t alpha = vshrq_n_u32(s, 27);
+            uint32x4_t red = vandq_u32(vshlq_u32(s, rshift_opaque), rmask128);
+            uint32x4_t blue = vandq_u32(vshrq_n_u32(s, 3), bmask128);
+
+            uint32x4_t converted = vaddq_u32(vaddq_u32(red, blue), vandq_u32(vshlq_u32(s, gshift_opaque), gmask128));
+
+            uint32x4_t s2 = vaddq_u32(vaddq_u32(red, blue), vshlq_u32(vandq_u32(s, gsrcmask128), gshift_spread));
+            uint32x4_t d2 = vandq_u32(vorrq_u32(d, vshlq_n_u32(d, 16)), spread128);
+            d2 = vaddq_u32(d2, vshrq_n_u32(vmulq_u32(vsubq_u32(s2, d2), alpha), 5));
+            d2 = vandq_u32(d2, spread128);
+            d2 = vorrq_u32(d2, vshrq_n_u32(d2, 16));
+
+            d2 = vbslq_u32(vceqq_u32(alpha, opaque), converted, d2);
+            d2 = vbslq_u32(vceqq_u32(alpha, zero), d, d2);
+
+            vst1_u16(dstp, vmovn_u32(d2));
+
+            srcp += 4;
+            dstp += 4;
+        }
+
+        for (; i < width; ++i) {
+            Uint32 s = *srcp;
+            unsigned alpha = s >> 27;
+            if (alpha) {
+                const Uint32 red = (s >> (gshift + 3)) & rmask;
+                const Uint32 blue = (s >> 3) & 0x1f;
+                if (alpha == (SDL_ALPHA_OPAQUE >> 3)) {
+                    *dstp = (Uint16)(red + ((s >> gshift) & gmask) + blue);
+                } else {
+                    Uint32 d = *dstp;
+                    s = ((s & gsrcmask) << (16 - gshift)) + red + blue;
+                    d = (d | d << 16) & spreadmask;
+                    d += (s - d) * alpha >> 5;
+                    d &= spreadmask;
+                    *dstp = (Uint16)(d | d >> 16);
+                }
+            }
+            srcp++;
+            dstp++;
+        }
+
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+static void BlitARGBto565PixelAlphaNEON(SDL_BlitInfo *info)
+{
+    BlitARGBto16PixelAlphaNEON(info, 5, 0x07e0f81f);
+}
+
+static void BlitARGBto555PixelAlphaNEON(SDL_BlitInfo *info)
+{
+    BlitARGBto16PixelAlphaNEON(info, 6, 0x03e07c1f);
+}
+
+#endif // SDL_NEON_INTRINSICS
+
 // General (slow) N->N blending with pixel alpha
 static void BlitNtoNPixelAlpha(SDL_BlitInfo *info)
 {
@@ -1479,8 +1932,28 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
         case 2:
             if (sf->bytes_per_pixel == 4 && sf->Amask == 0xff000000 && sf->Gmask == 0xff00 && ((sf->Rmask == 0xff && df->Rmask == 0x1f) || (sf->Bmask == 0xff && df->Bmask == 0x1f))) {
                 if (df->Gmask == 0x7e0) {
+#ifdef SDL_AVX2_INTRINSICS
+                    if (SDL_HasAVX2()) {
+                        return BlitARGBto565PixelAlphaAVX2;
+                    }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+                    if (SDL_HasNEON()) {
+                        return BlitARGBto565PixelAlphaNEON;
+                    }
+#endif
                     return BlitARGBto565PixelAlpha;
                 } else if (df->Gmask == 0x3e0 && !df->Amask) {
+#ifdef SDL_AVX2_INTRINSICS
+                    if (SDL_HasAVX2()) {
+                        return BlitARGBto555PixelAlphaAVX2;
+                    }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+                    if (SDL_HasNEON()) {
+                        return BlitARGBto555PixelAlphaNEON;
+                    }
+#endif
                     return BlitARGBto555PixelAlpha;
                 }
             }
@@ -1563,10 +2036,20 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
 
             case 4:
                 if (sf->Rmask == df->Rmask && sf->Gmask == df->Gmask && sf->Bmask == df->Bmask && sf->bytes_per_pixel == 4) {
+#ifdef SDL_AVX2_INTRINSICS
+                    if (sf->Rshift % 8 == 0 && sf->Gshift % 8 == 0 && sf->Bshift % 8 == 0 && SDL_HasAVX2()) {
+                        return Blit888to888SurfaceAlphaAVX2;
+                    }
+#endif
 #ifdef SDL_SSE2_INTRINSICS
                     if (sf->Rshift % 8 == 0 && sf->Gshift % 8 == 0 && sf->Bshift % 8 == 0 && SDL_HasSSE2()) {
                         return Blit888to888SurfaceAlphaSSE2;
                     }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+                    if (sf->Rshift % 8 == 0 && sf->Gshift % 8 == 0 && sf->Bshift % 8 == 0 && SDL_HasNEON()) {
+                        return Blit888to888SurfaceAlphaNEON;
+                    }
 #endif
                     if ((sf->Rmask | sf->Gmask | sf->Bmask) == 0xffffff) {
                         return BlitRGBtoRGBSurfaceAlpha;
@@ -1583,6 +2066,20 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
 
     case SDL_COPY_COLORKEY | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND:
         if (sf->Amask == 0) {
+            if (sf->bytes_per_pixel == 4 && df->bytes_per_pixel == 4 &&
+                sf->Rbits == 8 && sf->Gbits == 8 && sf->Bbits == 8 &&
+                sf->Rmask == df->Rmask && sf->Gmask == df->Gmask && sf->Bmask == df->Bmask) {
+#ifdef SDL_AVX2_INTRINSICS
+                if (SDL_HasAVX2()) {
+                    return Blit8888to8888SurfaceAlphaKeyAVX2;
+                }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+                if (SDL_HasNEON()) {
+                    return Blit8888to8888SurfaceAlphaKeyNEON;
+                }
+#endif
+            }
             if (df->bytes_per_pixel == 1) {
 
                 if (surface->map.info.dst_pal) {
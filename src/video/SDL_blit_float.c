@@ -0,0 +1,742 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#include "SDL_surface_c.h"
+#include "SDL_blit_slow.h"
+#include "SDL_pixels_c.h"
+
+/* Fast paths for the common colorspace conversions that would otherwise go
+ * through SDL_Blit_Slow_Float(): sRGB 8888 and 2101010, HDR10 2101010, and
+ * linear RGBA64_FLOAT and RGBA128_FLOAT surfaces, without blending or scaling.
+ *
+ * Each row is converted a span at a time: the pixels are unpacked into linear
+ * RGBA floats, tonemapped and converted to the destination primaries, and
+ * packed again. The transfer functions are evaluated with tables, which are
+ * built from the same functions the slow blitter uses, so the results match,
+ * except where PQ rounding is already unstable in the slow blitter.
+ */
+
+#define FLOAT_BLIT_SPAN 256
+
+typedef enum
+{
+    FloatBlitPixels_Unsupported,
+    FloatBlitPixels_8888,
+    FloatBlitPixels_2101010,
+    FloatBlitPixels_RGBA64_FLOAT,
+    FloatBlitPixels_RGBA128_FLOAT
+} FloatBlitPixels;
+
+/* A transfer function for 8 or 10 bit color channels
+ *
+ * Encoding looks up the first code to check in a table indexed by the high
+ * bits of the value, and then steps up to the code whose bounds contain it.
+ */
+#define TRANSFER_CURVE_GUESS_SHIFT 17
+#define TRANSFER_CURVE_GUESS_SIZE  2048
+
+typedef struct
+{
+    SDL_InitState init;
+    int max;
+    float input_max;
+    Sint32 guess_base;
+    int guess_count;
+    float decode[1024];
+    float bounds[1025];
+    Uint16 guess[TRANSFER_CURVE_GUESS_SIZE];
+} SDL_TransferCurve;
+
+typedef enum
+{
+    SDL_TRANSFER_CURVE_SRGB_8,
+    SDL_TRANSFER_CURVE_SRGB_10,
+    SDL_TRANSFER_CURVE_PQ_10,
+    SDL_TRANSFER_CURVE_COUNT
+} SDL_TransferCurveType;
+
+static SDL_TransferCurve SDL_transfer_curves[SDL_TRANSFER_CURVE_COUNT];
+
+typedef struct
+{
+    FloatBlitPixels src_pixels;
+    FloatBlitPixels dst_pixels;
+    const SDL_PixelFormatDetails *src_fmt;
+    const SDL_PixelFormatDetails *dst_fmt;
+    const SDL_TransferCurve *src_curve;
+    const SDL_TransferCurve *dst_curve;
+    SDL_BlitColorConversion conversion;
+    float src_scale; // the source is divided by this
+    float dst_scale; // the destination is multiplied by this
+} FloatBlitContext;
+
+typedef void (*FloatBlitReadFunc)(const Uint8 *src, float *rgba, int count, const FloatBlitContext *ctx);
+typedef void (*FloatBlitTransformFunc)(float *rgba, int count, const FloatBlitContext *ctx);
+typedef void (*FloatBlitWriteFunc)(const float *rgba, Uint8 *dst, int count, const FloatBlitContext *ctx);
+
+static Uint32 FloatToBits(float f)
+{
+    Uint32 bits;
+    SDL_memcpy(&bits, &f, sizeof(bits));
+    return bits;
+}
+
+static float BitsToFloat(Uint32 bits)
+{
+    float f;
+    SDL_memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+// This matches the code that SDL_Blit_Slow_Float() writes for a linear value
+static int EncodeTransferSlow(SDL_TransferCurveType type, float v)
+{
+    switch (type) {
+    case SDL_TRANSFER_CURVE_SRGB_8:
+        return (int)SDL_roundf(SDL_clamp(SDL_sRGBfromLinear(v), 0.0f, 1.0f) * 255.0f);
+    case SDL_TRANSFER_CURVE_SRGB_10:
+        return (int)SDL_roundf(SDL_clamp(SDL_sRGBfromLinear(v), 0.0f, 1.0f) * 1023.0f);
+    case SDL_TRANSFER_CURVE_PQ_10:
+        return (int)SDL_roundf(SDL_clamp(SDL_PQfromNits(v), 0.0f, 1.0f) * 1023.0f);
+    default:
+        return 0;
+    }
+}
+
+static void InitTransferCurve(SDL_TransferCurveType type)
+{
+    SDL_TransferCurve *curve = &SDL_transfer_curves[type];
+    Uint32 input_max_bits;
+    Sint32 guess_base;
+    int i, code;
+
+    if (!SDL_ShouldInit(&curve->init)) {
+        return;
+    }
+
+    if (type == SDL_TRANSFER_CURVE_SRGB_8) {
+        curve->max = 255;
+    } else {
+        curve->max = 1023;
+    }
+    if (type == SDL_TRANSFER_CURVE_PQ_10) {
+        curve->input_max = 10000.0f;
+    } else {
+        curve->input_max = 1.0f;
+    }
+
+    // Decoding gives the linear value, in nits for PQ
+    for (i = 0; i <= curve->max; ++i) {
+        const float v = (float)i / (float)curve->max;
+
+        if (type == SDL_TRANSFER_CURVE_PQ_10) {
+            curve->decode[i] = SDL_PQtoNits(v);
+        } else {
+            curve->decode[i] = SDL_sRGBtoLinear(v);
+        }
+    }
+
+    /* Find the smallest value that encodes to each code, searching the bit
+     * patterns of positive floats, which sort in the same order as the values.
+     */
+    input_max_bits = FloatToBits(curve->input_max);
+    curve->bounds[0] = 0.0f;
+    for (code = 1; code <= curve->max; ++code) {
+        Uint32 lo = FloatToBits(curve->bounds[code - 1]);
+        Uint32 hi = input_max_bits;
+
+        while (lo < hi) {
+            const Uint32 mid = lo + (hi - lo) / 2;
+            if (EncodeTransferSlow(type, BitsToFloat(mid)) >= code) {
+                hi = mid;
+            } else {
+                lo = mid + 1;
+            }
+        }
+        curve->bounds[code] = BitsToFloat(lo);
+    }
+
+    /* Values below the guess base start at code 0, the rest start at the
+     * code of the smallest value with the same high bits.
+     */
+    guess_base = (Sint32)FloatToBits(curve->bounds[1]);
+    guess_base = SDL_max(guess_base, (Sint32)input_max_bits - ((TRANSFER_CURVE_GUESS_SIZE - 2) << TRANSFER_CURVE_GUESS_SHIFT));
+    guess_base &= ~((1 << TRANSFER_CURVE_GUESS_SHIFT) - 1);
+    curve->guess_base = guess_base;
+    curve->guess_count = (int)((((Sint32)input_max_bits - guess_base) >> TRANSFER_CURVE_GUESS_SHIFT) + 2);
+    SDL_assert(curve->guess_count <= TRANSFER_CURVE_GUESS_SIZE);
+
+    code = 0;
+    curve->guess[0] = 0;
+    for (i = 1; i < curve->guess_count; ++i) {
+        const float v = BitsToFloat((Uint32)(guess_base + ((i - 1) << TRANSFER_CURVE_GUESS_SHIFT)));
+
+        while (code < curve->max && v >= curve->bounds[code + 1]) {
+            ++code;
+        }
+        curve->guess[i] = (Uint16)code;
+    }
+
+    SDL_SetInitialized(&curve->init, true);
+}
+
+static SDL_INLINE Uint32 EncodeTransfer(const SDL_TransferCurve *curve, float v)
+{
+    const Sint32 bits = (Sint32)FloatToBits(v);
+    int index, code;
+
+    if (bits < curve->guess_base) {
+        index = 0;
+    } else {
+        index = ((bits - curve->guess_base) >> TRANSFER_CURVE_GUESS_SHIFT) + 1;
+        index = SDL_min(index, curve->guess_count - 1);
+    }
+
+    code = curve->guess[index];
+    while (code < curve->max && v >= curve->bounds[code + 1]) {
+        ++code;
+    }
+    return (Uint32)code;
+}
+
+static FloatBlitPixels GetFloatBlitPixels(const SDL_PixelFormatDetails *fmt, SDL_Colorspace colorspace, SDL_TransferCurveType *curve)
+{
+    const SDL_TransferCharacteristics transfer = SDL_COLORSPACETRANSFER(colorspace);
+
+    if (SDL_ISPIXELFORMAT_10BIT(fmt->format)) {
+        if (transfer == SDL_TRANSFER_CHARACTERISTICS_SRGB) {
+            *curve = SDL_TRANSFER_CURVE_SRGB_10;
+            return FloatBlitPixels_2101010;
+        } else if (transfer == SDL_TRANSFER_CHARACTERISTICS_PQ) {
+            *curve = SDL_TRANSFER_CURVE_PQ_10;
+            return FloatBlitPixels_2101010;
+        }
+    } else if (SDL_PIXELTYPE(fmt->format) == SDL_PIXELTYPE_PACKED32 &&
+               SDL_PIXELLAYOUT(fmt->format) == SDL_PACKEDLAYOUT_8888) {
+        if (transfer == SDL_TRANSFER_CHARACTERISTICS_SRGB) {
+            *curve = SDL_TRANSFER_CURVE_SRGB_8;
+            return FloatBlitPixels_8888;
+        }
+    } else if (fmt->format == SDL_PIXELFORMAT_RGBA64_FLOAT) {
+        if (transfer == SDL_TRANSFER_CHARACTERISTICS_LINEAR) {
+            *curve = SDL_TRANSFER_CURVE_COUNT;
+            return FloatBlitPixels_RGBA64_FLOAT;
+        }
+    } else if (fmt->format == SDL_PIXELFORMAT_RGBA128_FLOAT) {
+        if (transfer == SDL_TRANSFER_CHARACTERISTICS_LINEAR) {
+            *curve = SDL_TRANSFER_CURVE_COUNT;
+            return FloatBlitPixels_RGBA128_FLOAT;
+        }
+    }
+    return FloatBlitPixels_Unsupported;
+}
+
+static void Read8888(const Uint8 *src, float *rgba, int count, const FloatBlitContext *ctx)
+{
+    const SDL_PixelFormatDetails *fmt = ctx->src_fmt;
+    const float *decode = ctx->src_curve->decode;
+    const Uint32 *pixels = (const Uint32 *)src;
+    int i;
+
+    for (i = 0; i < count; ++i, rgba += 4) {
+        const Uint32 pixel = pixels[i];
+
+        rgba[0] = decode[(pixel >> fmt->Rshift) & 0xFF];
+        rgba[1] = decode[(pixel >> fmt->Gshift) & 0xFF];
+        rgba[2] = decode[(pixel >> fmt->Bshift) & 0xFF];
+        if (fmt->Amask) {
+            rgba[3] = (float)((pixel >> fmt->Ashift) & 0xFF) / 255.0f;
+        } else {
+            rgba[3] = 1.0f;
+        }
+    }
+}
+
+static void Read2101010(const Uint8 *src, float *rgba, int count, const FloatBlitContext *ctx)
+{
+    const SDL_PixelFormatDetails *fmt = ctx->src_fmt;
+    const float *decode = ctx->src_curve->decode;
+    const Uint32 *pixels = (const Uint32 *)src;
+    int i;
+
+    for (i = 0; i < count; ++i, rgba += 4) {
+        const Uint32 pixel = pixels[i];
+
+        rgba[0] = decode[(pixel >> fmt->Rshift) & 0x3FF];
+        rgba[1] = decode[(pixel >> fmt->Gshift) & 0x3FF];
+        rgba[2] = decode[(pixel >> fmt->Bshift) & 0x3FF];
+        if (fmt->Amask) {
+            rgba[3] = (float)(pixel >> 30) / 3.0f;
+        } else {
+            rgba[3] = 1.0f;
+        }
+    }
+}
+
+static void ReadRGBA64Float(const Uint8 *src, float *rgba, int count, const FloatBlitContext *ctx)
+{
+    const Uint16 *pixels = (const Uint16 *)src;
+    int i;
+
+    for (i = 0; i < count * 4; ++i) {
+        rgba[i] = SDL_HalfToFloat(pixels[i]);
+    }
+}
+
+static void ReadRGBA128Float(const Uint8 *src, float *rgba, int count, const FloatBlitContext *ctx)
+{
+    SDL_memcpy(rgba, src, count * 4 * sizeof(float));
+}
+
+static void Write8888(const float *rgba, Uint8 *dst, int count, const FloatBlitContext *ctx)
+{
+    const SDL_PixelFormatDetails *fmt = ctx->dst_fmt;
+    const SDL_TransferCurve *curve = ctx->dst_curve;
+    Uint32 *pixels = (Uint32 *)dst;
+    int i;
+
+    for (i = 0; i < count; ++i, rgba += 4) {
+        Uint32 pixel = (EncodeTransfer(curve, rgba[0]) << fmt->Rshift) |
+                       (EncodeTransfer(curve, rgba[1]) << fmt->Gshift) |
+                       (EncodeTransfer(curve, rgba[2]) << fmt->Bshift);
+        if (fmt->Amask) {
+            pixel |= (Uint32)SDL_roundf(SDL_clamp(rgba[3], 0.0f, 1.0f) * 255.0f) << fmt->Ashift;
+        }
+        pixels[i] = pixel;
+    }
+}
+
+static void Write2101010(const float *rgba, Uint8 *dst, int count, const FloatBlitContext *ctx)
+{
+    const SDL_PixelFormatDetails *fmt = ctx->dst_fmt;
+    const SDL_TransferCurve *curve = ctx->dst_curve;
+    Uint32 *pixels = (Uint32 *)dst;
+    int i;
+
+    for (i = 0; i < count; ++i, rgba += 4) {
+        Uint32 pixel = (EncodeTransfer(curve, rgba[0]) << fmt->Rshift) |
+                       (EncodeTransfer(curve, rgba[1]) << fmt->Gshift) |
+                       (EncodeTransfer(curve, rgba[2]) << fmt->Bshift);
+        if (fmt->Amask) {
+            pixel |= (Uint32)SDL_roundf(SDL_clamp(rgba[3], 0.0f, 1.0f) * 3.0f) << 30;
+        } else {
+            pixel |= 0xC0000000;
+        }
+        pixels[i] = pixel;
+    }
+}
+
+static void WriteRGBA64Float(const float *rgba, Uint8 *dst, int count, const FloatBlitContext *ctx)
+{
+    Uint16 *pixels = (Uint16 *)dst;
+    int i;
+
+    for (i = 0; i < count * 4; ++i) {
+        pixels[i] = SDL_FloatToHalf(rgba[i]);
+    }
+}
+
+static void WriteRGBA128Float(const float *rgba, Uint8 *dst, int count, const FloatBlitContext *ctx)
+{
+    SDL_memcpy(dst, rgba, count * 4 * sizeof(float));
+}
+
+// These follow the order of operations in SDL_Blit_Slow_Float(), so the results are the same
+static void TransformScalar(float *rgba, int count, const FloatBlitContext *ctx)
+{
+    const SDL_TonemapContext *tonemap = &ctx->conversion.tonemap;
+    const float *matrix = ctx->conversion.color_primaries_matrix;
+    const float src_scale = ctx->src_scale;
+    const float dst_scale = ctx->dst_scale;
+    int i;
+
+    for (i = 0; i < count; ++i, rgba += 4) {
+        float r = rgba[0];
+        float g = rgba[1];
+        float b = rgba[2];
+
+        if (src_scale != 1.0f) {
+            r /= src_scale;
+            g /= src_scale;
+            b /= src_scale;
+        }
+
+        if (tonemap->op == SDL_TONEMAP_LINEAR) {
+            r *= tonemap->data.linear.scale;
+            g *= tonemap->data.linear.scale;
+            b *= tonemap->data.linear.scale;
+        } else if (tonemap->op == SDL_TONEMAP_CHROME) {
+            float vmax;
+
+            if (tonemap->data.chrome.color_primaries_matrix) {
+                SDL_ConvertColorPrimaries(&r, &g, &b, tonemap->data.chrome.color_primaries_matrix);
+            }
+            vmax = SDL_max(r, SDL_max(g, b));
+            if (vmax > 0.0f) {
+                const float scale = (1.0f + tonemap->data.chrome.a * vmax) / (1.0f + tonemap->data.chrome.b * vmax);
+                r *= scale;
+                g *= scale;
+                b *= scale;
+            }
+        }
+
+        if (matrix) {
+            SDL_ConvertColorPrimaries(&r, &g, &b, matrix);
+        }
+
+        if (dst_scale != 1.0f) {
+            r *= dst_scale;
+            g *= dst_scale;
+            b *= dst_scale;
+        }
+
+        rgba[0] = r;
+        rgba[1] = g;
+        rgba[2] = b;
+    }
+}
+
+#ifdef SDL_SSE2_INTRINSICS
+
+/* Convert between F16 and float, four values at a time
+ * Public domain implementations from https://gist.github.com/rygorous/2156668
+ */
+static SDL_INLINE __m128 SDL_TARGETING("sse2") HalfToFloatSSE2(__m128i h)
+{
+    const __m128i mask_nosign = _mm_set1_epi32(0x7fff);
+    const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23));
+    const __m128i was_infnan = _mm_set1_epi32(0x7bff);
+    const __m128 exp_infnan = _mm_castsi128_ps(_mm_set1_epi32(255 << 23));
+    const __m128i expmant = _mm_and_si128(mask_nosign, h);
+    const __m128i justsign = _mm_xor_si128(h, expmant);
+    const __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(expmant, 13)), magic);
+    const __m128i b_wasinfnan = _mm_cmpgt_epi32(expmant, was_infnan);
+    const __m128 sign = _mm_castsi128_ps(_mm_slli_epi32(justsign, 16));
+    const __m128 infnanexp = _mm_and_ps(_mm_castsi128_ps(b_wasinfnan), exp_infnan);
+
+    return _mm_or_ps(scaled, _mm_or_ps(sign, infnanexp));
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse2") FloatToHalfSSE2(__m128 f)
+{
+    const __m128i c_f16max = _mm_set1_epi32((127 + 16) << 23);                   // all FP32 values >= this round to +inf
+    const __m128i c_nanbit = _mm_set1_epi32(0x200);
+    const __m128i c_infty_as_fp16 = _mm_set1_epi32(0x7c00);
+    const __m128i c_min_normal = _mm_set1_epi32((127 - 14) << 23);              // smallest FP32 that yields a normalized FP16
+    const __m128i c_subnorm_magic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+    const __m128i c_normal_bias = _mm_set1_epi32(0xfff - ((127 - 15) << 23));    // adjust exponent and add mantissa rounding
+    const __m128 justsign = _mm_and_ps(_mm_castsi128_ps(_mm_set1_epi32(0x80000000)), f);
+    const __m128 absf = _mm_xor_ps(f, justsign);
+    const __m128i absf_int = _mm_castps_si128(absf);
+    const __m128 b_isnan = _mm_cmpunord_ps(absf, absf);
+    const __m128i b_isregular = _mm_cmpgt_epi32(c_f16max, absf_int);
+    const __m128i inf_or_nan = _mm_or_si128(_mm_and_si128(_mm_castps_si128(b_isnan), c_nanbit), c_infty_as_fp16);
+    const __m128i b_issub = _mm_cmpgt_epi32(c_min_normal, absf_int);
+
+    // The result is subnormal
+    const __m128 subnorm1 = _mm_add_ps(absf, _mm_castsi128_ps(c_subnorm_magic));
+    const __m128i subnorm2 = _mm_sub_epi32(_mm_castps_si128(subnorm1), c_subnorm_magic);
+
+    // The result is normal, round to nearest even
+    const __m128i mantodd = _mm_srai_epi32(_mm_slli_epi32(absf_int, 31 - 13), 31);
+    const __m128i round1 = _mm_add_epi32(absf_int, c_normal_bias);
+    const __m128i normal = _mm_srli_epi32(_mm_sub_epi32(round1, mantodd), 13);
+
+    const __m128i nonspecial = _mm_or_si128(_mm_and_si128(subnorm2, b_issub), _mm_andnot_si128(b_issub, normal));
+    const __m128i joined = _mm_or_si128(_mm_and_si128(nonspecial, b_isregular), _mm_andnot_si128(b_isregular, inf_or_nan));
+
+    return _mm_or_si128(joined, _mm_srai_epi32(_mm_castps_si128(justsign), 16));
+}
+
+static void SDL_TARGETING("sse2") ReadRGBA64FloatSSE2(const Uint8 *src, float *rgba, int count, const FloatBlitContext *ctx)
+{
+    const __m128i zero = _mm_setzero_si128();
+    int i;
+
+    // Two pixels at a time
+    for (i = 0; i + 2 <= count; i += 2) {
+        const __m128i h = _mm_loadu_si128((const __m128i *)(src + i * 8));
+
+        _mm_store_ps(rgba + i * 4, HalfToFloatSSE2(_mm_unpacklo_epi16(h, zero)));
+        _mm_store_ps(rgba + i * 4 + 4, HalfToFloatSSE2(_mm_unpackhi_epi16(h, zero)));
+    }
+    if (i < count) {
+        const __m128i h = _mm_loadl_epi64((const __m128i *)(src + i * 8));
+
+        _mm_store_ps(rgba + i * 4, HalfToFloatSSE2(_mm_unpacklo_epi16(h, zero)));
+    }
+}
+
+static void SDL_TARGETING("sse2") WriteRGBA64FloatSSE2(const float *rgba, Uint8 *dst, int count, const FloatBlitContext *ctx)
+{
+    int i;
+
+    // Two pixels at a time, sign extending the halves so they survive the signed pack
+    for (i = 0; i + 2 <= count; i += 2) {
+        __m128i lo = FloatToHalfSSE2(_mm_load_ps(rgba + i * 4));
+        __m128i hi = FloatToHalfSSE2(_mm_load_ps(rgba + i * 4 + 4));
+
+        lo = _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16);
+        hi = _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16);
+        _mm_storeu_si128((__m128i *)(dst + i * 8), _mm_packs_epi32(lo, hi));
+    }
+    if (i < count) {
+        __m128i lo = FloatToHalfSSE2(_mm_load_ps(rgba + i * 4));
+
+        lo = _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16);
+        _mm_storel_epi64((__m128i *)(dst + i * 8), _mm_packs_epi32(lo, lo));
+    }
+}
+
+// Multiplies the color by a 3x3 matrix, leaving alpha alone
+static SDL_INLINE __m128 SDL_TARGETING("sse2") ConvertColorPrimariesSSE2(__m128 v, const __m128 *columns, __m128 alpha_mask)
+{
+    const __m128 r = _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0));
+    const __m128 g = _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1));
+    const __m128 b = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
+    const __m128 result = _mm_add_ps(_mm_add_ps(_mm_mul_ps(columns[0], r), _mm_mul_ps(columns[1], g)), _mm_mul_ps(columns[2], b));
+
+    return _mm_or_ps(_mm_andnot_ps(alpha_mask, result), _mm_and_ps(alpha_mask, v));
+}
+
+static void SDL_TARGETING("sse2") SetupColorPrimariesSSE2(__m128 *columns, const float *matrix)
+{
+    int i;
+
+    for (i = 0; i < 3; ++i) {
+        if (matrix) {
+            columns[i] = _mm_setr_ps(matrix[0 * 3 + i], matrix[1 * 3 + i], matrix[2 * 3 + i], 0.0f);
+        } else {
+            columns[i] = _mm_setzero_ps();
+        }
+    }
+}
+
+static void SDL_TARGETING("sse2") TransformSSE2(float *rgba, int count, const FloatBlitContext *ctx)
+{
+    const SDL_TonemapContext *tonemap = &ctx->conversion.tonemap;
+    const __m128 alpha_mask = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 src_scale = _mm_setr_ps(ctx->src_scale, ctx->src_scale, ctx->src_scale, 1.0f);
+    const __m128 dst_scale = _mm_setr_ps(ctx->dst_scale, ctx->dst_scale, ctx->dst_scale, 1.0f);
+    const __m128 linear_scale = _mm_setr_ps(tonemap->data.linear.scale, tonemap->data.linear.scale, tonemap->data.linear.scale, 1.0f);
+    const __m128 chrome_a = _mm_set1_ps(tonemap->data.chrome.a);
+    const __m128 chrome_b = _mm_set1_ps(tonemap->data.chrome.b);
+    __m128 tonemap_columns[3];
+    __m128 columns[3];
+    int i;
+
+    SetupColorPrimariesSSE2(tonemap_columns, tonemap->op == SDL_TONEMAP_CHROME ? tonemap->data.chrome.color_primaries_matrix : NULL);
+    SetupColorPrimariesSSE2(columns, ctx->conversion.color_primaries_matrix);
+
+    for (i = 0; i < count; ++i, rgba += 4) {
+        __m128 v = _mm_load_ps(rgba);
+
+        if (ctx->src_scale != 1.0f) {
+            v = _mm_div_ps(v, src_scale);
+        }
+
+        if (tonemap->op == SDL_TONEMAP_LINEAR) {
+            v = _mm_mul_ps(v, linear_scale);
+        } else if (tonemap->op == SDL_TONEMAP_CHROME) {
+            __m128 vmax, scale;
+
+            if (tonemap->data.chrome.color_primaries_matrix) {
+                v = ConvertColorPrimariesSSE2(v, tonemap_columns, alpha_mask);
+            }
+            vmax = _mm_max_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)));
+            vmax = _mm_max_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)), vmax);
+            scale = _mm_div_ps(_mm_add_ps(one, _mm_mul_ps(chrome_a, vmax)), _mm_add_ps(one, _mm_mul_ps(chrome_b, vmax)));
+
+            // Only scale the color if vmax > 0
+            scale = _mm_or_ps(_mm_and_ps(_mm_cmpgt_ps(vmax, zero), scale), _mm_andnot_ps(_mm_cmpgt_ps(vmax, zero), one));
+            scale = _mm_or_ps(_mm_andnot_ps(alpha_mask, scale), _mm_and_ps(alpha_mask, one));
+            v = _mm_mul_ps(v, scale);
+        }
+
+        if (ctx->conversion.color_primaries_matrix) {
+            v = ConvertColorPrimariesSSE2(v, columns, alpha_mask);
+        }
+
+        if (ctx->dst_scale != 1.0f) {
+            v = _mm_mul_ps(v, dst_scale);
+        }
+
+        _mm_store_ps(rgba, v);
+    }
+}
+
+#endif // SDL_SSE2_INTRINSICS
+
+static void SDL_Blit_Float(SDL_BlitInfo *info)
+{
+    DECLARE_ALIGNED(float, rgba[FLOAT_BLIT_SPAN * 4], 16);
+    FloatBlitContext ctx;
+    FloatBlitReadFunc read_func = NULL;
+    FloatBlitTransformFunc transform_func = NULL;
+    FloatBlitWriteFunc write_func = NULL;
+    SDL_TransferCurveType src_curve, dst_curve;
+    const int srcbpp = info->src_fmt->bytes_per_pixel;
+    const int dstbpp = info->dst_fmt->bytes_per_pixel;
+
+    SDL_zero(ctx);
+    ctx.src_fmt = info->src_fmt;
+    ctx.dst_fmt = info->dst_fmt;
+    ctx.src_pixels = GetFloatBlitPixels(info->src_fmt, info->src_surface->colorspace, &src_curve);
+    ctx.dst_pixels = GetFloatBlitPixels(info->dst_fmt, info->dst_surface->colorspace, &dst_curve);
+
+    // The colorspace may have changed since the blit was set up
+    if (info->src_w != info->dst_w || info->src_h != info->dst_h ||
+        ctx.src_pixels == FloatBlitPixels_Unsupported ||
+        ctx.dst_pixels == FloatBlitPixels_Unsupported) {
+        SDL_Blit_Slow_Float(info);
+        return;
+    }
+    if (src_curve != SDL_TRANSFER_CURVE_COUNT) {
+        InitTransferCurve(src_curve);
+        ctx.src_curve = &SDL_transfer_curves[src_curve];
+    }
+    if (dst_curve != SDL_TRANSFER_CURVE_COUNT) {
+        InitTransferCurve(dst_curve);
+        ctx.dst_curve = &SDL_transfer_curves[dst_curve];
+    }
+
+    SDL_SetupBlitColorConversion(info, &ctx.conversion);
+
+    // sRGB values are relative to the SDR white point already
+    if (SDL_COLORSPACETRANSFER(ctx.conversion.src_colorspace) != SDL_TRANSFER_CHARACTERISTICS_SRGB) {
+        ctx.src_scale = ctx.conversion.src_white_point;
+    } else {
+        ctx.src_scale = 1.0f;
+    }
+    if (SDL_COLORSPACETRANSFER(ctx.conversion.dst_colorspace) != SDL_TRANSFER_CHARACTERISTICS_SRGB) {
+        ctx.dst_scale = ctx.conversion.dst_white_point;
+    } else {
+        ctx.dst_scale = 1.0f;
+    }
+
+    switch (ctx.src_pixels) {
+    case FloatBlitPixels_8888:
+        read_func = Read8888;
+        break;
+    case FloatBlitPixels_2101010:
+        read_func = Read2101010;
+        break;
+    case FloatBlitPixels_RGBA64_FLOAT:
+        read_func = ReadRGBA64Float;
+#ifdef SDL_SSE2_INTRINSICS
+        if (SDL_HasSSE2()) {
+            read_func = ReadRGBA64FloatSSE2;
+        }
+#endif
+        break;
+    default:
+        read_func = ReadRGBA128Float;
+        break;
+    }
+
+    switch (ctx.dst_pixels) {
+    case FloatBlitPixels_8888:
+        write_func = Write8888;
+        break;
+    case FloatBlitPixels_2101010:
+        write_func = Write2101010;
+        break;
+    case FloatBlitPixels_RGBA64_FLOAT:
+        write_func = WriteRGBA64Float;
+#ifdef SDL_SSE2_INTRINSICS
+        if (SDL_HasSSE2()) {
+            write_func = WriteRGBA64FloatSSE2;
+        }
+#endif
+        break;
+    default:
+        write_func = WriteRGBA128Float;
+        break;
+    }
+
+    if (ctx.src_scale != 1.0f || ctx.dst_scale != 1.0f ||
+        ctx.conversion.tonemap.op != SDL_TONEMAP_NONE ||
+        ctx.conversion.color_primaries_matrix) {
+        transform_func = TransformScalar;
+#ifdef SDL_SSE2_INTRINSICS
+        if (SDL_HasSSE2()) {
+            transform_func = TransformSSE2;
+        }
+#endif
+    }
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src;
+        Uint8 *dst = info->dst;
+        int x, n;
+
+        for (x = 0; x < info->dst_w; x += n) {
+            n = SDL_min(info->dst_w - x, FLOAT_BLIT_SPAN);
+
+            read_func(src + x * srcbpp, rgba, n, &ctx);
+            if (transform_func) {
+                transform_func(rgba, n, &ctx);
+            }
+            write_func(rgba, dst + x * dstbpp, n, &ctx);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+SDL_BlitFunc SDL_CalculateBlitFloat(SDL_Surface *surface)
+{
+    const SDL_BlitMap *map = &surface->map;
+    SDL_TransferCurveType src_curve, dst_curve;
+
+    if (map->info.flags & (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_COLORKEY)) {
+        return SDL_Blit_Slow_Float;
+    }
+    if (GetFloatBlitPixels(surface->fmt, surface->colorspace, &src_curve) == FloatBlitPixels_Unsupported ||
+        GetFloatBlitPixels(map->info.dst_fmt, map->info.dst_surface->colorspace, &dst_curve) == FloatBlitPixels_Unsupported) {
+        return SDL_Blit_Slow_Float;
+    }
+
+    // Build the tables now, so the blit can be split across threads
+    if (src_curve != SDL_TRANSFER_CURVE_COUNT) {
+        InitTransferCurve(src_curve);
+    }
+    if (dst_curve != SDL_TRANSFER_CURVE_COUNT) {
+        InitTransferCurve(dst_curve);
+    }
+    return SDL_Blit_Float;
+}
+
+// Returns true if SDL_Blit_Float() is going to hand this blit to SDL_Blit_Slow_Float()
+bool SDL_BlitFloatUsesSlowPath(SDL_BlitFunc blit, const SDL_BlitInfo *info)
+{
+    SDL_TransferCurveType curve;
+
+    if (blit != SDL_Blit_Float) {
+        return false;
+    }
+    return info->src_w != info->dst_w || info->src_h != info->dst_h ||
+           GetFloatBlitPixels(info->src_fmt, info->src_surface->colorspace, &curve) == FloatBlitPixels_Unsupported ||
+           GetFloatBlitPixels(info->dst_fmt, info->dst_surface->colorspace, &curve) == FloatBlitPixels_Unsupported;
+}
@@ -365,7 +365,7 @@ typedef union
 #pragma warning(pop)
 #endif
 
-static float half_to_float(Uint16 unValue)
+float SDL_HalfToFloat(Uint16 unValue)
 {
     static const FP32 magic = { (254 - 15) << 23 };
     static const FP32 was_infnan = { (127 + 16) << 23 };
@@ -384,7 +384,7 @@ static float half_to_float(Uint16 unValue)
 /* Convert from float to F16
  * Public domain implementation from https://stackoverflow.com/questions/76799117/how-to-convert-a-float-to-a-half-type-and-the-other-way-around-in-c
  */
-static Uint16 float_to_half(float a)
+Uint16 SDL_FloatToHalf(float a)
 {
     Uint32 ia;
     Uint16 ir;
@@ -486,11 +486,11 @@ static void ReadFloatPixel(Uint8 *pixels, SlowBlitPixelAccess access, const SDL_
             }
             break;
         case SDL_PIXELTYPE_ARRAYF16:
-            v[0] = half_to_float(((Uint16 *)pixels)[0]);
-            v[1] = half_to_float(((Uint16 *)pixels)[1]);
-            v[2] = half_to_float(((Uint16 *)pixels)[2]);
+            v[0] = SDL_HalfToFloat(((Uint16 *)pixels)[0]);
+            v[1] = SDL_HalfToFloat(((Uint16 *)pixels)[1]);
+            v[2] = SDL_HalfToFloat(((Uint16 *)pixels)[2]);
             if (fmt->bytes_per_pixel == 8) {
-                v[3] = half_to_float(((Uint16 *)pixels)[3]);
+                v[3] = SDL_HalfToFloat(((Uint16 *)pixels)[3]);
             } else {
                 v[3] = 1.0f;
             }
@@ -705,11 +705,11 @@ static void WriteFloatPixel(Uint8 *pixels, SlowBlitPixelAccess access, const SDL
             }
             break;
         case SDL_PIXELTYPE_ARRAYF16:
-            ((Uint16 *)pixels)[0] = float_to_half(v[0]);
-            ((Uint16 *)pixels)[1] = float_to_half(v[1]);
-            ((Uint16 *)pixels)[2] = float_to_half(v[2]);
+            ((Uint16 *)pixels)[0] = SDL_FloatToHalf(v[0]);
+            ((Uint16 *)pixels)[1] = SDL_FloatToHalf(v[1]);
+            ((Uint16 *)pixels)[2] = SDL_FloatToHalf(v[2]);
             if (fmt->bytes_per_pixel == 8) {
-                ((Uint16 *)pixels)[3] = float_to_half(v[3]);
+                ((Uint16 *)pixels)[3] = SDL_FloatToHalf(v[3]);
             }
             break;
         case SDL_PIXELTYPE_ARRAYF32:
@@ -728,32 +728,6 @@ static void WriteFloatPixel(Uint8 *pixels, SlowBlitPixelAccess access, const SDL
     }
 }
 
-typedef enum
-{
-    SDL_TONEMAP_NONE,
-    SDL_TONEMAP_LINEAR,
-    SDL_TONEMAP_CHROME
-} SDL_TonemapOperator;
-
-typedef struct
-{
-    SDL_TonemapOperator op;
-
-    union {
-        struct {
-            float scale;
-        } linear;
-
-        struct {
-            float a;
-            float b;
-            const float *color_primaries_matrix;
-        } chrome;
-
-    } data;
-
-} SDL_TonemapContext;
-
 static void TonemapLinear(float *r, float *g, float *b, float scale)
 {
     *r *= scale;
@@ -802,50 +776,28 @@ static void ApplyTonemap(SDL_TonemapContext *ctx, float *r, float *g, float *b)
     }
 }
 
-/* The SECOND TRUE BLITTER
- * This one is even slower than the first, but also handles large pixel formats and colorspace conversion
+/* Calculates the colorspace conversion for a blit, shared by the float blitters
+ *
+ * This sets the HDR headroom of the destination surface if it hasn't been set yet.
  */
-void SDL_Blit_Slow_Float(SDL_BlitInfo *info)
+void SDL_SetupBlitColorConversion(const SDL_BlitInfo *info, SDL_BlitColorConversion *conversion)
 {
-    const int flags = info->flags;
-    const Uint32 modulateR = info->r;
-    const Uint32 modulateG = info->g;
-    const Uint32 modulateB = info->b;
-    const Uint32 modulateA = info->a;
-    float srcR, srcG, srcB, srcA;
-    float dstR, dstG, dstB, dstA;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
-    Uint64 incy, incx;
-    const SDL_PixelFormatDetails *src_fmt = info->src_fmt;
-    const SDL_Palette *src_pal = info->src_pal;
-    const SDL_PixelFormatDetails *dst_fmt = info->dst_fmt;
-    const SDL_Palette *dst_pal = info->dst_pal;
-    SDL_HashTable *palette_map = info->palette_map;
-    int srcbpp = src_fmt->bytes_per_pixel;
-    int dstbpp = dst_fmt->bytes_per_pixel;
-    SlowBlitPixelAccess src_access;
-    SlowBlitPixelAccess dst_access;
     SDL_Colorspace src_colorspace;
     SDL_Colorspace dst_colorspace;
     SDL_ColorPrimaries src_primaries;
     SDL_ColorPrimaries dst_primaries;
-    const float *color_primaries_matrix = NULL;
-    float src_white_point;
-    float dst_white_point;
-    float dst_headroom;
     float src_headroom;
-    SDL_TonemapContext tonemap;
-    Uint32 last_pixel = 0;
-    Uint8 last_index = 0;
+    float dst_headroom;
+
+    SDL_zerop(conversion);
 
-    src_colorspace = info->src_surface->colorspace;
-    dst_colorspace = info->dst_surface->colorspace;
+    conversion->src_colorspace = src_colorspace = info->src_surface->colorspace;
+    conversion->dst_colorspace = dst_colorspace = info->dst_surface->colorspace;
     src_primaries = SDL_COLORSPACEPRIMARIES(src_colorspace);
     dst_primaries = SDL_COLORSPACEPRIMARIES(dst_colorspace);
 
-    src_white_point = SDL_GetSurfaceSDRWhitePoint(info->src_surface, src_colorspace);
-    dst_white_point = SDL_GetSurfaceSDRWhitePoint(info->dst_surface, dst_colorspace);
+    conversion->src_white_point = SDL_GetSurfaceSDRWhitePoint(info->src_surface, src_colorspace);
+    conversion->dst_white_point = SDL_GetSurfaceSDRWhitePoint(info->dst_surface, dst_colorspace);
     src_headroom = SDL_GetSurfaceHDRHeadroom(info->src_surface, src_colorspace);
     dst_headroom = SDL_GetSurfaceHDRHeadroom(info->dst_surface, dst_colorspace);
     if (dst_headroom == 0.0f) {
@@ -854,37 +806,76 @@ void SDL_Blit_Slow_Float(SDL_BlitInfo *info)
         SDL_SetFloatProperty(SDL_GetSurfaceProperties(info->dst_surface), SDL_PROP_SURFACE_HDR_HEADROOM_FLOAT, dst_headroom);
     }
 
-    SDL_zero(tonemap);
-
     if (src_headroom > dst_headroom) {
         const char *tonemap_operator = SDL_GetStringProperty(SDL_GetSurfaceProperties(info->src_surface), SDL_PROP_SURFACE_TONEMAP_OPERATOR_STRING, NULL);
         if (tonemap_operator) {
             if (SDL_strncmp(tonemap_operator, "*=", 2) == 0) {
-                tonemap.op = SDL_TONEMAP_LINEAR;
-                tonemap.data.linear.scale = (float)SDL_atof(tonemap_operator + 2);
+                conversion->tonemap.op = SDL_TONEMAP_LINEAR;
+                conversion->tonemap.data.linear.scale = (float)SDL_atof(tonemap_operator + 2);
             } else if (SDL_strcasecmp(tonemap_operator, "chrome") == 0) {
-                tonemap.op = SDL_TONEMAP_CHROME;
+                conversion->tonemap.op = SDL_TONEMAP_CHROME;
             } else if (SDL_strcasecmp(tonemap_operator, "none") == 0) {
-                tonemap.op = SDL_TONEMAP_NONE;
+                conversion->tonemap.op = SDL_TONEMAP_NONE;
             }
         } else {
-            tonemap.op = SDL_TONEMAP_CHROME;
+            conversion->tonemap.op = SDL_TONEMAP_CHROME;
         }
-        if (tonemap.op == SDL_TONEMAP_CHROME) {
-            tonemap.data.chrome.a = (dst_headroom / (src_headroom * src_headroom));
-            tonemap.data.chrome.b = (1.0f / dst_headroom);
+        if (conversion->tonemap.op == SDL_TONEMAP_CHROME) {
+            conversion->tonemap.data.chrome.a = (dst_headroom / (src_headroom * src_headroom));
+            conversion->tonemap.data.chrome.b = (1.0f / dst_headroom);
 
             // We'll convert to BT.2020 primaries for the tonemap operation
-            tonemap.data.chrome.color_primaries_matrix = SDL_GetColorPrimariesConversionMatrix(src_primaries, SDL_COLOR_PRIMARIES_BT2020);
-            if (tonemap.data.chrome.color_primaries_matrix) {
+            conversion->tonemap.data.chrome.color_primaries_matrix = SDL_GetColorPrimariesConversionMatrix(src_primaries, SDL_COLOR_PRIMARIES_BT2020);
+            if (conversion->tonemap.data.chrome.color_primaries_matrix) {
                 src_primaries = SDL_COLOR_PRIMARIES_BT2020;
             }
         }
     }
 
     if (src_primaries != dst_primaries) {
-        color_primaries_matrix = SDL_GetColorPrimariesConversionMatrix(src_primaries, dst_primaries);
+        conversion->color_primaries_matrix = SDL_GetColorPrimariesConversionMatrix(src_primaries, dst_primaries);
     }
+}
+
+/* The SECOND TRUE BLITTER
+ * This one is even slower than the first, but also handles large pixel formats and colorspace conversion
+ */
+void SDL_Blit_Slow_Float(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const Uint32 modulateR = info->r;
+    const Uint32 modulateG = info->g;
+    const Uint32 modulateB = info->b;
+    const Uint32 modulateA = info->a;
+    float srcR, srcG, srcB, srcA;
+    float dstR, dstG, dstB, dstA;
+    Uint64 srcy, srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    const SDL_PixelFormatDetails *src_fmt = info->src_fmt;
+    const SDL_Palette *src_pal = info->src_pal;
+    const SDL_PixelFormatDetails *dst_fmt = info->dst_fmt;
+    const SDL_Palette *dst_pal = info->dst_pal;
+    SDL_HashTable *palette_map = info->palette_map;
+    int srcbpp = src_fmt->bytes_per_pixel;
+    int dstbpp = dst_fmt->bytes_per_pixel;
+    SlowBlitPixelAccess src_access;
+    SlowBlitPixelAccess dst_access;
+    SDL_Colorspace src_colorspace;
+    SDL_Colorspace dst_colorspace;
+    const float *color_primaries_matrix;
+    float src_white_point;
+    float dst_white_point;
+    SDL_BlitColorConversion conversion;
+    Uint32 last_pixel = 0;
+    Uint8 last_index = 0;
+
+    SDL_SetupBlitColorConversion(info, &conversion);
+    src_colorspace = conversion.src_colorspace;
+    dst_colorspace = conversion.dst_colorspace;
+    src_white_point = conversion.src_white_point;
+    dst_white_point = conversion.dst_white_point;
+    color_primaries_matrix = conversion.color_primaries_matrix;
 
     src_access = GetPixelAccessMethod(src_fmt->format);
     dst_access = GetPixelAccessMethod(dst_fmt->format);
@@ -908,8 +899,8 @@ void SDL_Blit_Slow_Float(SDL_BlitInfo *info)
 
             ReadFloatPixel(src, src_access, src_fmt, src_pal, src_colorspace, src_white_point, &srcR, &srcG, &srcB, &srcA);
 
-            if (tonemap.op) {
-                ApplyTonemap(&tonemap, &srcR, &srcG, &srcB);
+            if (conversion.tonemap.op) {
+                ApplyTonemap(&conversion.tonemap, &srcR, &srcG, &srcB);
             }
 
             if (color_primaries_matrix) {
@@ -24,6 +24,45 @@
 
 #include "SDL_internal.h"
 
+typedef enum
+{
+    SDL_TONEMAP_NONE,
+    SDL_TONEMAP_LINEAR,
+    SDL_TONEMAP_CHROME
+} SDL_TonemapOperator;
+
+typedef struct
+{
+    SDL_TonemapOperator op;
+
+    union {
+        struct {
+            float scale;
+        } linear;
+
+        struct {
+            float a;
+            float b;
+            const float *color_primaries_matrix;
+        } chrome;
+
+    } data;
+
+} SDL_TonemapContext;
+
+typedef struct
+{
+    SDL_Colorspace src_colorspace;
+    SDL_Colorspace dst_colorspace;
+    float src_white_point;
+    float dst_white_point;
+    SDL_TonemapContext tonemap;
+    const float *color_primaries_matrix;
+} SDL_BlitColorConversion;
+
+extern float SDL_HalfToFloat(Uint16 unValue);
+extern Uint16 SDL_FloatToHalf(float a);
+extern void SDL_SetupBlitColorConversion(const SDL_BlitInfo *info, SDL_BlitColorConversion *conversion);
 extern void SDL_Blit_Slow(SDL_BlitInfo *info);
 extern void SDL_Blit_Slow_Float(SDL_BlitInfo *info);
 
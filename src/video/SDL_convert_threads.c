@@ -0,0 +1,265 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#include "SDL_pixels_c.h"
+
+/* Large pixel conversions, enabled with SDL_HINT_SURFACE_CONVERT_THREADS
+ *
+ * The image is split into bands of rows, which are handed out to a pool of
+ * threads and the calling thread. The pool works on one conversion at a time,
+ * a conversion that's started while it's busy runs on the calling thread.
+ *
+ * Other work that splits into bands, like compressing PNG files, uses the same
+ * pool through SDL_ConvertBandsInParallel() with its own number of threads.
+ * The pool grows to the largest number of threads asked for, and threads that
+ * aren't needed for a conversion sit it out.
+ */
+#define SDL_MAX_CONVERT_THREADS   32
+#define SDL_MIN_CONVERT_PIXELS    (512 * 512)
+#define SDL_MIN_CONVERT_BAND_ROWS 16
+#define SDL_CONVERT_BANDS_PER_THREAD 4 // so threads that finish early can help the others
+
+typedef struct SDL_ConvertThreadPool
+{
+    SDL_Mutex *lock;
+    SDL_Condition *work_cond;
+    SDL_Condition *done_cond;
+    SDL_Thread *threads[SDL_MAX_CONVERT_THREADS];
+    int num_threads;
+    SDL_AtomicInt next_thread_index;
+    bool busy;
+    bool quit;
+
+    // The conversion being worked on
+    Uint32 job;
+    int job_threads; // how many pool threads work on it
+    int active;
+    SDL_ConvertRowsFunc func;
+    void *userdata;
+    int height;
+    int band_rows;
+    int num_bands;
+    SDL_AtomicInt next_band;
+} SDL_ConvertThreadPool;
+
+static SDL_InitState SDL_convert_threads_init;
+static SDL_ConvertThreadPool SDL_convert_threads;
+
+static int SDL_GetConvertThreadsHint(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_SURFACE_CONVERT_THREADS);
+    int threads = 1;
+
+    if (hint) {
+        threads = SDL_atoi(hint);
+        if (threads == 0) {
+            threads = SDL_GetNumLogicalCPUCores();
+        }
+    }
+    return SDL_clamp(threads, 1, SDL_MAX_CONVERT_THREADS);
+}
+
+static void SDL_ConvertBands(SDL_ConvertThreadPool *pool)
+{
+    for (;;) {
+        const int band = SDL_AddAtomicInt(&pool->next_band, 1);
+        int row, rows;
+
+        if (band >= pool->num_bands) {
+            break;
+        }
+        row = band * pool->band_rows;
+        rows = SDL_min(pool->band_rows, pool->height - row);
+        pool->func(pool->userdata, row, rows);
+    }
+}
+
+static int SDLCALL SDL_ConvertThread(void *userdata)
+{
+    SDL_ConvertThreadPool *pool = (SDL_ConvertThreadPool *)userdata;
+    const int index = SDL_AddAtomicInt(&pool->next_thread_index, 1);
+    Uint32 job = 0;
+
+    for (;;) {
+        SDL_LockMutex(pool->lock);
+        while (pool->job == job && !pool->quit) {
+            SDL_WaitCondition(pool->work_cond, pool->lock);
+        }
+        if (pool->quit) {
+            SDL_UnlockMutex(pool->lock);
+            break;
+        }
+        job = pool->job;
+        if (index >= pool->job_threads) {
+            SDL_UnlockMutex(pool->lock);
+            continue;
+        }
+        SDL_UnlockMutex(pool->lock);
+
+        SDL_ConvertBands(pool);
+
+        SDL_LockMutex(pool->lock);
+        if (--pool->active == 0) {
+            SDL_SignalCondition(pool->done_cond);
+        }
+        SDL_UnlockMutex(pool->lock);
+    }
+    return 0;
+}
+
+// This is called with the pool lock held, by the thread that marked the pool busy
+static void SDL_StopConvertThreads(SDL_ConvertThreadPool *pool)
+{
+    int i;
+
+    if (pool->num_threads == 0) {
+        return;
+    }
+
+    pool->quit = true;
+    SDL_BroadcastCondition(pool->work_cond);
+    SDL_UnlockMutex(pool->lock);
+    for (i = 0; i < pool->num_threads; ++i) {
+        SDL_WaitThread(pool->threads[i], NULL);
+        pool->threads[i] = NULL;
+    }
+    SDL_LockMutex(pool->lock);
+    pool->num_threads = 0;
+    SDL_SetAtomicInt(&pool->next_thread_index, 0);
+    pool->quit = false;
+}
+
+// This is called with the pool lock held, new threads wait for it to pick their first job
+static void SDL_StartConvertThreads(SDL_ConvertThreadPool *pool, int num_threads)
+{
+    int i;
+
+    for (i = pool->num_threads; i < num_threads; ++i) {
+        pool->threads[i] = SDL_CreateThread(SDL_ConvertThread, "SDLConvert", pool);
+        if (!pool->threads[i]) {
+            break;
+        }
+        ++pool->num_threads;
+    }
+}
+
+static bool SDL_InitConvertThreads(SDL_ConvertThreadPool *pool)
+{
+    if (SDL_ShouldInit(&SDL_convert_threads_init)) {
+        pool->lock = SDL_CreateMutex();
+        pool->work_cond = SDL_CreateCondition();
+        pool->done_cond = SDL_CreateCondition();
+        if (!pool->lock || !pool->work_cond || !pool->done_cond) {
+            SDL_DestroyMutex(pool->lock);
+            SDL_DestroyCondition(pool->work_cond);
+            SDL_DestroyCondition(pool->done_cond);
+            SDL_zerop(pool);
+            SDL_SetInitialized(&SDL_convert_threads_init, false);
+            return false;
+        }
+        SDL_SetInitialized(&SDL_convert_threads_init, true);
+    }
+    return true;
+}
+
+bool SDL_ConvertBandsInParallel(int num_threads, int height, int band_rows, SDL_ConvertRowsFunc func, void *userdata)
+{
+    SDL_ConvertThreadPool *pool = &SDL_convert_threads;
+
+    num_threads = SDL_min(num_threads, SDL_MAX_CONVERT_THREADS);
+    if (num_threads <= 1 || band_rows <= 0 || height <= band_rows || !SDL_InitConvertThreads(pool)) {
+        return false;
+    }
+
+    SDL_LockMutex(pool->lock);
+    if (pool->busy) {
+        SDL_UnlockMutex(pool->lock);
+        return false;
+    }
+    pool->busy = true;
+
+    // The calling thread converts bands too
+    SDL_StartConvertThreads(pool, num_threads - 1);
+    if (pool->num_threads == 0) {
+        pool->busy = false;
+        SDL_UnlockMutex(pool->lock);
+        return false;
+    }
+
+    pool->func = func;
+    pool->userdata = userdata;
+    pool->height = height;
+    pool->band_rows = band_rows;
+    pool->num_bands = (height + band_rows - 1) / band_rows;
+    SDL_SetAtomicInt(&pool->next_band, 0);
+    pool->job_threads = SDL_min(pool->num_threads, num_threads - 1);
+    pool->active = pool->job_threads;
+    ++pool->job;
+    SDL_BroadcastCondition(pool->work_cond);
+    SDL_UnlockMutex(pool->lock);
+
+    SDL_ConvertBands(pool);
+
+    SDL_LockMutex(pool->lock);
+    while (pool->active > 0) {
+        SDL_WaitCondition(pool->done_cond, pool->lock);
+    }
+    pool->func = NULL;
+    pool->userdata = NULL;
+    pool->busy = false;
+    SDL_UnlockMutex(pool->lock);
+
+    return true;
+}
+
+bool SDL_ConvertRowsInParallel(int width, int height, int row_alignment, SDL_ConvertRowsFunc func, void *userdata)
+{
+    int num_threads, band_rows;
+
+    if ((Sint64)width * height < SDL_MIN_CONVERT_PIXELS || height < 2 * SDL_MIN_CONVERT_BAND_ROWS) {
+        return false;
+    }
+
+    num_threads = SDL_GetConvertThreadsHint();
+    band_rows = height / (num_threads * SDL_CONVERT_BANDS_PER_THREAD);
+    band_rows = SDL_max(band_rows, SDL_MIN_CONVERT_BAND_ROWS);
+    if (row_alignment > 1) {
+        band_rows = ((band_rows + row_alignment - 1) / row_alignment) * row_alignment;
+    }
+    return SDL_ConvertBandsInParallel(num_threads, height, band_rows, func, userdata);
+}
+
+void SDL_QuitConvertThreads(void)
+{
+    SDL_ConvertThreadPool *pool = &SDL_convert_threads;
+
+    if (SDL_ShouldQuit(&SDL_convert_threads_init)) {
+        SDL_LockMutex(pool->lock);
+        SDL_StopConvertThreads(pool);
+        SDL_UnlockMutex(pool->lock);
+        SDL_DestroyMutex(pool->lock);
+        SDL_DestroyCondition(pool->work_cond);
+        SDL_DestroyCondition(pool->done_cond);
+        SDL_zerop(pool);
+        SDL_SetInitialized(&SDL_convert_threads_init, false);
+    }
+}
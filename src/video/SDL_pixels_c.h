@@ -54,4 +54,10 @@ extern Uint8 SDL_LookupRGBAColor(SDL_HashTable *palette_map, Uint32 pixelvalue,
 extern void SDL_DetectPalette(const SDL_Palette *pal, bool *is_opaque, bool *has_alpha_channel);
 extern SDL_Surface *SDL_DuplicatePixels(int width, int height, SDL_PixelFormat format, SDL_Colorspace colorspace, void *pixels, int pitch);
 
+// Parallel conversion functions
+typedef void (*SDL_ConvertRowsFunc)(void *userdata, int row, int num_rows);
+extern bool SDL_ConvertRowsInParallel(int width, int height, int row_alignment, SDL_ConvertRowsFunc func, void *userdata);
+extern bool SDL_ConvertBandsInParallel(int num_threads, int height, int band_rows, SDL_ConvertRowsFunc func, void *userdata);
+extern void SDL_QuitConvertThreads(void);
+
 #endif // SDL_pixels_c_h_
@@ -21,7 +21,9 @@
 #include "SDL_internal.h"
 
 #include "SDL_stb_c.h"
+#include "SDL_pixels_c.h"
 #include "SDL_surface_c.h"
+#include "SDL_yuv_c.h"
 
 #ifdef SDL_HAVE_STB
 ////////////////////////////////////////////////////////////////////////////
@@ -73,11 +75,13 @@
 #define MINIZ_SDL_NOUNUSED
 #include "miniz.h"
 
+#undef memcpy
 #undef memset
 #endif // SDL_HAVE_STB
 
 #ifdef SDL_HAVE_STB
-static bool SDL_ConvertPixels_MJPG_to_NV12(int width, int height, const void *src, int src_pitch, void *dst, int dst_pitch)
+// Decode straight into the planes of a YUV image, without going through RGB
+static bool SDL_ConvertPixels_MJPG_to_YUV(int width, int height, const void *src, int src_pitch, const SDL_YUVLayout *layout)
 {
     int w = 0, h = 0, format = 0;
     stbi__context s;
@@ -89,14 +93,19 @@ static bool SDL_ConvertPixels_MJPG_to_NV12(int width, int height, const void *sr
     ri.channel_order = STBI_ORDER_RGB;
     ri.num_channels = 0;
 
-    stbi__nv12 nv12;
-    nv12.w = width;
-    nv12.h = height;
-    nv12.pitch = dst_pitch;
-    nv12.y = (stbi_uc *)dst;
-    nv12.uv = nv12.y + (nv12.h * nv12.pitch);
+    stbi__yuv yuv;
+    yuv.w = width;
+    yuv.h = height;
+    yuv.y = layout->y;
+    yuv.u = layout->u;
+    yuv.v = layout->v;
+    yuv.y_pitch = layout->y_stride;
+    yuv.uv_pitch = layout->uv_stride;
+    yuv.y_step = layout->y_step;
+    yuv.uv_step = layout->uv_step;
+    yuv.uv_vs = 1 << layout->uv_shift;
 
-    void *pixels = stbi__jpeg_load(&s, &w, &h, &format, 4, &nv12, &ri);
+    void *pixels = stbi__jpeg_load(&s, &w, &h, &format, 4, &yuv, &ri);
     if (!pixels) {
         return false;
     }
@@ -109,8 +118,14 @@ bool SDL_ConvertPixels_STB(int width, int height,
                            SDL_PixelFormat dst_format, SDL_Colorspace dst_colorspace, SDL_PropertiesID dst_properties, void *dst, int dst_pitch)
 {
 #ifdef SDL_HAVE_STB
-    if (src_format == SDL_PIXELFORMAT_MJPG && dst_format == SDL_PIXELFORMAT_NV12) {
-        return SDL_ConvertPixels_MJPG_to_NV12(width, height, src, src_pitch, dst, dst_pitch);
+    SDL_YUVLayout layout;
+    if (src_format == SDL_PIXELFORMAT_MJPG && SDL_GetYUVLayout(width, height, dst_format, dst, dst_pitch, &layout)) {
+        if (SDL_ConvertPixels_MJPG_to_YUV(width, height, src, src_pitch, &layout)) {
+            return true;
+        }
+        // RGB JPEGs (e.g. with an Adobe transform of 0) can't be decoded straight to YUV, so go through RGB instead,
+        // converting to the same full range BT.601 that the direct decode produces.
+        dst_colorspace = SDL_COLORSPACE_JPEG;
     }
 
     bool result;
@@ -388,6 +403,538 @@ SDL_Surface *SDL_LoadPNG(const char *file)
     return SDL_LoadPNG_IO(stream, true);
 }
 
+#ifdef SDL_HAVE_STB
+/* PNG writer
+ *
+ * Rows are filtered and deflated as they are read from the surface, and the
+ * compressed data is written out in IDAT chunks of up to SDL_PNG_IDAT_SIZE
+ * bytes as it is produced, so the whole file is never held in memory.
+ *
+ * Large images can be compressed on several threads of the pixel conversion
+ * thread pool: the image is split into bands of rows, each band is deflated
+ * on its own and ended on a byte boundary, and the bands are written in order
+ * a few per thread at a time. Each band starts with an empty dictionary, which
+ * costs a little compression.
+ *
+ * The zlib header and the Adler-32 trailer are written here rather than by
+ * miniz, which always claims the fastest compression level in the header.
+ */
+#define SDL_PNG_IDAT_SIZE         (64 * 1024)
+#define SDL_PNG_BAND_SIZE         (256 * 1024) // uncompressed bytes per band
+#define SDL_PNG_MIN_PARALLEL_SIZE (4 * SDL_PNG_BAND_SIZE)
+#define SDL_PNG_MAX_SAVE_THREADS  16
+#define SDL_PNG_BANDS_PER_THREAD  2 // how many bands each thread compresses before they're written
+
+typedef enum SDL_PNGFilter
+{
+    SDL_PNG_FILTER_NONE = 0,
+    SDL_PNG_FILTER_SUB = 1,
+    SDL_PNG_FILTER_UP = 2,
+    SDL_PNG_FILTER_AVERAGE = 3,
+    SDL_PNG_FILTER_PAETH = 4,
+    SDL_PNG_FILTER_ADAPTIVE = 5 // pick the best of the above for each row
+} SDL_PNGFilter;
+
+typedef struct SDL_PNGImage
+{
+    const Uint8 *pixels;
+    int height;
+    int pitch;
+    int bpp;
+    size_t row_size; // not counting the filter type byte
+    SDL_PNGFilter filter;
+    int level;       // zlib compression level, 0-9
+    int flags;       // tdefl compression flags
+    Uint8 *zero_row; // the row above the first row
+} SDL_PNGImage;
+
+typedef struct SDL_PNGWriter
+{
+    SDL_IOStream *dst;
+    Uint8 *buffer;
+    size_t size;
+    bool failed;
+} SDL_PNGWriter;
+
+typedef struct SDL_PNGBand
+{
+    bool compressed;
+    Uint8 *data;
+    size_t size;
+    Uint32 adler;
+} SDL_PNGBand;
+
+typedef struct SDL_PNGEncoder
+{
+    const SDL_PNGImage *image;
+    SDL_PNGBand *bands; // the bands being compressed, starting with first_band
+    int band_rows;
+    int first_band;
+} SDL_PNGEncoder;
+
+static int GetPNGCompressionLevel(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_PNG_SAVE_COMPRESSION_LEVEL);
+
+    if (hint && *hint) {
+        return SDL_clamp(SDL_atoi(hint), 0, 9);
+    }
+    return 6;
+}
+
+static int GetPNGCompressionFlags(int level)
+{
+    // The same search depth as zlib's compression levels, see tdefl_create_comp_flags_from_zip_params()
+    static const mz_uint num_probes[10] = { 0, 1, 6, 32, 16, 32, 128, 256, 512, 768 };
+    int flags;
+
+    flags = (int)num_probes[level];
+    if (level == 0) {
+        flags |= TDEFL_FORCE_ALL_RAW_BLOCKS;
+    } else if (level <= 3) {
+        flags |= TDEFL_GREEDY_PARSING_FLAG;
+    }
+    return flags;
+}
+
+static SDL_PNGFilter GetPNGFilter(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_PNG_SAVE_FILTER);
+
+    if (hint) {
+        if (SDL_strcasecmp(hint, "sub") == 0) {
+            return SDL_PNG_FILTER_SUB;
+        } else if (SDL_strcasecmp(hint, "up") == 0) {
+            return SDL_PNG_FILTER_UP;
+        } else if (SDL_strcasecmp(hint, "average") == 0) {
+            return SDL_PNG_FILTER_AVERAGE;
+        } else if (SDL_strcasecmp(hint, "paeth") == 0) {
+            return SDL_PNG_FILTER_PAETH;
+        } else if (SDL_strcasecmp(hint, "adaptive") == 0) {
+            return SDL_PNG_FILTER_ADAPTIVE;
+        }
+    }
+    return SDL_PNG_FILTER_NONE;
+}
+
+static int GetPNGSaveThreads(const SDL_PNGImage *image, int num_bands)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_PNG_SAVE_THREADS);
+    int threads = hint ? SDL_atoi(hint) : 0;
+
+    if (threads <= 0) {
+        if ((Sint64)image->height * (image->row_size + 1) < SDL_PNG_MIN_PARALLEL_SIZE) {
+            return 1;
+        }
+        threads = SDL_GetNumLogicalCPUCores();
+    }
+    threads = SDL_min(threads, SDL_PNG_MAX_SAVE_THREADS);
+    return SDL_clamp(threads, 1, num_bands);
+}
+
+static Uint8 PaethPredictor(int a, int b, int c)
+{
+    const int da = b - c;
+    const int db = a - c;
+    const int dc = da + db;
+    const int pa = (da < 0) ? -da : da;
+    const int pb = (db < 0) ? -db : db;
+    const int pc = (dc < 0) ? -dc : dc;
+
+    if (pa <= pb && pa <= pc) {
+        return (Uint8)a;
+    } else if (pb <= pc) {
+        return (Uint8)b;
+    }
+    return (Uint8)c;
+}
+
+static void FilterPNGRowWith(SDL_PNGFilter filter, const Uint8 *row, const Uint8 *prev, size_t size, int bpp, Uint8 *out)
+{
+    size_t i;
+
+    *out++ = (Uint8)filter;
+    switch (filter) {
+    case SDL_PNG_FILTER_SUB:
+        for (i = 0; i < (size_t)bpp; ++i) {
+            out[i] = row[i];
+        }
+        for (; i < size; ++i) {
+            out[i] = (Uint8)(row[i] - row[i - bpp]);
+        }
+        break;
+    case SDL_PNG_FILTER_UP:
+        for (i = 0; i < size; ++i) {
+            out[i] = (Uint8)(row[i] - prev[i]);
+        }
+        break;
+    case SDL_PNG_FILTER_AVERAGE:
+        for (i = 0; i < (size_t)bpp; ++i) {
+            out[i] = (Uint8)(row[i] - (prev[i] >> 1));
+        }
+        for (; i < size; ++i) {
+            out[i] = (Uint8)(row[i] - ((row[i - bpp] + prev[i]) >> 1));
+        }
+        break;
+    case SDL_PNG_FILTER_PAETH:
+        for (i = 0; i < (size_t)bpp; ++i) {
+            out[i] = (Uint8)(row[i] - prev[i]);
+        }
+        for (; i < size; ++i) {
+            out[i] = (Uint8)(row[i] - PaethPredictor(row[i - bpp], prev[i], prev[i - bpp]));
+        }
+        break;
+    default:
+        SDL_memcpy(out, row, size);
+        break;
+    }
+}
+
+static size_t GetPNGScratchSize(const SDL_PNGImage *image)
+{
+    return (image->filter == SDL_PNG_FILTER_ADAPTIVE ? 5 : 1) * (image->row_size + 1);
+}
+
+// Returns the filter type byte followed by the filtered row
+static const Uint8 *FilterPNGRow(const SDL_PNGImage *image, int y, Uint8 *scratch)
+{
+    const Uint8 *row = image->pixels + (size_t)y * image->pitch;
+    const Uint8 *prev = (y > 0) ? (row - image->pitch) : image->zero_row;
+    const Uint8 *best;
+    Uint64 best_sum = ~(Uint64)0;
+    int filter;
+
+    if (image->filter != SDL_PNG_FILTER_ADAPTIVE) {
+        FilterPNGRowWith(image->filter, row, prev, image->row_size, image->bpp, scratch);
+        return scratch;
+    }
+
+    // Use the filter with the smallest sum of absolute differences, like libpng
+    best = scratch;
+    for (filter = SDL_PNG_FILTER_NONE; filter <= SDL_PNG_FILTER_PAETH; ++filter) {
+        Uint8 *out = scratch + filter * (image->row_size + 1);
+        Uint64 sum = 0;
+        size_t i;
+
+        FilterPNGRowWith((SDL_PNGFilter)filter, row, prev, image->row_size, image->bpp, out);
+        for (i = 1; i <= image->row_size; ++i) {
+            sum += (out[i] < 128) ? out[i] : (256 - out[i]);
+        }
+        if (sum < best_sum) {
+            best_sum = sum;
+            best = out;
+        }
+    }
+    return best;
+}
+
+static bool WritePNGChunk(SDL_IOStream *dst, const char *type, const Uint8 *data, size_t size)
+{
+    Uint32 crc = (Uint32)mz_crc32(MZ_CRC32_INIT, (const unsigned char *)type, 4);
+
+    if (size > 0) {
+        crc = (Uint32)mz_crc32(crc, data, size);
+    }
+    return SDL_WriteU32BE(dst, (Uint32)size) &&
+           SDL_WriteIO(dst, type, 4) == 4 &&
+           (size == 0 || SDL_WriteIO(dst, data, size) == size) &&
+           SDL_WriteU32BE(dst, crc);
+}
+
+static bool FlushPNGImageData(SDL_PNGWriter *writer)
+{
+    if (writer->size > 0 && !writer->failed) {
+        if (!WritePNGChunk(writer->dst, "IDAT", writer->buffer, writer->size)) {
+            writer->failed = true;
+        }
+        writer->size = 0;
+    }
+    return !writer->failed;
+}
+
+static bool WritePNGImageData(SDL_PNGWriter *writer, const void *data, size_t size)
+{
+    const Uint8 *src = (const Uint8 *)data;
+
+    while (size > 0 && !writer->failed) {
+        const size_t amount = SDL_min(size, SDL_PNG_IDAT_SIZE - writer->size);
+        SDL_memcpy(writer->buffer + writer->size, src, amount);
+        writer->size += amount;
+        src += amount;
+        size -= amount;
+        if (writer->size == SDL_PNG_IDAT_SIZE) {
+            FlushPNGImageData(writer);
+        }
+    }
+    return !writer->failed;
+}
+
+static mz_bool PutPNGImageData(const void *data, int len, void *userdata)
+{
+    return WritePNGImageData((SDL_PNGWriter *)userdata, data, len) ? MZ_TRUE : MZ_FALSE;
+}
+
+// The zlib header, with FLEVEL set the same way zlib does for the compression level
+static bool WritePNGZlibHeader(const SDL_PNGImage *image, SDL_PNGWriter *writer)
+{
+    const int flevel = (image->level <= 1) ? 0 : (image->level <= 5) ? 1 : (image->level == 6) ? 2 : 3;
+    Uint8 header[2];
+
+    header[0] = 0x78; // deflate with a 32K window
+    header[1] = (Uint8)(flevel << 6);
+    header[1] |= (Uint8)((31 - ((header[0] << 8) | header[1]) % 31) % 31);
+    return WritePNGImageData(writer, header, sizeof(header));
+}
+
+static bool WritePNGAdler32(SDL_PNGWriter *writer, Uint32 adler)
+{
+    Uint8 trailer[4];
+
+    trailer[0] = (Uint8)(adler >> 24);
+    trailer[1] = (Uint8)(adler >> 16);
+    trailer[2] = (Uint8)(adler >> 8);
+    trailer[3] = (Uint8)(adler >> 0);
+    return WritePNGImageData(writer, trailer, sizeof(trailer));
+}
+
+static bool CompressPNGRows(const SDL_PNGImage *image, SDL_PNGWriter *writer)
+{
+    tdefl_compressor *comp = (tdefl_compressor *)SDL_malloc(sizeof(*comp));
+    Uint8 *scratch = (Uint8 *)SDL_malloc(GetPNGScratchSize(image));
+    bool result = false;
+    int y;
+
+    if (!comp || !scratch) {
+        goto done;
+    }
+
+    if (!WritePNGZlibHeader(image, writer)) {
+        goto done;
+    }
+    tdefl_init(comp, PutPNGImageData, writer, image->flags | TDEFL_COMPUTE_ADLER32);
+    for (y = 0; y < image->height; ++y) {
+        if (tdefl_compress_buffer(comp, FilterPNGRow(image, y, scratch), image->row_size + 1, TDEFL_NO_FLUSH) != TDEFL_STATUS_OKAY) {
+            goto done;
+        }
+    }
+    if (tdefl_compress_buffer(comp, NULL, 0, TDEFL_FINISH) != TDEFL_STATUS_DONE) {
+        goto done;
+    }
+    result = WritePNGAdler32(writer, comp->m_adler32);
+
+done:
+    if (!result && comp && !writer->failed) {
+        SDL_SetError("Failed to compress PNG image data");
+    }
+    SDL_free(comp);
+    SDL_free(scratch);
+    return result;
+}
+
+// Deflates a band of rows into memory, ending on a byte boundary so the bands can be joined
+static bool CompressPNGBand(const SDL_PNGEncoder *encoder, int index, SDL_PNGBand *band, tdefl_compressor *comp, Uint8 *scratch)
+{
+    const SDL_PNGImage *image = encoder->image;
+    const int first_row = index * encoder->band_rows;
+    const int last_row = SDL_min(first_row + encoder->band_rows, image->height);
+    const bool last = (last_row == image->height);
+    tdefl_output_buffer out;
+    int y;
+
+    SDL_zero(out);
+    out.m_expandable = MZ_TRUE;
+    tdefl_init(comp, tdefl_output_buffer_putter, &out, image->flags | TDEFL_COMPUTE_ADLER32);
+    for (y = first_row; y < last_row; ++y) {
+        if (tdefl_compress_buffer(comp, FilterPNGRow(image, y, scratch), image->row_size + 1, TDEFL_NO_FLUSH) != TDEFL_STATUS_OKAY) {
+            SDL_free(out.m_pBuf);
+            return false;
+        }
+    }
+    if (tdefl_compress_buffer(comp, NULL, 0, last ? TDEFL_FINISH : TDEFL_SYNC_FLUSH) != (last ? TDEFL_STATUS_DONE : TDEFL_STATUS_OKAY)) {
+        SDL_free(out.m_pBuf);
+        return false;
+    }
+    band->data = out.m_pBuf;
+    band->size = out.m_size;
+    band->adler = comp->m_adler32;
+    return true;
+}
+
+// Compresses some of the bands being worked on, called on the pixel conversion thread pool
+static void CompressPNGBands(void *userdata, int first, int count)
+{
+    SDL_PNGEncoder *encoder = (SDL_PNGEncoder *)userdata;
+    tdefl_compressor *comp = (tdefl_compressor *)SDL_malloc(sizeof(*comp));
+    Uint8 *scratch = (Uint8 *)SDL_malloc(GetPNGScratchSize(encoder->image));
+    int i;
+
+    for (i = first; i < first + count; ++i) {
+        SDL_PNGBand *band = &encoder->bands[i];
+        band->compressed = comp && scratch && CompressPNGBand(encoder, encoder->first_band + i, band, comp, scratch);
+    }
+
+    SDL_free(comp);
+    SDL_free(scratch);
+}
+
+// The zlib Adler-32 of two buffers joined together, given the checksum of each
+static Uint32 CombineAdler32(Uint32 adler1, Uint32 adler2, size_t len2)
+{
+    const Uint32 BASE = 65521;
+    const Uint32 rem = (Uint32)(len2 % BASE);
+    Uint32 sum1 = adler1 & 0xffff;
+    Uint32 sum2 = (rem * sum1) % BASE;
+
+    sum1 += (adler2 & 0xffff) + BASE - 1;
+    sum2 += ((adler1 >> 16) & 0xffff) + ((adler2 >> 16) & 0xffff) + BASE - rem;
+    if (sum1 >= BASE) {
+        sum1 -= BASE;
+    }
+    if (sum1 >= BASE) {
+        sum1 -= BASE;
+    }
+    if (sum2 >= (BASE << 1)) {
+        sum2 -= (BASE << 1);
+    }
+    if (sum2 >= BASE) {
+        sum2 -= BASE;
+    }
+    return sum1 | (sum2 << 16);
+}
+
+static bool CompressPNGRowsInParallel(const SDL_PNGImage *image, SDL_PNGWriter *writer, bool *handled)
+{
+    SDL_PNGEncoder encoder;
+    int num_bands, num_threads, group_size;
+    Uint32 adler = 1;
+    bool result = false;
+    int i;
+
+    *handled = false;
+
+    SDL_zero(encoder);
+    encoder.image = image;
+    encoder.band_rows = (int)SDL_max(SDL_PNG_BAND_SIZE / (image->row_size + 1), 1);
+    num_bands = (image->height + encoder.band_rows - 1) / encoder.band_rows;
+    num_threads = GetPNGSaveThreads(image, num_bands);
+    if (num_threads <= 1) {
+        return false;
+    }
+
+    group_size = num_threads * SDL_PNG_BANDS_PER_THREAD;
+    encoder.bands = (SDL_PNGBand *)SDL_calloc(group_size, sizeof(*encoder.bands));
+    if (!encoder.bands) {
+        return false;
+    }
+
+    for (encoder.first_band = 0; encoder.first_band < num_bands; encoder.first_band += group_size) {
+        const int count = SDL_min(group_size, num_bands - encoder.first_band);
+
+        if (!SDL_ConvertBandsInParallel(num_threads, count, 1, CompressPNGBands, &encoder)) {
+            if (encoder.first_band == 0) {
+                // The thread pool is busy, compress the image in one piece instead
+                goto done;
+            }
+            CompressPNGBands(&encoder, 0, count);
+        }
+        *handled = true;
+
+        if (encoder.first_band == 0 && !WritePNGZlibHeader(image, writer)) {
+            goto done;
+        }
+        for (i = 0; i < count; ++i) {
+            SDL_PNGBand *band = &encoder.bands[i];
+            const int index = encoder.first_band + i;
+            const int rows = SDL_min(encoder.band_rows, image->height - index * encoder.band_rows);
+
+            if (!band->compressed) {
+                SDL_SetError("Failed to compress PNG image data");
+                goto done;
+            }
+            adler = (index == 0) ? band->adler : CombineAdler32(adler, band->adler, (size_t)rows * (image->row_size + 1));
+            if (!WritePNGImageData(writer, band->data, band->size)) {
+                goto done;
+            }
+            SDL_free(band->data);
+            band->data = NULL;
+        }
+    }
+    result = WritePNGAdler32(writer, adler);
+
+done:
+    for (i = 0; i < group_size; ++i) {
+        SDL_free(encoder.bands[i].data);
+    }
+    SDL_free(encoder.bands);
+    return result;
+}
+
+static bool WritePNG(SDL_IOStream *dst, const SDL_Surface *surface, const Uint8 *plte, int plte_size, const Uint8 *trns, int trns_size)
+{
+    static const Uint8 signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    const bool indexed = (surface->format == SDL_PIXELFORMAT_INDEX8);
+    SDL_PNGImage image;
+    SDL_PNGWriter writer;
+    Uint8 ihdr[13];
+    bool handled = false;
+    bool result = false;
+
+    SDL_zero(image);
+    image.pixels = (const Uint8 *)surface->pixels;
+    image.height = surface->h;
+    image.pitch = surface->pitch;
+    image.bpp = SDL_BYTESPERPIXEL(surface->format);
+    image.row_size = (size_t)surface->w * image.bpp;
+    image.level = GetPNGCompressionLevel();
+    image.flags = GetPNGCompressionFlags(image.level);
+    // Filtering rarely helps palette images, so the PNG specification recommends not doing it
+    image.filter = indexed ? SDL_PNG_FILTER_NONE : GetPNGFilter();
+    image.zero_row = (Uint8 *)SDL_calloc(1, image.row_size);
+
+    SDL_zero(writer);
+    writer.dst = dst;
+    writer.buffer = (Uint8 *)SDL_malloc(SDL_PNG_IDAT_SIZE);
+
+    if (!image.zero_row || !writer.buffer) {
+        goto done;
+    }
+
+    ihdr[0] = (Uint8)(surface->w >> 24);
+    ihdr[1] = (Uint8)(surface->w >> 16);
+    ihdr[2] = (Uint8)(surface->w >> 8);
+    ihdr[3] = (Uint8)(surface->w >> 0);
+    ihdr[4] = (Uint8)(surface->h >> 24);
+    ihdr[5] = (Uint8)(surface->h >> 16);
+    ihdr[6] = (Uint8)(surface->h >> 8);
+    ihdr[7] = (Uint8)(surface->h >> 0);
+    ihdr[8] = 8;                // bit depth
+    ihdr[9] = indexed ? 3 : 6;  // color type: palette or RGBA
+    ihdr[10] = 0;               // compression method
+    ihdr[11] = 0;               // filter method
+    ihdr[12] = 0;               // no interlacing
+
+    if (SDL_WriteIO(dst, signature, sizeof(signature)) != sizeof(signature) ||
+        !WritePNGChunk(dst, "IHDR", ihdr, sizeof(ihdr)) ||
+        (plte_size > 0 && !WritePNGChunk(dst, "PLTE", plte, plte_size)) ||
+        (trns_size > 0 && !WritePNGChunk(dst, "tRNS", trns, trns_size))) {
+        goto done;
+    }
+
+    if (!CompressPNGRowsInParallel(&image, &writer, &handled) && (handled || !CompressPNGRows(&image, &writer))) {
+        goto done;
+    }
+    if (!FlushPNGImageData(&writer) || !WritePNGChunk(dst, "IEND", NULL, 0)) {
+        goto done;
+    }
+    result = true;
+
+done:
+    SDL_free(image.zero_row);
+    SDL_free(writer.buffer);
+    return result;
+}
+#endif // SDL_HAVE_STB
+
 bool SDL_SavePNG_IO(SDL_Surface *surface, SDL_IOStream *dst, bool closeio)
 {
     bool retval = false;
@@ -447,16 +994,7 @@ bool SDL_SavePNG_IO(SDL_Surface *surface, SDL_IOStream *dst, bool closeio)
         }
     }
 
-    size_t size = 0;
-    void *png = tdefl_write_image_to_png_file_in_memory_ex(surface->pixels, surface->w, surface->h, SDL_BYTESPERPIXEL(surface->format), surface->pitch, &size, 6, MZ_FALSE, plte, plte_size, trns, trns_size);
-    if (png) {
-        if (SDL_WriteIO(dst, png, size)) {
-            retval = true;
-        }
-        mz_free(png); /* calls SDL_free() */
-    } else {
-        SDL_SetError("Failed to convert and save image");
-    }
+    retval = WritePNG(dst, surface, plte, plte_size, trns, trns_size);
 
 #else
     SDL_SetError("SDL not built with STB image support");
@@ -21,9 +21,12 @@
 #include "SDL_internal.h"
 
 #include "SDL_surface_c.h"
+#include "SDL_pixels_c.h"
+#include "SDL_yuv_c.h"
 
 static bool SDL_StretchSurfaceUncheckedNearest(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect);
 static bool SDL_StretchSurfaceUncheckedLinear(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect);
+static bool SDL_StretchSurfaceUncheckedArea(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect);
 
 bool SDL_StretchSurface(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, SDL_ScaleMode scaleMode)
 {
@@ -40,6 +43,15 @@ bool SDL_StretchSurface(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *
         return SDL_InvalidParamError("dst");
     }
 
+    if (!srcrect && !dstrect &&
+        (scaleMode == SDL_SCALEMODE_NEAREST || scaleMode == SDL_SCALEMODE_PIXELART) &&
+        src->colorspace == dst->colorspace &&
+        SDL_CanStretchPixels_YUV(src->format, dst->format)) {
+        // Sample the YUV data directly, changing the layout without going through RGB
+        return SDL_StretchPixels_YUV(src->w, src->h, src->format, src->pixels, src->pitch,
+                                     dst->w, dst->h, dst->format, dst->pixels, dst->pitch);
+    }
+
     if (src->format != dst->format) {
         // Slow!
         SDL_Surface *src_tmp = SDL_ConvertSurfaceAndColorspace(src, dst->format, dst->palette, dst->colorspace, dst->props);
@@ -88,6 +100,8 @@ bool SDL_StretchSurface(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *
     case SDL_SCALEMODE_PIXELART:
         scaleMode = SDL_SCALEMODE_NEAREST;
         break;
+    case SDL_SCALEMODE_AREA:
+        break;
     default:
         return SDL_InvalidParamError("scaleMode");
     }
@@ -96,6 +110,10 @@ bool SDL_StretchSurface(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *
         if (SDL_BYTESPERPIXEL(src->format) != 4 || src->format == SDL_PIXELFORMAT_ARGB2101010) {
             return SDL_SetError("Wrong format");
         }
+    } else if (scaleMode == SDL_SCALEMODE_AREA) {
+        if (!SDL_IsAreaScaleFormat(src->format)) {
+            return SDL_SetError("Wrong format");
+        }
     }
 
     // Verify the blit rectangles
@@ -157,6 +175,8 @@ bool SDL_StretchSurface(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *
 
     if (scaleMode == SDL_SCALEMODE_NEAREST) {
         result = SDL_StretchSurfaceUncheckedNearest(src, srcrect, dst, dstrect);
+    } else if (scaleMode == SDL_SCALEMODE_AREA) {
+        result = SDL_StretchSurfaceUncheckedArea(src, srcrect, dst, dstrect);
     } else {
         result = SDL_StretchSurfaceUncheckedLinear(src, srcrect, dst, dstrect);
     }
@@ -860,6 +880,529 @@ bool SDL_StretchSurfaceUncheckedLinear(SDL_Surface *s, const SDL_Rect *srcrect,
     return result;
 }
 
+/* Area-average scaling
+ *
+ * Each destination pixel is the average of the source pixels under it,
+ * weighted by how much of each source pixel it covers. Source rows are first
+ * filtered horizontally into a row of 15-bit channel values, and those rows
+ * are then accumulated vertically into the destination row. The fixed point
+ * weights for each destination pixel add up to exactly AREA_ONE, so a solid
+ * color stays the same and every implementation gives identical results.
+ * Shrinking by more than AREA_MAX_RATIO is done in two steps, so each source
+ * pixel keeps a meaningful weight.
+ */
+#define AREA_MAX_RATIO 64
+#define AREA_PRECISION 14
+#define AREA_ONE       (1 << AREA_PRECISION)
+#define AREA_HSHIFT    7 // horizontal sums are at most 255 * AREA_ONE, this keeps them positive in a Sint16
+#define AREA_VSHIFT    (2 * AREA_PRECISION - AREA_HSHIFT)
+#define AREA_HROUND    (1 << (AREA_HSHIFT - 1))
+#define AREA_VROUND    (1 << (AREA_VSHIFT - 1))
+
+typedef struct area_weights_t
+{
+    int *start;      // first source pixel of each destination pixel
+    int *count;      // number of source pixels of each destination pixel
+    Uint16 *weights; // the weights of the source pixels, for each destination pixel in order
+} area_weights_t;
+
+typedef struct area_scaler_t area_scaler_t;
+
+typedef void (*area_filter_func)(const area_scaler_t *scaler, const Uint8 *src, Uint16 *row);
+typedef void (*area_accumulate_func)(Uint32 *acc, const Uint16 *row, int n, Uint32 weight);
+typedef void (*area_store_func)(const area_scaler_t *scaler, const Uint32 *acc, Uint8 *dst);
+
+struct area_scaler_t
+{
+    const Uint8 *src;
+    int src_pitch;
+    Uint8 *dst;
+    int dst_pitch;
+    int dst_w;
+    int channels;
+    area_weights_t x;
+    area_weights_t y;
+    Uint32 masks[4];  // for 16-bit formats
+    Uint8 shifts[4];
+    area_filter_func filter_row;
+    area_accumulate_func accumulate;
+    area_store_func store_row;
+    SDL_AtomicInt failed;
+};
+
+static void free_area_weights(area_weights_t *w)
+{
+    SDL_free(w->start);
+    SDL_free(w->count);
+    SDL_free(w->weights);
+    SDL_zerop(w);
+}
+
+static bool get_area_weights(int src_nb, int dst_nb, area_weights_t *w)
+{
+    Uint16 *weights;
+    int i;
+
+    w->start = (int *)SDL_malloc(dst_nb * sizeof(*w->start));
+    w->count = (int *)SDL_malloc(dst_nb * sizeof(*w->count));
+    w->weights = (Uint16 *)SDL_malloc((src_nb + dst_nb) * sizeof(*w->weights));
+    if (!w->start || !w->count || !w->weights) {
+        free_area_weights(w);
+        return false;
+    }
+
+    /* In units of 1 / (src_nb * dst_nb), destination pixel i covers
+       [i * src_nb, (i + 1) * src_nb) and source pixel k covers
+       [k * dst_nb, (k + 1) * dst_nb) */
+    weights = w->weights;
+    for (i = 0; i < dst_nb; i++) {
+        const Sint64 x0 = (Sint64)i * src_nb;
+        const Sint64 x1 = x0 + src_nb;
+        const int first = (int)(x0 / dst_nb);
+        const int last = (int)((x1 - 1) / dst_nb);
+        int k, total = 0;
+
+        /* Round the running total rather than each weight, so the rounding
+           errors are spread over all the weights and they add up to exactly one */
+        for (k = first; k <= last; k++) {
+            const Sint64 covered = SDL_min(x1, (Sint64)(k + 1) * dst_nb) - x0;
+            const int next_total = (int)((covered * AREA_ONE + src_nb / 2) / src_nb);
+
+            weights[k - first] = (Uint16)(next_total - total);
+            total = next_total;
+        }
+
+        w->start[i] = first;
+        w->count[i] = last - first + 1;
+        weights += w->count[i];
+    }
+    return true;
+}
+
+static SDL_INLINE Uint16 AREA_H(Uint32 sum)
+{
+    return (Uint16)((sum + AREA_HROUND) >> AREA_HSHIFT);
+}
+
+static SDL_INLINE Uint32 AREA_V(Uint32 acc)
+{
+    return (acc + AREA_VROUND) >> AREA_VSHIFT;
+}
+
+static SDL_INLINE void area_filter_row_bytes(const area_scaler_t *scaler, const Uint8 *src, Uint16 *row, const int bpp)
+{
+    const area_weights_t *aw = &scaler->x;
+    const Uint16 *weights = aw->weights;
+    int i, c;
+
+    for (i = 0; i < scaler->dst_w; i++) {
+        const Uint8 *s = src + bpp * aw->start[i];
+        int n = aw->count[i];
+        Uint32 sum[4] = { 0, 0, 0, 0 };
+
+        while (n--) {
+            const Uint32 weight = *weights++;
+            for (c = 0; c < bpp; c++) {
+                sum[c] += weight * s[c];
+            }
+            s += bpp;
+        }
+        for (c = 0; c < bpp; c++) {
+            row[c] = AREA_H(sum[c]);
+        }
+        row += bpp;
+    }
+}
+
+static void area_filter_row_3(const area_scaler_t *scaler, const Uint8 *src, Uint16 *row)
+{
+    area_filter_row_bytes(scaler, src, row, 3);
+}
+
+static void area_filter_row_4(const area_scaler_t *scaler, const Uint8 *src, Uint16 *row)
+{
+    area_filter_row_bytes(scaler, src, row, 4);
+}
+
+static void area_filter_row_16(const area_scaler_t *scaler, const Uint8 *src, Uint16 *row)
+{
+    const area_weights_t *aw = &scaler->x;
+    const Uint16 *weights = aw->weights;
+    const Uint32 *masks = scaler->masks;
+    const Uint8 *shifts = scaler->shifts;
+    int i, c;
+
+    for (i = 0; i < scaler->dst_w; i++) {
+        const Uint16 *s = (const Uint16 *)src + aw->start[i];
+        int n = aw->count[i];
+        Uint32 sum[4] = { 0, 0, 0, 0 };
+
+        while (n--) {
+            const Uint32 weight = *weights++;
+            const Uint32 pixel = *s++;
+            for (c = 0; c < 4; c++) {
+                sum[c] += weight * ((pixel & masks[c]) >> shifts[c]);
+            }
+        }
+        for (c = 0; c < 4; c++) {
+            row[c] = AREA_H(sum[c]);
+        }
+        row += 4;
+    }
+}
+
+static void area_accumulate(Uint32 *acc, const Uint16 *row, int n, Uint32 weight)
+{
+    int i;
+
+    for (i = 0; i < n; i++) {
+        acc[i] += weight * row[i];
+    }
+}
+
+static void area_store_row_bytes(const area_scaler_t *scaler, const Uint32 *acc, Uint8 *dst)
+{
+    const int n = scaler->dst_w * scaler->channels;
+    int i;
+
+    for (i = 0; i < n; i++) {
+        dst[i] = (Uint8)AREA_V(acc[i]);
+    }
+}
+
+static void area_store_row_16(const area_scaler_t *scaler, const Uint32 *acc, Uint8 *dst)
+{
+    Uint16 *d = (Uint16 *)dst;
+    int i, c;
+
+    for (i = 0; i < scaler->dst_w; i++) {
+        Uint32 pixel = 0;
+        for (c = 0; c < 4; c++) {
+            pixel |= (AREA_V(acc[c]) << scaler->shifts[c]) & scaler->masks[c];
+        }
+        *d++ = (Uint16)pixel;
+        acc += 4;
+    }
+}
+
+#ifdef SDL_SSE2_INTRINSICS
+
+static void SDL_TARGETING("sse2") area_filter_row_4_SSE(const area_scaler_t *scaler, const Uint8 *src, Uint16 *row)
+{
+    const area_weights_t *aw = &scaler->x;
+    const Uint16 *weights = aw->weights;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi32(AREA_HROUND);
+    int i;
+
+    for (i = 0; i < scaler->dst_w; i++) {
+        const Uint32 *s = (const Uint32 *)src + aw->start[i];
+        int n = aw->count[i];
+        __m128i sum = zero;
+
+        // Two pixels at a time: interleave their channels and multiply-add them with their weights
+        while (n >= 2) {
+            __m128i p = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)s), zero);
+            __m128i w = _mm_set1_epi32((int)(weights[0] | ((Uint32)weights[1] << 16)));
+            p = _mm_unpacklo_epi16(p, _mm_srli_si128(p, 8));
+            sum = _mm_add_epi32(sum, _mm_madd_epi16(p, w));
+            weights += 2;
+            s += 2;
+            n -= 2;
+        }
+        if (n) {
+            __m128i p = _mm_unpacklo_epi8(_mm_cvtsi32_si128((int)*s), zero);
+            __m128i w = _mm_set1_epi32(weights[0]);
+            p = _mm_unpacklo_epi16(p, zero);
+            sum = _mm_add_epi32(sum, _mm_madd_epi16(p, w));
+            weights += 1;
+        }
+
+        sum = _mm_srli_epi32(_mm_add_epi32(sum, round), AREA_HSHIFT);
+        _mm_storel_epi64((__m128i *)row, _mm_packs_epi32(sum, sum));
+        row += 4;
+    }
+}
+
+static void SDL_TARGETING("sse2") area_accumulate_SSE(Uint32 *acc, const Uint16 *row, int n, Uint32 weight)
+{
+    const __m128i w = _mm_set1_epi16((short)weight);
+    int i;
+
+    for (i = 0; i + 8 <= n; i += 8) {
+        const __m128i r = _mm_loadu_si128((const __m128i *)(row + i));
+        const __m128i lo = _mm_mullo_epi16(r, w);
+        const __m128i hi = _mm_mulhi_epu16(r, w);
+        __m128i a0 = _mm_loadu_si128((const __m128i *)(acc + i));
+        __m128i a1 = _mm_loadu_si128((const __m128i *)(acc + i + 4));
+        a0 = _mm_add_epi32(a0, _mm_unpacklo_epi16(lo, hi));
+        a1 = _mm_add_epi32(a1, _mm_unpackhi_epi16(lo, hi));
+        _mm_storeu_si128((__m128i *)(acc + i), a0);
+        _mm_storeu_si128((__m128i *)(acc + i + 4), a1);
+    }
+    for (; i < n; i++) {
+        acc[i] += weight * row[i];
+    }
+}
+
+static void SDL_TARGETING("sse2") area_store_row_bytes_SSE(const area_scaler_t *scaler, const Uint32 *acc, Uint8 *dst)
+{
+    const int n = scaler->dst_w * scaler->channels;
+    const __m128i round = _mm_set1_epi32(AREA_VROUND);
+    int i;
+
+    for (i = 0; i + 16 <= n; i += 16) {
+        __m128i a0 = _mm_loadu_si128((const __m128i *)(acc + i));
+        __m128i a1 = _mm_loadu_si128((const __m128i *)(acc + i + 4));
+        __m128i a2 = _mm_loadu_si128((const __m128i *)(acc + i + 8));
+        __m128i a3 = _mm_loadu_si128((const __m128i *)(acc + i + 12));
+        a0 = _mm_srli_epi32(_mm_add_epi32(a0, round), AREA_VSHIFT);
+        a1 = _mm_srli_epi32(_mm_add_epi32(a1, round), AREA_VSHIFT);
+        a2 = _mm_srli_epi32(_mm_add_epi32(a2, round), AREA_VSHIFT);
+        a3 = _mm_srli_epi32(_mm_add_epi32(a3, round), AREA_VSHIFT);
+        a0 = _mm_packs_epi32(a0, a1);
+        a2 = _mm_packs_epi32(a2, a3);
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(a0, a2));
+    }
+    for (; i < n; i++) {
+        dst[i] = (Uint8)AREA_V(acc[i]);
+    }
+}
+#endif // SDL_SSE2_INTRINSICS
+
+#ifdef SDL_NEON_INTRINSICS
+
+static void area_filter_row_4_NEON(const area_scaler_t *scaler, const Uint8 *src, Uint16 *row)
+{
+    const area_weights_t *aw = &scaler->x;
+    const Uint16 *weights = aw->weights;
+    int i;
+
+    for (i = 0; i < scaler->dst_w; i++) {
+        const Uint32 *s = (const Uint32 *)src + aw->start[i];
+        int n = aw->count[i];
+        uint32x4_t sum = vdupq_n_u32(0);
+
+        while (n--) {
+            const uint8x8_t p = vreinterpret_u8_u32(vdup_n_u32(*s++));
+            sum = vmlal_n_u16(sum, vget_low_u16(vmovl_u8(p)), *weights++);
+        }
+        vst1_u16(row, vmovn_u32(vshrq_n_u32(vaddq_u32(sum, vdupq_n_u32(AREA_HROUND)), AREA_HSHIFT)));
+        row += 4;
+    }
+}
+
+static void area_accumulate_NEON(Uint32 *acc, const Uint16 *row, int n, Uint32 weight)
+{
+    int i;
+
+    for (i = 0; i + 8 <= n; i += 8) {
+        const uint16x8_t r = vld1q_u16(row + i);
+        uint32x4_t a0 = vld1q_u32(acc + i);
+        uint32x4_t a1 = vld1q_u32(acc + i + 4);
+        a0 = vmlal_n_u16(a0, vget_low_u16(r), (Uint16)weight);
+        a1 = vmlal_n_u16(a1, vget_high_u16(r), (Uint16)weight);
+        vst1q_u32(acc + i, a0);
+        vst1q_u32(acc + i + 4, a1);
+    }
+    for (; i < n; i++) {
+        acc[i] += weight * row[i];
+    }
+}
+
+static void area_store_row_bytes_NEON(const area_scaler_t *scaler, const Uint32 *acc, Uint8 *dst)
+{
+    const int n = scaler->dst_w * scaler->channels;
+    const uint32x4_t round = vdupq_n_u32(AREA_VROUND);
+    int i;
+
+    for (i = 0; i + 8 <= n; i += 8) {
+        const uint32x4_t a0 = vshrq_n_u32(vaddq_u32(vld1q_u32(acc + i), round), AREA_VSHIFT);
+        const uint32x4_t a1 = vshrq_n_u32(vaddq_u32(vld1q_u32(acc + i + 4), round), AREA_VSHIFT);
+        vst1_u8(dst + i, vmovn_u16(vcombine_u16(vmovn_u32(a0), vmovn_u32(a1))));
+    }
+    for (; i < n; i++) {
+        dst[i] = (Uint8)AREA_V(acc[i]);
+    }
+}
+#endif // SDL_NEON_INTRINSICS
+
+static void area_scale_rows(void *userdata, int row, int num_rows)
+{
+    area_scaler_t *scaler = (area_scaler_t *)userdata;
+    const area_weights_t *aw = &scaler->y;
+    const int n = scaler->dst_w * scaler->channels;
+    const Uint16 *weights;
+    Uint16 *hrow;
+    Uint32 *acc;
+    int i, filtered = -1;
+
+    hrow = (Uint16 *)SDL_malloc(n * sizeof(*hrow));
+    acc = (Uint32 *)SDL_malloc(n * sizeof(*acc));
+    if (!hrow || !acc) {
+        SDL_SetAtomicInt(&scaler->failed, 1);
+        SDL_free(hrow);
+        SDL_free(acc);
+        return;
+    }
+
+    weights = aw->weights;
+    for (i = 0; i < row; i++) {
+        weights += aw->count[i];
+    }
+
+    for (i = row; i < row + num_rows; i++) {
+        int k;
+
+        SDL_memset(acc, 0, n * sizeof(*acc));
+        for (k = 0; k < aw->count[i]; k++) {
+            const int src_row = aw->start[i] + k;
+
+            // Source rows between two destination rows are used by both, only filter them once
+            if (src_row != filtered) {
+                scaler->filter_row(scaler, scaler->src + (size_t)src_row * scaler->src_pitch, hrow);
+                filtered = src_row;
+            }
+            scaler->accumulate(acc, hrow, n, *weights++);
+        }
+        scaler->store_row(scaler, acc, scaler->dst + (size_t)i * scaler->dst_pitch);
+    }
+
+    SDL_free(hrow);
+    SDL_free(acc);
+}
+
+bool SDL_IsAreaScaleFormat(SDL_PixelFormat format)
+{
+    if (SDL_ISPIXELFORMAT_INDEXED(format) || SDL_ISPIXELFORMAT_FOURCC(format) ||
+        SDL_ISPIXELFORMAT_10BIT(format) || SDL_ISPIXELFORMAT_FLOAT(format)) {
+        return false;
+    }
+    switch (SDL_BYTESPERPIXEL(format)) {
+    case 2:
+    case 3:
+    case 4:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Returns how many times larger than `dst_nb` the intermediate size should be, or 1 if the ratio is small enough
+static int get_area_step(int src_nb, int dst_nb)
+{
+    if (src_nb <= (Sint64)dst_nb * AREA_MAX_RATIO) {
+        return 1;
+    }
+    return (int)(((Sint64)src_nb + (Sint64)dst_nb * AREA_MAX_RATIO - 1) / ((Sint64)dst_nb * AREA_MAX_RATIO));
+}
+
+bool SDL_StretchSurfaceUncheckedArea(SDL_Surface *s, const SDL_Rect *srcrect, SDL_Surface *d, const SDL_Rect *dstrect)
+{
+    area_scaler_t scaler;
+    const int bpp = SDL_BYTESPERPIXEL(s->format);
+    const int step_x = get_area_step(srcrect->w, dstrect->w);
+    const int step_y = get_area_step(srcrect->h, dstrect->h);
+    int src_pixels;
+    bool result = true;
+
+    if (step_x > 1 || step_y > 1) {
+        /* The area average over a whole number of intermediate pixels is
+           exactly the area average over the source pixels they cover */
+        SDL_Surface *tmp = SDL_CreateSurface(dstrect->w * step_x, dstrect->h * step_y, s->format);
+        SDL_Rect tmprect;
+
+        if (!tmp) {
+            return false;
+        }
+        tmprect.x = 0;
+        tmprect.y = 0;
+        tmprect.w = tmp->w;
+        tmprect.h = tmp->h;
+        result = SDL_StretchSurfaceUncheckedArea(s, srcrect, tmp, &tmprect) &&
+                 SDL_StretchSurfaceUncheckedArea(tmp, &tmprect, d, dstrect);
+        SDL_DestroySurface(tmp);
+        return result;
+    }
+
+    SDL_zero(scaler);
+    scaler.src = (const Uint8 *)s->pixels + srcrect->x * bpp + srcrect->y * s->pitch;
+    scaler.src_pitch = s->pitch;
+    scaler.dst = (Uint8 *)d->pixels + dstrect->x * bpp + dstrect->y * d->pitch;
+    scaler.dst_pitch = d->pitch;
+    scaler.dst_w = dstrect->w;
+
+    if (bpp == 2) {
+        const SDL_PixelFormatDetails *details = SDL_GetPixelFormatDetails(s->format);
+        if (!details) {
+            return false;
+        }
+        scaler.masks[0] = details->Rmask;
+        scaler.masks[1] = details->Gmask;
+        scaler.masks[2] = details->Bmask;
+        scaler.masks[3] = details->Amask;
+        scaler.shifts[0] = details->Rshift;
+        scaler.shifts[1] = details->Gshift;
+        scaler.shifts[2] = details->Bshift;
+        scaler.shifts[3] = details->Ashift;
+        scaler.channels = 4;
+        scaler.filter_row = area_filter_row_16;
+        scaler.store_row = area_store_row_16;
+    } else if (bpp == 3) {
+        scaler.channels = 3;
+        scaler.filter_row = area_filter_row_3;
+        scaler.store_row = area_store_row_bytes;
+    } else {
+        scaler.channels = 4;
+        scaler.filter_row = area_filter_row_4;
+        scaler.store_row = area_store_row_bytes;
+    }
+    scaler.accumulate = area_accumulate;
+
+#ifdef SDL_NEON_INTRINSICS
+    if (hasNEON()) {
+        if (bpp == 4) {
+            scaler.filter_row = area_filter_row_4_NEON;
+        }
+        if (bpp != 2) {
+            scaler.store_row = area_store_row_bytes_NEON;
+        }
+        scaler.accumulate = area_accumulate_NEON;
+    }
+#endif
+
+#ifdef SDL_SSE2_INTRINSICS
+    if (hasSSE2()) {
+        if (bpp == 4) {
+            scaler.filter_row = area_filter_row_4_SSE;
+        }
+        if (bpp != 2) {
+            scaler.store_row = area_store_row_bytes_SSE;
+        }
+        scaler.accumulate = area_accumulate_SSE;
+    }
+#endif
+
+    if (!get_area_weights(srcrect->w, dstrect->w, &scaler.x) ||
+        !get_area_weights(srcrect->h, dstrect->h, &scaler.y)) {
+        free_area_weights(&scaler.x);
+        return false;
+    }
+
+    // The work for each destination row is proportional to the source pixels it covers
+    src_pixels = (int)SDL_min((Sint64)srcrect->w * srcrect->h / dstrect->h, SDL_MAX_SINT32);
+    if (!SDL_ConvertRowsInParallel(src_pixels, dstrect->h, 1, area_scale_rows, &scaler)) {
+        area_scale_rows(&scaler, 0, dstrect->h);
+    }
+    if (SDL_GetAtomicInt(&scaler.failed)) {
+        result = SDL_OutOfMemory();
+    }
+
+    free_area_weights(&scaler.x);
+    free_area_weights(&scaler.y);
+    return result;
+}
+
 #define SDL_SCALE_NEAREST__START          \
     int i;                                \
     Uint64 posy, incy;                    \
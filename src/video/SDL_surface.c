@@ -1141,6 +1141,8 @@ bool SDL_BlitSurfaceScaled(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surfac
     case SDL_SCALEMODE_PIXELART:
         scaleMode = SDL_SCALEMODE_NEAREST;
         break;
+    case SDL_SCALEMODE_AREA:
+        break;
     default:
         return SDL_InvalidParamError("scaleMode");
     }
@@ -1271,7 +1273,14 @@ bool SDL_BlitSurfaceUncheckedScaled(SDL_Surface *src, const SDL_Rect *srcrect, S
             return SDL_BlitSurfaceUnchecked(src, srcrect, dst, dstrect);
         }
     } else {
-        if (!(src->map.info.flags & complex_copy_flags) &&
+        if (scaleMode == SDL_SCALEMODE_AREA &&
+            !(src->map.info.flags & complex_copy_flags) &&
+            src->format == dst->format &&
+            SDL_IsAreaScaleFormat(src->format)) {
+            // fast path
+            return SDL_StretchSurface(src, srcrect, dst, dstrect, SDL_SCALEMODE_AREA);
+        } else if (scaleMode == SDL_SCALEMODE_LINEAR &&
+            !(src->map.info.flags & complex_copy_flags) &&
             src->format == dst->format &&
             !SDL_ISPIXELFORMAT_INDEXED(src->format) &&
             SDL_BYTESPERPIXEL(src->format) == 4 &&
@@ -1308,9 +1317,11 @@ bool SDL_BlitSurfaceUncheckedScaled(SDL_Surface *src, const SDL_Rect *srcrect, S
             srcrect2.h = srcrect->h;
 
             // Change source format if not appropriate for scaling
-            if (SDL_BYTESPERPIXEL(src->format) != 4 || src->format == SDL_PIXELFORMAT_ARGB2101010) {
+            if (SDL_BYTESPERPIXEL(src->format) != 4 || src->format == SDL_PIXELFORMAT_ARGB2101010 ||
+                (scaleMode == SDL_SCALEMODE_AREA && !SDL_IsAreaScaleFormat(src->format))) {
                 SDL_PixelFormat fmt;
-                if (SDL_BYTESPERPIXEL(dst->format) == 4 && dst->format != SDL_PIXELFORMAT_ARGB2101010) {
+                if (SDL_BYTESPERPIXEL(dst->format) == 4 && dst->format != SDL_PIXELFORMAT_ARGB2101010 &&
+                    (scaleMode != SDL_SCALEMODE_AREA || SDL_IsAreaScaleFormat(dst->format))) {
                     fmt = dst->format;
                 } else {
                     fmt = SDL_PIXELFORMAT_ARGB8888;
@@ -1328,7 +1339,7 @@ bool SDL_BlitSurfaceUncheckedScaled(SDL_Surface *src, const SDL_Rect *srcrect, S
             if (is_complex_copy_flags || src->format != dst->format) {
                 SDL_Rect tmprect;
                 SDL_Surface *tmp2 = SDL_CreateSurface(dstrect->w, dstrect->h, src->format);
-                SDL_StretchSurface(src, &srcrect2, tmp2, NULL, SDL_SCALEMODE_LINEAR);
+                SDL_StretchSurface(src, &srcrect2, tmp2, NULL, scaleMode);
 
                 SDL_SetSurfaceColorMod(tmp2, r, g, b);
                 SDL_SetSurfaceAlphaMod(tmp2, alpha);
@@ -1341,7 +1352,7 @@ bool SDL_BlitSurfaceUncheckedScaled(SDL_Surface *src, const SDL_Rect *srcrect, S
                 result = SDL_BlitSurfaceUnchecked(tmp2, &tmprect, dst, dstrect);
                 SDL_DestroySurface(tmp2);
             } else {
-                result = SDL_StretchSurface(src, &srcrect2, dst, dstrect, SDL_SCALEMODE_LINEAR);
+                result = SDL_StretchSurface(src, &srcrect2, dst, dstrect, scaleMode);
             }
 
             SDL_DestroySurface(tmp1);
@@ -2008,7 +2019,7 @@ static SDL_Surface *SDL_ConvertSurfaceRectAndColorspace(SDL_Surface *surface, co
     }
 
     if (surface->pixels || SDL_MUSTLOCK(surface)) {
-        result = SDL_BlitSurfaceUnchecked(surface, rect, convert, &bounds);
+        result = SDL_BlitSurfaceUncheckedParallel(surface, rect, convert, &bounds);
     } else {
         result = true;
     }
@@ -2226,8 +2237,23 @@ SDL_Surface *SDL_ScaleSurface(SDL_Surface *surface, int width, int height, SDL_S
         goto error;
     }
 
+    if (SDL_ISPIXELFORMAT_FOURCC(surface->format) && surface->pixels &&
+        (scaleMode == SDL_SCALEMODE_NEAREST || scaleMode == SDL_SCALEMODE_PIXELART) &&
+        SDL_CanStretchPixels_YUV(surface->format, surface->format)) {
+        // Nearest neighbor scaling can sample the YUV data directly
+        convert = SDL_CreateSurface(width, height, surface->format);
+        if (!convert) {
+            goto error;
+        }
+        SDL_SetSurfaceColorspace(convert, surface->colorspace);
+        if (!SDL_StretchSurface(surface, NULL, convert, NULL, scaleMode)) {
+            goto error;
+        }
+        return convert;
+    }
+
     if (SDL_ISPIXELFORMAT_FOURCC(surface->format)) {
-        // We can't directly scale a YUV surface (yet!)
+        // We can't directly scale this YUV surface (yet!)
         SDL_Surface *tmp = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_ARGB8888);
         if (!tmp) {
             return NULL;
@@ -2425,7 +2451,7 @@ bool SDL_ConvertPixelsAndColorspace(int width, int height,
     rect.y = 0;
     rect.w = width;
     rect.h = height;
-    result = SDL_BlitSurfaceUnchecked(&src_surface, &rect, &dst_surface, &rect);
+    result = SDL_BlitSurfaceUncheckedParallel(&src_surface, &rect, &dst_surface, &rect);
 
     SDL_DestroySurface(&src_surface);
     SDL_DestroySurface(&dst_surface);
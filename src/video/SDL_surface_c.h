@@ -93,6 +93,7 @@ extern float SDL_GetDefaultHDRHeadroom(SDL_Colorspace colorspace);
 extern float SDL_GetSurfaceHDRHeadroom(SDL_Surface *surface, SDL_Colorspace colorspace);
 extern SDL_Surface *SDL_GetSurfaceImage(SDL_Surface *surface, float display_scale);
 extern SDL_Surface *SDL_ConvertSurfaceRect(SDL_Surface *surface, const SDL_Rect *rect, SDL_PixelFormat format);
+extern bool SDL_IsAreaScaleFormat(SDL_PixelFormat format);
 extern bool SDL_IsBMP(SDL_IOStream *src);
 extern bool SDL_IsPNG(SDL_IOStream *src);
 
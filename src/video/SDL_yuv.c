@@ -421,6 +421,244 @@ static bool yuv_rgb_sse(
 }
 #endif
 
+#ifdef SDL_AVX2_INTRINSICS
+static bool yuv_rgb_avx2(
+    SDL_PixelFormat src_format, SDL_PixelFormat dst_format,
+    Uint32 width, Uint32 height,
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+    Uint8 *rgb, Uint32 rgb_stride,
+    YCbCrType yuv_type)
+{
+    if (!SDL_HasAVX2()) {
+        return false;
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YV12 ||
+        src_format == SDL_PIXELFORMAT_IYUV) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuv420_rgb565_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_RGB24:
+            yuv420_rgb24_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv420_rgba_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv420_bgra_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XRGB8888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv420_argb_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XBGR8888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv420_abgr_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YUY2 ||
+        src_format == SDL_PIXELFORMAT_UYVY ||
+        src_format == SDL_PIXELFORMAT_YVYU) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuv422_rgb565_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_RGB24:
+            yuv422_rgb24_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv422_rgba_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv422_bgra_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XRGB8888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv422_argb_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XBGR8888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv422_abgr_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_NV12 ||
+        src_format == SDL_PIXELFORMAT_NV21) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuvnv12_rgb565_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_RGB24:
+            yuvnv12_rgb24_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuvnv12_rgba_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuvnv12_bgra_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XRGB8888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuvnv12_argb_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XBGR8888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuvnv12_abgr_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        default:
+            break;
+        }
+    }
+    return false;
+}
+#else
+static bool yuv_rgb_avx2(
+    SDL_PixelFormat src_format, SDL_PixelFormat dst_format,
+    Uint32 width, Uint32 height,
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+    Uint8 *rgb, Uint32 rgb_stride,
+    YCbCrType yuv_type)
+{
+    return false;
+}
+#endif
+
+#if defined(SDL_NEON_INTRINSICS) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+static bool yuv_rgb_neon(
+    SDL_PixelFormat src_format, SDL_PixelFormat dst_format,
+    Uint32 width, Uint32 height,
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+    Uint8 *rgb, Uint32 rgb_stride,
+    YCbCrType yuv_type)
+{
+    if (!SDL_HasNEON()) {
+        return false;
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YV12 ||
+        src_format == SDL_PIXELFORMAT_IYUV) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuv420_rgb565_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_RGB24:
+            yuv420_rgb24_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv420_rgba_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv420_bgra_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XRGB8888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv420_argb_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XBGR8888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv420_abgr_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YUY2 ||
+        src_format == SDL_PIXELFORMAT_UYVY ||
+        src_format == SDL_PIXELFORMAT_YVYU) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuv422_rgb565_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_RGB24:
+            yuv422_rgb24_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv422_rgba_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv422_bgra_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XRGB8888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv422_argb_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XBGR8888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv422_abgr_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_NV12 ||
+        src_format == SDL_PIXELFORMAT_NV21) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuvnv12_rgb565_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_RGB24:
+            yuvnv12_rgb24_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuvnv12_rgba_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuvnv12_bgra_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XRGB8888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuvnv12_argb_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XBGR8888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuvnv12_abgr_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        default:
+            break;
+        }
+    }
+    return false;
+}
+#else
+static bool yuv_rgb_neon(
+    SDL_PixelFormat src_format, SDL_PixelFormat dst_format,
+    Uint32 width, Uint32 height,
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+    Uint8 *rgb, Uint32 rgb_stride,
+    YCbCrType yuv_type)
+{
+    return false;
+}
+#endif
+
 #ifdef SDL_LSX_INTRINSICS
 static bool yuv_rgb_lsx(
     SDL_PixelFormat src_format, SDL_PixelFormat dst_format,
@@ -586,6 +824,82 @@ static bool yuv_rgb_std(
     return false;
 }
 
+static bool yuv_rgb(
+    SDL_PixelFormat src_format, SDL_PixelFormat dst_format,
+    Uint32 width, Uint32 height,
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+    Uint8 *rgb, Uint32 rgb_stride,
+    YCbCrType yuv_type)
+{
+    return yuv_rgb_avx2(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type) ||
+           yuv_rgb_sse(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type) ||
+           yuv_rgb_neon(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type) ||
+           yuv_rgb_lsx(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type) ||
+           yuv_rgb_std(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+}
+
+typedef struct YUVtoRGBBands
+{
+    SDL_PixelFormat src_format;
+    SDL_PixelFormat dst_format;
+    Uint32 width;
+    const Uint8 *y;
+    const Uint8 *u;
+    const Uint8 *v;
+    Uint32 y_stride;
+    Uint32 uv_stride;
+    int uv_rows_shift;
+    Uint8 *rgb;
+    Uint32 rgb_stride;
+    YCbCrType yuv_type;
+    SDL_AtomicInt unsupported;
+} YUVtoRGBBands;
+
+static void yuv_rgb_rows(void *userdata, int row, int num_rows)
+{
+    YUVtoRGBBands *bands = (YUVtoRGBBands *)userdata;
+    const size_t uv_offset = (size_t)(row >> bands->uv_rows_shift) * bands->uv_stride;
+
+    if (!yuv_rgb(bands->src_format, bands->dst_format, bands->width, num_rows,
+                 bands->y + (size_t)row * bands->y_stride, bands->u + uv_offset, bands->v + uv_offset,
+                 bands->y_stride, bands->uv_stride,
+                 bands->rgb + (size_t)row * bands->rgb_stride, bands->rgb_stride, bands->yuv_type)) {
+        SDL_SetAtomicInt(&bands->unsupported, 1);
+    }
+}
+
+// Converts bands of rows on several threads, returns false if it didn't convert anything
+static bool yuv_rgb_parallel(
+    SDL_PixelFormat src_format, SDL_PixelFormat dst_format,
+    Uint32 width, Uint32 height,
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+    Uint8 *rgb, Uint32 rgb_stride,
+    YCbCrType yuv_type)
+{
+    YUVtoRGBBands bands;
+
+    bands.src_format = src_format;
+    bands.dst_format = dst_format;
+    bands.width = width;
+    bands.y = y;
+    bands.u = u;
+    bands.v = v;
+    bands.y_stride = y_stride;
+    bands.uv_stride = uv_stride;
+    // The packed formats have chroma on every row, the others on every other row
+    bands.uv_rows_shift = (src_format == SDL_PIXELFORMAT_YUY2 || src_format == SDL_PIXELFORMAT_UYVY || src_format == SDL_PIXELFORMAT_YVYU) ? 0 : 1;
+    bands.rgb = rgb;
+    bands.rgb_stride = rgb_stride;
+    bands.yuv_type = yuv_type;
+    SDL_SetAtomicInt(&bands.unsupported, 0);
+
+    if (!SDL_ConvertRowsInParallel((int)width, (int)height, 2, yuv_rgb_rows, &bands)) {
+        return false;
+    }
+    // If there's no fast path, none of the bands converted anything
+    return !SDL_GetAtomicInt(&bands.unsupported);
+}
+
 bool SDL_ConvertPixels_YUV_to_RGB(int width, int height,
                                   SDL_PixelFormat src_format, SDL_Colorspace src_colorspace, SDL_PropertiesID src_properties, const void *src, int src_pitch,
                                   SDL_PixelFormat dst_format, SDL_Colorspace dst_colorspace, SDL_PropertiesID dst_properties, void *dst, int dst_pitch)
@@ -605,15 +919,11 @@ bool SDL_ConvertPixels_YUV_to_RGB(int width, int height,
         return false;
     }
 
-    if (yuv_rgb_sse(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
-        return true;
-    }
-
-    if (yuv_rgb_lsx(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
+    if (yuv_rgb_parallel(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
         return true;
     }
 
-    if (yuv_rgb_std(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
+    if (yuv_rgb(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
         return true;
     }
 
@@ -713,59 +1023,572 @@ static struct RGB2YUVFactors RGB2YUVFactorTables[] = {
     },
 };
 
-static bool SDL_ConvertPixels_XRGB8888_to_YUV(int width, int height, const void *src, int src_pitch, SDL_PixelFormat dst_format, void *dst, int dst_pitch, YCbCrType yuv_type)
+/* The factors are converted to 15-bit fixed point, which is used by both the C and the SIMD code,
+ * so the output doesn't depend on which CPU features are available.
+ */
+#define RGB2YUV_PRECISION 15
+
+typedef struct RGB2YUVParams
+{
+    Sint16 y[3]; // Rfactor, Gfactor, Bfactor
+    Sint16 u[3]; // Rfactor, Gfactor, Bfactor
+    Sint16 v[3]; // Rfactor, Gfactor, Bfactor
+    Sint16 y_offset;
+    Sint16 uv_offset;
+    int r_index; // byte offset of the red channel in a 32-bit source pixel
+    int g_index;
+    int b_index;
+} RGB2YUVParams;
+
+static void GetRGB2YUVParams(YCbCrType yuv_type, int uv_offset, const SDL_PixelFormatDetails *details, RGB2YUVParams *params)
+{
+    const struct RGB2YUVFactors *cvt = &RGB2YUVFactorTables[yuv_type];
+    int i;
+
+    for (i = 0; i < 3; ++i) {
+        params->y[i] = (Sint16)SDL_lroundf(cvt->y[i] * (1 << RGB2YUV_PRECISION));
+        params->u[i] = (Sint16)SDL_lroundf(cvt->u[i] * (1 << RGB2YUV_PRECISION));
+        params->v[i] = (Sint16)SDL_lroundf(cvt->v[i] * (1 << RGB2YUV_PRECISION));
+    }
+    params->y_offset = (Sint16)cvt->y_offset;
+    params->uv_offset = (Sint16)uv_offset;
+
+    if (details && details->bytes_per_pixel == 4 && details->Rbits == 8) {
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+        params->r_index = details->Rshift / 8;
+        params->g_index = details->Gshift / 8;
+        params->b_index = details->Bshift / 8;
+#else
+        params->r_index = 3 - details->Rshift / 8;
+        params->g_index = 3 - details->Gshift / 8;
+        params->b_index = 3 - details->Bshift / 8;
+#endif
+    } else {
+        params->r_index = 0;
+        params->g_index = 0;
+        params->b_index = 0;
+    }
+}
+
+#define RGB2YUV(factors, offset, r, g, b) ((((factors)[0] * (int)(r) + (factors)[1] * (int)(g) + (factors)[2] * (int)(b) + (1 << (RGB2YUV_PRECISION - 1))) >> RGB2YUV_PRECISION) + (offset))
+
+/* The SIMD row functions convert two source rows at a time, writing two rows of Y and one row of
+ * chroma averaged over each 2x2 block, and return the number of pixels they handled. The rest of
+ * the row is left for the C code. For the last row of an image with an odd height, both rows are
+ * the same, which gives the same result as averaging the 1x2 block.
+ */
+typedef int (*RGB8888ToYUVRowPairFunc)(const Uint8 *row0, const Uint8 *row1, int width, Uint8 *y0, Uint8 *y1, Uint8 *u, Uint8 *v, int uv_step, const RGB2YUVParams *params);
+typedef int (*XBGR2101010ToP010RowPairFunc)(const Uint8 *row0, const Uint8 *row1, int width, Uint16 *y0, Uint16 *y1, Uint16 *uv, const RGB2YUVParams *params);
+
+#if defined(SDL_SSE4_1_INTRINSICS) || defined(SDL_AVX2_INTRINSICS)
+// Pack the red and green channels of each pixel into 16-bit pairs, and the blue channel into the low 16 bits
+static void GetRGB8888ShuffleMasks(const RGB2YUVParams *params, Uint8 rg_mask[16], Uint8 b_mask[16])
 {
+    int i;
+
+    for (i = 0; i < 4; ++i) {
+        rg_mask[i * 4 + 0] = (Uint8)(i * 4 + params->r_index);
+        rg_mask[i * 4 + 1] = 0x80;
+        rg_mask[i * 4 + 2] = (Uint8)(i * 4 + params->g_index);
+        rg_mask[i * 4 + 3] = 0x80;
+        b_mask[i * 4 + 0] = (Uint8)(i * 4 + params->b_index);
+        b_mask[i * 4 + 1] = 0x80;
+        b_mask[i * 4 + 2] = 0x80;
+        b_mask[i * 4 + 3] = 0x80;
+    }
+}
+
+#define RGB2YUV_PAIR(a, b)  ((int)((Uint32)(Uint16)(a) | ((Uint32)(Uint16)(b) << 16)))
+#define RGB2YUV_ROUND(offset) (((offset) << RGB2YUV_PRECISION) + (1 << (RGB2YUV_PRECISION - 1)))
+#endif
+
+#ifdef SDL_SSE4_1_INTRINSICS
+#define RGB2YUV_SSE41(rg, b, factors_rg, factors_b, round) \
+    _mm_srai_epi32(_mm_add_epi32(_mm_add_epi32(_mm_madd_epi16(rg, factors_rg), _mm_madd_epi16(b, factors_b)), round), RGB2YUV_PRECISION)
+
+static int SDL_TARGETING("sse4.1") RGB8888_to_YUV_RowPair_SSE41(const Uint8 *row0, const Uint8 *row1, int width, Uint8 *y0, Uint8 *y1, Uint8 *u, Uint8 *v, int uv_step, const RGB2YUVParams *params)
+{
+    Uint8 rg_mask[16], b_mask[16];
+    GetRGB8888ShuffleMasks(params, rg_mask, b_mask);
+
+    const __m128i shuffle_rg = _mm_loadu_si128((const __m128i *)rg_mask);
+    const __m128i shuffle_b = _mm_loadu_si128((const __m128i *)b_mask);
+    const __m128i y_rg = _mm_set1_epi32(RGB2YUV_PAIR(params->y[0], params->y[1]));
+    const __m128i y_b = _mm_set1_epi32(RGB2YUV_PAIR(params->y[2], 0));
+    const __m128i u_rg = _mm_set1_epi32(RGB2YUV_PAIR(params->u[0], params->u[1]));
+    const __m128i u_b = _mm_set1_epi32(RGB2YUV_PAIR(params->u[2], 0));
+    const __m128i v_rg = _mm_set1_epi32(RGB2YUV_PAIR(params->v[0], params->v[1]));
+    const __m128i v_b = _mm_set1_epi32(RGB2YUV_PAIR(params->v[2], 0));
+    const __m128i y_round = _mm_set1_epi32(RGB2YUV_ROUND(params->y_offset));
+    const __m128i uv_round = _mm_set1_epi32(RGB2YUV_ROUND(params->uv_offset));
+    // U and V are packed into the low and high halves of a register, interleave them for NV12/NV21
+    const __m128i uv_order = (u < v) ? _mm_setr_epi8(0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15)
+                                     : _mm_setr_epi8(8, 0, 9, 1, 10, 2, 11, 3, 12, 4, 13, 5, 14, 6, 15, 7);
+    Uint8 *uv = SDL_min(u, v);
+    int x, i;
+
+    for (x = 0; x + 16 <= width; x += 16) {
+        __m128i rg0[4], b0[4], rg1[4], b1[4], luma[4], cu[2], cv[2];
+
+        for (i = 0; i < 4; ++i) {
+            const __m128i p = _mm_loadu_si128((const __m128i *)(row0 + i * 16));
+            rg0[i] = _mm_shuffle_epi8(p, shuffle_rg);
+            b0[i] = _mm_shuffle_epi8(p, shuffle_b);
+            luma[i] = RGB2YUV_SSE41(rg0[i], b0[i], y_rg, y_b, y_round);
+        }
+        _mm_storeu_si128((__m128i *)y0, _mm_packus_epi16(_mm_packs_epi32(luma[0], luma[1]), _mm_packs_epi32(luma[2], luma[3])));
+
+        for (i = 0; i < 4; ++i) {
+            const __m128i p = _mm_loadu_si128((const __m128i *)(row1 + i * 16));
+            rg1[i] = _mm_shuffle_epi8(p, shuffle_rg);
+            b1[i] = _mm_shuffle_epi8(p, shuffle_b);
+            luma[i] = RGB2YUV_SSE41(rg1[i], b1[i], y_rg, y_b, y_round);
+        }
+        _mm_storeu_si128((__m128i *)y1, _mm_packus_epi16(_mm_packs_epi32(luma[0], luma[1]), _mm_packs_epi32(luma[2], luma[3])));
+
+        for (i = 0; i < 2; ++i) {
+            // Sum the rows, then add horizontal neighbors and divide by 4, the channels never overflow 16 bits
+            __m128i rg = _mm_hadd_epi32(_mm_add_epi16(rg0[i * 2], rg1[i * 2]), _mm_add_epi16(rg0[i * 2 + 1], rg1[i * 2 + 1]));
+            __m128i b = _mm_hadd_epi32(_mm_add_epi16(b0[i * 2], b1[i * 2]), _mm_add_epi16(b0[i * 2 + 1], b1[i * 2 + 1]));
+            rg = _mm_srli_epi16(rg, 2);
+            b = _mm_srli_epi16(b, 2);
+            cu[i] = RGB2YUV_SSE41(rg, b, u_rg, u_b, uv_round);
+            cv[i] = RGB2YUV_SSE41(rg, b, v_rg, v_b, uv_round);
+        }
+        const __m128i chroma = _mm_packus_epi16(_mm_packs_epi32(cu[0], cu[1]), _mm_packs_epi32(cv[0], cv[1]));
+        if (uv_step == 1) {
+            _mm_storel_epi64((__m128i *)u, chroma);
+            _mm_storel_epi64((__m128i *)v, _mm_srli_si128(chroma, 8));
+            u += 8;
+            v += 8;
+        } else {
+            _mm_storeu_si128((__m128i *)uv, _mm_shuffle_epi8(chroma, uv_order));
+            uv += 16;
+        }
+
+        row0 += 64;
+        row1 += 64;
+        y0 += 16;
+        y1 += 16;
+    }
+    return x;
+}
+
+#define UNPACK_2101010_SSE41(p, rg, b)                                                             \
+    rg = _mm_or_si128(_mm_and_si128(p, mask_10), _mm_and_si128(_mm_slli_epi32(p, 6), mask_10_hi)); \
+    b = _mm_and_si128(_mm_srli_epi32(p, 20), mask_10)
+
+static int SDL_TARGETING("sse4.1") XBGR2101010_to_P010_RowPair_SSE41(const Uint8 *row0, const Uint8 *row1, int width, Uint16 *y0, Uint16 *y1, Uint16 *uv, const RGB2YUVParams *params)
+{
+    const __m128i mask_10 = _mm_set1_epi32(0x03ff);
+    const __m128i mask_10_hi = _mm_set1_epi32(0x03ff0000);
+    const __m128i max_10 = _mm_set1_epi16(0x03ff);
+    const __m128i y_rg = _mm_set1_epi32(RGB2YUV_PAIR(params->y[0], params->y[1]));
+    const __m128i y_b = _mm_set1_epi32(RGB2YUV_PAIR(params->y[2], 0));
+    const __m128i u_rg = _mm_set1_epi32(RGB2YUV_PAIR(params->u[0], params->u[1]));
+    const __m128i u_b = _mm_set1_epi32(RGB2YUV_PAIR(params->u[2], 0));
+    const __m128i v_rg = _mm_set1_epi32(RGB2YUV_PAIR(params->v[0], params->v[1]));
+    const __m128i v_b = _mm_set1_epi32(RGB2YUV_PAIR(params->v[2], 0));
+    const __m128i y_round = _mm_set1_epi32(RGB2YUV_ROUND(params->y_offset));
+    const __m128i uv_round = _mm_set1_epi32(RGB2YUV_ROUND(params->uv_offset));
+    int x, i;
+
+    for (x = 0; x + 8 <= width; x += 8) {
+        __m128i rg0[2], b0[2], rg1[2], b1[2], luma[2];
+
+        for (i = 0; i < 2; ++i) {
+            const __m128i p = _mm_loadu_si128((const __m128i *)(row0 + i * 16));
+            UNPACK_2101010_SSE41(p, rg0[i], b0[i]);
+            luma[i] = RGB2YUV_SSE41(rg0[i], b0[i], y_rg, y_b, y_round);
+        }
+        _mm_storeu_si128((__m128i *)y0, _mm_slli_epi16(_mm_min_epu16(_mm_packus_epi32(luma[0], luma[1]), max_10), 6));
+
+        for (i = 0; i < 2; ++i) {
+            const __m128i p = _mm_loadu_si128((const __m128i *)(row1 + i * 16));
+            UNPACK_2101010_SSE41(p, rg1[i], b1[i]);
+            luma[i] = RGB2YUV_SSE41(rg1[i], b1[i], y_rg, y_b, y_round);
+        }
+        _mm_storeu_si128((__m128i *)y1, _mm_slli_epi16(_mm_min_epu16(_mm_packus_epi32(luma[0], luma[1]), max_10), 6));
+
+        __m128i rg = _mm_hadd_epi32(_mm_add_epi16(rg0[0], rg1[0]), _mm_add_epi16(rg0[1], rg1[1]));
+        __m128i b = _mm_hadd_epi32(_mm_add_epi16(b0[0], b1[0]), _mm_add_epi16(b0[1], b1[1]));
+        rg = _mm_srli_epi16(rg, 2);
+        b = _mm_srli_epi16(b, 2);
+        __m128i chroma = _mm_packus_epi32(RGB2YUV_SSE41(rg, b, u_rg, u_b, uv_round), RGB2YUV_SSE41(rg, b, v_rg, v_b, uv_round));
+        chroma = _mm_slli_epi16(_mm_min_epu16(chroma, max_10), 6);
+        _mm_storeu_si128((__m128i *)uv, _mm_unpacklo_epi16(chroma, _mm_srli_si128(chroma, 8)));
+
+        row0 += 32;
+        row1 += 32;
+        y0 += 8;
+        y1 += 8;
+        uv += 8;
+    }
+    return x;
+}
+#endif // SDL_SSE4_1_INTRINSICS
+
+#ifdef SDL_AVX2_INTRINSICS
+#define RGB2YUV_AVX2(rg, b, factors_rg, factors_b, round) \
+    _mm256_srai_epi32(_mm256_add_epi32(_mm256_add_epi32(_mm256_madd_epi16(rg, factors_rg), _mm256_madd_epi16(b, factors_b)), round), RGB2YUV_PRECISION)
+
+static int SDL_TARGETING("avx2") RGB8888_to_YUV_RowPair_AVX2(const Uint8 *row0, const Uint8 *row1, int width, Uint8 *y0, Uint8 *y1, Uint8 *u, Uint8 *v, int uv_step, const RGB2YUVParams *params)
+{
+    Uint8 rg_mask[16], b_mask[16];
+    GetRGB8888ShuffleMasks(params, rg_mask, b_mask);
+
+    const __m256i shuffle_rg = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)rg_mask));
+    const __m256i shuffle_b = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)b_mask));
+    const __m256i y_rg = _mm256_set1_epi32(RGB2YUV_PAIR(params->y[0], params->y[1]));
+    const __m256i y_b = _mm256_set1_epi32(RGB2YUV_PAIR(params->y[2], 0));
+    const __m256i u_rg = _mm256_set1_epi32(RGB2YUV_PAIR(params->u[0], params->u[1]));
+    const __m256i u_b = _mm256_set1_epi32(RGB2YUV_PAIR(params->u[2], 0));
+    const __m256i v_rg = _mm256_set1_epi32(RGB2YUV_PAIR(params->v[0], params->v[1]));
+    const __m256i v_b = _mm256_set1_epi32(RGB2YUV_PAIR(params->v[2], 0));
+    const __m256i y_round = _mm256_set1_epi32(RGB2YUV_ROUND(params->y_offset));
+    const __m256i uv_round = _mm256_set1_epi32(RGB2YUV_ROUND(params->uv_offset));
+    // The packs work within 128-bit lanes, these put the 4 byte groups back in order
+    const __m256i lane_order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    const __m256i chroma_order = _mm256_setr_epi8(0, 1, 4, 5, 2, 3, 6, 7, 8, 9, 12, 13, 10, 11, 14, 15,
+                                                  0, 1, 4, 5, 2, 3, 6, 7, 8, 9, 12, 13, 10, 11, 14, 15);
+    Uint8 *uv = SDL_min(u, v);
+    int x, i;
+
+    for (x = 0; x + 32 <= width; x += 32) {
+        __m256i rg0[4], b0[4], rg1[4], b1[4], luma[4], cu[2], cv[2];
+        __m256i packed;
+
+        for (i = 0; i < 4; ++i) {
+            const __m256i p = _mm256_loadu_si256((const __m256i *)(row0 + i * 32));
+            rg0[i] = _mm256_shuffle_epi8(p, shuffle_rg);
+            b0[i] = _mm256_shuffle_epi8(p, shuffle_b);
+            luma[i] = RGB2YUV_AVX2(rg0[i], b0[i], y_rg, y_b, y_round);
+        }
+        packed = _mm256_packus_epi16(_mm256_packs_epi32(luma[0], luma[1]), _mm256_packs_epi32(luma[2], luma[3]));
+        _mm256_storeu_si256((__m256i *)y0, _mm256_permutevar8x32_epi32(packed, lane_order));
+
+        for (i = 0; i < 4; ++i) {
+            const __m256i p = _mm256_loadu_si256((const __m256i *)(row1 + i * 32));
+            rg1[i] = _mm256_shuffle_epi8(p, shuffle_rg);
+            b1[i] = _mm256_shuffle_epi8(p, shuffle_b);
+            luma[i] = RGB2YUV_AVX2(rg1[i], b1[i], y_rg, y_b, y_round);
+        }
+        packed = _mm256_packus_epi16(_mm256_packs_epi32(luma[0], luma[1]), _mm256_packs_epi32(luma[2], luma[3]));
+        _mm256_storeu_si256((__m256i *)y1, _mm256_permutevar8x32_epi32(packed, lane_order));
+
+        for (i = 0; i < 2; ++i) {
+            __m256i rg = _mm256_hadd_epi32(_mm256_add_epi16(rg0[i * 2], rg1[i * 2]), _mm256_add_epi16(rg0[i * 2 + 1], rg1[i * 2 + 1]));
+            __m256i b = _mm256_hadd_epi32(_mm256_add_epi16(b0[i * 2], b1[i * 2]), _mm256_add_epi16(b0[i * 2 + 1], b1[i * 2 + 1]));
+            rg = _mm256_srli_epi16(rg, 2);
+            b = _mm256_srli_epi16(b, 2);
+            cu[i] = RGB2YUV_AVX2(rg, b, u_rg, u_b, uv_round);
+            cv[i] = RGB2YUV_AVX2(rg, b, v_rg, v_b, uv_round);
+        }
+        // This leaves the 16 U values in the low lane and the 16 V values in the high lane
+        packed = _mm256_packus_epi16(_mm256_packs_epi32(cu[0], cu[1]), _mm256_packs_epi32(cv[0], cv[1]));
+        packed = _mm256_shuffle_epi8(_mm256_permutevar8x32_epi32(packed, lane_order), chroma_order);
+        const __m128i chroma_u = _mm256_castsi256_si128(packed);
+        const __m128i chroma_v = _mm256_extracti128_si256(packed, 1);
+        if (uv_step == 1) {
+            _mm_storeu_si128((__m128i *)u, chroma_u);
+            _mm_storeu_si128((__m128i *)v, chroma_v);
+            u += 16;
+            v += 16;
+        } else {
+            const __m128i first = (u < v) ? chroma_u : chroma_v;
+            const __m128i second = (u < v) ? chroma_v : chroma_u;
+            _mm_storeu_si128((__m128i *)uv, _mm_unpacklo_epi8(first, second));
+            _mm_storeu_si128((__m128i *)(uv + 16), _mm_unpackhi_epi8(first, second));
+            uv += 32;
+        }
+
+        row0 += 128;
+        row1 += 128;
+        y0 += 32;
+        y1 += 32;
+    }
+    return x;
+}
+
+#define UNPACK_2101010_AVX2(p, rg, b)                                                                         \
+    rg = _mm256_or_si256(_mm256_and_si256(p, mask_10), _mm256_and_si256(_mm256_slli_epi32(p, 6), mask_10_hi)); \
+    b = _mm256_and_si256(_mm256_srli_epi32(p, 20), mask_10)
+
+static int SDL_TARGETING("avx2") XBGR2101010_to_P010_RowPair_AVX2(const Uint8 *row0, const Uint8 *row1, int width, Uint16 *y0, Uint16 *y1, Uint16 *uv, const RGB2YUVParams *params)
+{
+    const __m256i mask_10 = _mm256_set1_epi32(0x03ff);
+    const __m256i mask_10_hi = _mm256_set1_epi32(0x03ff0000);
+    const __m256i max_10 = _mm256_set1_epi16(0x03ff);
+    const __m256i y_rg = _mm256_set1_epi32(RGB2YUV_PAIR(params->y[0], params->y[1]));
+    const __m256i y_b = _mm256_set1_epi32(RGB2YUV_PAIR(params->y[2], 0));
+    const __m256i u_rg = _mm256_set1_epi32(RGB2YUV_PAIR(params->u[0], params->u[1]));
+    const __m256i u_b = _mm256_set1_epi32(RGB2YUV_PAIR(params->u[2], 0));
+    const __m256i v_rg = _mm256_set1_epi32(RGB2YUV_PAIR(params->v[0], params->v[1]));
+    const __m256i v_b = _mm256_set1_epi32(RGB2YUV_PAIR(params->v[2], 0));
+    const __m256i y_round = _mm256_set1_epi32(RGB2YUV_ROUND(params->y_offset));
+    const __m256i uv_round = _mm256_set1_epi32(RGB2YUV_ROUND(params->uv_offset));
+    int x, i;
+
+    for (x = 0; x + 16 <= width; x += 16) {
+        __m256i rg0[2], b0[2], rg1[2], b1[2], luma[2];
+        __m256i packed;
+
+        for (i = 0; i < 2; ++i) {
+            const __m256i p = _mm256_loadu_si256((const __m256i *)(row0 + i * 32));
+            UNPACK_2101010_AVX2(p, rg0[i], b0[i]);
+            luma[i] = RGB2YUV_AVX2(rg0[i], b0[i], y_rg, y_b, y_round);
+        }
+        packed = _mm256_slli_epi16(_mm256_min_epu16(_mm256_packus_epi32(luma[0], luma[1]), max_10), 6);
+        _mm256_storeu_si256((__m256i *)y0, _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0)));
+
+        for (i = 0; i < 2; ++i) {
+            const __m256i p = _mm256_loadu_si256((const __m256i *)(row1 + i * 32));
+            UNPACK_2101010_AVX2(p, rg1[i], b1[i]);
+            luma[i] = RGB2YUV_AVX2(rg1[i], b1[i], y_rg, y_b, y_round);
+        }
+        packed = _mm256_slli_epi16(_mm256_min_epu16(_mm256_packus_epi32(luma[0], luma[1]), max_10), 6);
+        _mm256_storeu_si256((__m256i *)y1, _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0)));
+
+        __m256i rg = _mm256_hadd_epi32(_mm256_add_epi16(rg0[0], rg1[0]), _mm256_add_epi16(rg0[1], rg1[1]));
+        __m256i b = _mm256_hadd_epi32(_mm256_add_epi16(b0[0], b1[0]), _mm256_add_epi16(b0[1], b1[1]));
+        rg = _mm256_srli_epi16(rg, 2);
+        b = _mm256_srli_epi16(b, 2);
+        packed = _mm256_packus_epi32(RGB2YUV_AVX2(rg, b, u_rg, u_b, uv_round), RGB2YUV_AVX2(rg, b, v_rg, v_b, uv_round));
+        packed = _mm256_slli_epi16(_mm256_min_epu16(packed, max_10), 6);
+        packed = _mm256_unpacklo_epi16(packed, _mm256_srli_si256(packed, 8));
+        _mm256_storeu_si256((__m256i *)uv, _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0)));
+
+        row0 += 64;
+        row1 += 64;
+        y0 += 16;
+        y1 += 16;
+        uv += 16;
+    }
+    return x;
+}
+#endif // SDL_AVX2_INTRINSICS
+
+#if defined(SDL_NEON_INTRINSICS) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+static int16x8_t RGB2YUV_NEON(uint16x8_t r, uint16x8_t g, uint16x8_t b, const Sint16 factors[3], Sint16 offset)
+{
+    int32x4_t lo = vmull_n_s16(vreinterpret_s16_u16(vget_low_u16(r)), factors[0]);
+    int32x4_t hi = vmull_n_s16(vreinterpret_s16_u16(vget_high_u16(r)), factors[0]);
+    lo = vmlal_n_s16(lo, vreinterpret_s16_u16(vget_low_u16(g)), factors[1]);
+    hi = vmlal_n_s16(hi, vreinterpret_s16_u16(vget_high_u16(g)), factors[1]);
+    lo = vmlal_n_s16(lo, vreinterpret_s16_u16(vget_low_u16(b)), factors[2]);
+    hi = vmlal_n_s16(hi, vreinterpret_s16_u16(vget_high_u16(b)), factors[2]);
+    return vaddq_s16(vcombine_s16(vqrshrn_n_s32(lo, RGB2YUV_PRECISION), vqrshrn_n_s32(hi, RGB2YUV_PRECISION)), vdupq_n_s16(offset));
+}
+
+static int RGB8888_to_YUV_RowPair_NEON(const Uint8 *row0, const Uint8 *row1, int width, Uint8 *y0, Uint8 *y1, Uint8 *u, Uint8 *v, int uv_step, const RGB2YUVParams *params)
+{
+    const int r_index = params->r_index;
+    const int g_index = params->g_index;
+    const int b_index = params->b_index;
+    const bool u_first = (u < v);
+    Uint8 *uv = SDL_min(u, v);
+    int x;
+
+    for (x = 0; x + 16 <= width; x += 16) {
+        const uint8x16x4_t p0 = vld4q_u8(row0);
+        const uint8x16x4_t p1 = vld4q_u8(row1);
+        const uint8x16_t r0 = p0.val[r_index], g0 = p0.val[g_index], b0 = p0.val[b_index];
+        const uint8x16_t r1 = p1.val[r_index], g1 = p1.val[g_index], b1 = p1.val[b_index];
+
+        vst1q_u8(y0, vcombine_u8(vqmovun_s16(RGB2YUV_NEON(vmovl_u8(vget_low_u8(r0)), vmovl_u8(vget_low_u8(g0)), vmovl_u8(vget_low_u8(b0)), params->y, params->y_offset)),
+                                 vqmovun_s16(RGB2YUV_NEON(vmovl_u8(vget_high_u8(r0)), vmovl_u8(vget_high_u8(g0)), vmovl_u8(vget_high_u8(b0)), params->y, params->y_offset))));
+        vst1q_u8(y1, vcombine_u8(vqmovun_s16(RGB2YUV_NEON(vmovl_u8(vget_low_u8(r1)), vmovl_u8(vget_low_u8(g1)), vmovl_u8(vget_low_u8(b1)), params->y, params->y_offset)),
+                                 vqmovun_s16(RGB2YUV_NEON(vmovl_u8(vget_high_u8(r1)), vmovl_u8(vget_high_u8(g1)), vmovl_u8(vget_high_u8(b1)), params->y, params->y_offset))));
+
+        // Add horizontal neighbors in both rows and divide by 4
+        const uint16x8_t r = vshrq_n_u16(vpadalq_u8(vpaddlq_u8(r0), r1), 2);
+        const uint16x8_t g = vshrq_n_u16(vpadalq_u8(vpaddlq_u8(g0), g1), 2);
+        const uint16x8_t b = vshrq_n_u16(vpadalq_u8(vpaddlq_u8(b0), b1), 2);
+        const uint8x8_t cu = vqmovun_s16(RGB2YUV_NEON(r, g, b, params->u, params->uv_offset));
+        const uint8x8_t cv = vqmovun_s16(RGB2YUV_NEON(r, g, b, params->v, params->uv_offset));
+        if (uv_step == 1) {
+            vst1_u8(u, cu);
+            vst1_u8(v, cv);
+            u += 8;
+            v += 8;
+        } else {
+            uint8x8x2_t chroma;
+            chroma.val[0] = u_first ? cu : cv;
+            chroma.val[1] = u_first ? cv : cu;
+            vst2_u8(uv, chroma);
+            uv += 16;
+        }
+
+        row0 += 64;
+        row1 += 64;
+        y0 += 16;
+        y1 += 16;
+    }
+    return x;
+}
+
+static int XBGR2101010_to_P010_RowPair_NEON(const Uint8 *row0, const Uint8 *row1, int width, Uint16 *y0, Uint16 *y1, Uint16 *uv, const RGB2YUVParams *params)
+{
+    const uint32x4_t mask_10 = vdupq_n_u32(0x03ff);
+    const int16x8_t zero = vdupq_n_s16(0);
+    const int16x8_t max_10 = vdupq_n_s16(0x03ff);
+    int x;
+
+#define UNPACK_2101010_NEON(row, r, g, b)                                                              \
+    {                                                                                                  \
+        const uint32x4_t lo = vld1q_u32((const uint32_t *)(row));                                      \
+        const uint32x4_t hi = vld1q_u32((const uint32_t *)(row) + 4);                                  \
+        r = vcombine_u16(vmovn_u32(vandq_u32(lo, mask_10)), vmovn_u32(vandq_u32(hi, mask_10)));                   \
+        g = vcombine_u16(vmovn_u32(vandq_u32(vshrq_n_u32(lo, 10), mask_10)), vmovn_u32(vandq_u32(vshrq_n_u32(hi, 10), mask_10))); \
+        b = vcombine_u16(vmovn_u32(vandq_u32(vshrq_n_u32(lo, 20), mask_10)), vmovn_u32(vandq_u32(vshrq_n_u32(hi, 20), mask_10))); \
+    }
+#define CLAMP_P010_NEON(x) vshlq_n_u16(vreinterpretq_u16_s16(vminq_s16(vmaxq_s16(x, zero), max_10)), 6)
+
+    for (x = 0; x + 8 <= width; x += 8) {
+        uint16x8_t r0, g0, b0, r1, g1, b1;
+
+        UNPACK_2101010_NEON(row0, r0, g0, b0);
+        UNPACK_2101010_NEON(row1, r1, g1, b1);
+        vst1q_u16(y0, CLAMP_P010_NEON(RGB2YUV_NEON(r0, g0, b0, params->y, params->y_offset)));
+        vst1q_u16(y1, CLAMP_P010_NEON(RGB2YUV_NEON(r1, g1, b1, params->y, params->y_offset)));
+
+        // Add horizontal neighbors in both rows and divide by 4, the upper half is unused
+        const uint16x4_t r4 = vshrn_n_u32(vaddq_u32(vpaddlq_u16(r0), vpaddlq_u16(r1)), 2);
+        const uint16x4_t g4 = vshrn_n_u32(vaddq_u32(vpaddlq_u16(g0), vpaddlq_u16(g1)), 2);
+        const uint16x4_t b4 = vshrn_n_u32(vaddq_u32(vpaddlq_u16(b0), vpaddlq_u16(b1)), 2);
+        const uint16x8_t r = vcombine_u16(r4, r4);
+        const uint16x8_t g = vcombine_u16(g4, g4);
+        const uint16x8_t b = vcombine_u16(b4, b4);
+        uint16x4x2_t chroma;
+        chroma.val[0] = vget_low_u16(CLAMP_P010_NEON(RGB2YUV_NEON(r, g, b, params->u, params->uv_offset)));
+        chroma.val[1] = vget_low_u16(CLAMP_P010_NEON(RGB2YUV_NEON(r, g, b, params->v, params->uv_offset)));
+        vst2_u16(uv, chroma);
+
+        row0 += 32;
+        row1 += 32;
+        y0 += 8;
+        y1 += 8;
+        uv += 8;
+    }
+#undef UNPACK_2101010_NEON
+#undef CLAMP_P010_NEON
+    return x;
+}
+#endif // SDL_NEON_INTRINSICS
+
+static RGB8888ToYUVRowPairFunc GetRGB8888ToYUVRowPairFunc(void)
+{
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        return RGB8888_to_YUV_RowPair_AVX2;
+    }
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    if (SDL_HasSSE41()) {
+        return RGB8888_to_YUV_RowPair_SSE41;
+    }
+#endif
+#if defined(SDL_NEON_INTRINSICS) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    if (SDL_HasNEON()) {
+        return RGB8888_to_YUV_RowPair_NEON;
+    }
+#endif
+    return NULL;
+}
+
+static XBGR2101010ToP010RowPairFunc GetXBGR2101010ToP010RowPairFunc(void)
+{
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        return XBGR2101010_to_P010_RowPair_AVX2;
+    }
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    if (SDL_HasSSE41()) {
+        return XBGR2101010_to_P010_RowPair_SSE41;
+    }
+#endif
+#if defined(SDL_NEON_INTRINSICS) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    if (SDL_HasNEON()) {
+        return XBGR2101010_to_P010_RowPair_NEON;
+    }
+#endif
+    return NULL;
+}
+
+static bool IsRGB8888Format(SDL_PixelFormat format)
+{
+    switch (format) {
+    case SDL_PIXELFORMAT_XRGB8888:
+    case SDL_PIXELFORMAT_ARGB8888:
+    case SDL_PIXELFORMAT_XBGR8888:
+    case SDL_PIXELFORMAT_ABGR8888:
+    case SDL_PIXELFORMAT_RGBX8888:
+    case SDL_PIXELFORMAT_RGBA8888:
+    case SDL_PIXELFORMAT_BGRX8888:
+    case SDL_PIXELFORMAT_BGRA8888:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool SDL_ConvertPixels_RGB8888_to_YUV(int width, int height, SDL_PixelFormat src_format, const void *src, int src_pitch, SDL_PixelFormat dst_format, void *dst, int dst_pitch, YCbCrType yuv_type)
+{
+    const SDL_PixelFormatDetails *details = SDL_GetPixelFormatDetails(src_format);
     const int src_pitch_x_2 = src_pitch * 2;
-    const int height_half = height / 2;
-    const int height_remainder = (height & 0x1);
     const int width_half = width / 2;
     const int width_remainder = (width & 0x1);
+    int r_shift, g_shift, b_shift;
     int i, j;
+    RGB2YUVParams params;
 
-    const struct RGB2YUVFactors *cvt = &RGB2YUVFactorTables[yuv_type];
+    if (!details) {
+        return false;
+    }
+    r_shift = details->Rshift;
+    g_shift = details->Gshift;
+    b_shift = details->Bshift;
 
-#define MAKE_Y(r, g, b) (Uint8)SDL_clamp(((int)(cvt->y[0] * (r) + cvt->y[1] * (g) + cvt->y[2] * (b) + 0.5f) + cvt->y_offset), 0, 255)
-#define MAKE_U(r, g, b) (Uint8)SDL_clamp(((int)(cvt->u[0] * (r) + cvt->u[1] * (g) + cvt->u[2] * (b) + 0.5f) + 128), 0, 255)
-#define MAKE_V(r, g, b) (Uint8)SDL_clamp(((int)(cvt->v[0] * (r) + cvt->v[1] * (g) + cvt->v[2] * (b) + 0.5f) + 128), 0, 255)
+    GetRGB2YUVParams(yuv_type, 128, details, &params);
 
-#define READ_2x2_PIXELS                                                                                     \
-    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];                                                    \
-    const Uint32 p2 = ((const Uint32 *)curr_row)[2 * i + 1];                                                \
-    const Uint32 p3 = ((const Uint32 *)next_row)[2 * i];                                                    \
-    const Uint32 p4 = ((const Uint32 *)next_row)[2 * i + 1];                                                \
-    const Uint32 r = ((p1 & 0x00ff0000) + (p2 & 0x00ff0000) + (p3 & 0x00ff0000) + (p4 & 0x00ff0000)) >> 18; \
-    const Uint32 g = ((p1 & 0x0000ff00) + (p2 & 0x0000ff00) + (p3 & 0x0000ff00) + (p4 & 0x0000ff00)) >> 10; \
-    const Uint32 b = ((p1 & 0x000000ff) + (p2 & 0x000000ff) + (p3 & 0x000000ff) + (p4 & 0x000000ff)) >> 2;
+#define MAKE_Y(r, g, b) (Uint8)SDL_clamp(RGB2YUV(params.y, params.y_offset, r, g, b), 0, 255)
+#define MAKE_U(r, g, b) (Uint8)SDL_clamp(RGB2YUV(params.u, params.uv_offset, r, g, b), 0, 255)
+#define MAKE_V(r, g, b) (Uint8)SDL_clamp(RGB2YUV(params.v, params.uv_offset, r, g, b), 0, 255)
 
-#define READ_2x1_PIXELS                                             \
-    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];            \
-    const Uint32 p2 = ((const Uint32 *)next_row)[2 * i];            \
-    const Uint32 r = ((p1 & 0x00ff0000) + (p2 & 0x00ff0000)) >> 17; \
-    const Uint32 g = ((p1 & 0x0000ff00) + (p2 & 0x0000ff00)) >> 9;  \
-    const Uint32 b = ((p1 & 0x000000ff) + (p2 & 0x000000ff)) >> 1;
+#define CHANNEL(p, shift) (((p) >> (shift)) & 0xff)
 
-#define READ_1x2_PIXELS                                             \
-    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];            \
-    const Uint32 p2 = ((const Uint32 *)curr_row)[2 * i + 1];        \
-    const Uint32 r = ((p1 & 0x00ff0000) + (p2 & 0x00ff0000)) >> 17; \
-    const Uint32 g = ((p1 & 0x0000ff00) + (p2 & 0x0000ff00)) >> 9;  \
-    const Uint32 b = ((p1 & 0x000000ff) + (p2 & 0x000000ff)) >> 1;
+#define READ_2x2_PIXELS                                                                                                       \
+    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];                                                                      \
+    const Uint32 p2 = ((const Uint32 *)curr_row)[2 * i + 1];                                                                  \
+    const Uint32 p3 = ((const Uint32 *)next_row)[2 * i];                                                                      \
+    const Uint32 p4 = ((const Uint32 *)next_row)[2 * i + 1];                                                                  \
+    const Uint32 r = (CHANNEL(p1, r_shift) + CHANNEL(p2, r_shift) + CHANNEL(p3, r_shift) + CHANNEL(p4, r_shift)) >> 2; \
+    const Uint32 g = (CHANNEL(p1, g_shift) + CHANNEL(p2, g_shift) + CHANNEL(p3, g_shift) + CHANNEL(p4, g_shift)) >> 2; \
+    const Uint32 b = (CHANNEL(p1, b_shift) + CHANNEL(p2, b_shift) + CHANNEL(p3, b_shift) + CHANNEL(p4, b_shift)) >> 2;
+
+#define READ_2x1_PIXELS                                                 \
+    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];                \
+    const Uint32 p2 = ((const Uint32 *)next_row)[2 * i];                \
+    const Uint32 r = (CHANNEL(p1, r_shift) + CHANNEL(p2, r_shift)) >> 1; \
+    const Uint32 g = (CHANNEL(p1, g_shift) + CHANNEL(p2, g_shift)) >> 1; \
+    const Uint32 b = (CHANNEL(p1, b_shift) + CHANNEL(p2, b_shift)) >> 1;
 
 #define READ_1x1_PIXEL                                  \
     const Uint32 p = ((const Uint32 *)curr_row)[2 * i]; \
-    const Uint32 r = (p & 0x00ff0000) >> 16;            \
-    const Uint32 g = (p & 0x0000ff00) >> 8;             \
-    const Uint32 b = (p & 0x000000ff);
+    const Uint32 r = CHANNEL(p, r_shift);               \
+    const Uint32 g = CHANNEL(p, g_shift);               \
+    const Uint32 b = CHANNEL(p, b_shift);
 
 #define READ_TWO_RGB_PIXELS                                  \
     const Uint32 p = ((const Uint32 *)curr_row)[2 * i];      \
-    const Uint32 r = (p & 0x00ff0000) >> 16;                 \
-    const Uint32 g = (p & 0x0000ff00) >> 8;                  \
-    const Uint32 b = (p & 0x000000ff);                       \
+    const Uint32 r = CHANNEL(p, r_shift);                    \
+    const Uint32 g = CHANNEL(p, g_shift);                    \
+    const Uint32 b = CHANNEL(p, b_shift);                    \
     const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i + 1]; \
-    const Uint32 r1 = (p1 & 0x00ff0000) >> 16;               \
-    const Uint32 g1 = (p1 & 0x0000ff00) >> 8;                \
-    const Uint32 b1 = (p1 & 0x000000ff);                     \
+    const Uint32 r1 = CHANNEL(p1, r_shift);                  \
+    const Uint32 g1 = CHANNEL(p1, g_shift);                  \
+    const Uint32 b1 = CHANNEL(p1, b_shift);                  \
     const Uint32 R = (r + r1) / 2;                           \
     const Uint32 G = (g + g1) / 2;                           \
     const Uint32 B = (b + b1) / 2;
@@ -778,13 +1601,14 @@ static bool SDL_ConvertPixels_XRGB8888_to_YUV(int width, int height, const void
     case SDL_PIXELFORMAT_NV12:
     case SDL_PIXELFORMAT_NV21:
     {
+        const RGB8888ToYUVRowPairFunc row_pair_func = GetRGB8888ToYUVRowPairFunc();
         const Uint8 *curr_row, *next_row;
 
-        Uint8 *plane_y;
+        Uint8 *plane_y, *next_y;
         Uint8 *plane_u;
         Uint8 *plane_v;
-        Uint8 *plane_interleaved_uv;
-        Uint32 y_stride, uv_stride, y_skip, uv_skip;
+        Uint32 y_stride, uv_stride;
+        int uv_step;
 
         if (!GetYUVPlanes(width, height, dst_format, dst, dst_pitch,
                           (const Uint8 **)&plane_y, (const Uint8 **)&plane_u, (const Uint8 **)&plane_v,
@@ -792,119 +1616,55 @@ static bool SDL_ConvertPixels_XRGB8888_to_YUV(int width, int height, const void
             return false;
         }
 
-        plane_interleaved_uv = (plane_y + height * y_stride);
-        y_skip = (y_stride - width);
-
-        curr_row = (const Uint8 *)src;
-
-        // Write Y plane
-        for (j = 0; j < height; j++) {
-            for (i = 0; i < width; i++) {
-                const Uint32 p1 = ((const Uint32 *)curr_row)[i];
-                const Uint32 r = (p1 & 0x00ff0000) >> 16;
-                const Uint32 g = (p1 & 0x0000ff00) >> 8;
-                const Uint32 b = (p1 & 0x000000ff);
-                *plane_y++ = MAKE_Y(r, g, b);
-            }
-            plane_y += y_skip;
-            curr_row += src_pitch;
+        if (dst_format == SDL_PIXELFORMAT_YV12 || dst_format == SDL_PIXELFORMAT_IYUV) {
+            uv_step = 1;
+        } else {
+            // U and V are interleaved
+            uv_step = 2;
         }
 
         curr_row = (const Uint8 *)src;
-        next_row = (const Uint8 *)src;
-        next_row += src_pitch;
 
-        if (dst_format == SDL_PIXELFORMAT_YV12 || dst_format == SDL_PIXELFORMAT_IYUV) {
-            // Write UV planes, not interleaved
-            uv_skip = (uv_stride - (width + 1) / 2);
-            for (j = 0; j < height_half; j++) {
-                for (i = 0; i < width_half; i++) {
-                    READ_2x2_PIXELS;
-                    *plane_u++ = MAKE_U(r, g, b);
-                    *plane_v++ = MAKE_V(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_2x1_PIXELS;
-                    *plane_u++ = MAKE_U(r, g, b);
-                    *plane_v++ = MAKE_V(r, g, b);
-                }
-                plane_u += uv_skip;
-                plane_v += uv_skip;
-                curr_row += src_pitch_x_2;
-                next_row += src_pitch_x_2;
-            }
-            if (height_remainder) {
-                for (i = 0; i < width_half; i++) {
-                    READ_1x2_PIXELS;
-                    *plane_u++ = MAKE_U(r, g, b);
-                    *plane_v++ = MAKE_V(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_1x1_PIXEL;
-                    *plane_u++ = MAKE_U(r, g, b);
-                    *plane_v++ = MAKE_V(r, g, b);
-                }
-                plane_u += uv_skip;
-                plane_v += uv_skip;
+        for (j = 0; j < height; j += 2) {
+            int x = 0;
+
+            // The last row of an odd height image is averaged with itself
+            if (j + 1 < height) {
+                next_row = curr_row + src_pitch;
+                next_y = plane_y + y_stride;
+            } else {
+                next_row = curr_row;
+                next_y = plane_y;
             }
-        } else if (dst_format == SDL_PIXELFORMAT_NV12) {
-            uv_skip = (uv_stride - ((width + 1) / 2) * 2);
-            for (j = 0; j < height_half; j++) {
-                for (i = 0; i < width_half; i++) {
-                    READ_2x2_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_2x1_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                }
-                plane_interleaved_uv += uv_skip;
-                curr_row += src_pitch_x_2;
-                next_row += src_pitch_x_2;
+
+            if (row_pair_func) {
+                x = row_pair_func(curr_row, next_row, width, plane_y, next_y, plane_u, plane_v, uv_step, &params);
             }
-            if (height_remainder) {
-                for (i = 0; i < width_half; i++) {
-                    READ_1x2_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_1x1_PIXEL;
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                }
+
+            // Write Y for the remaining pixels
+            for (i = x; i < width; i++) {
+                const Uint32 p1 = ((const Uint32 *)curr_row)[i];
+                const Uint32 p2 = ((const Uint32 *)next_row)[i];
+                plane_y[i] = MAKE_Y(CHANNEL(p1, r_shift), CHANNEL(p1, g_shift), CHANNEL(p1, b_shift));
+                next_y[i] = MAKE_Y(CHANNEL(p2, r_shift), CHANNEL(p2, g_shift), CHANNEL(p2, b_shift));
             }
-        } else /* dst_format == SDL_PIXELFORMAT_NV21 */ {
-            uv_skip = (uv_stride - ((width + 1) / 2) * 2);
-            for (j = 0; j < height_half; j++) {
-                for (i = 0; i < width_half; i++) {
-                    READ_2x2_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_2x1_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                }
-                plane_interleaved_uv += uv_skip;
-                curr_row += src_pitch_x_2;
-                next_row += src_pitch_x_2;
+
+            // Write U and V for the remaining pixels
+            for (i = x / 2; i < width_half; i++) {
+                READ_2x2_PIXELS;
+                plane_u[i * uv_step] = MAKE_U(r, g, b);
+                plane_v[i * uv_step] = MAKE_V(r, g, b);
             }
-            if (height_remainder) {
-                for (i = 0; i < width_half; i++) {
-                    READ_1x2_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_1x1_PIXEL;
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                }
+            if (width_remainder) {
+                READ_2x1_PIXELS;
+                plane_u[i * uv_step] = MAKE_U(r, g, b);
+                plane_v[i * uv_step] = MAKE_V(r, g, b);
             }
+
+            curr_row += src_pitch_x_2;
+            plane_y += 2 * y_stride;
+            plane_u += uv_stride;
+            plane_v += uv_stride;
         }
     } break;
 
@@ -995,9 +1755,9 @@ static bool SDL_ConvertPixels_XRGB8888_to_YUV(int width, int height, const void
 #undef MAKE_Y
 #undef MAKE_U
 #undef MAKE_V
+#undef CHANNEL
 #undef READ_2x2_PIXELS
 #undef READ_2x1_PIXELS
-#undef READ_1x2_PIXELS
 #undef READ_1x1_PIXEL
 #undef READ_TWO_RGB_PIXELS
 #undef READ_ONE_RGB_PIXEL
@@ -1006,18 +1766,18 @@ static bool SDL_ConvertPixels_XRGB8888_to_YUV(int width, int height, const void
 
 static bool SDL_ConvertPixels_XBGR2101010_to_P010(int width, int height, const void *src, int src_pitch, SDL_PixelFormat dst_format, void *dst, int dst_pitch, YCbCrType yuv_type)
 {
+    const XBGR2101010ToP010RowPairFunc row_pair_func = GetXBGR2101010ToP010RowPairFunc();
     const int src_pitch_x_2 = src_pitch * 2;
-    const int height_half = height / 2;
-    const int height_remainder = (height & 0x1);
     const int width_half = width / 2;
     const int width_remainder = (width & 0x1);
     int i, j;
+    RGB2YUVParams params;
 
-    const struct RGB2YUVFactors *cvt = &RGB2YUVFactorTables[yuv_type];
+    GetRGB2YUVParams(yuv_type, 512, NULL, &params);
 
-#define MAKE_Y(r, g, b) (Uint16)(((int)(cvt->y[0] * (r) + cvt->y[1] * (g) + cvt->y[2] * (b) + 0.5f) + cvt->y_offset) << 6)
-#define MAKE_U(r, g, b) (Uint16)(((int)(cvt->u[0] * (r) + cvt->u[1] * (g) + cvt->u[2] * (b) + 0.5f) + 512) << 6)
-#define MAKE_V(r, g, b) (Uint16)(((int)(cvt->v[0] * (r) + cvt->v[1] * (g) + cvt->v[2] * (b) + 0.5f) + 512) << 6)
+#define MAKE_Y(r, g, b) (Uint16)(SDL_clamp(RGB2YUV(params.y, params.y_offset, r, g, b), 0, 1023) << 6)
+#define MAKE_U(r, g, b) (Uint16)(SDL_clamp(RGB2YUV(params.u, params.uv_offset, r, g, b), 0, 1023) << 6)
+#define MAKE_V(r, g, b) (Uint16)(SDL_clamp(RGB2YUV(params.v, params.uv_offset, r, g, b), 0, 1023) << 6)
 
 #define READ_2x2_PIXELS                                                                                     \
     const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];                                                    \
@@ -1035,26 +1795,13 @@ static bool SDL_ConvertPixels_XBGR2101010_to_P010(int width, int height, const v
     const Uint32 g = ((p1 & 0x000ffc00) + (p2 & 0x000ffc00)) >> 11; \
     const Uint32 b = ((p1 & 0x3ff00000) + (p2 & 0x3ff00000)) >> 21;
 
-#define READ_1x2_PIXELS                                             \
-    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];            \
-    const Uint32 p2 = ((const Uint32 *)curr_row)[2 * i + 1];        \
-    const Uint32 r = ((p1 & 0x000003ff) + (p2 & 0x000003ff)) >> 1;  \
-    const Uint32 g = ((p1 & 0x000ffc00) + (p2 & 0x000ffc00)) >> 11; \
-    const Uint32 b = ((p1 & 0x3ff00000) + (p2 & 0x3ff00000)) >> 21;
-
-#define READ_1x1_PIXEL                                  \
-    const Uint32 p = ((const Uint32 *)curr_row)[2 * i]; \
-    const Uint32 r = (p & 0x000003ff);                  \
-    const Uint32 g = (p & 0x000ffc00) >> 10;            \
-    const Uint32 b = (p & 0x3ff00000) >> 20;
-
     const Uint8 *curr_row, *next_row;
 
-    Uint16 *plane_y;
+    Uint16 *plane_y, *next_y;
     Uint16 *plane_u;
     Uint16 *plane_v;
     Uint16 *plane_interleaved_uv;
-    Uint32 y_stride, uv_stride, y_skip, uv_skip;
+    Uint32 y_stride, uv_stride;
 
     if (!GetYUVPlanes(width, height, dst_format, dst, dst_pitch,
                       (const Uint8 **)&plane_y, (const Uint8 **)&plane_u, (const Uint8 **)&plane_v,
@@ -1065,55 +1812,49 @@ static bool SDL_ConvertPixels_XBGR2101010_to_P010(int width, int height, const v
     y_stride /= sizeof(Uint16);
     uv_stride /= sizeof(Uint16);
 
-    plane_interleaved_uv = (plane_y + height * y_stride);
-    y_skip = (y_stride - width);
+    plane_interleaved_uv = plane_u;
 
     curr_row = (const Uint8 *)src;
 
-    // Write Y plane
-    for (j = 0; j < height; j++) {
-        for (i = 0; i < width; i++) {
-            const Uint32 p1 = ((const Uint32 *)curr_row)[i];
-            const Uint32 r = (p1 >>  0) & 0x03ff;
-            const Uint32 g = (p1 >> 10) & 0x03ff;
-            const Uint32 b = (p1 >> 20) & 0x03ff;
-            *plane_y++ = MAKE_Y(r, g, b);
+    for (j = 0; j < height; j += 2) {
+        int x = 0;
+
+        // The last row of an odd height image is averaged with itself
+        if (j + 1 < height) {
+            next_row = curr_row + src_pitch;
+            next_y = plane_y + y_stride;
+        } else {
+            next_row = curr_row;
+            next_y = plane_y;
         }
-        plane_y += y_skip;
-        curr_row += src_pitch;
-    }
 
-    curr_row = (const Uint8 *)src;
-    next_row = (const Uint8 *)src;
-    next_row += src_pitch;
+        if (row_pair_func) {
+            x = row_pair_func(curr_row, next_row, width, plane_y, next_y, plane_interleaved_uv, &params);
+        }
 
-    uv_skip = (uv_stride - ((width + 1) / 2) * 2);
-    for (j = 0; j < height_half; j++) {
-        for (i = 0; i < width_half; i++) {
+        // Write Y for the remaining pixels
+        for (i = x; i < width; i++) {
+            const Uint32 p1 = ((const Uint32 *)curr_row)[i];
+            const Uint32 p2 = ((const Uint32 *)next_row)[i];
+            plane_y[i] = MAKE_Y((p1 >> 0) & 0x03ff, (p1 >> 10) & 0x03ff, (p1 >> 20) & 0x03ff);
+            next_y[i] = MAKE_Y((p2 >> 0) & 0x03ff, (p2 >> 10) & 0x03ff, (p2 >> 20) & 0x03ff);
+        }
+
+        // Write U and V for the remaining pixels
+        for (i = x / 2; i < width_half; i++) {
             READ_2x2_PIXELS;
-            *plane_interleaved_uv++ = MAKE_U(r, g, b);
-            *plane_interleaved_uv++ = MAKE_V(r, g, b);
+            plane_interleaved_uv[2 * i] = MAKE_U(r, g, b);
+            plane_interleaved_uv[2 * i + 1] = MAKE_V(r, g, b);
         }
         if (width_remainder) {
             READ_2x1_PIXELS;
-            *plane_interleaved_uv++ = MAKE_U(r, g, b);
-            *plane_interleaved_uv++ = MAKE_V(r, g, b);
+            plane_interleaved_uv[2 * i] = MAKE_U(r, g, b);
+            plane_interleaved_uv[2 * i + 1] = MAKE_V(r, g, b);
         }
-        plane_interleaved_uv += uv_skip;
+
         curr_row += src_pitch_x_2;
-        next_row += src_pitch_x_2;
-    }
-    if (height_remainder) {
-        for (i = 0; i < width_half; i++) {
-            READ_1x2_PIXELS;
-            *plane_interleaved_uv++ = MAKE_U(r, g, b);
-            *plane_interleaved_uv++ = MAKE_V(r, g, b);
-        }
-        if (width_remainder) {
-            READ_1x1_PIXEL;
-            *plane_interleaved_uv++ = MAKE_U(r, g, b);
-            *plane_interleaved_uv++ = MAKE_V(r, g, b);
-        }
+        plane_y += 2 * y_stride;
+        plane_interleaved_uv += uv_stride;
     }
 
 #undef MAKE_Y
@@ -1121,8 +1862,6 @@ static bool SDL_ConvertPixels_XBGR2101010_to_P010(int width, int height, const v
 #undef MAKE_V
 #undef READ_2x2_PIXELS
 #undef READ_2x1_PIXELS
-#undef READ_1x2_PIXELS
-#undef READ_1x1_PIXEL
     return true;
 }
 
@@ -1154,11 +1893,6 @@ bool SDL_ConvertPixels_RGB_to_YUV(int width, int height,
     }
 #endif
 
-    // ARGB8888 to FOURCC
-    if (src_format == SDL_PIXELFORMAT_ARGB8888 || src_format == SDL_PIXELFORMAT_XRGB8888) {
-        return SDL_ConvertPixels_XRGB8888_to_YUV(width, height, src, src_pitch, dst_format, dst, dst_pitch, yuv_type);
-    }
-
     if (dst_format == SDL_PIXELFORMAT_P010) {
         if (src_format == SDL_PIXELFORMAT_XBGR2101010) {
             return SDL_ConvertPixels_XBGR2101010_to_P010(width, height, src, src_pitch, dst_format, dst, dst_pitch, yuv_type);
@@ -1187,7 +1921,12 @@ bool SDL_ConvertPixels_RGB_to_YUV(int width, int height,
         return result;
     }
 
-    // not ARGB8888 to FOURCC : need an intermediate conversion
+    // 32-bit RGB to FOURCC
+    if (IsRGB8888Format(src_format)) {
+        return SDL_ConvertPixels_RGB8888_to_YUV(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch, yuv_type);
+    }
+
+    // not 32-bit RGB to FOURCC : need an intermediate conversion
     {
         bool result;
         void *tmp;
@@ -1206,7 +1945,7 @@ bool SDL_ConvertPixels_RGB_to_YUV(int width, int height,
         }
 
         // convert tmp/XRGB8888 to dst/FOURCC
-        result = SDL_ConvertPixels_XRGB8888_to_YUV(width, height, tmp, tmp_pitch, dst_format, dst, dst_pitch, yuv_type);
+        result = SDL_ConvertPixels_RGB8888_to_YUV(width, height, SDL_PIXELFORMAT_XRGB8888, tmp, tmp_pitch, dst_format, dst, dst_pitch, yuv_type);
         SDL_free(tmp);
         return result;
     }
@@ -2599,3 +3338,134 @@ bool SDL_ConvertPixels_YUV_to_YUV(int width, int height,
     return SDL_SetError("SDL not built with YUV support");
 #endif
 }
+
+#ifdef SDL_HAVE_YUV
+static bool IsYUVLayoutFormat(SDL_PixelFormat format)
+{
+    return format == SDL_PIXELFORMAT_YV12 || format == SDL_PIXELFORMAT_IYUV || format == SDL_PIXELFORMAT_NV12 || format == SDL_PIXELFORMAT_NV21 || IsPacked4Format(format);
+}
+
+// Map the center of a destination pixel to the source pixel it falls in
+static int GetStretchSourcePosition(int pos, int src_size, int dst_size)
+{
+    return (int)((((Sint64)pos * 2 + 1) * src_size) / ((Sint64)dst_size * 2));
+}
+#endif // SDL_HAVE_YUV
+
+bool SDL_GetYUVLayout(int width, int height, SDL_PixelFormat format, const void *yuv, int yuv_pitch, SDL_YUVLayout *layout)
+{
+#ifdef SDL_HAVE_YUV
+    const Uint8 *y, *u, *v;
+    Uint32 y_stride, uv_stride;
+
+    if (!IsYUVLayoutFormat(format) || !GetYUVPlanes(width, height, format, yuv, yuv_pitch, &y, &u, &v, &y_stride, &uv_stride)) {
+        return false;
+    }
+
+    layout->y = (Uint8 *)y;
+    layout->u = (Uint8 *)u;
+    layout->v = (Uint8 *)v;
+    layout->y_stride = (int)y_stride;
+    layout->uv_stride = (int)uv_stride;
+    if (IsPacked4Format(format)) {
+        layout->y_step = 2;
+        layout->uv_step = 4;
+        layout->uv_shift = 0;
+    } else if (format == SDL_PIXELFORMAT_NV12 || format == SDL_PIXELFORMAT_NV21) {
+        layout->y_step = 1;
+        layout->uv_step = 2;
+        layout->uv_shift = 1;
+    } else {
+        layout->y_step = 1;
+        layout->uv_step = 1;
+        layout->uv_shift = 1;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool SDL_CanStretchPixels_YUV(SDL_PixelFormat src_format, SDL_PixelFormat dst_format)
+{
+#ifdef SDL_HAVE_YUV
+    return IsYUVLayoutFormat(src_format) && IsYUVLayoutFormat(dst_format);
+#else
+    return false;
+#endif
+}
+
+bool SDL_StretchPixels_YUV(int src_w, int src_h, SDL_PixelFormat src_format, const void *src, int src_pitch,
+                           int dst_w, int dst_h, SDL_PixelFormat dst_format, void *dst, int dst_pitch)
+{
+#ifdef SDL_HAVE_YUV
+    SDL_YUVLayout s, d;
+    int *y_offsets, *uv_offsets;
+    const int dst_uv_w = (dst_w + 1) / 2;
+    int dst_uv_h;
+    int x, y;
+
+    if (!SDL_CanStretchPixels_YUV(src_format, dst_format)) {
+        return SDL_SetError("SDL_StretchPixels_YUV: Unsupported YUV conversion: %s -> %s", SDL_GetPixelFormatName(src_format), SDL_GetPixelFormatName(dst_format));
+    }
+    if (src_w <= 0 || src_h <= 0 || dst_w <= 0 || dst_h <= 0) {
+        return SDL_SetError("SDL_StretchPixels_YUV: Invalid size");
+    }
+    if (!SDL_GetYUVLayout(src_w, src_h, src_format, src, src_pitch, &s) ||
+        !SDL_GetYUVLayout(dst_w, dst_h, dst_format, dst, dst_pitch, &d)) {
+        return false;
+    }
+
+    // Each destination column samples the same source byte on every row
+    y_offsets = (int *)SDL_malloc((size_t)(dst_w + dst_uv_w) * sizeof(int));
+    if (!y_offsets) {
+        return false;
+    }
+    uv_offsets = y_offsets + dst_w;
+    for (x = 0; x < dst_w; ++x) {
+        y_offsets[x] = GetStretchSourcePosition(x, src_w, dst_w) * s.y_step;
+    }
+    // Chroma is taken from the source pixel under the first pixel that shares it
+    for (x = 0; x < dst_uv_w; ++x) {
+        uv_offsets[x] = (GetStretchSourcePosition(x * 2, src_w, dst_w) / 2) * s.uv_step;
+    }
+
+    for (y = 0; y < dst_h; ++y) {
+        const Uint8 *src_y = s.y + GetStretchSourcePosition(y, src_h, dst_h) * s.y_stride;
+        Uint8 *dst_y = d.y + y * d.y_stride;
+
+        if (d.y_step == 1) {
+            for (x = 0; x < dst_w; ++x) {
+                dst_y[x] = src_y[y_offsets[x]];
+            }
+        } else {
+            for (x = 0; x < dst_w; ++x) {
+                dst_y[x * 2] = src_y[y_offsets[x]];
+            }
+            if (dst_w & 1) {
+                // Packed formats store the last odd pixel twice
+                dst_y[dst_w * 2] = dst_y[(dst_w - 1) * 2];
+            }
+        }
+    }
+
+    dst_uv_h = (dst_h + d.uv_shift) >> d.uv_shift;
+    for (y = 0; y < dst_uv_h; ++y) {
+        const int src_row = GetStretchSourcePosition(y << d.uv_shift, src_h, dst_h) >> s.uv_shift;
+        const Uint8 *src_u = s.u + src_row * s.uv_stride;
+        const Uint8 *src_v = s.v + src_row * s.uv_stride;
+        Uint8 *dst_u = d.u + y * d.uv_stride;
+        Uint8 *dst_v = d.v + y * d.uv_stride;
+
+        for (x = 0; x < dst_uv_w; ++x) {
+            dst_u[x * d.uv_step] = src_u[uv_offsets[x]];
+            dst_v[x * d.uv_step] = src_v[uv_offsets[x]];
+        }
+    }
+
+    SDL_free(y_offsets);
+    return true;
+#else
+    return SDL_SetError("SDL not built with YUV support");
+#endif
+}
@@ -30,6 +30,26 @@ extern bool SDL_ConvertPixels_YUV_to_RGB(int width, int height, SDL_PixelFormat
 extern bool SDL_ConvertPixels_RGB_to_YUV(int width, int height, SDL_PixelFormat src_format, SDL_Colorspace src_colorspace, SDL_PropertiesID src_properties, const void *src, int src_pitch, SDL_PixelFormat dst_format, SDL_Colorspace dst_colorspace, SDL_PropertiesID dst_properties, void *dst, int dst_pitch);
 extern bool SDL_ConvertPixels_YUV_to_YUV(int width, int height, SDL_PixelFormat src_format, SDL_Colorspace src_colorspace, SDL_PropertiesID src_properties, const void *src, int src_pitch, SDL_PixelFormat dst_format, SDL_Colorspace dst_colorspace, SDL_PropertiesID dst_properties, void *dst, int dst_pitch);
 
+// The planes of an 8-bit YUV image, described so every layout can be walked the same way
+typedef struct SDL_YUVLayout
+{
+    Uint8 *y;
+    Uint8 *u;
+    Uint8 *v;
+    int y_stride;
+    int uv_stride;
+    int y_step;    // bytes between horizontally adjacent Y samples
+    int uv_step;   // bytes between horizontally adjacent U or V samples
+    int uv_shift;  // 1 if there is one chroma row for every two rows of pixels
+} SDL_YUVLayout;
+
+// Returns false if format isn't one of the 8-bit planar, semi-planar or packed 4:2:2 formats
+extern bool SDL_GetYUVLayout(int width, int height, SDL_PixelFormat format, const void *yuv, int yuv_pitch, SDL_YUVLayout *layout);
+
+// Nearest neighbor scaling between 8-bit YUV formats, converting the layout in the same pass
+extern bool SDL_CanStretchPixels_YUV(SDL_PixelFormat src_format, SDL_PixelFormat dst_format);
+extern bool SDL_StretchPixels_YUV(int src_w, int src_h, SDL_PixelFormat src_format, const void *src, int src_pitch, int dst_w, int dst_h, SDL_PixelFormat dst_format, void *dst, int dst_pitch);
+
 
 extern bool SDL_CalculateYUVSize(SDL_PixelFormat format, int w, int h, size_t *size, size_t *pitch);
 
@@ -33,12 +33,18 @@ my @src_formats = (
     "RGBA8888",
     "ABGR8888",
     "BGRA8888",
+    "RGB565",
+    "RGB24",
+    "ARGB2101010",
 );
 my @dst_formats = (
     "XRGB8888",
     "XBGR8888",
     "ARGB8888",
     "ABGR8888",
+    "RGB565",
+    "RGB24",
+    "ARGB2101010",
 );
 
 my %format_size = (
@@ -48,6 +54,9 @@ my %format_size = (
     "RGBA8888" => 4,
     "ABGR8888" => 4,
     "BGRA8888" => 4,
+    "RGB565" => 2,
+    "RGB24" => 3,
+    "ARGB2101010" => 4,
 );
 
 my %format_type = (
@@ -57,6 +66,14 @@ my %format_type = (
     "RGBA8888" => "Uint32",
     "ABGR8888" => "Uint32",
     "BGRA8888" => "Uint32",
+    "RGB565" => "Uint16",
+    "RGB24" => "Uint8",
+    "ARGB2101010" => "Uint32",
+);
+
+# Formats that are read and written a byte at a time, rather than as a pixel value
+my %format_is_bytes = (
+    "RGB24" => 1,
 );
 
 my %get_rgba_string_ignore_alpha = (
@@ -66,6 +83,9 @@ my %get_rgba_string_ignore_alpha = (
     "RGBA8888" => "__R = (Uint8)(__pixel_ >> 24); __G = (Uint8)(__pixel_ >> 16); __B = (Uint8)(__pixel_ >> 8);",
     "ABGR8888" => "__B = (Uint8)(__pixel_ >> 16); __G = (Uint8)(__pixel_ >> 8); __R = (Uint8)__pixel_;",
     "BGRA8888" => "__B = (Uint8)(__pixel_ >> 24); __G = (Uint8)(__pixel_ >> 16); __R = (Uint8)(__pixel_ >> 8);",
+    "RGB565" => "__R = SDL_expand_byte[5][__pixel_ >> 11]; __G = SDL_expand_byte[6][(__pixel_ >> 5) & 0x3F]; __B = SDL_expand_byte[5][__pixel_ & 0x1F];",
+    "RGB24" => "__R = PTR[0]; __G = PTR[1]; __B = PTR[2];",
+    "ARGB2101010" => "__R = (Uint8)(__pixel_ >> 22); __G = (Uint8)(__pixel_ >> 12); __B = (Uint8)(__pixel_ >> 2);",
 );
 
 my %get_rgba_string = (
@@ -75,8 +95,12 @@ my %get_rgba_string = (
     "RGBA8888" => $get_rgba_string_ignore_alpha{"RGBA8888"} . " __A = (Uint8)__pixel_;",
     "ABGR8888" => $get_rgba_string_ignore_alpha{"ABGR8888"} . " __A = (Uint8)(__pixel_ >> 24);",
     "BGRA8888" => $get_rgba_string_ignore_alpha{"BGRA8888"} . " __A = (Uint8)__pixel_;",
+    "RGB565" => $get_rgba_string_ignore_alpha{"RGB565"},
+    "RGB24" => $get_rgba_string_ignore_alpha{"RGB24"},
+    "ARGB2101010" => $get_rgba_string_ignore_alpha{"ARGB2101010"} . " __A = SDL_expand_byte[2][__pixel_ >> 30];",
 );
 
+# These match the conversions done by SDL_Blit_Slow()
 my %set_rgba_string = (
     "XRGB8888" => "__pixel_ = (__R << 16) | (__G << 8) | __B;",
     "XBGR8888" => "__pixel_ = (__B << 16) | (__G << 8) | __R;",
@@ -84,6 +108,26 @@ my %set_rgba_string = (
     "RGBA8888" => "__pixel_ = (__R << 24) | (__G << 16) | (__B << 8) | __A;",
     "ABGR8888" => "__pixel_ = (__A << 24) | (__B << 16) | (__G << 8) | __R;",
     "BGRA8888" => "__pixel_ = (__B << 24) | (__G << 16) | (__R << 8) | __A;",
+    "RGB565" => "__pixel_ = ((__R >> 3) << 11) | ((__G >> 2) << 5) | (__B >> 3);",
+    "RGB24" => "PTR[0] = (Uint8)__R; PTR[1] = (Uint8)__G; PTR[2] = (Uint8)__B;",
+    "ARGB2101010" => "__pixel_ = (((__A * 3) / 255) << 30) | ((__R ? ((__R << 2) | 0x3) : 0) << 20) | ((__G ? ((__G << 2) | 0x3) : 0) << 10) | (__B ? ((__B << 2) | 0x3) : 0);",
+);
+
+# The formats that have SIMD versions of the modulate and blend blitters
+my %format_is_8888 = (
+    "XRGB8888" => 1,
+    "XBGR8888" => 1,
+    "ARGB8888" => 1,
+    "RGBA8888" => 1,
+    "ABGR8888" => 1,
+    "BGRA8888" => 1,
+);
+
+# The instruction sets we generate SIMD blitters for, in order of preference
+my @simd_targets = (
+    [ "AVX2", "SDL_AVX2_INTRINSICS", "SDL_CPU_AVX2", "SDL_TARGETING(\"avx2\") " ],
+    [ "SSE41", "SDL_SSE4_1_INTRINSICS", "SDL_CPU_SSE41", "SDL_TARGETING(\"sse4.1\") " ],
+    [ "NEON", "SDL_BLIT_AUTO_NEON", "SDL_CPU_NEON", "" ],
 );
 
 sub open_file {
@@ -170,11 +214,23 @@ sub output_copyfuncname
     print FILE "$suffix";
 }
 
+sub get_pixel_var
+{
+    my $prefix = shift;
+
+    if ( $prefix eq "" ) {
+        return "pixelvalue";
+    }
+    return "${prefix}pixel";
+}
+
 sub get_rgba
 {
     my $prefix = shift;
     my $format = shift;
     my $ignore_alpha = shift;
+    my $pixel = get_pixel_var($prefix);
+    my $ptr = ($prefix eq "") ? "src" : $prefix;
 
     my $string;
     if ($ignore_alpha) {
@@ -183,19 +239,12 @@ sub get_rgba
         $string = $get_rgba_string{$format};
     }
 
+    $string =~ s/__pixel_/$pixel/g;
     $string =~ s/__/$prefix/g;
-    if ( $prefix eq "" ) {
-        $string =~ s/_/value/g;
-    } else {
-        $string =~ s/_//g;
-    }
-    if ( $prefix ne "" ) {
-        print FILE <<__EOF__;
-            ${prefix}pixel = *$prefix;
-__EOF__
-    } else {
+    $string =~ s/PTR/$ptr/g;
+    if ( !$format_is_bytes{$format} ) {
         print FILE <<__EOF__;
-            pixelvalue = *src;
+            $pixel = *$ptr;
 __EOF__
     }
     print FILE <<__EOF__;
@@ -207,18 +256,23 @@ sub set_rgba
 {
     my $prefix = shift;
     my $format = shift;
-    my $suffix = "";
+    my $pixel = get_pixel_var($prefix);
     my $string = $set_rgba_string{$format};
+
+    $string =~ s/__pixel_/$pixel/g;
     $string =~ s/__/$prefix/g;
-    if ( $prefix eq "" ) {
-        $suffix = "value";
-        $string =~ s/_/value/g;
-    } else {
-        $string =~ s/_//g;
-    }
+    $string =~ s/PTR/dst/g;
     print FILE <<__EOF__;
             $string
-            *dst = ${prefix}pixel${suffix};
+__EOF__
+    if ( $format_is_bytes{$format} ) {
+        return;
+    }
+    if ( $format_type{$format} ne "Uint32" ) {
+        $pixel = "($format_type{$format})$pixel";
+    }
+    print FILE <<__EOF__;
+            *dst = $pixel;
 __EOF__
 }
 
@@ -240,9 +294,17 @@ sub output_copycore
     if (!$modulate && !$blend) {
         # Nice and easy...
         if ( $src eq $dst ) {
-            print FILE <<__EOF__;
+            if ( $format_is_bytes{$src} ) {
+                print FILE <<__EOF__;
+            dst[0] = src[0];
+            dst[1] = src[1];
+            dst[2] = src[2];
+__EOF__
+            } else {
+                print FILE <<__EOF__;
             *dst = *src;
 __EOF__
+            }
             return;
         }
 
@@ -251,7 +313,7 @@ __EOF__
         $sa =~ s/[XA8]//g;
         $da = $dst;
         $da =~ s/[XA8]//g;
-        if ($sa eq $da) {
+        if ($format_is_8888{$src} && $format_is_8888{$dst} && $sa eq $da) {
             if ($dst_has_alpha && $src_has_alpha) {
                 $da = substr $dst, 0, 1;
                 if ($da eq "A") {
@@ -480,6 +542,8 @@ sub output_copyfunc
     my $ignore_dst_alpha = !$dst_has_alpha && !$blend;
 
     my $src_has_alpha = ($src =~ /A/) ? 1 : 0;
+    my $src_step = $format_is_bytes{$src} ? "src += $format_size{$src}" : "++src";
+    my $dst_step = $format_is_bytes{$dst} ? "dst += $format_size{$dst}" : "++dst";
 
     my $is_modulateA_done = 0;
     my $A_is_const_FF = 0;
@@ -490,7 +554,7 @@ sub output_copyfunc
 
     $sa =~ s/[XA8]//g;
     $da =~ s/[XA8]//g;
-    $matching_colors = (!$modulate && !$blend && ($sa eq $da)) ? 1 : 0;
+    $matching_colors = (!$modulate && !$blend && $format_is_8888{$src} && $format_is_8888{$dst} && ($sa eq $da)) ? 1 : 0;
 
     output_copyfuncname("static void", $src, $dst, $modulate, $blend, $scale, 1, "\n");
     print FILE <<__EOF__;
@@ -514,9 +578,11 @@ __EOF__
         }
     }
     if ( $blend ) {
-        print FILE <<__EOF__;
+        if (!$format_is_bytes{$src}) {
+            print FILE <<__EOF__;
     Uint32 srcpixel;
 __EOF__
+        }
         if (!$ignore_dst_alpha && !$src_has_alpha) {
             if ($modulate){
                 $is_modulateA_done = 1;
@@ -534,9 +600,11 @@ __EOF__
     Uint32 srcR, srcG, srcB, srcA;
 __EOF__
         }
-        print FILE <<__EOF__;
+        if (!$format_is_bytes{$dst}) {
+            print FILE <<__EOF__;
     Uint32 dstpixel;
 __EOF__
+        }
         if ($dst_has_alpha) {
             print FILE <<__EOF__;
     Uint32 dstR, dstG, dstB, dstA;
@@ -547,9 +615,11 @@ __EOF__
 __EOF__
         }
     } elsif ( $modulate || $src ne $dst ) {
-        print FILE <<__EOF__;
+        if (!$format_is_bytes{$src} || !$format_is_bytes{$dst}) {
+            print FILE <<__EOF__;
     Uint32 pixelvalue;
 __EOF__
+        }
         if ( !$ignore_dst_alpha && !$src_has_alpha ) {
             if ( $modulate ) {
                 $is_modulateA_done = 1;
@@ -608,7 +678,7 @@ __EOF__
         output_copycore($src, $dst, $modulate, $blend, $is_modulateA_done, $A_is_const_FF);
         print FILE <<__EOF__;
             posx += incx;
-            ++dst;
+            $dst_step;
         }
         posy += incy;
         info->dst += info->dst_pitch;
@@ -625,8 +695,8 @@ __EOF__
 __EOF__
         output_copycore($src, $dst, $modulate, $blend, $is_modulateA_done, $A_is_const_FF);
         print FILE <<__EOF__;
-            ++src;
-            ++dst;
+            $src_step;
+            $dst_step;
         }
         info->src += info->src_pitch;
         info->dst += info->dst_pitch;
@@ -660,6 +730,562 @@ sub output_copyinc_h
 __EOF__
 }
 
+sub output_simdkernels
+{
+    print FILE <<'__EOF__';
+#if defined(SDL_NEON_INTRINSICS) && (__ARM_ARCH >= 8) && (defined(__aarch64__) || defined(_M_ARM64)) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+#define SDL_BLIT_AUTO_NEON
+#endif
+
+#if defined(SDL_SSE4_1_INTRINSICS) || defined(SDL_AVX2_INTRINSICS) || defined(SDL_BLIT_AUTO_NEON)
+
+/* The SIMD blitters handle the modulate and blend combinations of all the
+ * 8888 formats above. They shuffle the source pixels into the destination
+ * layout and then work on four channels at once, treating the destination
+ * alpha (or unused) byte as the alpha channel. The results match the scalar
+ * blitters exactly.
+ *
+ * The constants are laid out for four pixels (16 bytes), or for two pixels
+ * once they are widened to 16-bit lanes.
+ */
+typedef struct
+{
+    Uint8 convert[16];      // Byte shuffle from the source to the destination layout
+    Uint8 alpha_splat[16];  // 16-bit lane shuffle that copies alpha to all four channels
+    Uint16 alpha_lane[8];   // 0xFF in the alpha lane
+    Uint16 modulate[8];     // The modulation factor of each channel
+    Uint32 opaque[4];       // The alpha byte, if the source has no alpha
+    Uint32 keep_dst[4];     // The destination bytes that the blend mode leaves alone
+    Uint32 clear[4];        // The unused byte, if the destination has no alpha
+    int blend;
+    bool premultiply;
+} SDL_Blit8888SIMDInfo;
+
+static void SDL_Setup8888SIMD(const SDL_BlitInfo *info, SDL_Blit8888SIMDInfo *simd)
+{
+    const SDL_PixelFormatDetails *src_fmt = info->src_fmt;
+    const SDL_PixelFormatDetails *dst_fmt = info->dst_fmt;
+    const int flags = info->flags;
+    // The byte that isn't R, G or B, whether or not it holds alpha
+    const int src_alpha = (48 - src_fmt->Rshift - src_fmt->Gshift - src_fmt->Bshift) >> 3;
+    const int dst_alpha = (48 - dst_fmt->Rshift - dst_fmt->Gshift - dst_fmt->Bshift) >> 3;
+    const Uint32 alpha = 0xFFu << (dst_alpha * 8);
+    Uint16 modulate[4];
+    Uint32 keep_dst = 0;
+    Uint32 clear = 0;
+    int i, j;
+
+    simd->blend = (flags & SDL_COPY_BLEND_MASK);
+    simd->premultiply = (flags & (SDL_COPY_BLEND | SDL_COPY_ADD)) != 0;
+    if (!dst_fmt->Amask) {
+        clear = alpha;
+    } else if (simd->blend != SDL_COPY_BLEND && simd->blend != SDL_COPY_BLEND_PREMULTIPLIED) {
+        keep_dst = alpha;
+    }
+
+    modulate[dst_fmt->Rshift >> 3] = (flags & SDL_COPY_MODULATE_COLOR) ? (Uint16)info->r : 255;
+    modulate[dst_fmt->Gshift >> 3] = (flags & SDL_COPY_MODULATE_COLOR) ? (Uint16)info->g : 255;
+    modulate[dst_fmt->Bshift >> 3] = (flags & SDL_COPY_MODULATE_COLOR) ? (Uint16)info->b : 255;
+    modulate[dst_alpha] = (flags & SDL_COPY_MODULATE_ALPHA) ? (Uint16)info->a : 255;
+
+    for (i = 0; i < 4; ++i) {
+        Uint8 *convert = &simd->convert[i * 4];
+
+        convert[dst_fmt->Rshift >> 3] = (Uint8)(i * 4 + (src_fmt->Rshift >> 3));
+        convert[dst_fmt->Gshift >> 3] = (Uint8)(i * 4 + (src_fmt->Gshift >> 3));
+        convert[dst_fmt->Bshift >> 3] = (Uint8)(i * 4 + (src_fmt->Bshift >> 3));
+        // Shuffle indices with the high bit set produce zero
+        convert[dst_alpha] = src_fmt->Amask ? (Uint8)(i * 4 + src_alpha) : 0x80;
+
+        simd->opaque[i] = src_fmt->Amask ? 0 : alpha;
+        simd->keep_dst[i] = keep_dst;
+        simd->clear[i] = clear;
+    }
+    for (i = 0; i < 2; ++i) {
+        for (j = 0; j < 4; ++j) {
+            simd->alpha_splat[i * 8 + j * 2] = (Uint8)(i * 8 + dst_alpha * 2);
+            simd->alpha_splat[i * 8 + j * 2 + 1] = 0x80;
+            simd->alpha_lane[i * 4 + j] = (j == dst_alpha) ? 0xFF : 0;
+            simd->modulate[i * 4 + j] = modulate[j];
+        }
+    }
+}
+
+#define SDL_BLIT_AUTO_GATHER_SIZE 64
+
+// Copies the pixels sampled by a scaled blit into a buffer, so they can be blended like an unscaled row
+static void SDL_Gather8888(const Uint32 *src, Uint32 *buffer, int count, Uint64 *posx, Uint64 incx)
+{
+    Uint64 x = *posx;
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        buffer[i] = src[x >> 16];
+        x += incx;
+    }
+    *posx = x;
+}
+
+/* Runs ROW(src, dst, n) over every row of the blit, gathering the source
+ * pixels of scaled blits into a buffer first
+ */
+#define SDL_BLIT_AUTO_8888_ROWS(info, scale, ROW)                                      \
+    if (scale) {                                                                       \
+        Uint32 buffer[SDL_BLIT_AUTO_GATHER_SIZE];                                      \
+        const Uint64 incy = ((Uint64)info->src_h << 16) / info->dst_h;                 \
+        const Uint64 incx = ((Uint64)info->src_w << 16) / info->dst_w;                 \
+        Uint64 posy = incy / 2;                                                        \
+                                                                                       \
+        while (info->dst_h--) {                                                        \
+            const Uint32 *src = (const Uint32 *)(info->src + (posy >> 16) * info->src_pitch); \
+            Uint32 *dst = (Uint32 *)info->dst;                                         \
+            Uint64 posx = incx / 2;                                                    \
+            int n = info->dst_w;                                                       \
+                                                                                       \
+            while (n > 0) {                                                            \
+                const int count = SDL_min(n, SDL_BLIT_AUTO_GATHER_SIZE);               \
+                SDL_Gather8888(src, buffer, count, &posx, incx);                       \
+                ROW(buffer, dst, count);                                               \
+                dst += count;                                                          \
+                n -= count;                                                            \
+            }                                                                          \
+            posy += incy;                                                              \
+            info->dst += info->dst_pitch;                                              \
+        }                                                                              \
+    } else {                                                                           \
+        while (info->dst_h--) {                                                        \
+            ROW((const Uint32 *)info->src, (Uint32 *)info->dst, info->dst_w);          \
+            info->src += info->src_pitch;                                              \
+            info->dst += info->dst_pitch;                                              \
+        }                                                                              \
+    }
+
+#endif // SDL_SSE4_1_INTRINSICS || SDL_AVX2_INTRINSICS || SDL_BLIT_AUTO_NEON
+
+#ifdef SDL_SSE4_1_INTRINSICS
+
+typedef struct
+{
+    __m128i convert;
+    __m128i alpha_splat;
+    __m128i alpha_lane;
+    __m128i modulate;
+    __m128i opaque;
+    __m128i keep_dst;
+    __m128i clear;
+} SDL_Blit8888ConstantsSSE41;
+
+// out = (a * b) / 255 for each 16-bit lane, rounded like MULT_DIV_255
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") SDL_MultDiv255SSE41(__m128i a, __m128i b)
+{
+    __m128i x = _mm_add_epi16(_mm_mullo_epi16(a, b), _mm_set1_epi16(1));
+    return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+}
+
+SDL_FORCE_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit8888PixelsSSE41(__m128i src, __m128i dst, const SDL_Blit8888SIMDInfo *simd, const SDL_Blit8888ConstantsSSE41 *k, bool modulate, bool blend)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i all = _mm_set1_epi16(0xFF);
+    __m128i src_lo, src_hi, dst_lo, dst_hi, alpha_lo, alpha_hi, result;
+
+    src = _mm_or_si128(_mm_shuffle_epi8(src, k->convert), k->opaque);
+    src_lo = _mm_unpacklo_epi8(src, zero);
+    src_hi = _mm_unpackhi_epi8(src, zero);
+    if (modulate) {
+        src_lo = SDL_MultDiv255SSE41(src_lo, k->modulate);
+        src_hi = SDL_MultDiv255SSE41(src_hi, k->modulate);
+    }
+    if (!blend) {
+        return _mm_andnot_si128(k->clear, _mm_packus_epi16(src_lo, src_hi));
+    }
+
+    alpha_lo = _mm_shuffle_epi8(src_lo, k->alpha_splat);
+    alpha_hi = _mm_shuffle_epi8(src_hi, k->alpha_splat);
+    if (simd->premultiply) {
+        // The alpha channel itself is multiplied by 255
+        src_lo = SDL_MultDiv255SSE41(src_lo, _mm_or_si128(alpha_lo, k->alpha_lane));
+        src_hi = SDL_MultDiv255SSE41(src_hi, _mm_or_si128(alpha_hi, k->alpha_lane));
+    }
+    dst_lo = _mm_unpacklo_epi8(dst, zero);
+    dst_hi = _mm_unpackhi_epi8(dst, zero);
+
+    // The pack below clamps the results to 255
+    switch (simd->blend) {
+    case SDL_COPY_BLEND:
+    case SDL_COPY_BLEND_PREMULTIPLIED:
+        alpha_lo = _mm_xor_si128(alpha_lo, all);
+        alpha_hi = _mm_xor_si128(alpha_hi, all);
+        dst_lo = _mm_add_epi16(SDL_MultDiv255SSE41(alpha_lo, dst_lo), src_lo);
+        dst_hi = _mm_add_epi16(SDL_MultDiv255SSE41(alpha_hi, dst_hi), src_hi);
+        break;
+    case SDL_COPY_ADD:
+    case SDL_COPY_ADD_PREMULTIPLIED:
+        dst_lo = _mm_add_epi16(src_lo, dst_lo);
+        dst_hi = _mm_add_epi16(src_hi, dst_hi);
+        break;
+    case SDL_COPY_MOD:
+        dst_lo = SDL_MultDiv255SSE41(src_lo, dst_lo);
+        dst_hi = SDL_MultDiv255SSE41(src_hi, dst_hi);
+        break;
+    case SDL_COPY_MUL:
+        alpha_lo = _mm_xor_si128(alpha_lo, all);
+        alpha_hi = _mm_xor_si128(alpha_hi, all);
+        dst_lo = _mm_add_epi16(SDL_MultDiv255SSE41(src_lo, dst_lo), SDL_MultDiv255SSE41(dst_lo, alpha_lo));
+        dst_hi = _mm_add_epi16(SDL_MultDiv255SSE41(src_hi, dst_hi), SDL_MultDiv255SSE41(dst_hi, alpha_hi));
+        break;
+    default:
+        break;
+    }
+    result = _mm_packus_epi16(dst_lo, dst_hi);
+    result = _mm_blendv_epi8(result, dst, k->keep_dst);
+    return _mm_andnot_si128(k->clear, result);
+}
+
+SDL_FORCE_INLINE void SDL_TARGETING("sse4.1") SDL_Blit8888RowSSE41(const Uint32 *src, Uint32 *dst, int n, const SDL_Blit8888SIMDInfo *simd, const SDL_Blit8888ConstantsSSE41 *k, bool modulate, bool blend)
+{
+    for (; n >= 4; n -= 4) {
+        __m128i src128 = _mm_loadu_si128((const __m128i *)src);
+        __m128i dst128 = _mm_loadu_si128((const __m128i *)dst);
+        _mm_storeu_si128((__m128i *)dst, SDL_Blit8888PixelsSSE41(src128, dst128, simd, k, modulate, blend));
+        src += 4;
+        dst += 4;
+    }
+    if (n > 0) {
+        Uint32 src_tail[4] = { 0 };
+        Uint32 dst_tail[4] = { 0 };
+        __m128i src128, dst128;
+
+        SDL_memcpy(src_tail, src, n * sizeof(Uint32));
+        SDL_memcpy(dst_tail, dst, n * sizeof(Uint32));
+        src128 = _mm_loadu_si128((const __m128i *)src_tail);
+        dst128 = _mm_loadu_si128((const __m128i *)dst_tail);
+        _mm_storeu_si128((__m128i *)dst_tail, SDL_Blit8888PixelsSSE41(src128, dst128, simd, k, modulate, blend));
+        SDL_memcpy(dst, dst_tail, n * sizeof(Uint32));
+    }
+}
+
+SDL_FORCE_INLINE void SDL_TARGETING("sse4.1") SDL_Blit8888SSE41(SDL_BlitInfo *info, bool modulate, bool blend, bool scale)
+{
+    SDL_Blit8888SIMDInfo simd;
+    SDL_Blit8888ConstantsSSE41 k;
+
+    SDL_Setup8888SIMD(info, &simd);
+    k.convert = _mm_loadu_si128((const __m128i *)simd.convert);
+    k.alpha_splat = _mm_loadu_si128((const __m128i *)simd.alpha_splat);
+    k.alpha_lane = _mm_loadu_si128((const __m128i *)simd.alpha_lane);
+    k.modulate = _mm_loadu_si128((const __m128i *)simd.modulate);
+    k.opaque = _mm_loadu_si128((const __m128i *)simd.opaque);
+    k.keep_dst = _mm_loadu_si128((const __m128i *)simd.keep_dst);
+    k.clear = _mm_loadu_si128((const __m128i *)simd.clear);
+
+#define SDL_BLIT_ROW_SSE41(src, dst, n) SDL_Blit8888RowSSE41(src, dst, n, &simd, &k, modulate, blend)
+    SDL_BLIT_AUTO_8888_ROWS(info, scale, SDL_BLIT_ROW_SSE41)
+#undef SDL_BLIT_ROW_SSE41
+}
+
+#endif // SDL_SSE4_1_INTRINSICS
+
+#ifdef SDL_AVX2_INTRINSICS
+
+typedef struct
+{
+    __m256i convert;
+    __m256i alpha_splat;
+    __m256i alpha_lane;
+    __m256i modulate;
+    __m256i opaque;
+    __m256i keep_dst;
+    __m256i clear;
+} SDL_Blit8888ConstantsAVX2;
+
+// See SDL_MultDiv255SSE41
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") SDL_MultDiv255AVX2(__m256i a, __m256i b)
+{
+    __m256i x = _mm256_add_epi16(_mm256_mullo_epi16(a, b), _mm256_set1_epi16(1));
+    return _mm256_srli_epi16(_mm256_add_epi16(x, _mm256_srli_epi16(x, 8)), 8);
+}
+
+// See SDL_Blit8888PixelsSSE41, shuffles, unpacks and packs all work within 128-bit lanes
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit8888PixelsAVX2(__m256i src, __m256i dst, const SDL_Blit8888SIMDInfo *simd, const SDL_Blit8888ConstantsAVX2 *k, bool modulate, bool blend)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i all = _mm256_set1_epi16(0xFF);
+    __m256i src_lo, src_hi, dst_lo, dst_hi, alpha_lo, alpha_hi, result;
+
+    src = _mm256_or_si256(_mm256_shuffle_epi8(src, k->convert), k->opaque);
+    src_lo = _mm256_unpacklo_epi8(src, zero);
+    src_hi = _mm256_unpackhi_epi8(src, zero);
+    if (modulate) {
+        src_lo = SDL_MultDiv255AVX2(src_lo, k->modulate);
+        src_hi = SDL_MultDiv255AVX2(src_hi, k->modulate);
+    }
+    if (!blend) {
+        return _mm256_andnot_si256(k->clear, _mm256_packus_epi16(src_lo, src_hi));
+    }
+
+    alpha_lo = _mm256_shuffle_epi8(src_lo, k->alpha_splat);
+    alpha_hi = _mm256_shuffle_epi8(src_hi, k->alpha_splat);
+    if (simd->premultiply) {
+        src_lo = SDL_MultDiv255AVX2(src_lo, _mm256_or_si256(alpha_lo, k->alpha_lane));
+        src_hi = SDL_MultDiv255AVX2(src_hi, _mm256_or_si256(alpha_hi, k->alpha_lane));
+    }
+    dst_lo = _mm256_unpacklo_epi8(dst, zero);
+    dst_hi = _mm256_unpackhi_epi8(dst, zero);
+
+    switch (simd->blend) {
+    case SDL_COPY_BLEND:
+    case SDL_COPY_BLEND_PREMULTIPLIED:
+        alpha_lo = _mm256_xor_si256(alpha_lo, all);
+        alpha_hi = _mm256_xor_si256(alpha_hi, all);
+        dst_lo = _mm256_add_epi16(SDL_MultDiv255AVX2(alpha_lo, dst_lo), src_lo);
+        dst_hi = _mm256_add_epi16(SDL_MultDiv255AVX2(alpha_hi, dst_hi), src_hi);
+        break;
+    case SDL_COPY_ADD:
+    case SDL_COPY_ADD_PREMULTIPLIED:
+        dst_lo = _mm256_add_epi16(src_lo, dst_lo);
+        dst_hi = _mm256_add_epi16(src_hi, dst_hi);
+        break;
+    case SDL_COPY_MOD:
+        dst_lo = SDL_MultDiv255AVX2(src_lo, dst_lo);
+        dst_hi = SDL_MultDiv255AVX2(src_hi, dst_hi);
+        break;
+    case SDL_COPY_MUL:
+        alpha_lo = _mm256_xor_si256(alpha_lo, all);
+        alpha_hi = _mm256_xor_si256(alpha_hi, all);
+        dst_lo = _mm256_add_epi16(SDL_MultDiv255AVX2(src_lo, dst_lo), SDL_MultDiv255AVX2(dst_lo, alpha_lo));
+        dst_hi = _mm256_add_epi16(SDL_MultDiv255AVX2(src_hi, dst_hi), SDL_MultDiv255AVX2(dst_hi, alpha_hi));
+        break;
+    default:
+        break;
+    }
+    result = _mm256_packus_epi16(dst_lo, dst_hi);
+    result = _mm256_blendv_epi8(result, dst, k->keep_dst);
+    return _mm256_andnot_si256(k->clear, result);
+}
+
+SDL_FORCE_INLINE void SDL_TARGETING("avx2") SDL_Blit8888RowAVX2(const Uint32 *src, Uint32 *dst, int n, const SDL_Blit8888SIMDInfo *simd, const SDL_Blit8888ConstantsAVX2 *k, bool modulate, bool blend)
+{
+    for (; n >= 8; n -= 8) {
+        __m256i src256 = _mm256_loadu_si256((const __m256i *)src);
+        __m256i dst256 = _mm256_loadu_si256((const __m256i *)dst);
+        _mm256_storeu_si256((__m256i *)dst, SDL_Blit8888PixelsAVX2(src256, dst256, simd, k, modulate, blend));
+        src += 8;
+        dst += 8;
+    }
+    if (n > 0) {
+        Uint32 src_tail[8] = { 0 };
+        Uint32 dst_tail[8] = { 0 };
+        __m256i src256, dst256;
+
+        SDL_memcpy(src_tail, src, n * sizeof(Uint32));
+        SDL_memcpy(dst_tail, dst, n * sizeof(Uint32));
+        src256 = _mm256_loadu_si256((const __m256i *)src_tail);
+        dst256 = _mm256_loadu_si256((const __m256i *)dst_tail);
+        _mm256_storeu_si256((__m256i *)dst_tail, SDL_Blit8888PixelsAVX2(src256, dst256, simd, k, modulate, blend));
+        SDL_memcpy(dst, dst_tail, n * sizeof(Uint32));
+    }
+}
+
+SDL_FORCE_INLINE void SDL_TARGETING("avx2") SDL_Blit8888AVX2(SDL_BlitInfo *info, bool modulate, bool blend, bool scale)
+{
+    SDL_Blit8888SIMDInfo simd;
+    SDL_Blit8888ConstantsAVX2 k;
+
+    SDL_Setup8888SIMD(info, &simd);
+    k.convert = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)simd.convert));
+    k.alpha_splat = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)simd.alpha_splat));
+    k.alpha_lane = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)simd.alpha_lane));
+    k.modulate = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)simd.modulate));
+    k.opaque = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)simd.opaque));
+    k.keep_dst = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)simd.keep_dst));
+    k.clear = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)simd.clear));
+
+#define SDL_BLIT_ROW_AVX2(src, dst, n) SDL_Blit8888RowAVX2(src, dst, n, &simd, &k, modulate, blend)
+    SDL_BLIT_AUTO_8888_ROWS(info, scale, SDL_BLIT_ROW_AVX2)
+#undef SDL_BLIT_ROW_AVX2
+}
+
+#endif // SDL_AVX2_INTRINSICS
+
+#ifdef SDL_BLIT_AUTO_NEON
+
+typedef struct
+{
+    uint8x16_t convert;
+    uint8x16_t alpha_splat;
+    uint16x8_t alpha_lane;
+    uint16x8_t modulate;
+    uint8x16_t opaque;
+    uint8x16_t keep_dst;
+    uint8x16_t clear;
+} SDL_Blit8888ConstantsNEON;
+
+// See SDL_MultDiv255SSE41
+SDL_FORCE_INLINE uint16x8_t SDL_MultDiv255NEON(uint16x8_t a, uint16x8_t b)
+{
+    uint16x8_t x = vaddq_u16(vmulq_u16(a, b), vdupq_n_u16(1));
+    return vshrq_n_u16(vaddq_u16(x, vshrq_n_u16(x, 8)), 8);
+}
+
+SDL_FORCE_INLINE uint16x8_t SDL_SplatAlphaNEON(uint16x8_t v, uint8x16_t splat)
+{
+    return vreinterpretq_u16_u8(vqtbl1q_u8(vreinterpretq_u8_u16(v), splat));
+}
+
+// See SDL_Blit8888PixelsSSE41
+SDL_FORCE_INLINE uint8x16_t SDL_Blit8888PixelsNEON(uint8x16_t src, uint8x16_t dst, const SDL_Blit8888SIMDInfo *simd, const SDL_Blit8888ConstantsNEON *k, bool modulate, bool blend)
+{
+    const uint16x8_t all = vdupq_n_u16(0xFF);
+    uint16x8_t src_lo, src_hi, dst_lo, dst_hi, alpha_lo, alpha_hi;
+    uint8x16_t result;
+
+    src = vorrq_u8(vqtbl1q_u8(src, k->convert), k->opaque);
+    src_lo = vmovl_u8(vget_low_u8(src));
+    src_hi = vmovl_high_u8(src);
+    if (modulate) {
+        src_lo = SDL_MultDiv255NEON(src_lo, k->modulate);
+        src_hi = SDL_MultDiv255NEON(src_hi, k->modulate);
+    }
+    if (!blend) {
+        return vbicq_u8(vcombine_u8(vqmovn_u16(src_lo), vqmovn_u16(src_hi)), k->clear);
+    }
+
+    alpha_lo = SDL_SplatAlphaNEON(src_lo, k->alpha_splat);
+    alpha_hi = SDL_SplatAlphaNEON(src_hi, k->alpha_splat);
+    if (simd->premultiply) {
+        src_lo = SDL_MultDiv255NEON(src_lo, vorrq_u16(alpha_lo, k->alpha_lane));
+        src_hi = SDL_MultDiv255NEON(src_hi, vorrq_u16(alpha_hi, k->alpha_lane));
+    }
+    dst_lo = vmovl_u8(vget_low_u8(dst));
+    dst_hi = vmovl_high_u8(dst);
+
+    switch (simd->blend) {
+    case SDL_COPY_BLEND:
+    case SDL_COPY_BLEND_PREMULTIPLIED:
+        alpha_lo = veorq_u16(alpha_lo, all);
+        alpha_hi = veorq_u16(alpha_hi, all);
+        dst_lo = vaddq_u16(SDL_MultDiv255NEON(alpha_lo, dst_lo), src_lo);
+        dst_hi = vaddq_u16(SDL_MultDiv255NEON(alpha_hi, dst_hi), src_hi);
+        break;
+    case SDL_COPY_ADD:
+    case SDL_COPY_ADD_PREMULTIPLIED:
+        dst_lo = vaddq_u16(src_lo, dst_lo);
+        dst_hi = vaddq_u16(src_hi, dst_hi);
+        break;
+    case SDL_COPY_MOD:
+        dst_lo = SDL_MultDiv255NEON(src_lo, dst_lo);
+        dst_hi = SDL_MultDiv255NEON(src_hi, dst_hi);
+        break;
+    case SDL_COPY_MUL:
+        alpha_lo = veorq_u16(alpha_lo, all);
+        alpha_hi = veorq_u16(alpha_hi, all);
+        dst_lo = vaddq_u16(SDL_MultDiv255NEON(src_lo, dst_lo), SDL_MultDiv255NEON(dst_lo, alpha_lo));
+        dst_hi = vaddq_u16(SDL_MultDiv255NEON(src_hi, dst_hi), SDL_MultDiv255NEON(dst_hi, alpha_hi));
+        break;
+    default:
+        break;
+    }
+    result = vcombine_u8(vqmovn_u16(dst_lo), vqmovn_u16(dst_hi));
+    result = vbslq_u8(k->keep_dst, dst, result);
+    return vbicq_u8(result, k->clear);
+}
+
+SDL_FORCE_INLINE void SDL_Blit8888RowNEON(const Uint32 *src, Uint32 *dst, int n, const SDL_Blit8888SIMDInfo *simd, const SDL_Blit8888ConstantsNEON *k, bool modulate, bool blend)
+{
+    for (; n >= 4; n -= 4) {
+        uint8x16_t src128 = vld1q_u8((const Uint8 *)src);
+        uint8x16_t dst128 = vld1q_u8((const Uint8 *)dst);
+        vst1q_u8((Uint8 *)dst, SDL_Blit8888PixelsNEON(src128, dst128, simd, k, modulate, blend));
+        src += 4;
+        dst += 4;
+    }
+    if (n > 0) {
+        Uint32 src_tail[4] = { 0 };
+        Uint32 dst_tail[4] = { 0 };
+        uint8x16_t src128, dst128;
+
+        SDL_memcpy(src_tail, src, n * sizeof(Uint32));
+        SDL_memcpy(dst_tail, dst, n * sizeof(Uint32));
+        src128 = vld1q_u8((const Uint8 *)src_tail);
+        dst128 = vld1q_u8((const Uint8 *)dst_tail);
+        vst1q_u8((Uint8 *)dst_tail, SDL_Blit8888PixelsNEON(src128, dst128, simd, k, modulate, blend));
+        SDL_memcpy(dst, dst_tail, n * sizeof(Uint32));
+    }
+}
+
+SDL_FORCE_INLINE void SDL_Blit8888NEON(SDL_BlitInfo *info, bool modulate, bool blend, bool scale)
+{
+    SDL_Blit8888SIMDInfo simd;
+    SDL_Blit8888ConstantsNEON k;
+
+    SDL_Setup8888SIMD(info, &simd);
+    k.convert = vld1q_u8(simd.convert);
+    k.alpha_splat = vld1q_u8(simd.alpha_splat);
+    k.alpha_lane = vld1q_u16(simd.alpha_lane);
+    k.modulate = vld1q_u16(simd.modulate);
+    k.opaque = vreinterpretq_u8_u32(vld1q_u32(simd.opaque));
+    k.keep_dst = vreinterpretq_u8_u32(vld1q_u32(simd.keep_dst));
+    k.clear = vreinterpretq_u8_u32(vld1q_u32(simd.clear));
+
+#define SDL_BLIT_ROW_NEON(src, dst, n) SDL_Blit8888RowNEON(src, dst, n, &simd, &k, modulate, blend)
+    SDL_BLIT_AUTO_8888_ROWS(info, scale, SDL_BLIT_ROW_NEON)
+#undef SDL_BLIT_ROW_NEON
+}
+
+#endif // SDL_BLIT_AUTO_NEON
+
+__EOF__
+}
+
+sub output_simdfuncname
+{
+    my $prefix = shift;
+    my $target = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $scale = shift;
+    my $suffix = shift;
+
+    print FILE "${prefix}SDL_Blit_8888";
+    if ( $modulate ) {
+        print FILE "_Modulate";
+    }
+    if ( $blend ) {
+        print FILE "_Blend";
+    }
+    if ( $scale ) {
+        print FILE "_Scale";
+    }
+    print FILE "_$target$suffix";
+}
+
+sub output_simdfuncs
+{
+    output_simdkernels();
+    foreach my $simd (@simd_targets) {
+        my ($target, $guard, $cpu, $attribute) = @$simd;
+
+        print FILE "#ifdef $guard\n\n";
+        for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+            for (my $blend = 0; $blend <= 1; ++$blend) {
+                for (my $scale = 0; $scale <= 1; ++$scale) {
+                    if ( $modulate || $blend ) {
+                        my $args = join(", ", map { $_ ? "true" : "false" } ($modulate, $blend, $scale));
+                        output_simdfuncname("static void $attribute", $target, $modulate, $blend, $scale, "(SDL_BlitInfo *info)\n");
+                        print FILE <<__EOF__;
+{
+    SDL_Blit8888$target(info, $args);
+}
+
+__EOF__
+                    }
+                }
+            }
+        }
+        print FILE "#endif // $guard\n\n";
+    }
+}
+
 sub output_copyfunctable
 {
     print FILE <<__EOF__;
@@ -673,7 +1299,6 @@ __EOF__
                 for (my $blend = 0; $blend <= 1; ++$blend) {
                     for (my $scale = 0; $scale <= 1; ++$scale) {
                         if ( $modulate || $blend || $scale ) {
-                            print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
                             my $flags = "";
                             my $flag = "";
                             if ( $modulate ) {
@@ -703,6 +1328,16 @@ __EOF__
                             if ( $flags eq "" ) {
                                 $flags = "0";
                             }
+                            if ( ($modulate || $blend) && $format_is_8888{$src} && $format_is_8888{$dst} ) {
+                                foreach my $simd (@simd_targets) {
+                                    my ($target, $guard, $cpu) = @$simd;
+                                    print FILE "#ifdef $guard\n";
+                                    print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ($flags), $cpu,";
+                                    output_simdfuncname(" ", $target, $modulate, $blend, $scale, " },\n");
+                                    print FILE "#endif\n";
+                                }
+                            }
+                            print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
                             print FILE "($flags), SDL_CPU_ANY,";
                             output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n");
                         }
@@ -752,5 +1387,6 @@ for (my $i = 0; $i <= $#src_formats; ++$i) {
         output_copyfunc_c($src_formats[$i], $dst_formats[$j]);
     }
 }
+output_simdfuncs();
 output_copyfunctable();
 close_file("SDL_blit_auto.c");
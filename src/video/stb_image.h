@@ -976,10 +976,15 @@ typedef struct
 {
     int w;
     int h;
-    int pitch;
     stbi_uc *y;
-    stbi_uc *uv;
-} stbi__nv12;
+    stbi_uc *u;
+    stbi_uc *v;
+    int y_pitch;
+    int uv_pitch;
+    int y_step;   // bytes between Y samples, 2 for packed formats
+    int uv_step;  // bytes between U (or V) samples
+    int uv_vs;    // 2 if there's a row of chroma for every two rows of pixels
+} stbi__yuv;
 
 typedef struct
 {
@@ -990,7 +995,7 @@ typedef struct
 
 #ifndef STBI_NO_JPEG
 static int      stbi__jpeg_test(stbi__context *s);
-static void    *stbi__jpeg_load(stbi__context *s, int *x, int *y, int *comp, int req_comp, stbi__nv12 *nv12, stbi__result_info *ri);
+static void    *stbi__jpeg_load(stbi__context *s, int *x, int *y, int *comp, int req_comp, stbi__yuv *yuv, stbi__result_info *ri);
 #if 0 /* not used in SDL */
 static int      stbi__jpeg_info(stbi__context *s, int *x, int *y, int *comp);
 #endif
@@ -4032,49 +4037,70 @@ static stbi_uc stbi__blinn_8x8(stbi_uc x, stbi_uc y)
    return (stbi_uc) ((t + (t >>8)) >> 8);
 }
 
-static stbi_uc *output_jpeg_nv12(stbi__jpeg *z, stbi__nv12 *nv12)
+static stbi_uc *output_jpeg_yuv(stbi__jpeg *z, stbi__yuv *yuv)
 {
-   unsigned int i,j;
+   const int w = (int)z->s->img_x;
+   const int h = (int)z->s->img_y;
+   const int uv_w = (w + 1) / 2;
+   const int uv_h = (h + yuv->uv_vs - 1) / yuv->uv_vs;
+   int i,j;
 
-   // Copy the Y plane
-   if (nv12->pitch == (int)z->s->img_x) {
-      memcpy(nv12->y, z->img_comp[0].data, z->s->img_y * z->s->img_x);
-   } else {
-      for (i=0; i < z->s->img_y; ++i) {
-         memcpy(nv12->y + i * nv12->pitch, z->img_comp[0].data + i * z->s->img_x, z->s->img_x);
+   // Copy the Y plane, the decoded rows are padded out to a whole MCU
+   for (i=0; i < h; ++i) {
+      const stbi_uc *src = z->img_comp[0].data + i * z->img_comp[0].w2;
+      stbi_uc *dst = yuv->y + i * yuv->y_pitch;
+      if (yuv->y_step == 1) {
+         memcpy(dst, src, w);
+      } else {
+         for (j=0; j < w; ++j) {
+            dst[j * yuv->y_step] = src[j];
+         }
+         if (w & 1) {
+            // Packed formats store the last odd pixel twice
+            dst[w * yuv->y_step] = src[w - 1];
+         }
       }
    }
 
    if (z->s->img_n == 3) {
-      // NV12: U and V are interleaved, each subsampled by 2
-      const int nv12_hs = 2;
-      const int nv12_vs = 2;
+      // Take the chroma sample under the top left pixel of each 2x2 (or 2x1) block
       const int u_hs = (z->img_h_max / z->img_comp[1].h);
       const int u_vs = (z->img_v_max / z->img_comp[1].v);
       const int v_hs = (z->img_h_max / z->img_comp[2].h);
       const int v_vs = (z->img_v_max / z->img_comp[2].v);
-      for (i=0; i < (z->s->img_y + 1) / 2; ++i) {
-         stbi_uc *src_u = z->img_comp[1].data + i * (1 + (nv12_vs - u_vs)) * z->img_comp[1].x;
-         stbi_uc *src_v = z->img_comp[2].data + i * (1 + (nv12_vs - v_vs)) * z->img_comp[2].x;
-         stbi_uc *dst = nv12->uv + i * nv12->pitch;
-         for (j=0; j < (z->s->img_x + 1) / 2; ++j) {
-            *dst++ = *src_u;
-            src_u += 1 + (nv12_hs - u_hs);
-            *dst++ = *src_v;
-            src_v += 1 + (nv12_hs - v_hs);
+      for (i=0; i < uv_h; ++i) {
+         const stbi_uc *src_u = z->img_comp[1].data + ((i * yuv->uv_vs) / u_vs) * z->img_comp[1].w2;
+         const stbi_uc *src_v = z->img_comp[2].data + ((i * yuv->uv_vs) / v_vs) * z->img_comp[2].w2;
+         stbi_uc *dst_u = yuv->u + i * yuv->uv_pitch;
+         stbi_uc *dst_v = yuv->v + i * yuv->uv_pitch;
+         if (u_hs == 2 && v_hs == 2) {
+            for (j=0; j < uv_w; ++j) {
+               dst_u[j * yuv->uv_step] = src_u[j];
+               dst_v[j * yuv->uv_step] = src_v[j];
+            }
+         } else {
+            for (j=0; j < uv_w; ++j) {
+               dst_u[j * yuv->uv_step] = src_u[(j * 2) / u_hs];
+               dst_v[j * yuv->uv_step] = src_v[(j * 2) / v_hs];
+            }
          }
       }
    } else {
       // Grayscale
-      for (i=0; i < (z->s->img_y + 1) / 2; ++i) {
-         memset(nv12->uv + i * nv12->pitch, 0x80808080, ((z->s->img_x + 1) / 2) * 2);
+      for (i=0; i < uv_h; ++i) {
+         stbi_uc *dst_u = yuv->u + i * yuv->uv_pitch;
+         stbi_uc *dst_v = yuv->v + i * yuv->uv_pitch;
+         for (j=0; j < uv_w; ++j) {
+            dst_u[j * yuv->uv_step] = 0x80;
+            dst_v[j * yuv->uv_step] = 0x80;
+         }
       }
    }
 
-   return nv12->y;
+   return yuv->y;
 }
 
-static stbi_uc *load_jpeg_image(stbi__jpeg *z, int *out_x, int *out_y, int *comp, int req_comp, stbi__nv12 *nv12)
+static stbi_uc *load_jpeg_image(stbi__jpeg *z, int *out_x, int *out_y, int *comp, int req_comp, stbi__yuv *yuv)
 {
    int n, decode_n, is_rgb;
    z->s->img_n = 0; // make stbi__cleanup_jpeg safe
@@ -4108,18 +4134,18 @@ static stbi_uc *load_jpeg_image(stbi__jpeg *z, int *out_x, int *out_y, int *comp
 
       stbi__resample res_comp[4];
 
-      if (nv12) {
-         if (nv12->w != (int)z->s->img_x || nv12->h != (int)z->s->img_y) {
+      if (yuv) {
+         if (yuv->w != (int)z->s->img_x || yuv->h != (int)z->s->img_y) {
              stbi__cleanup_jpeg(z);
              return stbi__errpuc("badsize", "Unexpected size");
          }
 
          if (is_rgb) {
              stbi__cleanup_jpeg(z);
-             return stbi__errpuc("rgbtonv12", "Can't convert RGB to NV12");
+             return stbi__errpuc("rgbtoyuv", "Can't convert RGB to YUV");
          }
 
-         output = output_jpeg_nv12(z, nv12);
+         output = output_jpeg_yuv(z, yuv);
       } else {
          for (k=0; k < decode_n; ++k) {
             stbi__resample *r = &res_comp[k];
@@ -4251,7 +4277,7 @@ static stbi_uc *load_jpeg_image(stbi__jpeg *z, int *out_x, int *out_y, int *comp
    }
 }
 
-static void *stbi__jpeg_load(stbi__context *s, int *x, int *y, int *comp, int req_comp, stbi__nv12 *nv12, stbi__result_info *ri)
+static void *stbi__jpeg_load(stbi__context *s, int *x, int *y, int *comp, int req_comp, stbi__yuv *yuv, stbi__result_info *ri)
 {
    unsigned char* result;
    stbi__jpeg* j = (stbi__jpeg*) stbi__malloc(sizeof(stbi__jpeg));
@@ -4260,7 +4286,7 @@ static void *stbi__jpeg_load(stbi__context *s, int *x, int *y, int *comp, int re
    STBI_NOTUSED(ri);
    j->s = s;
    stbi__setup_jpeg(j);
-   result = load_jpeg_image(j, x,y,comp,req_comp,nv12);
+   result = load_jpeg_image(j, x,y,comp,req_comp,yuv);
    STBI_FREE(j);
    return result;
 }
@@ -18,6 +18,7 @@
 
 // For all methods, width and height should be even, if not, the last row/column of the result image won't be affected.
 // For sse methods, if the width if not divisable by 32, the last (width%32) pixels of each line won't be affected.
+// The avx2 and neon methods convert the remaining pixels with the standard c implementation.
 
 /*#include <stdint.h>*/
 
@@ -27,6 +28,12 @@
 // yuv to rgb, sse2 implementation
 #include "yuv_rgb_sse.h"
 
+// yuv to rgb, avx2 implementation
+#include "yuv_rgb_avx2.h"
+
+// yuv to rgb, neon implementation
+#include "yuv_rgb_neon.h"
+
 // yuv to rgb, lsx implementation
 #include "yuv_rgb_lsx.h"
 
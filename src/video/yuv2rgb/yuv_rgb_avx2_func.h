@@ -0,0 +1,345 @@
+// Copyright 2016 Adrien Descamps
+// Distributed under BSD 3-Clause License
+
+/* You need to define the following macros before including this file:
+	AVX2_FUNCTION_NAME
+	STD_FUNCTION_NAME
+	YUV_FORMAT
+	RGB_FORMAT
+*/
+
+/* Each iteration converts 32 pixels of one line, or of two lines for the
+ * 4:2:0 formats, which share the chroma.
+ *
+ * Unlike the SSE2 version, the luma and chroma terms are added with signed
+ * saturation, so values far outside the nominal range clamp instead of
+ * wrapping around.
+ */
+
+#define LOAD_SI256 _mm256_loadu_si256
+#define SAVE_SI256 _mm256_storeu_si256
+
+/* Computes the chroma terms for 32 pixels from 16 U and 16 V samples
+ * The _1 outputs hold pixels 0-7 and 16-23, the _2 outputs hold 8-15 and 24-31,
+ * matching the lane order of _mm256_unpacklo/hi_epi8() on the Y values.
+ */
+#define UV2RGB_32(U,V,R1,G1,B1,R2,G2,B2) \
+{ \
+	__m256i u_16, v_16, r_tmp, g_tmp, b_tmp; \
+	u_16 = _mm256_sub_epi16(_mm256_cvtepu8_epi16(U), _mm256_set1_epi16(128)); \
+	v_16 = _mm256_sub_epi16(_mm256_cvtepu8_epi16(V), _mm256_set1_epi16(128)); \
+	r_tmp = _mm256_mullo_epi16(v_16, _mm256_set1_epi16(param->v_r_factor)); \
+	g_tmp = _mm256_add_epi16( \
+		_mm256_mullo_epi16(u_16, _mm256_set1_epi16(param->u_g_factor)), \
+		_mm256_mullo_epi16(v_16, _mm256_set1_epi16(param->v_g_factor))); \
+	b_tmp = _mm256_mullo_epi16(u_16, _mm256_set1_epi16(param->u_b_factor)); \
+	R1 = _mm256_unpacklo_epi16(r_tmp, r_tmp); \
+	G1 = _mm256_unpacklo_epi16(g_tmp, g_tmp); \
+	B1 = _mm256_unpacklo_epi16(b_tmp, b_tmp); \
+	R2 = _mm256_unpackhi_epi16(r_tmp, r_tmp); \
+	G2 = _mm256_unpackhi_epi16(g_tmp, g_tmp); \
+	B2 = _mm256_unpackhi_epi16(b_tmp, b_tmp); \
+}
+
+/* Adds the luma of 32 pixels to the chroma terms and packs to 8 bits, in pixel order */
+#define ADD_Y2RGB_32(Y,R1,G1,B1,R2,G2,B2,R,G,B) \
+{ \
+	__m256i y_16_1, y_16_2; \
+	y_16_1 = _mm256_unpacklo_epi8(Y, _mm256_setzero_si256()); \
+	y_16_2 = _mm256_unpackhi_epi8(Y, _mm256_setzero_si256()); \
+	y_16_1 = _mm256_mullo_epi16(_mm256_sub_epi16(y_16_1, _mm256_set1_epi16(param->y_shift)), _mm256_set1_epi16(param->y_factor)); \
+	y_16_2 = _mm256_mullo_epi16(_mm256_sub_epi16(y_16_2, _mm256_set1_epi16(param->y_shift)), _mm256_set1_epi16(param->y_factor)); \
+	R = _mm256_packus_epi16(_mm256_srai_epi16(_mm256_adds_epi16(R1, y_16_1), PRECISION), \
+	                        _mm256_srai_epi16(_mm256_adds_epi16(R2, y_16_2), PRECISION)); \
+	G = _mm256_packus_epi16(_mm256_srai_epi16(_mm256_adds_epi16(G1, y_16_1), PRECISION), \
+	                        _mm256_srai_epi16(_mm256_adds_epi16(G2, y_16_2), PRECISION)); \
+	B = _mm256_packus_epi16(_mm256_srai_epi16(_mm256_adds_epi16(B1, y_16_1), PRECISION), \
+	                        _mm256_srai_epi16(_mm256_adds_epi16(B2, y_16_2), PRECISION)); \
+}
+
+/* Interleaves four planes of 32 bytes, C0 ending up first in memory */
+#define PACK_32BPP(C0,C1,C2,C3,RGB1,RGB2,RGB3,RGB4) \
+{ \
+	__m256i lo_01, hi_01, lo_23, hi_23, p1, p2, p3, p4; \
+	lo_01 = _mm256_unpacklo_epi8(C0, C1); \
+	hi_01 = _mm256_unpackhi_epi8(C0, C1); \
+	lo_23 = _mm256_unpacklo_epi8(C2, C3); \
+	hi_23 = _mm256_unpackhi_epi8(C2, C3); \
+	p1 = _mm256_unpacklo_epi16(lo_01, lo_23); \
+	p2 = _mm256_unpackhi_epi16(lo_01, lo_23); \
+	p3 = _mm256_unpacklo_epi16(hi_01, hi_23); \
+	p4 = _mm256_unpackhi_epi16(hi_01, hi_23); \
+	RGB1 = _mm256_permute2x128_si256(p1, p2, 0x20); \
+	RGB2 = _mm256_permute2x128_si256(p3, p4, 0x20); \
+	RGB3 = _mm256_permute2x128_si256(p1, p2, 0x31); \
+	RGB4 = _mm256_permute2x128_si256(p3, p4, 0x31); \
+}
+
+#if RGB_FORMAT == RGB_FORMAT_RGB565
+
+#define SAVE_PIXELS(R,G,B,rgb_ptr) \
+{ \
+	__m256i rgb_1, rgb_2, tmp_1, tmp_2; \
+	rgb_1 = _mm256_and_si256(_mm256_unpacklo_epi8(_mm256_setzero_si256(), R), _mm256_set1_epi16((short)0xF800)); \
+	rgb_2 = _mm256_and_si256(_mm256_unpackhi_epi8(_mm256_setzero_si256(), R), _mm256_set1_epi16((short)0xF800)); \
+	tmp_1 = _mm256_slli_epi16(_mm256_srli_epi16(_mm256_unpacklo_epi8(G, _mm256_setzero_si256()), 2), 5); \
+	tmp_2 = _mm256_slli_epi16(_mm256_srli_epi16(_mm256_unpackhi_epi8(G, _mm256_setzero_si256()), 2), 5); \
+	rgb_1 = _mm256_or_si256(rgb_1, tmp_1); \
+	rgb_2 = _mm256_or_si256(rgb_2, tmp_2); \
+	tmp_1 = _mm256_srli_epi16(_mm256_unpacklo_epi8(B, _mm256_setzero_si256()), 3); \
+	tmp_2 = _mm256_srli_epi16(_mm256_unpackhi_epi8(B, _mm256_setzero_si256()), 3); \
+	rgb_1 = _mm256_or_si256(rgb_1, tmp_1); \
+	rgb_2 = _mm256_or_si256(rgb_2, tmp_2); \
+	SAVE_SI256((__m256i *)(rgb_ptr), _mm256_permute2x128_si256(rgb_1, rgb_2, 0x20)); \
+	SAVE_SI256((__m256i *)(rgb_ptr + 32), _mm256_permute2x128_si256(rgb_1, rgb_2, 0x31)); \
+}
+
+#elif RGB_FORMAT == RGB_FORMAT_RGB24
+
+/* Packs as 32 bits per pixel, then squeezes each group of 8 pixels down to 24 bytes.
+ * The stores overlap so that nothing is written past the last pixel.
+ */
+#define PACK_RGB24_8(RGB) \
+	_mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(RGB, _mm256_setr_epi8( \
+		0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1, \
+		0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1)), \
+		_mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7))
+
+#define SAVE_PIXELS(R,G,B,rgb_ptr) \
+{ \
+	__m256i rgb_1, rgb_2, rgb_3, rgb_4; \
+	PACK_32BPP(R, G, B, _mm256_setzero_si256(), rgb_1, rgb_2, rgb_3, rgb_4) \
+	rgb_4 = PACK_RGB24_8(rgb_4); \
+	SAVE_SI256((__m256i *)(rgb_ptr), PACK_RGB24_8(rgb_1)); \
+	SAVE_SI256((__m256i *)(rgb_ptr + 24), PACK_RGB24_8(rgb_2)); \
+	SAVE_SI256((__m256i *)(rgb_ptr + 48), PACK_RGB24_8(rgb_3)); \
+	_mm_storeu_si128((__m128i *)(rgb_ptr + 72), _mm256_castsi256_si128(rgb_4)); \
+	_mm_storel_epi64((__m128i *)(rgb_ptr + 88), _mm256_extracti128_si256(rgb_4, 1)); \
+}
+
+#elif RGB_FORMAT == RGB_FORMAT_RGBA || RGB_FORMAT == RGB_FORMAT_BGRA || \
+      RGB_FORMAT == RGB_FORMAT_ARGB || RGB_FORMAT == RGB_FORMAT_ABGR
+
+#if RGB_FORMAT == RGB_FORMAT_RGBA
+#define PACK_PIXELS(R,G,B,A,RGB1,RGB2,RGB3,RGB4) PACK_32BPP(A, B, G, R, RGB1, RGB2, RGB3, RGB4)
+#elif RGB_FORMAT == RGB_FORMAT_BGRA
+#define PACK_PIXELS(R,G,B,A,RGB1,RGB2,RGB3,RGB4) PACK_32BPP(A, R, G, B, RGB1, RGB2, RGB3, RGB4)
+#elif RGB_FORMAT == RGB_FORMAT_ARGB
+#define PACK_PIXELS(R,G,B,A,RGB1,RGB2,RGB3,RGB4) PACK_32BPP(B, G, R, A, RGB1, RGB2, RGB3, RGB4)
+#else
+#define PACK_PIXELS(R,G,B,A,RGB1,RGB2,RGB3,RGB4) PACK_32BPP(R, G, B, A, RGB1, RGB2, RGB3, RGB4)
+#endif
+
+#define SAVE_PIXELS(R,G,B,rgb_ptr) \
+{ \
+	__m256i rgb_1, rgb_2, rgb_3, rgb_4; \
+	PACK_PIXELS(R, G, B, _mm256_set1_epi8((char)0xFF), rgb_1, rgb_2, rgb_3, rgb_4) \
+	SAVE_SI256((__m256i *)(rgb_ptr), rgb_1); \
+	SAVE_SI256((__m256i *)(rgb_ptr + 32), rgb_2); \
+	SAVE_SI256((__m256i *)(rgb_ptr + 64), rgb_3); \
+	SAVE_SI256((__m256i *)(rgb_ptr + 96), rgb_4); \
+}
+
+#else
+#error SAVE_PIXELS unimplemented
+#endif
+
+#if YUV_FORMAT == YUV_FORMAT_420
+
+#define READ_Y(y_ptr) \
+	y = LOAD_SI256((const __m256i *)(y_ptr)); \
+
+#define READ_UV \
+	u = _mm_loadu_si128((const __m128i *)(u_ptr)); \
+	v = _mm_loadu_si128((const __m128i *)(v_ptr)); \
+
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+
+#define READ_Y(y_ptr) \
+	y = LOAD_SI256((const __m256i *)(y_ptr)); \
+
+/* Reads the 32 interleaved bytes starting at whichever of U and V comes first,
+ * so NV21 doesn't read past the end of the line, then splits them in halves.
+ */
+#define READ_UV \
+{ \
+	__m256i uv = LOAD_SI256((const __m256i *)(uv_swapped ? v_ptr : u_ptr)); \
+	uv = _mm256_shuffle_epi8(uv, _mm256_setr_epi8( \
+		0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15, \
+		0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15)); \
+	uv = _mm256_permute4x64_epi64(uv, _MM_SHUFFLE(3, 1, 2, 0)); \
+	if (uv_swapped) { \
+		v = _mm256_castsi256_si128(uv); \
+		u = _mm256_extracti128_si256(uv, 1); \
+	} else { \
+		u = _mm256_castsi256_si128(uv); \
+		v = _mm256_extracti128_si256(uv, 1); \
+	} \
+}
+
+#elif YUV_FORMAT == YUV_FORMAT_422
+
+/* Reads the 64 bytes of 32 packed pixels, starting at the first byte of the
+ * macropixel, and separates them into 32 Y, 16 U and 16 V values.
+ */
+#define READ_YUV(packed_ptr) \
+{ \
+	__m256i p1, p2, yuv_1, yuv_2; \
+	p1 = _mm256_shuffle_epi8(LOAD_SI256((const __m256i *)(packed_ptr)), packed_mask); \
+	p2 = _mm256_shuffle_epi8(LOAD_SI256((const __m256i *)(packed_ptr + 32)), packed_mask); \
+	p1 = _mm256_permutevar8x32_epi32(p1, _mm256_setr_epi32(0, 1, 4, 5, 2, 6, 3, 7)); \
+	p2 = _mm256_permutevar8x32_epi32(p2, _mm256_setr_epi32(0, 1, 4, 5, 2, 6, 3, 7)); \
+	y = _mm256_permute2x128_si256(p1, p2, 0x20); \
+	yuv_1 = _mm256_permute2x128_si256(p1, p2, 0x31); \
+	yuv_2 = _mm256_permute4x64_epi64(yuv_1, _MM_SHUFFLE(3, 1, 2, 0)); \
+	u = _mm256_castsi256_si128(yuv_2); \
+	v = _mm256_extracti128_si256(yuv_2, 1); \
+}
+
+#else
+#error READ_UV unimplemented
+#endif
+
+void SDL_TARGETING("avx2") AVX2_FUNCTION_NAME(uint32_t width, uint32_t height,
+	const uint8_t *Y, const uint8_t *U, const uint8_t *V, uint32_t Y_stride, uint32_t UV_stride,
+	uint8_t *RGB, uint32_t RGB_stride,
+	YCbCrType yuv_type)
+{
+	const YUV2RGBParam *const param = &(YUV2RGB[yuv_type]);
+#if YUV_FORMAT == YUV_FORMAT_420
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 1;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#elif YUV_FORMAT == YUV_FORMAT_422
+	const int y_pixel_stride = 2;
+	const int uv_pixel_stride = 4;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 1;
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 2;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#endif
+#if RGB_FORMAT == RGB_FORMAT_RGB565
+	const int rgb_pixel_stride = 2;
+#elif RGB_FORMAT == RGB_FORMAT_RGB24
+	const int rgb_pixel_stride = 3;
+#elif RGB_FORMAT == RGB_FORMAT_RGBA || RGB_FORMAT == RGB_FORMAT_BGRA || \
+      RGB_FORMAT == RGB_FORMAT_ARGB || RGB_FORMAT == RGB_FORMAT_ABGR
+	const int rgb_pixel_stride = 4;
+#else
+#error Unknown RGB pixel size
+#endif
+
+#if YUV_FORMAT == YUV_FORMAT_NV12
+	const bool uv_swapped = (V < U);
+#elif YUV_FORMAT == YUV_FORMAT_422
+	/* The offsets of Y, U and V within a macropixel, e.g. YUY2 is 0, 1, 3 */
+	const uint8_t *packed = SDL_min(Y, SDL_min(U, V));
+	const char y_offset = (char)(Y - packed);
+	const char u_offset = (char)(U - packed);
+	const char v_offset = (char)(V - packed);
+	const __m256i packed_mask = _mm256_setr_epi8(
+		y_offset, y_offset + 2, y_offset + 4, y_offset + 6, y_offset + 8, y_offset + 10, y_offset + 12, y_offset + 14,
+		u_offset, u_offset + 4, u_offset + 8, u_offset + 12, v_offset, v_offset + 4, v_offset + 8, v_offset + 12,
+		y_offset, y_offset + 2, y_offset + 4, y_offset + 6, y_offset + 8, y_offset + 10, y_offset + 12, y_offset + 14,
+		u_offset, u_offset + 4, u_offset + 8, u_offset + 12, v_offset, v_offset + 4, v_offset + 8, v_offset + 12);
+#endif
+
+	uint32_t xpos, ypos = 0;
+
+	if (width >= 32) {
+		for(ypos=0; ypos<(height-(uv_y_sample_interval-1)); ypos+=uv_y_sample_interval)
+		{
+#if YUV_FORMAT == YUV_FORMAT_422
+			const uint8_t *packed_ptr=packed+ypos*Y_stride;
+#else
+			const uint8_t *y_ptr1=Y+ypos*Y_stride,
+				*y_ptr2=Y+(ypos+1)*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+
+			uint8_t *rgb_ptr2=RGB+(ypos+1)*RGB_stride;
+#endif
+			uint8_t *rgb_ptr1=RGB+ypos*RGB_stride;
+
+			for(xpos=0; xpos<(width-31); xpos+=32)
+			{
+				__m256i y, r, g, b;
+				__m256i r_uv_1, g_uv_1, b_uv_1, r_uv_2, g_uv_2, b_uv_2;
+				__m128i u, v;
+
+#if YUV_FORMAT == YUV_FORMAT_422
+				READ_YUV(packed_ptr)
+				UV2RGB_32(u, v, r_uv_1, g_uv_1, b_uv_1, r_uv_2, g_uv_2, b_uv_2)
+				ADD_Y2RGB_32(y, r_uv_1, g_uv_1, b_uv_1, r_uv_2, g_uv_2, b_uv_2, r, g, b)
+				SAVE_PIXELS(r, g, b, rgb_ptr1)
+				packed_ptr+=32*y_pixel_stride;
+#else
+				READ_UV
+				UV2RGB_32(u, v, r_uv_1, g_uv_1, b_uv_1, r_uv_2, g_uv_2, b_uv_2)
+
+				READ_Y(y_ptr1)
+				ADD_Y2RGB_32(y, r_uv_1, g_uv_1, b_uv_1, r_uv_2, g_uv_2, b_uv_2, r, g, b)
+				SAVE_PIXELS(r, g, b, rgb_ptr1)
+
+				READ_Y(y_ptr2)
+				ADD_Y2RGB_32(y, r_uv_1, g_uv_1, b_uv_1, r_uv_2, g_uv_2, b_uv_2, r, g, b)
+				SAVE_PIXELS(r, g, b, rgb_ptr2)
+
+				y_ptr1+=32*y_pixel_stride;
+				y_ptr2+=32*y_pixel_stride;
+				u_ptr+=32*uv_pixel_stride/uv_x_sample_interval;
+				v_ptr+=32*uv_pixel_stride/uv_x_sample_interval;
+				rgb_ptr2+=32*rgb_pixel_stride;
+#endif
+				rgb_ptr1+=32*rgb_pixel_stride;
+			}
+		}
+
+		/* Catch the last line, if needed */
+		if (uv_y_sample_interval == 2 && ypos == (height-1))
+		{
+			const uint8_t *y_ptr=Y+ypos*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+
+			uint8_t *rgb_ptr=RGB+ypos*RGB_stride;
+
+			STD_FUNCTION_NAME(width, 1, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+
+	/* Catch the right column, if needed */
+	{
+		uint32_t converted = (width & ~31);
+		if (converted != width)
+		{
+			const uint8_t *y_ptr=Y+converted*y_pixel_stride,
+				*u_ptr=U+converted*uv_pixel_stride/uv_x_sample_interval,
+				*v_ptr=V+converted*uv_pixel_stride/uv_x_sample_interval;
+
+			uint8_t *rgb_ptr=RGB+converted*rgb_pixel_stride;
+
+			STD_FUNCTION_NAME(width-converted, height, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+}
+
+#undef AVX2_FUNCTION_NAME
+#undef STD_FUNCTION_NAME
+#undef YUV_FORMAT
+#undef RGB_FORMAT
+#undef LOAD_SI256
+#undef SAVE_SI256
+#undef UV2RGB_32
+#undef ADD_Y2RGB_32
+#undef PACK_32BPP
+#undef PACK_RGB24_8
+#undef PACK_PIXELS
+#undef SAVE_PIXELS
+#undef READ_Y
+#undef READ_UV
+#undef READ_YUV
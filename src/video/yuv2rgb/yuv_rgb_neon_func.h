@@ -0,0 +1,272 @@
+// Copyright 2016 Adrien Descamps
+// Distributed under BSD 3-Clause License
+
+/* You need to define the following macros before including this file:
+	NEON_FUNCTION_NAME
+	STD_FUNCTION_NAME
+	YUV_FORMAT
+	RGB_FORMAT
+*/
+
+/* Each iteration converts 16 pixels of one line, or of two lines for the
+ * 4:2:0 formats, which share the chroma.
+ *
+ * Like the AVX2 version, the luma and chroma terms are added with signed
+ * saturation, so values far outside the nominal range clamp instead of
+ * wrapping around.
+ */
+
+/* Computes the chroma terms for 16 pixels from 8 U and 8 V samples */
+#define UV2RGB_16(U,V,R,G,B) \
+{ \
+	const int16x8_t u_16 = vreinterpretq_s16_u16(vsubl_u8(U, vdup_n_u8(128))); \
+	const int16x8_t v_16 = vreinterpretq_s16_u16(vsubl_u8(V, vdup_n_u8(128))); \
+	const int16x8_t r_tmp = vmulq_n_s16(v_16, param->v_r_factor); \
+	const int16x8_t g_tmp = vmlaq_n_s16(vmulq_n_s16(u_16, param->u_g_factor), v_16, param->v_g_factor); \
+	const int16x8_t b_tmp = vmulq_n_s16(u_16, param->u_b_factor); \
+	R = vzipq_s16(r_tmp, r_tmp); \
+	G = vzipq_s16(g_tmp, g_tmp); \
+	B = vzipq_s16(b_tmp, b_tmp); \
+}
+
+/* Adds the luma of 16 pixels to the chroma terms and packs to 8 bits */
+#define ADD_Y2RGB_16(Y,R_UV,G_UV,B_UV,R,G,B) \
+{ \
+	int16x8_t y_16_1, y_16_2; \
+	y_16_1 = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(Y))); \
+	y_16_2 = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(Y))); \
+	y_16_1 = vmulq_n_s16(vsubq_s16(y_16_1, vdupq_n_s16(param->y_shift)), param->y_factor); \
+	y_16_2 = vmulq_n_s16(vsubq_s16(y_16_2, vdupq_n_s16(param->y_shift)), param->y_factor); \
+	R = vcombine_u8(vqshrun_n_s16(vqaddq_s16(R_UV.val[0], y_16_1), PRECISION), \
+	                vqshrun_n_s16(vqaddq_s16(R_UV.val[1], y_16_2), PRECISION)); \
+	G = vcombine_u8(vqshrun_n_s16(vqaddq_s16(G_UV.val[0], y_16_1), PRECISION), \
+	                vqshrun_n_s16(vqaddq_s16(G_UV.val[1], y_16_2), PRECISION)); \
+	B = vcombine_u8(vqshrun_n_s16(vqaddq_s16(B_UV.val[0], y_16_1), PRECISION), \
+	                vqshrun_n_s16(vqaddq_s16(B_UV.val[1], y_16_2), PRECISION)); \
+}
+
+#if RGB_FORMAT == RGB_FORMAT_RGB565
+
+#define SAVE_PIXELS(R,G,B,rgb_ptr) \
+{ \
+	uint16x8_t rgb_1, rgb_2; \
+	rgb_1 = vshll_n_u8(vget_low_u8(R), 8); \
+	rgb_2 = vshll_n_u8(vget_high_u8(R), 8); \
+	rgb_1 = vsriq_n_u16(rgb_1, vshll_n_u8(vget_low_u8(G), 8), 5); \
+	rgb_2 = vsriq_n_u16(rgb_2, vshll_n_u8(vget_high_u8(G), 8), 5); \
+	rgb_1 = vsriq_n_u16(rgb_1, vshll_n_u8(vget_low_u8(B), 8), 11); \
+	rgb_2 = vsriq_n_u16(rgb_2, vshll_n_u8(vget_high_u8(B), 8), 11); \
+	vst1q_u16((uint16_t *)(rgb_ptr), rgb_1); \
+	vst1q_u16((uint16_t *)(rgb_ptr + 16), rgb_2); \
+}
+
+#elif RGB_FORMAT == RGB_FORMAT_RGB24
+
+#define SAVE_PIXELS(R,G,B,rgb_ptr) \
+{ \
+	uint8x16x3_t rgb; \
+	rgb.val[0] = R; \
+	rgb.val[1] = G; \
+	rgb.val[2] = B; \
+	vst3q_u8(rgb_ptr, rgb); \
+}
+
+#elif RGB_FORMAT == RGB_FORMAT_RGBA || RGB_FORMAT == RGB_FORMAT_BGRA || \
+      RGB_FORMAT == RGB_FORMAT_ARGB || RGB_FORMAT == RGB_FORMAT_ABGR
+
+/* The byte order in memory of the 32-bit pixels */
+#if RGB_FORMAT == RGB_FORMAT_RGBA
+#define PACK_PIXELS(R,G,B,A,RGB) RGB.val[0] = A; RGB.val[1] = B; RGB.val[2] = G; RGB.val[3] = R;
+#elif RGB_FORMAT == RGB_FORMAT_BGRA
+#define PACK_PIXELS(R,G,B,A,RGB) RGB.val[0] = A; RGB.val[1] = R; RGB.val[2] = G; RGB.val[3] = B;
+#elif RGB_FORMAT == RGB_FORMAT_ARGB
+#define PACK_PIXELS(R,G,B,A,RGB) RGB.val[0] = B; RGB.val[1] = G; RGB.val[2] = R; RGB.val[3] = A;
+#else
+#define PACK_PIXELS(R,G,B,A,RGB) RGB.val[0] = R; RGB.val[1] = G; RGB.val[2] = B; RGB.val[3] = A;
+#endif
+
+#define SAVE_PIXELS(R,G,B,rgb_ptr) \
+{ \
+	uint8x16x4_t rgb; \
+	PACK_PIXELS(R, G, B, vdupq_n_u8(0xFF), rgb) \
+	vst4q_u8(rgb_ptr, rgb); \
+}
+
+#else
+#error SAVE_PIXELS unimplemented
+#endif
+
+#if YUV_FORMAT == YUV_FORMAT_420
+
+#define READ_Y(y_ptr) \
+	y = vld1q_u8(y_ptr); \
+
+#define READ_UV \
+	u = vld1_u8(u_ptr); \
+	v = vld1_u8(v_ptr); \
+
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+
+#define READ_Y(y_ptr) \
+	y = vld1q_u8(y_ptr); \
+
+/* Reads the 16 interleaved bytes starting at whichever of U and V comes first,
+ * so NV21 doesn't read past the end of the line.
+ */
+#define READ_UV \
+{ \
+	const uint8x8x2_t uv = vld2_u8(uv_swapped ? v_ptr : u_ptr); \
+	u = uv.val[uv_swapped]; \
+	v = uv.val[!uv_swapped]; \
+}
+
+#elif YUV_FORMAT == YUV_FORMAT_422
+
+/* Reads the 32 bytes of 16 packed pixels, starting at the first byte of the macropixel */
+#define READ_YUV(packed_ptr) \
+{ \
+	const uint8x8x4_t yuv = vld4_u8(packed_ptr); \
+	const uint8x8x2_t y_pairs = vzip_u8(yuv.val[y_offset], yuv.val[y_offset + 2]); \
+	y = vcombine_u8(y_pairs.val[0], y_pairs.val[1]); \
+	u = yuv.val[u_offset]; \
+	v = yuv.val[v_offset]; \
+}
+
+#else
+#error READ_UV unimplemented
+#endif
+
+void NEON_FUNCTION_NAME(uint32_t width, uint32_t height,
+	const uint8_t *Y, const uint8_t *U, const uint8_t *V, uint32_t Y_stride, uint32_t UV_stride,
+	uint8_t *RGB, uint32_t RGB_stride,
+	YCbCrType yuv_type)
+{
+	const YUV2RGBParam *const param = &(YUV2RGB[yuv_type]);
+#if YUV_FORMAT == YUV_FORMAT_420
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 1;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#elif YUV_FORMAT == YUV_FORMAT_422
+	const int y_pixel_stride = 2;
+	const int uv_pixel_stride = 4;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 1;
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 2;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#endif
+#if RGB_FORMAT == RGB_FORMAT_RGB565
+	const int rgb_pixel_stride = 2;
+#elif RGB_FORMAT == RGB_FORMAT_RGB24
+	const int rgb_pixel_stride = 3;
+#elif RGB_FORMAT == RGB_FORMAT_RGBA || RGB_FORMAT == RGB_FORMAT_BGRA || \
+      RGB_FORMAT == RGB_FORMAT_ARGB || RGB_FORMAT == RGB_FORMAT_ABGR
+	const int rgb_pixel_stride = 4;
+#else
+#error Unknown RGB pixel size
+#endif
+
+#if YUV_FORMAT == YUV_FORMAT_NV12
+	const int uv_swapped = (V < U);
+#elif YUV_FORMAT == YUV_FORMAT_422
+	/* The offsets of Y, U and V within a macropixel, e.g. YUY2 is 0, 1, 3 */
+	const uint8_t *packed = SDL_min(Y, SDL_min(U, V));
+	const int y_offset = (int)(Y - packed);
+	const int u_offset = (int)(U - packed);
+	const int v_offset = (int)(V - packed);
+#endif
+
+	uint32_t xpos, ypos = 0;
+
+	if (width >= 16) {
+		for(ypos=0; ypos<(height-(uv_y_sample_interval-1)); ypos+=uv_y_sample_interval)
+		{
+#if YUV_FORMAT == YUV_FORMAT_422
+			const uint8_t *packed_ptr=packed+ypos*Y_stride;
+#else
+			const uint8_t *y_ptr1=Y+ypos*Y_stride,
+				*y_ptr2=Y+(ypos+1)*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+
+			uint8_t *rgb_ptr2=RGB+(ypos+1)*RGB_stride;
+#endif
+			uint8_t *rgb_ptr1=RGB+ypos*RGB_stride;
+
+			for(xpos=0; xpos<(width-15); xpos+=16)
+			{
+				uint8x16_t y, r, g, b;
+				uint8x8_t u, v;
+				int16x8x2_t r_uv, g_uv, b_uv;
+
+#if YUV_FORMAT == YUV_FORMAT_422
+				READ_YUV(packed_ptr)
+				UV2RGB_16(u, v, r_uv, g_uv, b_uv)
+				ADD_Y2RGB_16(y, r_uv, g_uv, b_uv, r, g, b)
+				SAVE_PIXELS(r, g, b, rgb_ptr1)
+				packed_ptr+=16*y_pixel_stride;
+#else
+				READ_UV
+				UV2RGB_16(u, v, r_uv, g_uv, b_uv)
+
+				READ_Y(y_ptr1)
+				ADD_Y2RGB_16(y, r_uv, g_uv, b_uv, r, g, b)
+				SAVE_PIXELS(r, g, b, rgb_ptr1)
+
+				READ_Y(y_ptr2)
+				ADD_Y2RGB_16(y, r_uv, g_uv, b_uv, r, g, b)
+				SAVE_PIXELS(r, g, b, rgb_ptr2)
+
+				y_ptr1+=16*y_pixel_stride;
+				y_ptr2+=16*y_pixel_stride;
+				u_ptr+=16*uv_pixel_stride/uv_x_sample_interval;
+				v_ptr+=16*uv_pixel_stride/uv_x_sample_interval;
+				rgb_ptr2+=16*rgb_pixel_stride;
+#endif
+				rgb_ptr1+=16*rgb_pixel_stride;
+			}
+		}
+
+		/* Catch the last line, if needed */
+		if (uv_y_sample_interval == 2 && ypos == (height-1))
+		{
+			const uint8_t *y_ptr=Y+ypos*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+
+			uint8_t *rgb_ptr=RGB+ypos*RGB_stride;
+
+			STD_FUNCTION_NAME(width, 1, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+
+	/* Catch the right column, if needed */
+	{
+		uint32_t converted = (width & ~15);
+		if (converted != width)
+		{
+			const uint8_t *y_ptr=Y+converted*y_pixel_stride,
+				*u_ptr=U+converted*uv_pixel_stride/uv_x_sample_interval,
+				*v_ptr=V+converted*uv_pixel_stride/uv_x_sample_interval;
+
+			uint8_t *rgb_ptr=RGB+converted*rgb_pixel_stride;
+
+			STD_FUNCTION_NAME(width-converted, height, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+}
+
+#undef NEON_FUNCTION_NAME
+#undef STD_FUNCTION_NAME
+#undef YUV_FORMAT
+#undef RGB_FORMAT
+#undef UV2RGB_16
+#undef ADD_Y2RGB_16
+#undef PACK_PIXELS
+#undef SAVE_PIXELS
+#undef READ_Y
+#undef READ_UV
+#undef READ_YUV
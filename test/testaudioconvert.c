@@ -0,0 +1,182 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures the throughput of the audio sample format converters.
+ *
+ * The converters are chosen once per process from the CPU features, so to
+ * compare kernels, run this program several times with SDL_CPU_FEATURE_MASK
+ * set, e.g. "-avx2" for the SSE2 kernels, or "-sse2,-avx2,-neon" for the
+ * scalar ones.
+ */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+typedef struct
+{
+    const char *name;
+    SDL_AudioFormat src;
+    SDL_AudioFormat dst;
+} ConversionCase;
+
+static const ConversionCase conversions[] = {
+    { "S16 -> F32", SDL_AUDIO_S16LE, SDL_AUDIO_F32LE },
+    { "F32 -> S16", SDL_AUDIO_F32LE, SDL_AUDIO_S16LE },
+    { "S32 -> F32", SDL_AUDIO_S32LE, SDL_AUDIO_F32LE },
+    { "F32 -> S32", SDL_AUDIO_F32LE, SDL_AUDIO_S32LE },
+    { "S8 -> F32", SDL_AUDIO_S8, SDL_AUDIO_F32LE },
+    { "F32 -> U8", SDL_AUDIO_F32LE, SDL_AUDIO_U8 },
+    { "S16BE -> S16LE", SDL_AUDIO_S16BE, SDL_AUDIO_S16LE },
+    { "F32BE -> F32LE", SDL_AUDIO_F32BE, SDL_AUDIO_F32LE },
+};
+
+static const char *GetKernelName(void)
+{
+    if (SDL_HasAVX2()) {
+        return "AVX2";
+    } else if (SDL_HasSSE41()) {
+        return "SSE2/SSSE3";
+    } else if (SDL_HasSSE2()) {
+        return "SSE2";
+    } else if (SDL_HasNEON()) {
+        return "NEON";
+    }
+    return "scalar";
+}
+
+static bool RunConversion(const ConversionCase *conversion, int channels, int frames, int iterations)
+{
+    SDL_AudioSpec srcspec, dstspec;
+    SDL_AudioStream *stream = NULL;
+    Uint8 *src = NULL;
+    Uint8 *dst = NULL;
+    int src_len, dst_len;
+    Uint64 start, elapsed;
+    double seconds;
+    int i;
+    bool result = false;
+
+    srcspec.format = conversion->src;
+    srcspec.channels = channels;
+    srcspec.freq = 48000;
+    dstspec.format = conversion->dst;
+    dstspec.channels = channels;
+    dstspec.freq = 48000;
+
+    src_len = frames * SDL_AUDIO_FRAMESIZE(srcspec);
+    dst_len = frames * SDL_AUDIO_FRAMESIZE(dstspec);
+    src = (Uint8 *)SDL_malloc(src_len);
+    dst = (Uint8 *)SDL_malloc(dst_len);
+    if (!src || !dst) {
+        goto done;
+    }
+
+    // Fill with a low level sine so the float paths see realistic values
+    if (SDL_AUDIO_ISFLOAT(conversion->src) && !SDL_AUDIO_ISBIGENDIAN(conversion->src)) {
+        float *samples = (float *)src;
+        for (i = 0; i < frames * channels; ++i) {
+            samples[i] = 0.5f * SDL_sinf((float)i * 0.01f);
+        }
+    } else {
+        for (i = 0; i < src_len; ++i) {
+            src[i] = (Uint8)SDL_rand(256);
+        }
+    }
+
+    stream = SDL_CreateAudioStream(&srcspec, &dstspec);
+    if (!stream) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CreateAudioStream() failed: %s", SDL_GetError());
+        goto done;
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        if (!SDL_PutAudioStreamData(stream, src, src_len) ||
+            SDL_GetAudioStreamData(stream, dst, dst_len) != dst_len) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Conversion failed: %s", SDL_GetError());
+            goto done;
+        }
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+    seconds = (double)elapsed / (double)SDL_GetPerformanceFrequency();
+
+    SDL_Log("%-16s %10.2f Msamples/sec", conversion->name,
+            ((double)frames * channels * iterations) / (seconds * 1000000.0));
+    result = true;
+
+done:
+    SDL_DestroyAudioStream(stream);
+    SDL_free(src);
+    SDL_free(dst);
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    SDLTest_CommonState *state;
+    int channels = 2;
+    int frames = 4800;
+    int iterations = 2000;
+    int ret = 0;
+    int i;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--channels") == 0 && argv[i + 1]) {
+                channels = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--frames") == 0 && argv[i + 1]) {
+                frames = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+                iterations = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0 || channels <= 0 || frames <= 0 || iterations <= 0) {
+            static const char *options[] = { "[--channels N]", "[--frames N]", "[--iterations N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            ret = 1;
+            goto done;
+        }
+        i += consumed;
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_Init() failed: %s", SDL_GetError());
+        ret = 1;
+        goto done;
+    }
+
+    SDL_Log("Converting %d frames of %d channels, %d times, using %s kernels", frames, channels, iterations, GetKernelName());
+
+    for (i = 0; i < (int)SDL_arraysize(conversions); ++i) {
+        if (!RunConversion(&conversions[i], channels, frames, iterations)) {
+            ret = 1;
+            break;
+        }
+    }
+
+    SDL_Quit();
+done:
+    SDLTest_CommonDestroyState(state);
+    return ret;
+}
@@ -0,0 +1,270 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures how fast a playback device can mix a large number of bound streams.
+ *
+ * This uses the dummy audio driver with SDL_AUDIO_DUMMY_TIMESCALE set to 0, so
+ * the device thread runs as fast as it can, and reports how many seconds of
+ * audio were mixed per second of wall time. Use --threads to set
+ * SDL_AUDIO_DEVICE_MIX_THREADS, and --realtime to run at normal speed instead
+ * (missed deadlines are then logged when the device closes).
+ *
+ * With --mixaudio, this instead mixes --streams buffers into one with
+ * SDL_MixAudio, for each native sample format, and reports the throughput.
+ * Set SDL_CPU_FEATURE_MASK to compare the SIMD mixers against each other.
+ */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+typedef struct
+{
+    float *samples;
+    int num_samples;
+    int position;
+} StreamSource;
+
+static SDL_AtomicInt mixed_frames;
+
+static void SDLCALL FeedStream(void *userdata, SDL_AudioStream *stream, int additional_amount, int total_amount)
+{
+    StreamSource *source = (StreamSource *)userdata;
+    int samples = additional_amount / (int)sizeof(float);
+
+    while (samples > 0) {
+        const int cpy = SDL_min(samples, source->num_samples - source->position);
+        SDL_PutAudioStreamData(stream, source->samples + source->position, cpy * (int)sizeof(float));
+        source->position = (source->position + cpy) % source->num_samples;
+        samples -= cpy;
+    }
+}
+
+static void SDLCALL CountMixedFrames(void *userdata, const SDL_AudioSpec *spec, float *buffer, int buflen)
+{
+    SDL_AddAtomicInt(&mixed_frames, buflen / (int)(sizeof(float) * spec->channels));
+}
+
+static bool RunMixAudio(SDL_AudioFormat format, int num_streams, int seconds)
+{
+    const int num_samples = 1024 * 2;
+    const int len = num_samples * SDL_AUDIO_BYTESIZE(format);
+    Uint8 *sources = (Uint8 *)SDL_malloc((size_t)len * num_streams);
+    Uint8 *dst = (Uint8 *)SDL_malloc(len);
+    Uint64 start, elapsed, mixed = 0;
+    int i;
+
+    if (!sources || !dst) {
+        SDL_free(sources);
+        SDL_free(dst);
+        return false;
+    }
+
+    // Keep the levels low, so most samples don't clip.
+    for (i = 0; i < num_samples * num_streams; ++i) {
+        const float sample = 0.01f * SDL_sinf((float)i * 0.01f);
+        switch (format) {
+        case SDL_AUDIO_U8:
+            sources[i] = (Uint8)(128 + (int)(sample * 127.0f));
+            break;
+        case SDL_AUDIO_S8:
+            ((Sint8 *)sources)[i] = (Sint8)(sample * 127.0f);
+            break;
+        case SDL_AUDIO_S16:
+            ((Sint16 *)sources)[i] = (Sint16)(sample * 32767.0f);
+            break;
+        case SDL_AUDIO_S32:
+            ((Sint32 *)sources)[i] = (Sint32)(sample * 2147483647.0f);
+            break;
+        default:
+            ((float *)sources)[i] = sample;
+            break;
+        }
+    }
+
+    start = SDL_GetTicksNS();
+    do {
+        SDL_memset(dst, SDL_GetSilenceValueForFormat(format), len);
+        for (i = 0; i < num_streams; ++i) {
+            // 0.5 goes through the multiply; 1.0 would let the integer mixers skip it.
+            SDL_MixAudio(dst, sources + ((size_t)len * i), format, len, 0.5f);
+        }
+        mixed += (Uint64)num_samples * num_streams;
+        elapsed = SDL_GetTicksNS() - start;
+    } while (elapsed < (Uint64)seconds * SDL_NS_PER_SECOND);
+
+    SDL_Log("%-16s %10.2f Msamples/sec", SDL_GetAudioFormatName(format), (double)mixed / ((double)elapsed / SDL_NS_PER_SECOND) / 1000000.0);
+
+    SDL_free(sources);
+    SDL_free(dst);
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    SDLTest_CommonState *state;
+    SDL_AudioSpec devspec, srcspec;
+    SDL_AudioDeviceID devid = 0;
+    SDL_AudioStream **streams = NULL;
+    StreamSource *sources = NULL;
+    const char *threads = "1";
+    int num_streams = 256;
+    int seconds = 3;
+    bool realtime = false;
+    bool mixaudio = false;
+    Uint64 start, elapsed;
+    int ret = 1;
+    int i, j;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--streams") == 0 && argv[i + 1]) {
+                num_streams = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--threads") == 0 && argv[i + 1]) {
+                threads = argv[i + 1];
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--seconds") == 0 && argv[i + 1]) {
+                seconds = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--realtime") == 0) {
+                realtime = true;
+                consumed = 1;
+            } else if (SDL_strcmp(argv[i], "--mixaudio") == 0) {
+                mixaudio = true;
+                consumed = 1;
+            }
+        }
+        if (consumed <= 0 || num_streams <= 0 || seconds <= 0) {
+            static const char *options[] = { "[--streams N]", "[--threads N]", "[--seconds N]", "[--realtime]", "[--mixaudio]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            goto done;
+        }
+        i += consumed;
+    }
+
+    if (mixaudio) {
+        static const SDL_AudioFormat formats[] = { SDL_AUDIO_U8, SDL_AUDIO_S8, SDL_AUDIO_S16, SDL_AUDIO_S32, SDL_AUDIO_F32 };
+
+        SDL_Log("Mixing %d buffers into one with SDL_MixAudio", num_streams);
+        for (i = 0; i < (int)SDL_arraysize(formats); ++i) {
+            if (!RunMixAudio(formats[i], num_streams, seconds)) {
+                goto done;
+            }
+        }
+        ret = 0;
+        goto done;
+    }
+
+    SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+    SDL_SetHint(SDL_HINT_AUDIO_DUMMY_TIMESCALE, realtime ? "1" : "0");
+    SDL_SetHint(SDL_HINT_AUDIO_DEVICE_MIX_THREADS, threads);
+    if (realtime) {
+        SDL_SetLogPriority(SDL_LOG_CATEGORY_AUDIO, SDL_LOG_PRIORITY_DEBUG);
+    }
+
+    if (!SDL_Init(SDL_INIT_AUDIO)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_Init(SDL_INIT_AUDIO) failed: %s", SDL_GetError());
+        goto done;
+    }
+
+    devspec.format = SDL_AUDIO_F32;
+    devspec.channels = 2;
+    devspec.freq = 48000;
+    devid = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &devspec);
+    if (!devid) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_OpenAudioDevice() failed: %s", SDL_GetError());
+        goto quit;
+    }
+    SDL_PauseAudioDevice(devid);
+
+    // Every stream needs resampling, since that's the expensive part of a real mix.
+    srcspec.format = SDL_AUDIO_F32;
+    srcspec.channels = 2;
+    srcspec.freq = 44100;
+
+    streams = (SDL_AudioStream **)SDL_calloc(num_streams, sizeof(*streams));
+    sources = (StreamSource *)SDL_calloc(num_streams, sizeof(*sources));
+    if (!streams || !sources) {
+        goto quit;
+    }
+
+    for (i = 0; i < num_streams; ++i) {
+        StreamSource *source = &sources[i];
+        const float freq = 110.0f + 10.0f * (float)i;
+
+        source->num_samples = srcspec.freq * srcspec.channels;
+        source->samples = (float *)SDL_malloc(source->num_samples * sizeof(float));
+        if (!source->samples) {
+            goto quit;
+        }
+        for (j = 0; j < source->num_samples; j += 2) {
+            source->samples[j] = source->samples[j + 1] = 0.01f * SDL_sinf(2.0f * SDL_PI_F * freq * (float)(j / 2) / (float)srcspec.freq);
+        }
+
+        streams[i] = SDL_CreateAudioStream(&srcspec, NULL);
+        if (!streams[i] || !SDL_SetAudioStreamGetCallback(streams[i], FeedStream, source)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create audio stream: %s", SDL_GetError());
+            goto quit;
+        }
+    }
+
+    if (!SDL_BindAudioStreams(devid, streams, num_streams) ||
+        !SDL_SetAudioPostmixCallback(devid, CountMixedFrames, NULL)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't set up the audio device: %s", SDL_GetError());
+        goto quit;
+    }
+
+    SDL_Log("Mixing %d streams (%d Hz to %d Hz) with %s mix thread(s)%s", num_streams, srcspec.freq, devspec.freq, threads,
+            realtime ? " in realtime" : "");
+
+    start = SDL_GetTicksNS();
+    SDL_ResumeAudioDevice(devid);
+    SDL_Delay(seconds * 1000);
+    SDL_PauseAudioDevice(devid);
+    elapsed = SDL_GetTicksNS() - start;
+
+    SDL_Log("Mixed %.2f seconds of audio in %.2f seconds: %.2fx realtime",
+            (double)SDL_GetAtomicInt(&mixed_frames) / devspec.freq,
+            (double)elapsed / SDL_NS_PER_SECOND,
+            ((double)SDL_GetAtomicInt(&mixed_frames) / devspec.freq) / ((double)elapsed / SDL_NS_PER_SECOND));
+    ret = 0;
+
+quit:
+    if (devid) {
+        SDL_CloseAudioDevice(devid);
+    }
+    if (streams) {
+        for (i = 0; i < num_streams; ++i) {
+            SDL_DestroyAudioStream(streams[i]);
+        }
+    }
+    if (sources) {
+        for (i = 0; i < num_streams; ++i) {
+            SDL_free(sources[i].samples);
+        }
+    }
+    SDL_free(streams);
+    SDL_free(sources);
+    SDL_Quit();
+done:
+    SDLTest_CommonDestroyState(state);
+    return ret;
+}
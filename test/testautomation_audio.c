@@ -1176,6 +1176,202 @@ static int SDLCALL audio_resampleLoss(void *arg)
   return TEST_COMPLETED;
 }
 
+/**
+ * Check that every resampler quality reproduces a sine wave, and that the high
+ * quality resampler filters out frequencies above the output Nyquist frequency.
+ *
+ * \sa SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER
+ */
+static int SDLCALL audio_resampleQuality(void *arg)
+{
+  struct test_spec_t {
+    SDL_AudioResampleQuality quality;
+    int freq;
+    int rate_in;
+    int rate_out;
+    double signal_to_noise; /* if negative, the maximum level in decibels of the (filtered out) output instead */
+  } test_specs[] = {
+    { SDL_AUDIO_RESAMPLE_QUALITY_LINEAR, 440, 44100, 48000, 60 },
+    { SDL_AUDIO_RESAMPLE_QUALITY_LINEAR, 440, 48000, 44100, 60 },
+    { SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM, 440, 44100, 48000, 80 },
+    { SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM, 440, 48000, 44100, 80 },
+    { SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM, 440, 44100, 48001, 80 },
+    { SDL_AUDIO_RESAMPLE_QUALITY_HIGH, 440, 44100, 48000, 80 },
+    { SDL_AUDIO_RESAMPLE_QUALITY_HIGH, 440, 48000, 44100, 80 },
+    { SDL_AUDIO_RESAMPLE_QUALITY_HIGH, 440, 44100, 48001, 80 },
+    { SDL_AUDIO_RESAMPLE_QUALITY_HIGH, 15000, 48000, 22050, -40 },
+    { SDL_AUDIO_RESAMPLE_QUALITY_HIGH, 15000, 48000, 22051, -40 },
+  };
+  const int seconds = 2;
+  int spec_idx;
+
+  for (spec_idx = 0; spec_idx < (int)SDL_arraysize(test_specs); ++spec_idx) {
+    const struct test_spec_t *spec = &test_specs[spec_idx];
+    const int frames_in = seconds * spec->rate_in;
+    const int frames_out = seconds * spec->rate_out;
+    SDL_AudioSpec tmpspec1, tmpspec2;
+    SDL_AudioStream *stream = NULL;
+    float *buf_in = NULL;
+    float *buf_out = NULL;
+    double sum_squared_error = 0;
+    double sum_squared_value = 0;
+    double sum_squared_output = 0;
+    int len_out;
+    int i;
+
+    SDLTest_AssertPass("Test resampling quality %d of %i Hz sine wave from %i Hz to %i Hz",
+                       (int)spec->quality, spec->freq, spec->rate_in, spec->rate_out);
+
+    tmpspec1.format = SDL_AUDIO_F32;
+    tmpspec1.channels = 1;
+    tmpspec1.freq = spec->rate_in;
+    tmpspec2.format = SDL_AUDIO_F32;
+    tmpspec2.channels = 1;
+    tmpspec2.freq = spec->rate_out;
+    stream = SDL_CreateAudioStream(&tmpspec1, &tmpspec2);
+    SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed.");
+    if (stream == NULL) {
+      return TEST_ABORTED;
+    }
+    SDLTest_AssertCheck(SDL_SetNumberProperty(SDL_GetAudioStreamProperties(stream), SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER, spec->quality),
+                        "Expected setting the resample quality to succeed.");
+
+    buf_in = (float *)SDL_malloc(frames_in * sizeof(float));
+    buf_out = (float *)SDL_malloc(frames_out * sizeof(float));
+    if (buf_in == NULL || buf_out == NULL) {
+      SDL_free(buf_in);
+      SDL_free(buf_out);
+      SDL_DestroyAudioStream(stream);
+      return TEST_ABORTED;
+    }
+
+    for (i = 0; i < frames_in; ++i) {
+      buf_in[i] = (float)sine_wave_sample(i, spec->rate_in, spec->freq, 0);
+    }
+
+    len_out = convert_audio_chunks(stream, buf_in, frames_in * (int)sizeof(float), buf_out, frames_out * (int)sizeof(float));
+    SDLTest_AssertCheck(len_out == frames_out * (int)sizeof(float), "Expected output length to be %i, got %i.",
+                        frames_out * (int)sizeof(float), len_out);
+    SDL_DestroyAudioStream(stream);
+    SDL_free(buf_in);
+    if (len_out != frames_out * (int)sizeof(float)) {
+      SDL_free(buf_out);
+      return TEST_ABORTED;
+    }
+
+    for (i = 0; i < frames_out; ++i) {
+      const double target = sine_wave_sample(i, spec->rate_out, spec->freq, 0);
+      const double error = target - buf_out[i];
+      sum_squared_error += error * error;
+      sum_squared_value += target * target;
+      sum_squared_output += (double)buf_out[i] * buf_out[i];
+    }
+    SDL_free(buf_out);
+
+    if (spec->signal_to_noise >= 0) {
+      const double signal_to_noise = 10 * SDL_log10(sum_squared_value / sum_squared_error);
+      SDLTest_AssertCheck(signal_to_noise >= spec->signal_to_noise, "Conversion signal-to-noise ratio %f dB should be no less than %f dB.",
+                          signal_to_noise, spec->signal_to_noise);
+    } else {
+      /* Compared to a full scale sine wave */
+      const double level = 10 * SDL_log10(sum_squared_output / (frames_out * 0.5));
+      SDLTest_AssertCheck(level <= spec->signal_to_noise, "Filtered output level %f dB should be no more than %f dB.",
+                          level, spec->signal_to_noise);
+    }
+  }
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * Check that the resampler stays accurate across a change of the frequency ratio,
+ * which leaves the resample offset between the phases of the new ratio's filter.
+ *
+ * \sa SDL_SetAudioStreamFrequencyRatio
+ */
+static int SDLCALL audio_resampleRatioChange(void *arg)
+{
+  const SDL_AudioResampleQuality qualities[] = { SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM, SDL_AUDIO_RESAMPLE_QUALITY_HIGH };
+  const int rate_in = 96000;
+  const int rate_out = 48000;
+  const int freq = 5000;
+  const float ratio = 1.01f;
+  /* 96000 * 1.01f rounds to exactly 96960 Hz, so these frames end 0.34 input frames past an input frame */
+  const int frames_ratio = 1017;
+  const int frames_out = 4096;
+  const int frames_in = 3 * frames_out;
+  const int skip_frames = 32; /* Leading frames which include the silence before the stream */
+  const double step_ratio = (double)(int)((float)rate_in * ratio) / rate_out;
+  const double step = (double)rate_in / rate_out;
+  float *buf_in = NULL;
+  float *buf_out = NULL;
+  int quality_idx;
+  int i;
+
+  buf_in = (float *)SDL_malloc(frames_in * sizeof(float));
+  buf_out = (float *)SDL_malloc(frames_out * sizeof(float));
+  if (buf_in == NULL || buf_out == NULL) {
+    SDL_free(buf_in);
+    SDL_free(buf_out);
+    return TEST_ABORTED;
+  }
+
+  for (i = 0; i < frames_in; ++i) {
+    buf_in[i] = (float)sine_wave_sample(i, rate_in, freq, 0);
+  }
+
+  for (quality_idx = 0; quality_idx < (int)SDL_arraysize(qualities); ++quality_idx) {
+    SDL_AudioSpec spec_in, spec_out;
+    SDL_AudioStream *stream;
+    double sum_squared_error = 0;
+    double sum_squared_value = 0;
+    double signal_to_noise;
+    int len_out;
+
+    SDLTest_AssertPass("Test resampling quality %d from %i Hz to %i Hz, after a frequency ratio of %f",
+                       (int)qualities[quality_idx], rate_in, rate_out, ratio);
+
+    spec_in.format = SDL_AUDIO_F32;
+    spec_in.channels = 1;
+    spec_in.freq = rate_in;
+    spec_out.format = SDL_AUDIO_F32;
+    spec_out.channels = 1;
+    spec_out.freq = rate_out;
+    stream = SDL_CreateAudioStream(&spec_in, &spec_out);
+    SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed.");
+    if (stream == NULL) {
+      break;
+    }
+    SDL_SetNumberProperty(SDL_GetAudioStreamProperties(stream), SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER, qualities[quality_idx]);
+    SDL_PutAudioStreamData(stream, buf_in, frames_in * (int)sizeof(float));
+
+    SDL_SetAudioStreamFrequencyRatio(stream, ratio);
+    len_out = SDL_GetAudioStreamData(stream, buf_out, frames_ratio * (int)sizeof(float));
+    SDLTest_AssertCheck(len_out == frames_ratio * (int)sizeof(float), "Expected %i bytes, got %i.", frames_ratio * (int)sizeof(float), len_out);
+
+    SDL_SetAudioStreamFrequencyRatio(stream, 1.0f);
+    len_out = SDL_GetAudioStreamData(stream, buf_out + frames_ratio, (frames_out - frames_ratio) * (int)sizeof(float));
+    SDLTest_AssertCheck(len_out == (frames_out - frames_ratio) * (int)sizeof(float), "Expected %i bytes, got %i.",
+                        (frames_out - frames_ratio) * (int)sizeof(float), len_out);
+    SDL_DestroyAudioStream(stream);
+
+    for (i = skip_frames; i < frames_out; ++i) {
+      const double pos = (i < frames_ratio) ? (i * step_ratio) : (frames_ratio * step_ratio + (i - frames_ratio) * step);
+      const double target = SDL_sin(pos * freq / rate_in * 2.0 * SDL_PI_D);
+      const double error = target - buf_out[i];
+      sum_squared_error += error * error;
+      sum_squared_value += target * target;
+    }
+
+    signal_to_noise = 10 * SDL_log10(sum_squared_value / sum_squared_error);
+    SDLTest_AssertCheck(signal_to_noise >= 80, "Conversion signal-to-noise ratio %f dB should be no less than 80 dB.", signal_to_noise);
+  }
+
+  SDL_free(buf_in);
+  SDL_free(buf_out);
+  return TEST_COMPLETED;
+}
+
 /**
  * Check accuracy converting between audio formats.
  *
@@ -1470,6 +1666,1038 @@ cleanup:
 
     return status;
 }
+
+#define MIX_THREADS_NUM_STREAMS 16
+#define MIX_THREADS_NUM_BUFFERS 8
+
+typedef struct
+{
+    SDL_AtomicInt buffers;
+    Uint32 hash;
+} mix_threads_result_t;
+
+static void SDLCALL mix_threads_postmix(void *userdata, const SDL_AudioSpec *spec, float *buffer, int buflen)
+{
+    mix_threads_result_t *result = (mix_threads_result_t *)userdata;
+    const Uint8 *bytes = (const Uint8 *)buffer;
+    int i;
+
+    if (SDL_GetAtomicInt(&result->buffers) >= MIX_THREADS_NUM_BUFFERS) {
+        return;
+    }
+
+    /* FNV-1a over the mixed output, so any difference in summing order shows up */
+    for (i = 0; i < buflen; ++i) {
+        result->hash = (result->hash ^ bytes[i]) * 16777619u;
+    }
+    SDL_AddAtomicInt(&result->buffers, 1);
+}
+
+static bool mix_threads_run(const char *threads, Uint32 *hash)
+{
+    SDL_AudioSpec devspec, srcspec;
+    SDL_AudioStream *streams[MIX_THREADS_NUM_STREAMS];
+    SDL_AudioDeviceID devid;
+    mix_threads_result_t result;
+    float *data = NULL;
+    const int frames = 44100;
+    Uint64 timeout;
+    bool retval = false;
+    int i, j;
+
+    SDL_zeroa(streams);
+    SDL_zero(result);
+    result.hash = 2166136261u;
+
+    SDL_SetHint(SDL_HINT_AUDIO_DEVICE_MIX_THREADS, threads);
+
+    devspec.format = SDL_AUDIO_F32;
+    devspec.channels = 2;
+    devspec.freq = 48000;
+    devid = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &devspec);
+    SDLTest_AssertPass("Call to SDL_OpenAudioDevice() with %s mix threads", threads);
+    if (!SDLTest_AssertCheck(devid != 0, "Validate device ID; expected: != 0, got: %" SDL_PRIu32, devid)) {
+        goto cleanup;
+    }
+    SDL_PauseAudioDevice(devid);
+
+    srcspec.format = SDL_AUDIO_F32;
+    srcspec.channels = 2;
+    srcspec.freq = 44100;
+    data = (float *)SDL_malloc(frames * 2 * sizeof(float));
+    if (!SDLTest_AssertCheck(data != NULL, "Expected source buffer to be created.")) {
+        goto cleanup;
+    }
+
+    for (i = 0; i < MIX_THREADS_NUM_STREAMS; ++i) {
+        streams[i] = SDL_CreateAudioStream(&srcspec, NULL);
+        if (!SDLTest_AssertCheck(streams[i] != NULL, "Expected SDL_CreateAudioStream to succeed")) {
+            goto cleanup;
+        }
+    }
+
+    if (!SDLTest_AssertCheck(SDL_BindAudioStreams(devid, streams, MIX_THREADS_NUM_STREAMS), "Expected SDL_BindAudioStreams to succeed")) {
+        goto cleanup;
+    }
+
+    /* the device is paused, so nothing is pulled from the streams until all of them are full */
+    for (i = 0; i < MIX_THREADS_NUM_STREAMS; ++i) {
+        for (j = 0; j < frames; ++j) {
+            data[j * 2] = data[j * 2 + 1] = 0.05f * (float)sine_wave_sample(j, srcspec.freq, 100 + i * 50, 0.0);
+        }
+        if (!SDLTest_AssertCheck(SDL_PutAudioStreamData(streams[i], data, frames * 2 * sizeof(float)), "Expected SDL_PutAudioStreamData to succeed")) {
+            goto cleanup;
+        }
+    }
+    SDL_SetAudioPostmixCallback(devid, mix_threads_postmix, &result);
+    SDL_ResumeAudioDevice(devid);
+
+    timeout = SDL_GetTicks() + 5000;
+    while (SDL_GetAtomicInt(&result.buffers) < MIX_THREADS_NUM_BUFFERS && SDL_GetTicks() < timeout) {
+        SDL_Delay(10);
+    }
+    if (!SDLTest_AssertCheck(SDL_GetAtomicInt(&result.buffers) >= MIX_THREADS_NUM_BUFFERS, "Expected %d buffers to be mixed", MIX_THREADS_NUM_BUFFERS)) {
+        goto cleanup;
+    }
+
+    *hash = result.hash;
+    retval = true;
+
+cleanup:
+    if (devid) {
+        SDL_CloseAudioDevice(devid);
+    }
+    for (i = 0; i < MIX_THREADS_NUM_STREAMS; ++i) {
+        SDL_DestroyAudioStream(streams[i]);
+    }
+    SDL_free(data);
+    SDL_ResetHint(SDL_HINT_AUDIO_DEVICE_MIX_THREADS);
+    return retval;
+}
+
+/**
+ * Check that mixing bound streams on worker threads gives the same output as mixing them serially.
+ *
+ * \sa SDL_HINT_AUDIO_DEVICE_MIX_THREADS
+ */
+static int SDLCALL audio_mixThreads(void *arg)
+{
+    Uint32 serial_hash = 0;
+    Uint32 threaded_hash = 0;
+
+    if (!mix_threads_run("1", &serial_hash) || !mix_threads_run("4", &threaded_hash)) {
+        return TEST_ABORTED;
+    }
+
+    SDLTest_AssertCheck(serial_hash == threaded_hash, "Expected identical output; serial hash 0x%08" SDL_PRIx32 ", threaded hash 0x%08" SDL_PRIx32,
+                        serial_hash, threaded_hash);
+
+    return TEST_COMPLETED;
+}
+
+/* The scalar mixing rules from SDL_mixer.c, which the SIMD mixers have to match exactly. */
+static void mix_audio_reference(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format, int num_samples, float fvolume)
+{
+    const int volume = (int)SDL_roundf(fvolume * 128);
+    int i;
+
+    for (i = 0; i < num_samples; i++) {
+        switch (format) {
+        case SDL_AUDIO_U8:
+        {
+            const int s = (Uint8)((((src[i] - 128) * volume) / 128) + 128);
+            dst[i] = (Uint8)SDL_clamp(dst[i] + s - 128, 0, 255);
+        } break;
+        case SDL_AUDIO_S8:
+        {
+            const int s = (Sint8)((((Sint8)src[i]) * volume) / 128);
+            dst[i] = (Uint8)(Sint8)SDL_clamp(((Sint8)dst[i]) + s, SDL_MIN_SINT8, SDL_MAX_SINT8);
+        } break;
+        case SDL_AUDIO_S16:
+        {
+            const int s = (Sint16)((((const Sint16 *)src)[i] * volume) / 128);
+            ((Sint16 *)dst)[i] = (Sint16)SDL_clamp(((Sint16 *)dst)[i] + s, SDL_MIN_SINT16, SDL_MAX_SINT16);
+        } break;
+        case SDL_AUDIO_S32:
+        {
+            const Sint64 s = ((Sint64)((const Sint32 *)src)[i] * volume) / 128;
+            ((Sint32 *)dst)[i] = (Sint32)SDL_clamp(((Sint32 *)dst)[i] + s, SDL_MIN_SINT32, SDL_MAX_SINT32);
+        } break;
+        case SDL_AUDIO_F32:
+        {
+            const float s = ((const float *)src)[i] * fvolume;
+            ((float *)dst)[i] = SDL_clamp(((float *)dst)[i] + s, -1.0f, 1.0f);
+        } break;
+        default:
+            break;
+        }
+    }
+}
+
+/**
+ * Check that SDL_MixAudio gives the same results for every native format,
+ * whichever mixing code is used on this CPU.
+ *
+ * \sa SDL_MixAudio
+ */
+static int SDLCALL audio_mixAudio(void *arg)
+{
+    static const SDL_AudioFormat formats[] = { SDL_AUDIO_U8, SDL_AUDIO_S8, SDL_AUDIO_S16, SDL_AUDIO_S32, SDL_AUDIO_F32 };
+    static const float volumes[] = { 0.1f, 0.5f, 0.75f, 1.0f, 1.5f };
+    const int num_samples = 1031; /* not a multiple of any vector size, so the leftovers get tested too */
+    Uint8 *src = NULL;
+    Uint8 *dst = NULL;
+    Uint8 *expected = NULL;
+    int status = TEST_ABORTED;
+    int i, j, k;
+
+    src = (Uint8 *)SDL_malloc(num_samples * 4);
+    dst = (Uint8 *)SDL_malloc(num_samples * 4);
+    expected = (Uint8 *)SDL_malloc(num_samples * 4);
+    if (!SDLTest_AssertCheck(src && dst && expected, "Expected buffers to be created.")) {
+        goto cleanup;
+    }
+
+    for (i = 0; i < (int)SDL_arraysize(formats); i++) {
+        const SDL_AudioFormat format = formats[i];
+        const int len = num_samples * SDL_AUDIO_BYTESIZE(format);
+
+        for (j = 0; j < (int)SDL_arraysize(volumes); j++) {
+            if (SDL_AUDIO_ISFLOAT(format)) {
+                for (k = 0; k < num_samples; k++) {
+                    ((float *)src)[k] = SDLTest_RandomUnitFloat() * 2.0f - 1.0f;
+                    ((float *)dst)[k] = SDLTest_RandomUnitFloat() * 2.0f - 1.0f;
+                }
+            } else {
+                for (k = 0; k < len; k++) {
+                    src[k] = SDLTest_RandomUint8();
+                    dst[k] = SDLTest_RandomUint8();
+                }
+            }
+            SDL_memcpy(expected, dst, len);
+            mix_audio_reference(expected, src, format, num_samples, volumes[j]);
+
+            SDLTest_AssertCheck(SDL_MixAudio(dst, src, format, len, volumes[j]), "Expected SDL_MixAudio(%s, %.2f) to succeed", SDL_GetAudioFormatName(format), volumes[j]);
+            SDLTest_AssertCheck(SDL_memcmp(dst, expected, len) == 0, "Expected SDL_MixAudio(%s, %.2f) to match the reference mixer", SDL_GetAudioFormatName(format), volumes[j]);
+        }
+    }
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    SDL_free(src);
+    SDL_free(dst);
+    SDL_free(expected);
+    return status;
+}
+#define GAIN_RAMP_NUM_BUFFERS 8
+
+typedef struct
+{
+    SDL_AtomicInt buffers;
+    float max_step;
+    float last_sample;
+    float final_sample;
+} gain_ramp_result_t;
+
+static void SDLCALL gain_ramp_postmix(void *userdata, const SDL_AudioSpec *spec, float *buffer, int buflen)
+{
+    gain_ramp_result_t *result = (gain_ramp_result_t *)userdata;
+    const int num_samples = buflen / (int)sizeof(float);
+    int i;
+
+    if (SDL_GetAtomicInt(&result->buffers) >= GAIN_RAMP_NUM_BUFFERS) {
+        return;
+    }
+
+    /* the stream is DC, so any jump between samples is a gain change that wasn't smoothed out.
+       The first buffer is skipped, since it might have some resampler ringing as the signal starts. */
+    for (i = 0; i < num_samples; ++i) {
+        if (SDL_GetAtomicInt(&result->buffers) > 0) {
+            result->max_step = SDL_max(result->max_step, SDL_fabsf(buffer[i] - result->last_sample));
+        }
+        result->last_sample = buffer[i];
+    }
+    result->final_sample = buffer[num_samples - 1];
+    SDL_AddAtomicInt(&result->buffers, 1);
+}
+
+/**
+ * Check that changing a bound stream's gain ramps to the new value instead of jumping.
+ *
+ * \sa SDL_SetAudioStreamGain
+ */
+static int SDLCALL audio_gainRamp(void *arg)
+{
+    SDL_AudioSpec spec;
+    SDL_AudioStream *streams[2] = { NULL, NULL };
+    SDL_AudioDeviceID devid;
+    gain_ramp_result_t result;
+    float *data = NULL;
+    const int frames = 48000 * 2;
+    Uint64 timeout;
+    int status = TEST_ABORTED;
+    int i;
+
+    SDL_zero(result);
+
+    spec.format = SDL_AUDIO_F32;
+    spec.channels = 1;
+    spec.freq = 48000;
+    devid = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec);
+    SDLTest_AssertPass("Call to SDL_OpenAudioDevice()");
+    if (!SDLTest_AssertCheck(devid != 0, "Validate device ID; expected: != 0, got: %" SDL_PRIu32, devid)) {
+        goto cleanup;
+    }
+    SDL_PauseAudioDevice(devid);
+
+    data = (float *)SDL_malloc(frames * sizeof(float));
+    if (!SDLTest_AssertCheck(data != NULL, "Expected source buffer to be created.")) {
+        goto cleanup;
+    }
+    for (i = 0; i < frames; ++i) {
+        data[i] = 0.5f;
+    }
+
+    /* two streams, so the device has to mix instead of copying straight through */
+    for (i = 0; i < (int)SDL_arraysize(streams); ++i) {
+        streams[i] = SDL_CreateAudioStream(&spec, NULL);
+        if (!SDLTest_AssertCheck(streams[i] != NULL, "Expected SDL_CreateAudioStream to succeed")) {
+            goto cleanup;
+        }
+    }
+    if (!SDLTest_AssertCheck(SDL_BindAudioStreams(devid, streams, (int)SDL_arraysize(streams)), "Expected SDL_BindAudioStreams to succeed")) {
+        goto cleanup;
+    }
+    SDL_PutAudioStreamData(streams[0], data, frames * sizeof(float));
+    SDL_memset(data, 0, frames * sizeof(float));
+    SDL_PutAudioStreamData(streams[1], data, frames * sizeof(float));
+
+    SDL_SetAudioPostmixCallback(devid, gain_ramp_postmix, &result);
+    SDL_ResumeAudioDevice(devid);
+
+    timeout = SDL_GetTicks() + 5000;
+    while (SDL_GetAtomicInt(&result.buffers) < 2 && SDL_GetTicks() < timeout) {
+        SDL_Delay(1);
+    }
+    SDL_SetAudioStreamGain(streams[0], 0.0f);
+    while (SDL_GetAtomicInt(&result.buffers) < GAIN_RAMP_NUM_BUFFERS && SDL_GetTicks() < timeout) {
+        SDL_Delay(10);
+    }
+    if (!SDLTest_AssertCheck(SDL_GetAtomicInt(&result.buffers) >= GAIN_RAMP_NUM_BUFFERS, "Expected %d buffers to be mixed", GAIN_RAMP_NUM_BUFFERS)) {
+        goto cleanup;
+    }
+
+    SDLTest_AssertCheck(result.final_sample == 0.0f, "Expected the output to end up silent, got %f", result.final_sample);
+    SDLTest_AssertCheck(result.max_step < 0.01f, "Expected no sudden jumps in the output, largest was %f", result.max_step);
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    if (devid) {
+        SDL_CloseAudioDevice(devid);
+    }
+    for (i = 0; i < (int)SDL_arraysize(streams); ++i) {
+        SDL_DestroyAudioStream(streams[i]);
+    }
+    SDL_free(data);
+    return status;
+}
+
+typedef struct single_producer_data_t
+{
+    SDL_AudioStream *stream;
+    SDL_Semaphore *done;
+    int start;
+    int count;
+    bool result;
+} single_producer_data_t;
+
+static int SDLCALL single_producer_thread(void *arg)
+{
+    single_producer_data_t *data = (single_producer_data_t *)arg;
+    Sint32 buffer[1000];
+    int value = data->start;
+    const int end = data->start + data->count;
+    int chunk = 1;
+
+    data->result = true;
+    while (value < end) {
+        const int len = SDL_min(chunk, end - value);
+        int i;
+
+        for (i = 0; i < len; ++i) {
+            buffer[i] = value++;
+        }
+        if (!SDL_PutAudioStreamData(data->stream, buffer, len * (int)sizeof(Sint32))) {
+            data->result = false;
+            break;
+        }
+        chunk = ((chunk + 37) % (int)SDL_arraysize(buffer)) + 1;
+    }
+    SDL_SignalSemaphore(data->done);
+    return 0;
+}
+
+/**
+ * Check that a single producer can put data into a stream without waiting on its lock, and that none of it is lost or reordered.
+ *
+ * \sa SDL_PutAudioStreamData
+ * \sa SDL_GetAudioStreamData
+ */
+static int SDLCALL audio_singleProducer(void *arg)
+{
+    SDL_AudioSpec spec;
+    SDL_AudioStream *stream = NULL;
+    SDL_Thread *thread = NULL;
+    single_producer_data_t data;
+    Sint32 buffer[777];
+    const int first_count = 100000;
+    const int total = 2000000;
+    int expected = 0;
+    bool in_order = true;
+    Uint64 timeout;
+    int status = TEST_ABORTED;
+    int i;
+
+    SDL_zero(data);
+
+    spec.format = SDL_AUDIO_S32;
+    spec.channels = 1;
+    spec.freq = 48000;
+    stream = SDL_CreateAudioStream(&spec, &spec);
+    if (!SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed")) {
+        goto cleanup;
+    }
+    SDL_SetBooleanProperty(SDL_GetAudioStreamProperties(stream), SDL_PROP_AUDIOSTREAM_SINGLE_PRODUCER_BOOLEAN, true);
+
+    data.stream = stream;
+    data.done = SDL_CreateSemaphore(0);
+    if (!SDLTest_AssertCheck(data.done != NULL, "Expected SDL_CreateSemaphore to succeed")) {
+        goto cleanup;
+    }
+
+    /* the first put settles the format, after that the producer shouldn't need the lock at all */
+    buffer[0] = 0;
+    SDL_PutAudioStreamData(stream, buffer, sizeof(Sint32));
+    data.start = 1;
+    data.count = first_count - 1;
+
+    SDL_LockAudioStream(stream);
+    thread = SDL_CreateThread(single_producer_thread, "SingleProducer", &data);
+    if (!SDLTest_AssertCheck(thread != NULL, "Expected SDL_CreateThread to succeed")) {
+        SDL_UnlockAudioStream(stream);
+        goto cleanup;
+    }
+    SDLTest_AssertCheck(SDL_WaitSemaphoreTimeout(data.done, 5000), "Expected the producer to finish while the stream is locked");
+    SDL_UnlockAudioStream(stream);
+    SDL_WaitThread(thread, NULL);
+    thread = NULL;
+    SDLTest_AssertCheck(data.result, "Expected SDL_PutAudioStreamData to succeed");
+    SDLTest_AssertCheck(SDL_GetAudioStreamQueued(stream) == first_count * (int)sizeof(Sint32), "Expected %d bytes queued, got %d", first_count * (int)sizeof(Sint32), SDL_GetAudioStreamQueued(stream));
+
+    /* now read while the producer is writing */
+    data.start = first_count;
+    data.count = total - first_count;
+    thread = SDL_CreateThread(single_producer_thread, "SingleProducer", &data);
+    if (!SDLTest_AssertCheck(thread != NULL, "Expected SDL_CreateThread to succeed")) {
+        goto cleanup;
+    }
+
+    timeout = SDL_GetTicks() + 30000;
+    while (expected < total && in_order && SDL_GetTicks() < timeout) {
+        const int got = SDL_GetAudioStreamData(stream, buffer, sizeof(buffer));
+        if (got < 0) {
+            break;
+        }
+        for (i = 0; i < got / (int)sizeof(Sint32); ++i) {
+            if (buffer[i] != expected) {
+                in_order = false;
+                break;
+            }
+            ++expected;
+        }
+    }
+    SDL_WaitThread(thread, NULL);
+    thread = NULL;
+
+    SDLTest_AssertCheck(data.result, "Expected SDL_PutAudioStreamData to succeed");
+    SDLTest_AssertCheck(in_order, "Expected the data in order, checked %d samples", expected);
+    SDLTest_AssertCheck(expected == total, "Expected %d samples, got %d", total, expected);
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    if (thread) {
+        SDL_WaitThread(thread, NULL);
+    }
+    SDL_DestroySemaphore(data.done);
+    SDL_DestroyAudioStream(stream);
+    return status;
+}
+
+/**
+ * Check the stream queue's memory pool properties, and that a steady stream of data doesn't allocate.
+ *
+ * \sa SDL_GetAudioStreamProperties
+ */
+static int SDLCALL audio_queuePool(void *arg)
+{
+    SDL_AudioSpec spec;
+    SDL_AudioStream *stream = NULL;
+    SDL_PropertiesID props;
+    Uint8 buffer[4096];
+    const int reserved = 4;
+    Sint64 allocated, recycled, freed;
+    int status = TEST_ABORTED;
+    int i;
+
+    SDL_memset(buffer, 0, sizeof(buffer));
+
+    spec.format = SDL_AUDIO_S16;
+    spec.channels = 2;
+    spec.freq = 48000;
+    stream = SDL_CreateAudioStream(&spec, &spec);
+    if (!SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed")) {
+        goto cleanup;
+    }
+
+    props = SDL_GetAudioStreamProperties(stream);
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_AUDIOSTREAM_QUEUE_BLOCKS_ALLOCATED_NUMBER, -1) >= 0, "Expected the allocation counter to be set");
+    SDL_SetNumberProperty(props, SDL_PROP_AUDIOSTREAM_QUEUE_CHUNK_SIZE_NUMBER, 2048);
+    SDL_SetNumberProperty(props, SDL_PROP_AUDIOSTREAM_QUEUE_RESERVED_CHUNKS_NUMBER, reserved);
+    SDL_SetNumberProperty(props, SDL_PROP_AUDIOSTREAM_QUEUE_MAX_FREE_CHUNKS_NUMBER, 0);
+
+    /* the reservation happens on the next put */
+    SDL_PutAudioStreamData(stream, buffer, 4);
+    SDL_GetAudioStreamData(stream, buffer, 4);
+    props = SDL_GetAudioStreamProperties(stream);
+    allocated = SDL_GetNumberProperty(props, SDL_PROP_AUDIOSTREAM_QUEUE_BLOCKS_ALLOCATED_NUMBER, -1);
+    SDLTest_AssertCheck(allocated >= reserved * 2, "Expected at least %d chunks and tracks to be allocated, got %" SDL_PRIs64, reserved, allocated);
+
+    /* two chunks of data in flight at a time, well within the reservation */
+    for (i = 0; i < 100; ++i) {
+        SDL_PutAudioStreamData(stream, buffer, sizeof(buffer));
+        if (SDL_GetAudioStreamData(stream, buffer, sizeof(buffer)) != sizeof(buffer)) {
+            SDLTest_AssertCheck(false, "Expected to get %d bytes back", (int)sizeof(buffer));
+            goto cleanup;
+        }
+    }
+
+    props = SDL_GetAudioStreamProperties(stream);
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_AUDIOSTREAM_QUEUE_BLOCKS_ALLOCATED_NUMBER, -1) == allocated, "Expected no more allocations, got %" SDL_PRIs64 " (was %" SDL_PRIs64 ")", SDL_GetNumberProperty(props, SDL_PROP_AUDIOSTREAM_QUEUE_BLOCKS_ALLOCATED_NUMBER, -1), allocated);
+    recycled = SDL_GetNumberProperty(props, SDL_PROP_AUDIOSTREAM_QUEUE_BLOCKS_RECYCLED_NUMBER, -1);
+    SDLTest_AssertCheck(recycled >= 200, "Expected chunks to be recycled, got %" SDL_PRIs64, recycled);
+
+    /* dropping the reservation frees everything beyond the cap */
+    SDL_SetNumberProperty(props, SDL_PROP_AUDIOSTREAM_QUEUE_RESERVED_CHUNKS_NUMBER, 0);
+    SDL_PutAudioStreamData(stream, buffer, 4);
+    props = SDL_GetAudioStreamProperties(stream);
+    freed = SDL_GetNumberProperty(props, SDL_PROP_AUDIOSTREAM_QUEUE_BLOCKS_FREED_NUMBER, -1);
+    SDLTest_AssertCheck(freed >= reserved - 1, "Expected the unused chunks to be freed, got %" SDL_PRIs64, freed);
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    SDL_DestroyAudioStream(stream);
+    return status;
+}
+
+/* Writes a little-endian value into a WAVE header being built in memory. */
+static Uint8 *PutLE(Uint8 *dst, Uint32 value, int size)
+{
+    int i;
+    for (i = 0; i < size; ++i) {
+        *(dst++) = (Uint8)(value >> (i * 8));
+    }
+    return dst;
+}
+
+/* Builds a WAVE file in memory. The data of ADPCM blocks is random, only the headers have to be valid. */
+static Uint8 *BuildWAV(Uint16 encoding, Uint16 channels, Uint16 bits, Uint16 blockalign, Uint16 samplesperblock, Uint32 datalength, size_t *length)
+{
+    static const Sint16 coeffs[14] = { 256, 0, 512, -256, 0, 0, 192, 64, 240, 0, 460, -208, 392, -232 };
+    const bool msadpcm = (encoding == 0x02);
+    const bool adpcm = (encoding == 0x11);
+    const Uint32 fmtlength = msadpcm ? 50 : adpcm ? 20 : 16;
+    const Uint32 headerlength = 12 + 8 + fmtlength + 8;
+    Uint8 *wav = (Uint8 *)SDL_malloc(headerlength + datalength);
+    Uint8 *ptr = wav;
+    Uint32 i;
+
+    if (!wav) {
+        return NULL;
+    }
+
+    SDL_memcpy(ptr, "RIFF", 4);
+    ptr = PutLE(ptr + 4, headerlength - 8 + datalength, 4);
+    SDL_memcpy(ptr, "WAVEfmt ", 8);
+    ptr = PutLE(ptr + 8, fmtlength, 4);
+    ptr = PutLE(ptr, encoding, 2);
+    ptr = PutLE(ptr, channels, 2);
+    ptr = PutLE(ptr, 22050, 4);
+    ptr = PutLE(ptr, 22050 * blockalign, 4);
+    ptr = PutLE(ptr, blockalign, 2);
+    ptr = PutLE(ptr, bits, 2);
+    if (msadpcm) {
+        ptr = PutLE(ptr, 32, 2);
+        ptr = PutLE(ptr, samplesperblock, 2);
+        ptr = PutLE(ptr, 7, 2);
+        for (i = 0; i < SDL_arraysize(coeffs); ++i) {
+            ptr = PutLE(ptr, (Uint16)coeffs[i], 2);
+        }
+    } else if (adpcm) {
+        ptr = PutLE(ptr, 2, 2);
+        ptr = PutLE(ptr, samplesperblock, 2);
+    }
+    SDL_memcpy(ptr, "data", 4);
+    ptr = PutLE(ptr + 4, datalength, 4);
+
+    for (i = 0; i < datalength; ++i) {
+        ptr[i] = (Uint8)SDL_rand(256);
+        if (msadpcm && (i % blockalign) < channels) {
+            /* Block header: the predictor index comes first, followed by the delta and two samples */
+            ptr[i] = (Uint8)SDL_rand(7);
+        } else if (adpcm && (i % blockalign) < (Uint32)channels * 4) {
+            /* Block header: initial sample, step index and a reserved byte */
+            switch (i % 4) {
+            case 2:
+                ptr[i] = (Uint8)SDL_rand(89);
+                break;
+            case 3:
+                ptr[i] = 0;
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    *length = headerlength + datalength;
+    return wav;
+}
+
+/**
+ * Reads WAVE files in pieces and after seeking, and compares the result with SDL_LoadWAV_IO.
+ *
+ * \sa SDL_OpenWAVReader_IO
+ * \sa SDL_ReadWAVFrames
+ * \sa SDL_SeekWAVReader
+ */
+static int SDLCALL audio_wavReader(void *arg)
+{
+    const struct
+    {
+        const char *name;
+        Uint16 encoding;
+        Uint16 channels;
+        Uint16 bits;
+        Uint16 blockalign;
+        Uint16 samplesperblock;
+        Uint32 datalength;
+    } files[] = {
+        { "16-bit PCM", 0x0001, 2, 16, 4, 0, 40000 },
+        { "24-bit PCM", 0x0001, 1, 24, 3, 0, 30000 },
+        { "mu-law", 0x0007, 2, 8, 2, 0, 20000 },
+        { "IMA ADPCM", 0x0011, 2, 4, 256, 249, 256 * 20 },
+        { "IMA ADPCM with a short last block", 0x0011, 1, 4, 256, 505, 256 * 20 + 100 },
+    };
+    int status = TEST_ABORTED;
+    int f;
+
+    for (f = 0; f < (int)SDL_arraysize(files); ++f) {
+        SDL_AudioSpec spec, readerspec;
+        SDL_WAVReader *reader = NULL;
+        Uint8 *wav = NULL;
+        Uint8 *loaded = NULL;
+        Uint8 *streamed = NULL;
+        size_t wavlength = 0;
+        Uint32 loadedlength = 0;
+        Sint64 frames;
+        int framesize;
+        int pos, read;
+        bool ok = false;
+
+        SDLTest_Log("Reading %s", files[f].name);
+
+        wav = BuildWAV(files[f].encoding, files[f].channels, files[f].bits, files[f].blockalign, files[f].samplesperblock, files[f].datalength, &wavlength);
+        if (!SDLTest_AssertCheck(wav != NULL, "Expected the WAVE file to be built")) {
+            goto next;
+        }
+
+        if (!SDLTest_AssertCheck(SDL_LoadWAV_IO(SDL_IOFromConstMem(wav, wavlength), true, &spec, &loaded, &loadedlength), "Expected SDL_LoadWAV_IO to succeed: %s", SDL_GetError())) {
+            goto next;
+        }
+
+        reader = SDL_OpenWAVReader_IO(SDL_IOFromConstMem(wav, wavlength), true, &readerspec);
+        if (!SDLTest_AssertCheck(reader != NULL, "Expected SDL_OpenWAVReader_IO to succeed: %s", SDL_GetError())) {
+            goto next;
+        }
+        SDLTest_AssertCheck(SDL_memcmp(&spec, &readerspec, sizeof(spec)) == 0, "Expected the same format as SDL_LoadWAV_IO");
+
+        framesize = SDL_AUDIO_FRAMESIZE(spec);
+        frames = SDL_GetWAVReaderFrames(reader);
+        if (!SDLTest_AssertCheck(frames * framesize == loadedlength, "Expected %d frames, got %" SDL_PRIs64, (int)(loadedlength / framesize), frames)) {
+            goto next;
+        }
+
+        /* Read it all in odd sized pieces */
+        streamed = (Uint8 *)SDL_malloc(loadedlength + framesize);
+        if (!streamed) {
+            goto next;
+        }
+        pos = 0;
+        while ((read = SDL_ReadWAVFrames(reader, streamed + pos * framesize, 123)) > 0) {
+            pos += read;
+        }
+        SDLTest_AssertCheck(read == 0, "Expected to reach the end of the data, got %d", read);
+        SDLTest_AssertCheck(pos == frames, "Expected %" SDL_PRIs64 " frames to be read, got %d", frames, pos);
+        SDLTest_AssertCheck(SDL_memcmp(streamed, loaded, loadedlength) == 0, "Expected the same data as SDL_LoadWAV_IO");
+
+        /* Then jump around */
+        for (read = 0; read < 20; ++read) {
+            const Sint64 target = SDL_rand_bits() % frames;
+            const int count = (int)SDL_min(frames - target, 300);
+            SDL_SeekWAVReader(reader, target);
+            if (SDL_TellWAVReader(reader) != target ||
+                SDL_ReadWAVFrames(reader, streamed, count) != count ||
+                SDL_memcmp(streamed, loaded + target * framesize, (size_t)count * framesize) != 0) {
+                SDLTest_AssertCheck(false, "Expected to read %d frames at frame %" SDL_PRIs64, count, target);
+                goto next;
+            }
+        }
+
+        SDLTest_AssertCheck(SDL_SeekWAVReader(reader, frames + 100), "Expected seeking past the end to succeed");
+        SDLTest_AssertCheck(SDL_TellWAVReader(reader) == frames, "Expected the position to be clamped to the end");
+        ok = true;
+
+    next:
+        SDL_CloseWAVReader(reader);
+        SDL_free(streamed);
+        SDL_free(loaded);
+        SDL_free(wav);
+        if (!ok) {
+            return status;
+        }
+    }
+
+    status = TEST_COMPLETED;
+    return status;
+}
+
+/* A memory stream that doesn't know its size, like a pipe, so a truncated
+ * file isn't noticed until reading runs out of data.
+ */
+typedef struct
+{
+    const Uint8 *data;
+    size_t length;
+    Sint64 position;
+} UnsizedStream;
+
+static Sint64 SDLCALL UnsizedStream_size(void *userdata)
+{
+    return -1;
+}
+
+static Sint64 SDLCALL UnsizedStream_seek(void *userdata, Sint64 offset, SDL_IOWhence whence)
+{
+    UnsizedStream *stream = (UnsizedStream *)userdata;
+    Sint64 position;
+
+    if (whence == SDL_IO_SEEK_SET) {
+        position = offset;
+    } else if (whence == SDL_IO_SEEK_CUR) {
+        position = stream->position + offset;
+    } else {
+        SDL_SetError("Can't seek from the end of an unsized stream");
+        return -1;
+    }
+    if (position < 0) {
+        SDL_SetError("Seek before the start of the stream");
+        return -1;
+    }
+    stream->position = position;
+    return position;
+}
+
+static size_t SDLCALL UnsizedStream_read(void *userdata, void *ptr, size_t size, SDL_IOStatus *status)
+{
+    UnsizedStream *stream = (UnsizedStream *)userdata;
+
+    if (stream->position >= (Sint64)stream->length) {
+        *status = SDL_IO_STATUS_EOF;
+        return 0;
+    }
+    size = SDL_min(size, stream->length - (size_t)stream->position);
+    SDL_memcpy(ptr, stream->data + stream->position, size);
+    stream->position += size;
+    return size;
+}
+
+static bool SDLCALL UnsizedStream_close(void *userdata)
+{
+    return true;
+}
+
+/**
+ * Reads WAVE files that end in the middle of the data chunk from a stream of
+ * unknown size, and checks that only the frames that were in the file are
+ * returned.
+ *
+ * \sa SDL_OpenWAVReader_IO
+ * \sa SDL_ReadWAVFrames
+ */
+static int SDLCALL audio_wavReaderTruncated(void *arg)
+{
+    const struct
+    {
+        const char *name;
+        Uint16 encoding;
+        Uint16 channels;
+        Uint16 bits;
+        Uint16 blockalign;
+        Uint32 datalength;
+    } files[] = {
+        { "16-bit PCM", 0x0001, 2, 16, 4, 40000 },
+        { "24-bit PCM", 0x0001, 1, 24, 3, 30000 },
+        { "mu-law", 0x0007, 2, 8, 2, 20000 },
+    };
+    const int chunk_frames = 700;
+    const Uint32 cut = 1001; /* bytes removed from the end, in the middle of a frame */
+    int f;
+
+    for (f = 0; f < (int)SDL_arraysize(files); ++f) {
+        SDL_AudioSpec spec;
+        SDL_IOStreamInterface iface;
+        UnsizedStream unsized;
+        SDL_WAVReader *reader = NULL;
+        Uint8 *wav = NULL;
+        Uint8 *loaded = NULL;
+        Uint8 *buf = NULL;
+        size_t wavlength = 0;
+        Uint32 loadedlength = 0;
+        const int expected_frames = (int)((files[f].datalength - cut) / files[f].blockalign);
+        int framesize, pos = 0, read, i;
+        bool ok = false;
+
+        SDLTest_Log("Reading truncated %s", files[f].name);
+
+        wav = BuildWAV(files[f].encoding, files[f].channels, files[f].bits, files[f].blockalign, 0, files[f].datalength, &wavlength);
+        if (!SDLTest_AssertCheck(wav != NULL, "Expected the WAVE file to be built")) {
+            goto next;
+        }
+        if (!SDLTest_AssertCheck(SDL_LoadWAV_IO(SDL_IOFromConstMem(wav, wavlength), true, &spec, &loaded, &loadedlength), "Expected SDL_LoadWAV_IO to succeed: %s", SDL_GetError())) {
+            goto next;
+        }
+
+        SDL_INIT_INTERFACE(&iface);
+        iface.size = UnsizedStream_size;
+        iface.seek = UnsizedStream_seek;
+        iface.read = UnsizedStream_read;
+        iface.close = UnsizedStream_close;
+        unsized.data = wav;
+        unsized.length = wavlength - cut;
+        unsized.position = 0;
+        reader = SDL_OpenWAVReader_IO(SDL_OpenIO(&iface, &unsized), true, NULL);
+        if (!SDLTest_AssertCheck(reader != NULL, "Expected SDL_OpenWAVReader_IO to succeed: %s", SDL_GetError())) {
+            goto next;
+        }
+
+        framesize = SDL_AUDIO_FRAMESIZE(spec);
+        buf = (Uint8 *)SDL_malloc((size_t)chunk_frames * framesize);
+        if (!buf) {
+            goto next;
+        }
+        for (;;) {
+            SDL_memset(buf, 0xAA, (size_t)chunk_frames * framesize);
+            read = SDL_ReadWAVFrames(reader, buf, chunk_frames);
+            if (read <= 0) {
+                break;
+            }
+            if (!SDLTest_AssertCheck(pos + read <= expected_frames, "Expected at most %d frames, got %d", expected_frames, pos + read) ||
+                !SDLTest_AssertCheck(SDL_memcmp(buf, loaded + (size_t)pos * framesize, (size_t)read * framesize) == 0, "Expected the same data as SDL_LoadWAV_IO at frame %d", pos)) {
+                goto next;
+            }
+            /* The bytes of an incomplete last frame may be left in the buffer, but nothing else */
+            for (i = (read + 1) * framesize; i < chunk_frames * framesize; ++i) {
+                if (buf[i] != 0xAA) {
+                    break;
+                }
+            }
+            if (!SDLTest_AssertCheck(i >= chunk_frames * framesize, "Expected nothing to be written past the %d frames that were read", read)) {
+                goto next;
+            }
+            pos += read;
+        }
+        SDLTest_AssertCheck(read == 0, "Expected to reach the end of the data, got %d", read);
+        SDLTest_AssertCheck(pos == expected_frames, "Expected %d frames to be read, got %d", expected_frames, pos);
+        ok = true;
+
+    next:
+        SDL_CloseWAVReader(reader);
+        SDL_free(buf);
+        SDL_free(loaded);
+        SDL_free(wav);
+        if (!ok) {
+            return TEST_ABORTED;
+        }
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Decodes MS and IMA ADPCM WAVE files with and without threads and compares the output.
+ *
+ * \sa SDL_LoadWAV_IO
+ */
+static int SDLCALL audio_wavDecodeThreads(void *arg)
+{
+    const struct
+    {
+        const char *name;
+        Uint16 encoding;
+        Uint16 samplesperblock;
+    } files[] = {
+        { "MS ADPCM", 0x0002, 244 },
+        { "IMA ADPCM", 0x0011, 249 },
+    };
+    const char *truncation[] = { "dropblock", "dropframe" };
+    Uint8 *wav = NULL;
+    Uint8 *serial = NULL;
+    Uint8 *threaded = NULL;
+    Uint32 serial_len = 0, threaded_len = 0;
+    size_t wavlength = 0;
+    SDL_AudioSpec spec;
+    int status = TEST_ABORTED;
+    int f, t;
+
+    for (f = 0; f < (int)SDL_arraysize(files); ++f) {
+        /* 300 complete blocks and a truncated one, so the last block goes through the serial path */
+        SDL_free(wav);
+        wav = BuildWAV(files[f].encoding, 2, 4, 256, files[f].samplesperblock, 256 * 300 + 100, &wavlength);
+        if (!SDLTest_AssertCheck(wav != NULL, "Expected the %s file to be built", files[f].name)) {
+            goto cleanup;
+        }
+
+        for (t = 0; t < (int)SDL_arraysize(truncation); ++t) {
+            SDL_SetHint(SDL_HINT_WAVE_TRUNCATION, truncation[t]);
+
+            SDL_SetHint(SDL_HINT_WAVE_DECODE_THREADS, "1");
+            SDL_free(serial);
+            serial = NULL;
+            if (!SDLTest_AssertCheck(SDL_LoadWAV_IO(SDL_IOFromConstMem(wav, wavlength), true, &spec, &serial, &serial_len), "Expected serial %s decoding to succeed: %s", files[f].name, SDL_GetError())) {
+                goto cleanup;
+            }
+
+            SDL_SetHint(SDL_HINT_WAVE_DECODE_THREADS, "4");
+            SDL_free(threaded);
+            threaded = NULL;
+            if (!SDLTest_AssertCheck(SDL_LoadWAV_IO(SDL_IOFromConstMem(wav, wavlength), true, &spec, &threaded, &threaded_len), "Expected threaded %s decoding to succeed: %s", files[f].name, SDL_GetError())) {
+                goto cleanup;
+            }
+
+            SDLTest_AssertCheck(serial_len == threaded_len, "Expected %u bytes of %s with truncation \"%s\", got %u", serial_len, files[f].name, truncation[t], threaded_len);
+            SDLTest_AssertCheck(serial_len == threaded_len && SDL_memcmp(serial, threaded, serial_len) == 0, "Expected the same %s samples with truncation \"%s\"", files[f].name, truncation[t]);
+        }
+    }
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    SDL_ResetHint(SDL_HINT_WAVE_TRUNCATION);
+    SDL_ResetHint(SDL_HINT_WAVE_DECODE_THREADS);
+    SDL_free(serial);
+    SDL_free(threaded);
+    SDL_free(wav);
+    return status;
+}
+
+/**
+ * Gets planar data from a stream and compares it with interleaved data from an identical stream.
+ *
+ * \sa SDL_GetAudioStreamPlanarData
+ * \sa SDL_GetAudioStreamPlanarPointers
+ */
+static int SDLCALL audio_getPlanarData(void *arg)
+{
+    SDL_AudioSpec src_spec, dst_spec;
+    SDL_AudioStream *planar_stream = NULL;
+    SDL_AudioStream *interleaved_stream = NULL;
+    Sint16 input[1000 * 3];
+    float interleaved[1000 * 3];
+    float left[1000], right[1000];
+    void *channels[3];
+    const void *pointers[3];
+    int status = TEST_ABORTED;
+    int i, frames, got;
+
+    for (i = 0; i < (int)SDL_arraysize(input); ++i) {
+        input[i] = (Sint16)SDL_rand(65536);
+    }
+
+    src_spec.format = SDL_AUDIO_S16;
+    src_spec.channels = 3;
+    src_spec.freq = 44100;
+    dst_spec.format = SDL_AUDIO_F32;
+    dst_spec.channels = 3;
+    dst_spec.freq = 48000;
+
+    planar_stream = SDL_CreateAudioStream(&src_spec, &dst_spec);
+    interleaved_stream = SDL_CreateAudioStream(&src_spec, &dst_spec);
+    if (!SDLTest_AssertCheck(planar_stream && interleaved_stream, "Expected SDL_CreateAudioStream to succeed")) {
+        goto cleanup;
+    }
+
+    SDL_PutAudioStreamData(planar_stream, input, sizeof(input));
+    SDL_FlushAudioStream(planar_stream);
+    SDL_PutAudioStreamData(interleaved_stream, input, sizeof(input));
+    SDL_FlushAudioStream(interleaved_stream);
+
+    /* The middle channel is dropped with a NULL array */
+    channels[0] = left;
+    channels[1] = NULL;
+    channels[2] = right;
+    frames = SDL_GetAudioStreamData(interleaved_stream, interleaved, 600 * 3 * sizeof(float)) / (3 * sizeof(float));
+    got = SDL_GetAudioStreamPlanarData(planar_stream, channels, 3, 600);
+    SDLTest_AssertCheck(got == frames, "Expected %d samples per channel, got %d", frames, got);
+    for (i = 0; i < got; ++i) {
+        if (left[i] != interleaved[i * 3] || right[i] != interleaved[i * 3 + 2]) {
+            SDLTest_AssertCheck(false, "Expected the planar data to match at frame %d", i);
+            goto cleanup;
+        }
+    }
+
+    /* Get the rest without a copy, providing only two pointers */
+    frames = SDL_GetAudioStreamData(interleaved_stream, interleaved, sizeof(interleaved)) / (3 * sizeof(float));
+    got = SDL_GetAudioStreamPlanarPointers(planar_stream, pointers, 2, 1000);
+    SDLTest_AssertCheck(got == frames, "Expected %d samples per channel, got %d", frames, got);
+    if (!SDLTest_AssertCheck(got > 0 && pointers[0] && pointers[1], "Expected pointers to the planar data")) {
+        goto cleanup;
+    }
+    for (i = 0; i < got; ++i) {
+        if (((const float *)pointers[0])[i] != interleaved[i * 3] || ((const float *)pointers[1])[i] != interleaved[i * 3 + 1]) {
+            SDLTest_AssertCheck(false, "Expected the planar pointers to match at frame %d", i);
+            goto cleanup;
+        }
+    }
+
+    got = SDL_GetAudioStreamPlanarPointers(planar_stream, pointers, -1, 1000);
+    SDLTest_AssertCheck(got == 0, "Expected the stream to be empty, got %d", got);
+    SDLTest_AssertCheck(pointers[0] == NULL && pointers[2] == NULL, "Expected NULL pointers when there is no data");
+
+    got = SDL_GetAudioStreamPlanarPointers(planar_stream, pointers, -1, SDL_MAX_SINT32);
+    SDLTest_AssertCheck(got == -1, "Expected too many samples to be rejected, got %d", got);
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    SDL_DestroyAudioStream(planar_stream);
+    SDL_DestroyAudioStream(interleaved_stream);
+    return status;
+}
+
 /* ================= Test Case References ================== */
 
 /* Audio test cases */
@@ -1551,13 +2779,57 @@ static const SDLTest_TestCaseReference audioTest18 = {
     audio_formatChange, "audio_formatChange", "Check handling of format changes.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference audioTest19 = {
+    audio_resampleQuality, "audio_resampleQuality", "Check each resampler quality setting.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest20 = {
+    audio_mixThreads, "audio_mixThreads", "Check that threaded mixing matches serial mixing.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest21 = {
+    audio_mixAudio, "audio_mixAudio", "Check SDL_MixAudio against the reference mixer for each format.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest22 = {
+    audio_gainRamp, "audio_gainRamp", "Check that stream gain changes are ramped while mixing.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest23 = {
+    audio_singleProducer, "audio_singleProducer", "Check putting data into a stream from a single producer without locking.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest24 = {
+    audio_queuePool, "audio_queuePool", "Check the stream queue's memory pool properties and counters.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest25 = {
+    audio_wavReader, "audio_wavReader", "Check reading and seeking WAVE files in pieces.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest26 = {
+    audio_wavDecodeThreads, "audio_wavDecodeThreads", "Check that threaded ADPCM decoding matches serial decoding.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest27 = {
+    audio_getPlanarData, "audio_getPlanarData", "Check getting planar data from a stream.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest28 = {
+    audio_wavReaderTruncated, "audio_wavReaderTruncated", "Check reading WAVE files that end in the middle of the data chunk.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest29 = {
+    audio_resampleRatioChange, "audio_resampleRatioChange", "Check resampling accuracy after the frequency ratio changes.", TEST_ENABLED
+};
+
 /* Sequence of Audio test cases */
 static const SDLTest_TestCaseReference *audioTests[] = {
     &audioTestGetAudioFormatName,
     &audioTest1, &audioTest2, &audioTest3, &audioTest4, &audioTest5, &audioTest6,
     &audioTest7, &audioTest8, &audioTest9, &audioTest10, &audioTest11,
     &audioTest12, &audioTest13, &audioTest14, &audioTest15, &audioTest16,
-    &audioTest17, &audioTest18, NULL
+    &audioTest17, &audioTest18, &audioTest19, &audioTest20, &audioTest21, &audioTest22, &audioTest23, &audioTest24, &audioTest25, &audioTest26, &audioTest27, &audioTest28, &audioTest29, NULL
 };
 
 /* Audio test suite (global) */
@@ -194,6 +194,502 @@ static int SDLCALL blit_testRandomToRandomSVGAMultipleIterations(void *arg) {
     return TEST_COMPLETED;
 }
 
+/*
+ * Creates a surface of the given size filled with PRNG pixel data
+ */
+static SDL_Surface *getRandomSurface(const int width, const int height, SDL_PixelFormat format) {
+    SDL_Surface *surface = SDL_CreateSurface(width, height, format);
+    int y;
+    if (!surface) {
+        return NULL;
+    }
+    for (y = 0; y < height; y++) {
+        Uint8 *row = (Uint8 *)surface->pixels + y * surface->pitch;
+        int x;
+        for (x = 0; x < surface->pitch; x++) {
+            row[x] = (Uint8)getRandomUint32();
+        }
+    }
+    return surface;
+}
+/*
+ * Blends one 8-bit channel the same way as ALPHA_BLEND_CHANNEL in SDL_blit.h
+ */
+static Uint32 blendChannel(Uint32 s, Uint32 d, Uint32 a) {
+    Uint16 x = (Uint16)(((s - d) * a) + ((d << 8) - d));
+    x += 0x1U;
+    x += x >> 8;
+    return x >> 8;
+}
+/*
+ * Blits src onto dst repeatedly and logs how many pixels per second were blended
+ */
+static void logBlitThroughput(const char *name, SDL_Surface *src, SDL_Surface *dst) {
+    const int iterations = 50;
+    Uint64 start, elapsed;
+    int i;
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; i++) {
+        SDL_BlitSurface(src, NULL, dst, NULL);
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+    SDLTest_Log("%s: %.1f Mpixels/s", name,
+                ((double)src->w * src->h * iterations) / ((double)elapsed / SDL_GetPerformanceFrequency()) / 1000000.0);
+}
+/**
+ * Tests per-surface alpha blending between XRGB8888 surfaces against a reference blend, then logs the throughput.
+ * The width isn't a multiple of the SIMD width, so the scalar tails are covered too.
+ */
+static int SDLCALL blit_testSurfaceAlphaThroughput(void *arg) {
+    const int width = 797;
+    const int height = 600;
+    const Uint8 alpha = 100;
+    SDL_Surface *src = getRandomSurface(width, height, SDL_PIXELFORMAT_XRGB8888);
+    SDL_Surface *dst = getRandomSurface(width, height, SDL_PIXELFORMAT_XRGB8888);
+    SDL_Surface *expected = SDL_DuplicateSurface(dst);
+    int x, y, mismatches = 0;
+
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+    SDL_SetSurfaceAlphaMod(src, alpha);
+
+    for (y = 0; y < height; y++) {
+        const Uint32 *s = (const Uint32 *)((Uint8 *)src->pixels + y * src->pitch);
+        Uint32 *e = (Uint32 *)((Uint8 *)expected->pixels + y * expected->pitch);
+        for (x = 0; x < width; x++) {
+            e[x] = 0xff000000 |
+                   (blendChannel((s[x] >> 16) & 0xff, (e[x] >> 16) & 0xff, alpha) << 16) |
+                   (blendChannel((s[x] >> 8) & 0xff, (e[x] >> 8) & 0xff, alpha) << 8) |
+                   blendChannel(s[x] & 0xff, e[x] & 0xff, alpha);
+        }
+    }
+
+    SDL_BlitSurface(src, NULL, dst, NULL);
+    for (y = 0; y < height; y++) {
+        mismatches += SDL_memcmp((Uint8 *)dst->pixels + y * dst->pitch, (Uint8 *)expected->pixels + y * expected->pitch, width * 4) != 0;
+    }
+    SDLTest_AssertCheck(mismatches == 0, "Should blend like the reference, %d rows differ", mismatches);
+
+    logBlitThroughput("XRGB8888 -> XRGB8888 surface alpha", src, dst);
+
+    SDL_DestroySurface(src);
+    SDL_DestroySurface(dst);
+    SDL_DestroySurface(expected);
+    return TEST_COMPLETED;
+}
+/**
+ * Tests colorkeyed per-surface alpha blending from XRGB8888 to ARGB8888 against a reference blend, then logs the
+ * throughput.
+ */
+static int SDLCALL blit_testSurfaceAlphaKeyThroughput(void *arg) {
+    const int width = 797;
+    const int height = 600;
+    const Uint8 alpha = 200;
+    const Uint32 key = 0x00123456;
+    SDL_Surface *src = getRandomSurface(width, height, SDL_PIXELFORMAT_XRGB8888);
+    SDL_Surface *dst = getRandomSurface(width, height, SDL_PIXELFORMAT_ARGB8888);
+    SDL_Surface *expected = SDL_DuplicateSurface(dst);
+    int x, y, mismatches = 0;
+
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+    SDL_SetSurfaceAlphaMod(src, alpha);
+    SDL_SetSurfaceColorKey(src, true, key);
+
+    for (y = 0; y < height; y++) {
+        Uint32 *s = (Uint32 *)((Uint8 *)src->pixels + y * src->pitch);
+        Uint32 *e = (Uint32 *)((Uint8 *)expected->pixels + y * expected->pitch);
+        for (x = 0; x < width; x++) {
+            if ((getRandomUint32() & 3) == 0) {
+                s[x] = key;
+                continue;
+            }
+            e[x] = (blendChannel(0xff, e[x] >> 24, alpha) << 24) |
+                   (blendChannel((s[x] >> 16) & 0xff, (e[x] >> 16) & 0xff, alpha) << 16) |
+                   (blendChannel((s[x] >> 8) & 0xff, (e[x] >> 8) & 0xff, alpha) << 8) |
+                   blendChannel(s[x] & 0xff, e[x] & 0xff, alpha);
+        }
+    }
+
+    SDL_BlitSurface(src, NULL, dst, NULL);
+    for (y = 0; y < height; y++) {
+        mismatches += SDL_memcmp((Uint8 *)dst->pixels + y * dst->pitch, (Uint8 *)expected->pixels + y * expected->pitch, width * 4) != 0;
+    }
+    SDLTest_AssertCheck(mismatches == 0, "Should blend like the reference, %d rows differ", mismatches);
+
+    logBlitThroughput("XRGB8888 -> ARGB8888 colorkey and surface alpha", src, dst);
+
+    SDL_DestroySurface(src);
+    SDL_DestroySurface(dst);
+    SDL_DestroySurface(expected);
+    return TEST_COMPLETED;
+}
+/**
+ * Tests per-pixel alpha blending from ARGB8888 to RGB565 against the reference blend of the scalar blitter, then logs
+ * the throughput.
+ */
+static int SDLCALL blit_testARGBto565Throughput(void *arg) {
+    const int width = 797;
+    const int height = 600;
+    SDL_Surface *src = getRandomSurface(width, height, SDL_PIXELFORMAT_ARGB8888);
+    SDL_Surface *dst = getRandomSurface(width, height, SDL_PIXELFORMAT_RGB565);
+    SDL_Surface *expected = SDL_DuplicateSurface(dst);
+    int x, y, mismatches = 0;
+
+    for (y = 0; y < height; y++) {
+        const Uint32 *s = (const Uint32 *)((Uint8 *)src->pixels + y * src->pitch);
+        Uint16 *e = (Uint16 *)((Uint8 *)expected->pixels + y * expected->pitch);
+        for (x = 0; x < width; x++) {
+            Uint32 p = s[x];
+            Uint32 a = p >> 27;
+            if (a == 31) {
+                e[x] = (Uint16)((p >> 8 & 0xf800) + (p >> 5 & 0x7e0) + (p >> 3 & 0x1f));
+            } else if (a) {
+                Uint32 d = e[x];
+                p = ((p & 0xfc00) << 11) + (p >> 8 & 0xf800) + (p >> 3 & 0x1f);
+                d = (d | d << 16) & 0x07e0f81f;
+                d += (p - d) * a >> 5;
+                d &= 0x07e0f81f;
+                e[x] = (Uint16)(d | d >> 16);
+            }
+        }
+    }
+
+    SDL_BlitSurface(src, NULL, dst, NULL);
+    for (y = 0; y < height; y++) {
+        mismatches += SDL_memcmp((Uint8 *)dst->pixels + y * dst->pitch, (Uint8 *)expected->pixels + y * expected->pitch, width * 2) != 0;
+    }
+    SDLTest_AssertCheck(mismatches == 0, "Should blend like the reference, %d rows differ", mismatches);
+
+    logBlitThroughput("ARGB8888 -> RGB565 pixel alpha", src, dst);
+
+    SDL_DestroySurface(src);
+    SDL_DestroySurface(dst);
+    SDL_DestroySurface(expected);
+    return TEST_COMPLETED;
+}
+
+/*
+ * out = (a * b) / 255, rounded the same way as MULT_DIV_255 in SDL_blit.h
+ */
+static Uint32 multDiv255(Uint32 a, Uint32 b) {
+    Uint16 x = (Uint16)(a * b);
+    x += 0x1U;
+    x += x >> 8;
+    return x >> 8;
+}
+/*
+ * Modulates and blends one pixel the way the generated blitters in SDL_blit_auto.c do
+ */
+static Uint32 referenceBlendPixel(Uint32 src, Uint32 dst, const SDL_PixelFormatDetails *srcfmt, const SDL_PixelFormatDetails *dstfmt,
+                                  SDL_BlendMode mode, const Uint32 mod[4]) {
+    Uint8 sr, sg, sb, sa, dr, dg, db, da;
+    Uint32 s[4], d[4], inv;
+    int i;
+
+    SDL_GetRGBA(src, srcfmt, NULL, &sr, &sg, &sb, &sa);
+    SDL_GetRGBA(dst, dstfmt, NULL, &dr, &dg, &db, &da);
+    s[0] = multDiv255(sr, mod[0]);
+    s[1] = multDiv255(sg, mod[1]);
+    s[2] = multDiv255(sb, mod[2]);
+    s[3] = multDiv255(sa, mod[3]);
+    d[0] = dr;
+    d[1] = dg;
+    d[2] = db;
+    d[3] = da;
+    inv = 255 - s[3];
+
+    if (mode == SDL_BLENDMODE_BLEND || mode == SDL_BLENDMODE_ADD) {
+        for (i = 0; i < 3; i++) {
+            s[i] = multDiv255(s[i], s[3]);
+        }
+    }
+    for (i = 0; i < 4; i++) {
+        const bool alpha = (i == 3);
+        switch (mode) {
+        case SDL_BLENDMODE_NONE:
+            d[i] = s[i];
+            break;
+        case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_BLEND_PREMULTIPLIED:
+            d[i] = SDL_min(multDiv255(inv, d[i]) + s[i], 255);
+            break;
+        case SDL_BLENDMODE_ADD:
+        case SDL_BLENDMODE_ADD_PREMULTIPLIED:
+            if (!alpha) {
+                d[i] = SDL_min(s[i] + d[i], 255);
+            }
+            break;
+        case SDL_BLENDMODE_MOD:
+            if (!alpha) {
+                d[i] = multDiv255(s[i], d[i]);
+            }
+            break;
+        case SDL_BLENDMODE_MUL:
+            if (!alpha) {
+                d[i] = SDL_min(multDiv255(s[i], d[i]) + multDiv255(d[i], inv), 255);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    return SDL_MapRGBA(dstfmt, NULL, (Uint8)d[0], (Uint8)d[1], (Uint8)d[2], (Uint8)d[3]);
+}
+static SDL_LogOutputFunction originalLogOutput;
+static void *originalLogUserdata;
+static char slowBlitMessages[1024];
+
+static void SDLCALL captureSlowBlitLog(void *userdata, int category, SDL_LogPriority priority, const char *message) {
+    if (category == SDL_LOG_CATEGORY_VIDEO && SDL_strstr(message, "slow blitter")) {
+        SDL_strlcat(slowBlitMessages, message, sizeof(slowBlitMessages));
+        SDL_strlcat(slowBlitMessages, "\n", sizeof(slowBlitMessages));
+    }
+    originalLogOutput(originalLogUserdata, category, priority, message);
+}
+/*
+ * Sets a colorkey that none of the pixels match. Blits then go through SDL_Blit_Slow(), but draw every pixel.
+ */
+static void setUnmatchedColorKey(SDL_Surface *surface) {
+    const SDL_PixelFormatDetails *fmt = SDL_GetPixelFormatDetails(surface->format);
+    const Uint32 rgbmask = ~fmt->Amask;
+    Uint32 key = 0xFF000000; /* out of range for 16 and 24 bits per pixel */
+    int x, y;
+
+    if (fmt->bytes_per_pixel == 4) {
+        key = 0x12345678 & rgbmask;
+        for (y = 0; y < surface->h; y++) {
+            Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+            for (x = 0; x < surface->w; x++) {
+                if ((row[x] & rgbmask) == key) {
+                    row[x] ^= 1;
+                }
+            }
+        }
+    }
+    SDL_SetSurfaceColorKey(surface, true, key);
+}
+/*
+ * The largest difference, in 8-bit units, from one step of a channel with the given number of bits
+ */
+static int channelTolerance(Uint32 mask) {
+    const int bits = SDL_MostSignificantBitIndex32(mask) - SDL_MostSignificantBitIndex32(mask & (0u - mask)) + 1;
+    return (bits >= 8) ? 1 : (255 + (1 << bits) - 2) / ((1 << bits) - 1);
+}
+/*
+ * Counts the pixels where a channel differs by more than one step of the destination format
+ */
+static int countBlendMismatches(SDL_Surface *actual, SDL_Surface *expected) {
+    const SDL_PixelFormatDetails *fmt = SDL_GetPixelFormatDetails(actual->format);
+    const int tolerance[4] = {
+        channelTolerance(fmt->Rmask), channelTolerance(fmt->Gmask), channelTolerance(fmt->Bmask),
+        fmt->Amask ? channelTolerance(fmt->Amask) : 0
+    };
+    int x, y, i, mismatches = 0;
+
+    for (y = 0; y < actual->h; y++) {
+        for (x = 0; x < actual->w; x++) {
+            Uint8 a[4], e[4];
+            SDL_ReadSurfacePixel(actual, x, y, &a[0], &a[1], &a[2], &a[3]);
+            SDL_ReadSurfacePixel(expected, x, y, &e[0], &e[1], &e[2], &e[3]);
+            for (i = 0; i < 4; i++) {
+                if (SDL_abs(a[i] - e[i]) > tolerance[i]) {
+                    mismatches++;
+                    break;
+                }
+            }
+        }
+    }
+    return mismatches;
+}
+/**
+ * Tests the generated modulate and blend blitters between 8888 formats against a reference blend, unscaled and
+ * scaled, then logs the throughput. The widths aren't a multiple of the SIMD width, so the tails are covered too.
+ * The generated RGB565, RGB24 and ARGB2101010 blitters are checked against SDL_Blit_Slow(), within one step of
+ * each destination channel, since the generated MUL blend rounds each product where the slow blitter doesn't.
+ */
+static int SDLCALL blit_testGeneratedBlendModes(void *arg) {
+    static const SDL_PixelFormat formats[][2] = {
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888 },
+        { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888 },
+        { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888 },
+        { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888 },
+        { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888 },
+    };
+    static const SDL_PixelFormat other_formats[][2] = {
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565 },
+        { SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_XRGB8888 },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB24 },
+        { SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_ABGR8888 },
+        { SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_RGB24 },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB2101010 },
+        { SDL_PIXELFORMAT_ARGB2101010, SDL_PIXELFORMAT_XRGB8888 },
+    };
+    static const SDL_BlendMode modes[] = {
+        SDL_BLENDMODE_NONE, SDL_BLENDMODE_BLEND, SDL_BLENDMODE_BLEND_PREMULTIPLIED, SDL_BLENDMODE_ADD,
+        SDL_BLENDMODE_ADD_PREMULTIPLIED, SDL_BLENDMODE_MOD, SDL_BLENDMODE_MUL
+    };
+    static const Uint32 mod[4] = { 200, 100, 50, 170 };
+    const SDL_LogPriority priority = SDL_GetLogPriority(SDL_LOG_CATEGORY_VIDEO);
+    const int width = 61;
+    const int height = 7;
+    int f, m, scaled;
+
+    for (f = 0; f < SDL_arraysize(formats); f++) {
+        for (m = 0; m < SDL_arraysize(modes); m++) {
+            for (scaled = 0; scaled <= 1; scaled++) {
+                const int src_w = scaled ? 33 : width;
+                const int src_h = scaled ? 5 : height;
+                SDL_Surface *src = getRandomSurface(src_w, src_h, formats[f][0]);
+                SDL_Surface *dst = getRandomSurface(width, height, formats[f][1]);
+                SDL_Surface *expected = SDL_DuplicateSurface(dst);
+                const SDL_PixelFormatDetails *srcfmt = SDL_GetPixelFormatDetails(formats[f][0]);
+                const SDL_PixelFormatDetails *dstfmt = SDL_GetPixelFormatDetails(formats[f][1]);
+                int x, y, mismatches = 0;
+
+                SDL_SetSurfaceBlendMode(src, modes[m]);
+                SDL_SetSurfaceColorMod(src, (Uint8)mod[0], (Uint8)mod[1], (Uint8)mod[2]);
+                SDL_SetSurfaceAlphaMod(src, (Uint8)mod[3]);
+
+                for (y = 0; y < height; y++) {
+                    /* The same sampling as the nearest neighbor blitters */
+                    const Uint64 incy = ((Uint64)src_h << 16) / height;
+                    const Uint64 incx = ((Uint64)src_w << 16) / width;
+                    const int sy = (int)((incy / 2 + y * incy) >> 16);
+                    const Uint32 *s = (const Uint32 *)((Uint8 *)src->pixels + sy * src->pitch);
+                    Uint32 *e = (Uint32 *)((Uint8 *)expected->pixels + y * expected->pitch);
+                    for (x = 0; x < width; x++) {
+                        const int sx = (int)((incx / 2 + x * incx) >> 16);
+                        e[x] = referenceBlendPixel(s[sx], e[x], srcfmt, dstfmt, modes[m], mod);
+                    }
+                }
+
+                if (scaled) {
+                    SDL_BlitSurfaceScaled(src, NULL, dst, NULL, SDL_SCALEMODE_NEAREST);
+                } else {
+                    SDL_BlitSurface(src, NULL, dst, NULL);
+                }
+                for (y = 0; y < height; y++) {
+                    mismatches += SDL_memcmp((Uint8 *)dst->pixels + y * dst->pitch, (Uint8 *)expected->pixels + y * expected->pitch, width * 4) != 0;
+                }
+                SDLTest_AssertCheck(mismatches == 0, "%s -> %s, blend mode 0x%x%s: should blend like the reference, %d rows differ",
+                                    SDL_GetPixelFormatName(formats[f][0]), SDL_GetPixelFormatName(formats[f][1]),
+                                    modes[m], scaled ? ", scaled" : "", mismatches);
+
+                SDL_DestroySurface(src);
+                SDL_DestroySurface(dst);
+                SDL_DestroySurface(expected);
+            }
+        }
+    }
+
+    SDL_GetLogOutputFunction(&originalLogOutput, &originalLogUserdata);
+    SDL_SetLogOutputFunction(captureSlowBlitLog, NULL);
+    SDL_SetLogPriority(SDL_LOG_CATEGORY_VIDEO, SDL_LOG_PRIORITY_DEBUG);
+
+    for (f = 0; f < SDL_arraysize(other_formats); f++) {
+        for (m = 0; m < SDL_arraysize(modes); m++) {
+            for (scaled = 0; scaled <= 1; scaled++) {
+                const int src_w = scaled ? 33 : width;
+                const int src_h = scaled ? 5 : height;
+                SDL_Surface *src = getRandomSurface(src_w, src_h, other_formats[f][0]);
+                SDL_Surface *dst = getRandomSurface(width, height, other_formats[f][1]);
+                SDL_Surface *expected = SDL_DuplicateSurface(dst);
+                int mismatches;
+
+                /* 10-bit surfaces default to HDR10, which would need a colorspace conversion */
+                SDL_SetSurfaceColorspace(src, SDL_COLORSPACE_SRGB);
+                SDL_SetSurfaceColorspace(dst, SDL_COLORSPACE_SRGB);
+                SDL_SetSurfaceColorspace(expected, SDL_COLORSPACE_SRGB);
+
+                SDL_SetSurfaceBlendMode(src, modes[m]);
+                SDL_SetSurfaceColorMod(src, (Uint8)mod[0], (Uint8)mod[1], (Uint8)mod[2]);
+                SDL_SetSurfaceAlphaMod(src, (Uint8)mod[3]);
+
+                if (scaled) {
+                    SDL_BlitSurfaceScaled(src, NULL, dst, NULL, SDL_SCALEMODE_NEAREST);
+                } else {
+                    SDL_BlitSurface(src, NULL, dst, NULL);
+                }
+
+                slowBlitMessages[0] = '\0';
+                setUnmatchedColorKey(src);
+                if (scaled) {
+                    SDL_BlitSurfaceScaled(src, NULL, expected, NULL, SDL_SCALEMODE_NEAREST);
+                } else {
+                    SDL_BlitSurface(src, NULL, expected, NULL);
+                }
+                SDLTest_AssertCheck(SDL_strstr(slowBlitMessages, SDL_GetPixelFormatName(other_formats[f][0])) != NULL,
+                                    "%s -> %s, blend mode 0x%x%s: the reference should use the slow blitter",
+                                    SDL_GetPixelFormatName(other_formats[f][0]), SDL_GetPixelFormatName(other_formats[f][1]),
+                                    modes[m], scaled ? ", scaled" : "");
+
+                mismatches = countBlendMismatches(dst, expected);
+                SDLTest_AssertCheck(mismatches == 0, "%s -> %s, blend mode 0x%x%s: should blend like the slow blitter, %d pixels differ",
+                                    SDL_GetPixelFormatName(other_formats[f][0]), SDL_GetPixelFormatName(other_formats[f][1]),
+                                    modes[m], scaled ? ", scaled" : "", mismatches);
+
+                SDL_DestroySurface(src);
+                SDL_DestroySurface(dst);
+                SDL_DestroySurface(expected);
+            }
+        }
+    }
+
+    SDL_SetLogPriority(SDL_LOG_CATEGORY_VIDEO, priority);
+    SDL_SetLogOutputFunction(originalLogOutput, originalLogUserdata);
+
+    {
+        SDL_Surface *src = getRandomSurface(797, 600, SDL_PIXELFORMAT_ARGB8888);
+        SDL_Surface *dst = getRandomSurface(797, 600, SDL_PIXELFORMAT_XRGB8888);
+
+        SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+        SDL_SetSurfaceColorMod(src, (Uint8)mod[0], (Uint8)mod[1], (Uint8)mod[2]);
+        logBlitThroughput("ARGB8888 -> XRGB8888 color modulated pixel alpha", src, dst);
+        SDL_DestroySurface(src);
+        SDL_DestroySurface(dst);
+    }
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests that blits which fall back to the slow blitter are logged, and the ones with generated blitters aren't.
+ */
+static int SDLCALL blit_testSlowBlitLog(void *arg) {
+    const SDL_LogPriority priority = SDL_GetLogPriority(SDL_LOG_CATEGORY_VIDEO);
+    SDL_Surface *src_slow = getRandomSurface(16, 16, SDL_PIXELFORMAT_XBGR8888);
+    SDL_Surface *dst_slow = getRandomSurface(32, 32, SDL_PIXELFORMAT_BGRA8888);
+    SDL_Surface *src_fast = getRandomSurface(16, 16, SDL_PIXELFORMAT_RGB24);
+    SDL_Surface *dst_fast = getRandomSurface(16, 16, SDL_PIXELFORMAT_RGB565);
+
+    slowBlitMessages[0] = '\0';
+    SDL_GetLogOutputFunction(&originalLogOutput, &originalLogUserdata);
+    SDL_SetLogOutputFunction(captureSlowBlitLog, NULL);
+    SDL_SetLogPriority(SDL_LOG_CATEGORY_VIDEO, SDL_LOG_PRIORITY_DEBUG);
+
+    /* Each combination is only logged the first time, so use one that other tests are unlikely to */
+    SDL_SetSurfaceBlendMode(src_slow, SDL_BLENDMODE_MUL);
+    SDL_SetSurfaceColorMod(src_slow, 10, 20, 30);
+    SDL_SetSurfaceColorKey(src_slow, true, 0);
+    SDL_BlitSurfaceScaled(src_slow, NULL, dst_slow, NULL, SDL_SCALEMODE_NEAREST);
+    SDL_SetSurfaceBlendMode(src_fast, SDL_BLENDMODE_MUL);
+    SDL_SetSurfaceColorMod(src_fast, 10, 20, 30);
+    SDL_BlitSurface(src_fast, NULL, dst_fast, NULL);
+
+    SDL_SetLogPriority(SDL_LOG_CATEGORY_VIDEO, priority);
+    SDL_SetLogOutputFunction(originalLogOutput, originalLogUserdata);
+
+    SDLTest_AssertCheck(SDL_strstr(slowBlitMessages, "SDL_PIXELFORMAT_XBGR8888 to SDL_PIXELFORMAT_BGRA8888") != NULL,
+                        "Scaled XBGR8888 -> BGRA8888 multiply with a colorkey should be logged as a slow blit");
+    SDLTest_AssertCheck(SDL_strstr(slowBlitMessages, "SDL_PIXELFORMAT_RGB24") == NULL,
+                        "RGB24 -> RGB565 modulate and multiply should use a generated blitter");
+
+    SDL_DestroySurface(src_slow);
+    SDL_DestroySurface(dst_slow);
+    SDL_DestroySurface(src_fast);
+    SDL_DestroySurface(dst_fast);
+    return TEST_COMPLETED;
+}
+
 static const SDLTest_TestCaseReference blitTest1 = {
         blit_testExampleApplicationRender, "blit_testExampleApplicationRender",
         "Test example application render.", TEST_ENABLED
@@ -206,8 +702,28 @@ static const SDLTest_TestCaseReference blitTest3 = {
         blit_testRandomToRandomSVGAMultipleIterations, "blit_testRandomToRandomSVGAMultipleIterations",
         "Test SVGA noise render (250k iterations).", TEST_ENABLED
 };
+static const SDLTest_TestCaseReference blitTest4 = {
+        blit_testSurfaceAlphaThroughput, "blit_testSurfaceAlphaThroughput",
+        "Test surface alpha blending and its throughput.", TEST_ENABLED
+};
+static const SDLTest_TestCaseReference blitTest5 = {
+        blit_testSurfaceAlphaKeyThroughput, "blit_testSurfaceAlphaKeyThroughput",
+        "Test colorkeyed surface alpha blending and its throughput.", TEST_ENABLED
+};
+static const SDLTest_TestCaseReference blitTest6 = {
+        blit_testARGBto565Throughput, "blit_testARGBto565Throughput",
+        "Test ARGB8888 to RGB565 pixel alpha blending and its throughput.", TEST_ENABLED
+};
+static const SDLTest_TestCaseReference blitTest7 = {
+        blit_testGeneratedBlendModes, "blit_testGeneratedBlendModes",
+        "Test the generated modulate and blend blitters and their throughput.", TEST_ENABLED
+};
+static const SDLTest_TestCaseReference blitTest8 = {
+        blit_testSlowBlitLog, "blit_testSlowBlitLog",
+        "Test that blits using the slow blitter are logged.", TEST_ENABLED
+};
 static const SDLTest_TestCaseReference *blitTests[] = {
-        &blitTest1, &blitTest2, &blitTest3, NULL
+        &blitTest1, &blitTest2, &blitTest3, &blitTest4, &blitTest5, &blitTest6, &blitTest7, &blitTest8, NULL
 };
 
 SDLTest_TestSuiteReference blitTestSuite = {
@@ -1563,6 +1563,7 @@ static int SDLCALL render_testGetSetTextureScaleMode(void *arg)
         { "SDL_SCALEMODE_LINEAR",  SDL_SCALEMODE_LINEAR },
         { "SDL_SCALEMODE_PIXELART",  SDL_SCALEMODE_PIXELART },
     };
+    SDL_ScaleMode default_mode = SDL_SCALEMODE_INVALID;
     size_t i;
 
     for (i = 0; i < SDL_arraysize(modes); i++) {
@@ -1583,6 +1584,12 @@ static int SDLCALL render_testGetSetTextureScaleMode(void *arg)
         SDLTest_AssertCheck(actual_mode == modes[i].mode, "SDL_GetTextureScaleMode must return %s (%d), actual=%d",
                             modes[i].name, modes[i].mode, actual_mode);
     }
+
+    /* Area-average filtering is only available for surfaces */
+    SDLTest_AssertPass("About to call SDL_SetDefaultTextureScaleMode(renderer, SDL_SCALEMODE_AREA)");
+    SDLTest_AssertCheck(!SDL_SetDefaultTextureScaleMode(renderer, SDL_SCALEMODE_AREA), "SDL_SetDefaultTextureScaleMode must reject SDL_SCALEMODE_AREA");
+    SDL_GetDefaultTextureScaleMode(renderer, &default_mode);
+    SDLTest_AssertCheck(default_mode != SDL_SCALEMODE_AREA, "SDL_GetDefaultTextureScaleMode must not return SDL_SCALEMODE_AREA, actual=%d", default_mode);
     return TEST_COMPLETED;
 }
 
@@ -2304,6 +2311,644 @@ static int SDLCALL render_testColorspaceSRGB(void *arg)
     return TEST_COMPLETED;
 }
 
+static SDL_Surface *renderSoftwareScene(int threads)
+{
+    SDL_Surface *target = NULL;
+    SDL_Surface *pattern = NULL;
+    SDL_Surface *result = NULL;
+    SDL_Renderer *software_renderer = NULL;
+    SDL_Texture *texture = NULL;
+    SDL_Rect viewport = { 10, 20, 180, 120 };
+    SDL_Rect cliprect = { 5, 5, 150, 100 };
+    SDL_Vertex verts[3];
+    SDL_FPoint points[64];
+    SDL_FRect rect;
+    Uint64 seed = 1234;
+    char hint[16];
+    int i, x, y;
+
+    SDL_snprintf(hint, sizeof(hint), "%d", threads);
+    SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, hint);
+
+    target = SDL_CreateSurface(200, 150, SDL_PIXELFORMAT_ARGB8888);
+    pattern = SDL_CreateSurface(16, 16, SDL_PIXELFORMAT_ARGB8888);
+    if (!target || !pattern) {
+        goto done;
+    }
+    for (y = 0; y < pattern->h; ++y) {
+        Uint32 *row = (Uint32 *)((Uint8 *)pattern->pixels + y * pattern->pitch);
+        for (x = 0; x < pattern->w; ++x) {
+            row[x] = ((Uint32)(x * y) << 24) | ((Uint32)(x * 16) << 16) | ((Uint32)(y * 16) << 8) | 0x40;
+        }
+    }
+
+    software_renderer = SDL_CreateSoftwareRenderer(target);
+    if (!software_renderer) {
+        goto done;
+    }
+    texture = SDL_CreateTextureFromSurface(software_renderer, pattern);
+    if (!texture) {
+        goto done;
+    }
+
+    SDL_SetRenderDrawColor(software_renderer, 0x10, 0x20, 0x30, 0xFF);
+    SDL_RenderClear(software_renderer);
+
+    SDL_SetRenderViewport(software_renderer, &viewport);
+    SDL_SetRenderClipRect(software_renderer, &cliprect);
+
+    SDL_SetRenderDrawBlendMode(software_renderer, SDL_BLENDMODE_BLEND);
+    for (i = 0; i < 40; ++i) {
+        SDL_SetRenderDrawColor(software_renderer, (Uint8)SDL_rand_r(&seed, 256), (Uint8)SDL_rand_r(&seed, 256), (Uint8)SDL_rand_r(&seed, 256), 0x80);
+        rect.x = (float)SDL_rand_r(&seed, 200) - 20.0f;
+        rect.y = (float)SDL_rand_r(&seed, 150) - 20.0f;
+        rect.w = (float)SDL_rand_r(&seed, 60);
+        rect.h = (float)SDL_rand_r(&seed, 60);
+        SDL_RenderFillRect(software_renderer, &rect);
+        SDL_RenderLine(software_renderer, rect.x, rect.y, rect.x + rect.w * 2.0f, rect.y + rect.h * 2.0f);
+    }
+    for (i = 0; i < (int)SDL_arraysize(points); ++i) {
+        points[i].x = (float)SDL_rand_r(&seed, 200);
+        points[i].y = (float)SDL_rand_r(&seed, 150);
+    }
+    SDL_RenderPoints(software_renderer, points, SDL_arraysize(points));
+
+    for (i = 0; i < 60; ++i) {
+        SDL_SetTextureColorMod(texture, 0xFF, (Uint8)SDL_rand_r(&seed, 256), 0xFF);
+        rect.x = (float)SDL_rand_r(&seed, 200) - 16.0f;
+        rect.y = (float)SDL_rand_r(&seed, 150) - 16.0f;
+        rect.w = (float)(16 + (i % 3) * SDL_rand_r(&seed, 40));
+        rect.h = (float)(16 + (i % 3) * SDL_rand_r(&seed, 40));
+        if (i % 5 == 0) {
+            SDL_RenderTextureRotated(software_renderer, texture, NULL, &rect, (double)(i * 7), NULL, SDL_FLIP_NONE);
+        } else {
+            SDL_RenderTexture(software_renderer, texture, NULL, &rect);
+        }
+    }
+
+    for (i = 0; i < 30; ++i) {
+        for (x = 0; x < 3; ++x) {
+            verts[x].position.x = (float)SDL_rand_r(&seed, 220) - 10.0f;
+            verts[x].position.y = (float)SDL_rand_r(&seed, 170) - 10.0f;
+            verts[x].color.r = (float)SDL_rand_r(&seed, 256) / 255.0f;
+            verts[x].color.g = 0.5f;
+            verts[x].color.b = 1.0f;
+            verts[x].color.a = 0.5f;
+            verts[x].tex_coord.x = (x == 1) ? 1.0f : 0.0f;
+            verts[x].tex_coord.y = (x == 2) ? 1.0f : 0.0f;
+        }
+        SDL_RenderGeometry(software_renderer, (i % 2) ? texture : NULL, verts, 3, NULL, 0);
+    }
+
+    /* Scaled rotated copies */
+    SDL_SetRenderScale(software_renderer, 2.0f, 2.0f);
+    for (i = 0; i < 10; ++i) {
+        rect.x = (float)SDL_rand_r(&seed, 100);
+        rect.y = (float)SDL_rand_r(&seed, 75);
+        rect.w = 16.0f;
+        rect.h = 16.0f;
+        SDL_RenderTextureRotated(software_renderer, texture, NULL, &rect, (double)(i * 33), NULL, SDL_FLIP_HORIZONTAL);
+    }
+
+    if (SDL_FlushRenderer(software_renderer)) {
+        result = SDL_DuplicateSurface(target);
+    }
+
+done:
+    SDL_ResetHint(SDL_HINT_RENDER_SOFTWARE_THREADS);
+    SDL_DestroyTexture(texture);
+    SDL_DestroyRenderer(software_renderer);
+    SDL_DestroySurface(pattern);
+    SDL_DestroySurface(target);
+    return result;
+}
+
+/**
+ * Tests that the software renderer draws the same pixels on several threads
+ */
+static int SDLCALL render_testSoftwareThreads(void *arg)
+{
+    SDL_Surface *serial;
+    SDL_Surface *threaded;
+    int y, mismatch = -1;
+
+    serial = renderSoftwareScene(1);
+    SDLTest_AssertCheck(serial != NULL, "Render scene on one thread: %s", serial ? "success" : SDL_GetError());
+    threaded = renderSoftwareScene(4);
+    SDLTest_AssertCheck(threaded != NULL, "Render scene on four threads: %s", threaded ? "success" : SDL_GetError());
+
+    if (serial && threaded) {
+        for (y = 0; y < serial->h; ++y) {
+            if (SDL_memcmp((Uint8 *)serial->pixels + y * serial->pitch,
+                           (Uint8 *)threaded->pixels + y * threaded->pitch,
+                           serial->w * SDL_BYTESPERPIXEL(serial->format)) != 0) {
+                mismatch = y;
+                break;
+            }
+        }
+        SDLTest_AssertCheck(mismatch < 0, "Check the threaded output matches, first mismatch at row %d", mismatch);
+    }
+
+    SDL_DestroySurface(serial);
+    SDL_DestroySurface(threaded);
+
+    return TEST_COMPLETED;
+}
+
+static void drawScaleCacheFrame(SDL_Renderer *software_renderer, SDL_Texture *texture)
+{
+    SDL_FRect onscreen = { 20.0f, 30.0f, 48.0f, 40.0f };
+    SDL_FRect offscreen = { -10.0f, 120.0f, 40.0f, 40.0f };
+
+    SDL_SetRenderDrawColor(software_renderer, 0x10, 0x20, 0x30, 0xFF);
+    SDL_RenderClear(software_renderer);
+    SDL_SetTextureColorMod(texture, 0xFF, 0x80, 0xC0);
+    SDL_RenderTexture(software_renderer, texture, NULL, &onscreen);
+    SDL_RenderTexture(software_renderer, texture, NULL, &offscreen);
+}
+
+static bool compareSurfacePixels(SDL_Surface *a, SDL_Surface *b, const SDL_Rect *rect)
+{
+    SDL_Rect all = { 0, 0, a->w, a->h };
+    const int bpp = SDL_BYTESPERPIXEL(a->format);
+    int y;
+
+    if (!rect) {
+        rect = &all;
+    }
+    for (y = rect->y; y < rect->y + rect->h; ++y) {
+        if (SDL_memcmp((Uint8 *)a->pixels + y * a->pitch + rect->x * bpp,
+                       (Uint8 *)b->pixels + y * b->pitch + rect->x * bpp, rect->w * bpp) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static SDL_Surface *renderGeometryScene(SDL_PixelFormat format)
+{
+    const SDL_BlendMode blend_modes[] = {
+        SDL_BLENDMODE_NONE, SDL_BLENDMODE_BLEND, SDL_BLENDMODE_ADD, SDL_BLENDMODE_MOD, SDL_BLENDMODE_MUL
+    };
+    SDL_Surface *target = NULL;
+    SDL_Surface *pattern = NULL;
+    SDL_Surface *result = NULL;
+    SDL_Renderer *software_renderer = NULL;
+    SDL_Texture *texture = NULL;
+    SDL_Vertex verts[3];
+    Uint64 seed = 5678;
+    int i, x, y;
+
+    target = SDL_CreateSurface(200, 150, format);
+    pattern = SDL_CreateSurface(16, 16, SDL_PIXELFORMAT_ARGB8888);
+    if (!target || !pattern) {
+        goto done;
+    }
+    for (y = 0; y < pattern->h; ++y) {
+        Uint32 *row = (Uint32 *)((Uint8 *)pattern->pixels + y * pattern->pitch);
+        for (x = 0; x < pattern->w; ++x) {
+            row[x] = ((Uint32)(x * y) << 24) | ((Uint32)(x * 16) << 16) | ((Uint32)(y * 16) << 8) | 0x40;
+        }
+    }
+
+    software_renderer = SDL_CreateSoftwareRenderer(target);
+    if (!software_renderer) {
+        goto done;
+    }
+    texture = SDL_CreateTextureFromSurface(software_renderer, pattern);
+    if (!texture) {
+        goto done;
+    }
+
+    SDL_SetRenderDrawColor(software_renderer, 0x10, 0x20, 0x30, 0xFF);
+    SDL_RenderClear(software_renderer);
+
+    /* Solid, gradient, textured and color modulated textured triangles in each blend mode,
+       large enough to be shaded a full span at a time, with odd sized remainders */
+    for (i = 0; i < 80; ++i) {
+        const SDL_BlendMode blend = blend_modes[i % SDL_arraysize(blend_modes)];
+        const int kind = (i / (int)SDL_arraysize(blend_modes)) % 4;
+        const bool textured = (kind >= 2);
+        const bool gradient = (kind == 1 || kind == 3);
+
+        for (x = 0; x < 3; ++x) {
+            verts[x].position.x = (float)SDL_rand_r(&seed, 240) - 20.0f;
+            verts[x].position.y = (float)SDL_rand_r(&seed, 190) - 20.0f;
+            verts[x].color.r = gradient ? (float)SDL_rand_r(&seed, 256) / 255.0f : 1.0f;
+            verts[x].color.g = gradient ? (float)SDL_rand_r(&seed, 256) / 255.0f : 0.75f;
+            verts[x].color.b = gradient ? (float)SDL_rand_r(&seed, 256) / 255.0f : 0.5f;
+            verts[x].color.a = gradient ? (float)SDL_rand_r(&seed, 256) / 255.0f : 0.625f;
+            verts[x].tex_coord.x = (x == 1) ? 1.0f : 0.0f;
+            verts[x].tex_coord.y = (x == 2) ? 1.0f : 0.0f;
+        }
+        if (textured) {
+            SDL_SetTextureBlendMode(texture, blend);
+        } else {
+            SDL_SetRenderDrawBlendMode(software_renderer, blend);
+        }
+        SDL_RenderGeometry(software_renderer, textured ? texture : NULL, verts, 3, NULL, 0);
+    }
+
+    if (SDL_FlushRenderer(software_renderer)) {
+        result = SDL_DuplicateSurface(target);
+    }
+
+done:
+    SDL_DestroyTexture(texture);
+    SDL_DestroyRenderer(software_renderer);
+    SDL_DestroySurface(pattern);
+    SDL_DestroySurface(target);
+    return result;
+}
+
+/**
+ * Tests that the software renderer's SIMD triangle shading draws the same pixels as the scalar code
+ */
+static int SDLCALL render_testGeometrySIMD(void *arg)
+{
+    const SDL_PixelFormat formats[] = { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888 };
+    int i;
+
+    for (i = 0; i < (int)SDL_arraysize(formats); ++i) {
+        SDL_Surface *simd;
+        SDL_Surface *scalar;
+
+        simd = renderGeometryScene(formats[i]);
+        SDLTest_AssertCheck(simd != NULL, "Render geometry to %s: %s", SDL_GetPixelFormatName(formats[i]), simd ? "success" : SDL_GetError());
+
+        SDL_SetHint(SDL_HINT_CPU_FEATURE_MASK, "-sse,-sse2,-sse3,-sse41,-sse42,-avx,-avx2,-avx512f,-neon");
+        SDLTest_AssertCheck(!SDL_HasSSE41() && !SDL_HasAVX2() && !SDL_HasNEON(), "Check SIMD is disabled by SDL_HINT_CPU_FEATURE_MASK");
+        scalar = renderGeometryScene(formats[i]);
+        SDL_ResetHint(SDL_HINT_CPU_FEATURE_MASK);
+        SDLTest_AssertCheck(scalar != NULL, "Render geometry to %s without SIMD: %s", SDL_GetPixelFormatName(formats[i]), scalar ? "success" : SDL_GetError());
+
+        if (simd && scalar) {
+            SDLTest_AssertCheck(compareSurfacePixels(simd, scalar, NULL), "Check the SIMD output matches the scalar output");
+        }
+
+        SDL_DestroySurface(simd);
+        SDL_DestroySurface(scalar);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests that the software renderer reuses scaled texture copies, and scales again when the texture changes
+ */
+static int SDLCALL render_testSoftwareScaleCache(void *arg)
+{
+    SDL_Surface *target = NULL;
+    SDL_Surface *pattern = NULL;
+    SDL_Surface *first = NULL;
+    SDL_Surface *expected = NULL;
+    SDL_Renderer *software_renderer = NULL;
+    SDL_Texture *texture = NULL;
+    SDL_PropertiesID props;
+    SDL_Rect onscreen = { 20, 30, 48, 40 };
+    Sint64 hits, misses;
+    int x, y;
+
+    target = SDL_CreateSurface(200, 150, SDL_PIXELFORMAT_ARGB8888);
+    pattern = SDL_CreateSurface(16, 16, SDL_PIXELFORMAT_ABGR8888);
+    SDLTest_AssertCheck(target && pattern, "Create surfaces");
+    if (!target || !pattern) {
+        goto done;
+    }
+    for (y = 0; y < pattern->h; ++y) {
+        Uint32 *row = (Uint32 *)((Uint8 *)pattern->pixels + y * pattern->pitch);
+        for (x = 0; x < pattern->w; ++x) {
+            row[x] = ((Uint32)(0x80 + x * 8) << 24) | ((Uint32)(x * 16) << 16) | ((Uint32)(y * 16) << 8) | 0x40;
+        }
+    }
+
+    software_renderer = SDL_CreateSoftwareRenderer(target);
+    SDLTest_AssertCheck(software_renderer != NULL, "SDL_CreateSoftwareRenderer(): %s", software_renderer ? "success" : SDL_GetError());
+    if (!software_renderer) {
+        goto done;
+    }
+    texture = SDL_CreateTexture(software_renderer, pattern->format, SDL_TEXTUREACCESS_STREAMING, pattern->w, pattern->h);
+    SDLTest_AssertCheck(texture != NULL, "SDL_CreateTexture(): %s", texture ? "success" : SDL_GetError());
+    if (!texture) {
+        goto done;
+    }
+    SDL_UpdateTexture(texture, NULL, pattern->pixels, pattern->pitch);
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_LINEAR);
+    props = SDL_GetRendererProperties(software_renderer);
+
+    drawScaleCacheFrame(software_renderer, texture);
+    SDL_FlushRenderer(software_renderer);
+    first = SDL_DuplicateSurface(target);
+    hits = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_SOFTWARE_SCALE_CACHE_HITS_NUMBER, -1);
+    misses = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_SOFTWARE_SCALE_CACHE_MISSES_NUMBER, -1);
+    SDLTest_AssertCheck(hits == 0 && misses == 2, "Check the first frame scales both copies, got %d hits and %d misses", (int)hits, (int)misses);
+
+    drawScaleCacheFrame(software_renderer, texture);
+    SDL_FlushRenderer(software_renderer);
+    hits = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_SOFTWARE_SCALE_CACHE_HITS_NUMBER, -1);
+    misses = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_SOFTWARE_SCALE_CACHE_MISSES_NUMBER, -1);
+    SDLTest_AssertCheck(hits == 2 && misses == 2, "Check the second frame reuses both copies, got %d hits and %d misses", (int)hits, (int)misses);
+    SDLTest_AssertCheck(first && compareSurfacePixels(first, target, NULL), "Check the cached copies draw the same pixels");
+
+    /* The cached copies have to match a scaled blit of the texture */
+    expected = SDL_CreateSurface(target->w, target->h, target->format);
+    SDLTest_AssertCheck(expected != NULL, "Create reference surface");
+    if (expected) {
+        SDL_FillSurfaceRect(expected, NULL, SDL_MapSurfaceRGB(expected, 0x10, 0x20, 0x30));
+        SDL_SetSurfaceBlendMode(pattern, SDL_BLENDMODE_BLEND);
+        SDL_SetSurfaceColorMod(pattern, 0xFF, 0x80, 0xC0);
+        SDL_BlitSurfaceScaled(pattern, NULL, expected, &onscreen, SDL_SCALEMODE_LINEAR);
+        SDLTest_AssertCheck(compareSurfacePixels(expected, target, &onscreen), "Check the cached copy matches SDL_BlitSurfaceScaled()");
+    }
+
+    /* Updating the texture throws its copies away */
+    for (y = 0; y < pattern->h; ++y) {
+        Uint32 *row = (Uint32 *)((Uint8 *)pattern->pixels + y * pattern->pitch);
+        for (x = 0; x < pattern->w; ++x) {
+            row[x] ^= 0x00FFFF00;
+        }
+    }
+    SDL_UpdateTexture(texture, NULL, pattern->pixels, pattern->pitch);
+    drawScaleCacheFrame(software_renderer, texture);
+    SDL_FlushRenderer(software_renderer);
+    hits = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_SOFTWARE_SCALE_CACHE_HITS_NUMBER, -1);
+    misses = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_SOFTWARE_SCALE_CACHE_MISSES_NUMBER, -1);
+    SDLTest_AssertCheck(hits == 2 && misses == 4, "Check the updated texture is scaled again, got %d hits and %d misses", (int)hits, (int)misses);
+    SDLTest_AssertCheck(first && !compareSurfacePixels(first, target, NULL), "Check the updated texture is drawn");
+
+done:
+    SDL_DestroySurface(expected);
+    SDL_DestroySurface(first);
+    SDL_DestroyTexture(texture);
+    SDL_DestroyRenderer(software_renderer);
+    SDL_DestroySurface(pattern);
+    SDL_DestroySurface(target);
+
+    return TEST_COMPLETED;
+}
+
+static SDL_Texture *createReorderTexture(SDL_Renderer *software_renderer, Uint8 r, Uint8 g, Uint8 b)
+{
+    SDL_Texture *texture = SDL_CreateTexture(software_renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 8, 8);
+    Uint32 pixels[8 * 8];
+    int i;
+
+    if (!texture) {
+        return NULL;
+    }
+    for (i = 0; i < (int)SDL_arraysize(pixels); ++i) {
+        pixels[i] = ((Uint32)(0x60 + i * 2) << 24) | ((Uint32)r << 16) | ((Uint32)g << 8) | b;
+    }
+    SDL_UpdateTexture(texture, NULL, pixels, 8 * sizeof(Uint32));
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    return texture;
+}
+
+static void drawReorderQuad(SDL_Renderer *software_renderer, SDL_Texture *texture, float x, float y, float size)
+{
+    static const int indices[] = { 0, 1, 2, 0, 2, 3 };
+    SDL_Vertex verts[4];
+    int i;
+
+    for (i = 0; i < 4; ++i) {
+        verts[i].position.x = x + ((i == 1 || i == 2) ? size : 0.0f);
+        verts[i].position.y = y + ((i >= 2) ? size : 0.0f);
+        verts[i].color.r = 1.0f;
+        verts[i].color.g = 1.0f;
+        verts[i].color.b = 1.0f;
+        verts[i].color.a = 1.0f;
+        verts[i].tex_coord.x = (i == 1 || i == 2) ? 1.0f : 0.0f;
+        verts[i].tex_coord.y = (i >= 2) ? 1.0f : 0.0f;
+    }
+    SDL_RenderGeometry(software_renderer, texture, verts, 4, indices, 6);
+}
+
+static SDL_Surface *drawReorderFrame(bool reorder, Sint64 *queued, Sint64 *submitted)
+{
+    SDL_Surface *target = NULL;
+    SDL_Renderer *software_renderer = NULL;
+    SDL_Texture *textures[2] = { NULL, NULL };
+    SDL_PropertiesID props;
+    SDL_FRect rect = { 150.0f, 10.0f, 30.0f, 30.0f };
+    int i;
+
+    target = SDL_CreateSurface(200, 150, SDL_PIXELFORMAT_ARGB8888);
+    if (!target) {
+        return NULL;
+    }
+    props = SDL_CreateProperties();
+    SDL_SetPointerProperty(props, SDL_PROP_RENDERER_CREATE_SURFACE_POINTER, target);
+    SDL_SetBooleanProperty(props, SDL_PROP_RENDERER_CREATE_REORDER_DRAWS_BOOLEAN, reorder);
+    software_renderer = SDL_CreateRendererWithProperties(props);
+    SDL_DestroyProperties(props);
+    if (!software_renderer) {
+        SDL_DestroySurface(target);
+        return NULL;
+    }
+    textures[0] = createReorderTexture(software_renderer, 0xFF, 0x40, 0x00);
+    textures[1] = createReorderTexture(software_renderer, 0x00, 0x80, 0xFF);
+
+    /* Wrapping keeps the software renderer from turning the quads into copies */
+    SDL_SetRenderTextureAddressMode(software_renderer, SDL_TEXTURE_ADDRESS_WRAP, SDL_TEXTURE_ADDRESS_WRAP);
+    SDL_SetRenderDrawColor(software_renderer, 0x10, 0x20, 0x30, 0xFF);
+    SDL_RenderClear(software_renderer);
+
+    /* Interleaved draws from two textures that don't overlap, which can be merged */
+    for (i = 0; i < 40; ++i) {
+        drawReorderQuad(software_renderer, textures[i % 2], (float)((i % 10) * 12), (float)((i / 10) * 12), 10.0f);
+    }
+
+    /* Overlapping draws, which have to stay in order */
+    for (i = 0; i < 10; ++i) {
+        drawReorderQuad(software_renderer, textures[i % 2], 20.0f + i * 3.0f, 70.0f + i * 2.0f, 24.0f);
+    }
+
+    /* A fill that overlaps draws from both textures */
+    SDL_SetRenderDrawColor(software_renderer, 0xFF, 0xFF, 0xFF, 0x80);
+    SDL_SetRenderDrawBlendMode(software_renderer, SDL_BLENDMODE_BLEND);
+    SDL_RenderFillRect(software_renderer, &rect);
+    for (i = 0; i < 4; ++i) {
+        drawReorderQuad(software_renderer, textures[i % 2], 140.0f + i * 10.0f, 20.0f, 16.0f);
+    }
+
+    SDL_FlushRenderer(software_renderer);
+    props = SDL_GetRendererProperties(software_renderer);
+    *queued = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_QUEUED_COMMANDS_NUMBER, -1);
+    *submitted = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_SUBMITTED_COMMANDS_NUMBER, -1);
+
+    SDL_DestroyTexture(textures[0]);
+    SDL_DestroyTexture(textures[1]);
+    SDL_DestroyRenderer(software_renderer);
+    return target;
+}
+
+/**
+ * Tests that reordering draws merges them without changing the output
+ */
+static int SDLCALL render_testReorderDraws(void *arg)
+{
+    SDL_Surface *ordered;
+    SDL_Surface *reordered;
+    Sint64 ordered_queued = 0, ordered_submitted = 0;
+    Sint64 reordered_queued = 0, reordered_submitted = 0;
+
+    ordered = drawReorderFrame(false, &ordered_queued, &ordered_submitted);
+    reordered = drawReorderFrame(true, &reordered_queued, &reordered_submitted);
+    SDLTest_AssertCheck(ordered && reordered, "Draw frames with and without reordering");
+    if (ordered && reordered) {
+        SDLTest_AssertCheck(compareSurfacePixels(ordered, reordered, NULL), "Check the reordered draws produce the same pixels");
+    }
+    SDLTest_AssertCheck(ordered_queued > 0 && ordered_submitted == ordered_queued,
+                        "Check all commands are submitted without reordering, got %d of %d", (int)ordered_submitted, (int)ordered_queued);
+    SDLTest_AssertCheck(reordered_queued == ordered_queued && reordered_submitted < reordered_queued - 30,
+                        "Check the draws are merged with reordering, got %d of %d", (int)reordered_submitted, (int)reordered_queued);
+
+    SDL_DestroySurface(ordered);
+    SDL_DestroySurface(reordered);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests the statistics reported for each frame
+ */
+static int SDLCALL render_testFrameStats(void *arg)
+{
+    SDL_Surface *target = NULL;
+    SDL_Renderer *software_renderer = NULL;
+    SDL_Texture *texture = NULL;
+    SDL_PropertiesID props;
+    SDL_FRect rect = { 4.0f, 4.0f, 8.0f, 8.0f };
+    SDL_FPoint points[2] = { { 1.0f, 1.0f }, { 20.0f, 20.0f } };
+    Uint32 pixels[16 * 16];
+    Sint64 value;
+
+    SDL_zeroa(pixels);
+    target = SDL_CreateSurface(32, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(target != NULL, "Create target surface");
+    if (!target) {
+        goto done;
+    }
+    software_renderer = SDL_CreateSoftwareRenderer(target);
+    SDLTest_AssertCheck(software_renderer != NULL, "Create software renderer");
+    if (!software_renderer) {
+        goto done;
+    }
+    texture = SDL_CreateTexture(software_renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 16, 16);
+    SDLTest_AssertCheck(texture != NULL, "Create texture");
+    if (!texture) {
+        goto done;
+    }
+    props = SDL_GetRendererProperties(software_renderer);
+
+    SDL_RenderClear(software_renderer);
+    SDL_UpdateTexture(texture, NULL, pixels, 16 * sizeof(Uint32));
+    SDL_RenderTexture(software_renderer, texture, NULL, &rect);
+    /* Changing a texture that a queued draw uses flushes the queue */
+    SDL_UpdateTexture(texture, NULL, pixels, 16 * sizeof(Uint32));
+    SDL_SetRenderDrawColor(software_renderer, 0xFF, 0x00, 0x00, 0xFF);
+    SDL_RenderFillRect(software_renderer, &rect);
+    SDL_RenderLines(software_renderer, points, 2);
+    SDL_RenderPresent(software_renderer);
+
+    value = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_FRAME_CLEAR_COMMANDS_NUMBER, -1);
+    SDLTest_AssertCheck(value == 1, "Check the frame clears, got %d", (int)value);
+    value = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_FRAME_COPY_COMMANDS_NUMBER, -1);
+    SDLTest_AssertCheck(value == 1, "Check the frame copies, got %d", (int)value);
+    value = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_FRAME_RECT_COMMANDS_NUMBER, -1);
+    SDLTest_AssertCheck(value == 1, "Check the frame rects, got %d", (int)value);
+    value = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_FRAME_LINE_COMMANDS_NUMBER, -1);
+    SDLTest_AssertCheck(value == 1, "Check the frame lines, got %d", (int)value);
+    value = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_FRAME_STATE_COMMANDS_NUMBER, -1);
+    SDLTest_AssertCheck(value >= 2, "Check the frame state changes, got %d", (int)value);
+    value = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_FRAME_VERTEX_BYTES_NUMBER, -1);
+    SDLTest_AssertCheck(value > 0, "Check the frame vertex bytes, got %d", (int)value);
+    value = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_FRAME_TEXTURE_UPLOAD_BYTES_NUMBER, -1);
+    SDLTest_AssertCheck(value == 2 * sizeof(pixels), "Check the frame texture upload bytes, got %d", (int)value);
+    value = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_FRAME_FLUSHES_NUMBER, -1);
+    SDLTest_AssertCheck(value == 2, "Check the frame flushes, got %d", (int)value);
+    value = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_FRAME_DEPENDENCY_FLUSHES_NUMBER, -1);
+    SDLTest_AssertCheck(value == 1, "Check the frame dependency flushes, got %d", (int)value);
+    value = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_FRAME_SUBMIT_TIME_NS_NUMBER, -1);
+    SDLTest_AssertCheck(value >= 0, "Check the frame submit time, got %d", (int)value);
+
+    /* The next frame starts counting from zero */
+    SDL_RenderPresent(software_renderer);
+    value = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_FRAME_COPY_COMMANDS_NUMBER, -1);
+    SDLTest_AssertCheck(value == 0, "Check the empty frame copies, got %d", (int)value);
+    value = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_FRAME_TEXTURE_UPLOAD_BYTES_NUMBER, -1);
+    SDLTest_AssertCheck(value == 0, "Check the empty frame texture upload bytes, got %d", (int)value);
+    value = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_FRAME_FLUSHES_NUMBER, -1);
+    SDLTest_AssertCheck(value == 0, "Check the empty frame flushes, got %d", (int)value);
+
+done:
+    SDL_DestroyTexture(texture);
+    SDL_DestroyRenderer(software_renderer);
+    SDL_DestroySurface(target);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests that the memory for vertex data shrinks after a heavy frame
+ */
+static int SDLCALL render_testVertexBufferDecay(void *arg)
+{
+    SDL_Surface *target = NULL;
+    SDL_Renderer *software_renderer = NULL;
+    SDL_PropertiesID props;
+    SDL_FRect *rects = NULL;
+    const int num_rects = 20000;
+    Sint64 heavy_size, light_size;
+    int i;
+
+    target = SDL_CreateSurface(64, 64, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(target != NULL, "Create target surface");
+    rects = (SDL_FRect *)SDL_calloc(num_rects, sizeof(*rects));
+    SDLTest_AssertCheck(rects != NULL, "Allocate rectangles");
+    if (!target || !rects) {
+        goto done;
+    }
+    for (i = 0; i < num_rects; ++i) {
+        rects[i].x = (float)(i % 60);
+        rects[i].y = (float)(i % 61);
+        rects[i].w = 2.0f;
+        rects[i].h = 2.0f;
+    }
+
+    props = SDL_CreateProperties();
+    SDL_SetPointerProperty(props, SDL_PROP_RENDERER_CREATE_SURFACE_POINTER, target);
+    SDL_SetNumberProperty(props, SDL_PROP_RENDERER_CREATE_VERTEX_BUFFER_SIZE_NUMBER, 16384);
+    SDL_SetNumberProperty(props, SDL_PROP_RENDERER_CREATE_VERTEX_BUFFER_DECAY_NUMBER, 2);
+    software_renderer = SDL_CreateRendererWithProperties(props);
+    SDL_DestroyProperties(props);
+    SDLTest_AssertCheck(software_renderer != NULL, "Create software renderer");
+    if (!software_renderer) {
+        goto done;
+    }
+    props = SDL_GetRendererProperties(software_renderer);
+
+    SDL_RenderFillRects(software_renderer, rects, num_rects);
+    SDL_RenderPresent(software_renderer);
+    heavy_size = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_VERTEX_BUFFER_SIZE_NUMBER, -1);
+    SDLTest_AssertCheck(heavy_size >= num_rects * (Sint64)sizeof(SDL_Rect), "Check the vertex buffers grow for a heavy frame, got %d bytes", (int)heavy_size);
+
+    for (i = 0; i < 10; ++i) {
+        SDL_RenderFillRects(software_renderer, rects, 10);
+        SDL_RenderPresent(software_renderer);
+    }
+    light_size = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_VERTEX_BUFFER_SIZE_NUMBER, -1);
+    SDLTest_AssertCheck(light_size == 2 * 16384, "Check the vertex buffers shrink back to their initial size, got %d bytes", (int)light_size);
+
+done:
+    SDL_DestroyRenderer(software_renderer);
+    SDL_free(rects);
+    SDL_DestroySurface(target);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Render test cases */
@@ -2383,6 +3028,30 @@ static const SDLTest_TestCaseReference renderTestColorspaceSRGB = {
     render_testColorspaceSRGB, "render_testColorspaceSRGB", "Tests colorspace support (linear -> sRGB)", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference renderTestSoftwareThreads = {
+    render_testSoftwareThreads, "render_testSoftwareThreads", "Tests drawing with several software renderer threads", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestSoftwareScaleCache = {
+    render_testSoftwareScaleCache, "render_testSoftwareScaleCache", "Tests the software renderer cache of scaled textures", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestReorderDraws = {
+    render_testReorderDraws, "render_testReorderDraws", "Tests reordering and merging draws", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestFrameStats = {
+    render_testFrameStats, "render_testFrameStats", "Tests the statistics reported for each frame", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestVertexBufferDecay = {
+    render_testVertexBufferDecay, "render_testVertexBufferDecay", "Tests that the memory for vertex data shrinks after a heavy frame", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestGeometrySIMD = {
+    render_testGeometrySIMD, "render_testGeometrySIMD", "Tests that SIMD triangle shading matches the scalar code", TEST_ENABLED
+};
+
 /* Sequence of Render test cases */
 static const SDLTest_TestCaseReference *renderTests[] = {
     &renderTestGetNumRenderDrivers,
@@ -2404,6 +3073,12 @@ static const SDLTest_TestCaseReference *renderTests[] = {
     &renderTestRGBSurfaceNoAlpha,
     &renderTestColorspaceLinear,
     &renderTestColorspaceSRGB,
+    &renderTestSoftwareThreads,
+    &renderTestSoftwareScaleCache,
+    &renderTestReorderDraws,
+    &renderTestFrameStats,
+    &renderTestVertexBufferDecay,
+    &renderTestGeometrySIMD,
     NULL
 };
 
@@ -2128,6 +2128,688 @@ static int SDLCALL surface_test16BitTo32Bit(void *arg)
 }
 
 
+static SDL_Surface *ConvertWithThreads(SDL_Surface *surface, SDL_PixelFormat format, SDL_Colorspace colorspace, const char *threads)
+{
+    SDL_Surface *result;
+
+    SDL_SetHint(SDL_HINT_SURFACE_CONVERT_THREADS, threads);
+    result = SDL_ConvertSurfaceAndColorspace(surface, format, NULL, colorspace, 0);
+    SDL_ResetHint(SDL_HINT_SURFACE_CONVERT_THREADS);
+    return result;
+}
+
+/**
+ * Tests that converting large surfaces on several threads gives the same pixels as one thread.
+ */
+static int SDLCALL surface_testConvertThreads(void *arg)
+{
+    static const struct
+    {
+        SDL_PixelFormat src_format;
+        SDL_PixelFormat dst_format;
+        SDL_Colorspace dst_colorspace;
+    } conversions[] = {
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565, SDL_COLORSPACE_UNKNOWN },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR24, SDL_COLORSPACE_UNKNOWN },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR2101010, SDL_COLORSPACE_UNKNOWN },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGBA64_FLOAT, SDL_COLORSPACE_SRGB_LINEAR },
+        { SDL_PIXELFORMAT_RGBA64_FLOAT, SDL_PIXELFORMAT_ARGB8888, SDL_COLORSPACE_SRGB },
+        { SDL_PIXELFORMAT_NV12, SDL_PIXELFORMAT_XRGB8888, SDL_COLORSPACE_UNKNOWN },
+        { SDL_PIXELFORMAT_YUY2, SDL_PIXELFORMAT_XBGR8888, SDL_COLORSPACE_UNKNOWN },
+    };
+    const int width = 720;
+    const int height = 811; /* odd, so the last band has a single row of chroma */
+    SDL_Surface *source;
+    int i, x, y, ret;
+
+    source = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(source != NULL, "Verify source surface is not NULL");
+    if (!source) {
+        return TEST_ABORTED;
+    }
+    for (y = 0; y < height; ++y) {
+        Uint32 *row = (Uint32 *)((Uint8 *)source->pixels + y * source->pitch);
+        for (x = 0; x < width; ++x) {
+            row[x] = (Uint32)((x * 7) ^ (y * 13)) * 0x01010101u + (Uint32)(x + y);
+        }
+    }
+
+    for (i = 0; i < SDL_arraysize(conversions); ++i) {
+        SDL_Surface *input = NULL;
+        SDL_Surface *expected = NULL;
+        SDL_Surface *actual = NULL;
+
+        SDLTest_Log("Checking conversion from %s to %s on several threads",
+                    SDL_GetPixelFormatName(conversions[i].src_format), SDL_GetPixelFormatName(conversions[i].dst_format));
+
+        input = SDL_ConvertSurface(source, conversions[i].src_format);
+        SDLTest_AssertCheck(input != NULL, "Verify input surface is not NULL");
+        if (input) {
+            expected = ConvertWithThreads(input, conversions[i].dst_format, conversions[i].dst_colorspace, "1");
+            actual = ConvertWithThreads(input, conversions[i].dst_format, conversions[i].dst_colorspace, "4");
+        }
+        SDLTest_AssertCheck(expected != NULL && actual != NULL, "Verify converted surfaces are not NULL");
+        if (expected && actual) {
+            for (y = 0; y < height; ++y) {
+                const void *a = (const Uint8 *)expected->pixels + y * expected->pitch;
+                const void *b = (const Uint8 *)actual->pixels + y * actual->pitch;
+                if (SDL_memcmp(a, b, width * SDL_BYTESPERPIXEL(expected->format)) != 0) {
+                    break;
+                }
+            }
+            ret = (y == height) ? 0 : y;
+            SDLTest_AssertCheck(ret == 0, "Validate the pixels are identical, first difference on row: %i", ret);
+        }
+        SDL_DestroySurface(input);
+        SDL_DestroySurface(expected);
+        SDL_DestroySurface(actual);
+    }
+    SDL_DestroySurface(source);
+
+    return TEST_COMPLETED;
+}
+
+
+static SDL_Surface *CreateFloatConversionSource(int width, int height, SDL_PixelFormat format, SDL_Colorspace colorspace)
+{
+    SDL_Surface *surface;
+    Uint64 seed = 1234;
+    int x, y;
+
+    if (format == SDL_PIXELFORMAT_RGBA64_FLOAT) {
+        SDL_Surface *temp = CreateFloatConversionSource(width, height, SDL_PIXELFORMAT_RGBA128_FLOAT, colorspace);
+        if (!temp) {
+            return NULL;
+        }
+        surface = SDL_ConvertSurfaceAndColorspace(temp, format, NULL, colorspace, 0);
+        SDL_DestroySurface(temp);
+        return surface;
+    }
+
+    surface = SDL_CreateSurface(width, height, format);
+    if (!surface) {
+        return NULL;
+    }
+    SDL_SetSurfaceColorspace(surface, colorspace);
+
+    for (y = 0; y < height; ++y) {
+        Uint8 *row = (Uint8 *)surface->pixels + y * surface->pitch;
+        for (x = 0; x < width; ++x) {
+            if (format == SDL_PIXELFORMAT_RGBA128_FLOAT) {
+                float *pixel = (float *)row + x * 4;
+                pixel[0] = (float)SDL_rand_r(&seed, 5000) / 1000.0f - 0.5f;
+                pixel[1] = (float)SDL_rand_r(&seed, 5000) / 1000.0f - 0.5f;
+                pixel[2] = (float)SDL_rand_r(&seed, 5000) / 1000.0f - 0.5f;
+                pixel[3] = 1.0f;
+            } else if (SDL_ISPIXELFORMAT_10BIT(format)) {
+                /* Opaque, so blending gives the same result as copying */
+                ((Uint32 *)row)[x] = 0xC0000000 | (SDL_rand_bits_r(&seed) & 0x3FFFFFFF);
+            } else {
+                ((Uint32 *)row)[x] = SDL_rand_bits_r(&seed) | SDL_GetPixelFormatDetails(format)->Amask;
+            }
+        }
+    }
+    return surface;
+}
+
+/**
+ * Tests that the fast colorspace conversions give the same result as the general float blitter.
+ *
+ * Blending an opaque surface onto a cleared one always goes through SDL_Blit_Slow_Float(),
+ * while converting it may use one of the fast paths.
+ */
+static int SDLCALL surface_testFloatConversions(void *arg)
+{
+    static const struct
+    {
+        SDL_PixelFormat src_format;
+        SDL_Colorspace src_colorspace;
+        const char *tonemap;
+        SDL_PixelFormat dst_format;
+        SDL_Colorspace dst_colorspace;
+    } conversions[] = {
+        { SDL_PIXELFORMAT_ARGB8888, SDL_COLORSPACE_SRGB, NULL, SDL_PIXELFORMAT_RGBA128_FLOAT, SDL_COLORSPACE_SRGB_LINEAR },
+        { SDL_PIXELFORMAT_ABGR8888, SDL_COLORSPACE_SRGB, NULL, SDL_PIXELFORMAT_RGBA64_FLOAT, SDL_COLORSPACE_SRGB_LINEAR },
+        { SDL_PIXELFORMAT_XRGB8888, SDL_COLORSPACE_SRGB, NULL, SDL_PIXELFORMAT_ABGR2101010, SDL_COLORSPACE_HDR10 },
+        { SDL_PIXELFORMAT_RGBA128_FLOAT, SDL_COLORSPACE_SRGB_LINEAR, NULL, SDL_PIXELFORMAT_ARGB8888, SDL_COLORSPACE_SRGB },
+        { SDL_PIXELFORMAT_RGBA128_FLOAT, SDL_COLORSPACE_SRGB_LINEAR, "chrome", SDL_PIXELFORMAT_XBGR8888, SDL_COLORSPACE_SRGB },
+        { SDL_PIXELFORMAT_RGBA64_FLOAT, SDL_COLORSPACE_SRGB_LINEAR, NULL, SDL_PIXELFORMAT_XRGB2101010, SDL_COLORSPACE_HDR10 },
+        { SDL_PIXELFORMAT_RGBA128_FLOAT, SDL_COLORSPACE_SRGB_LINEAR, NULL, SDL_PIXELFORMAT_RGBA64_FLOAT, SDL_COLORSPACE_HDR10 },
+        { SDL_PIXELFORMAT_ABGR2101010, SDL_COLORSPACE_HDR10, NULL, SDL_PIXELFORMAT_RGBA128_FLOAT, SDL_COLORSPACE_SRGB_LINEAR },
+        { SDL_PIXELFORMAT_ABGR2101010, SDL_COLORSPACE_HDR10, "chrome", SDL_PIXELFORMAT_ARGB8888, SDL_COLORSPACE_SRGB },
+        { SDL_PIXELFORMAT_XBGR2101010, SDL_COLORSPACE_HDR10, "*=0.5", SDL_PIXELFORMAT_RGBA64_FLOAT, SDL_COLORSPACE_SRGB_LINEAR },
+        { SDL_PIXELFORMAT_ARGB2101010, SDL_COLORSPACE_SRGB, NULL, SDL_PIXELFORMAT_RGBA8888, SDL_COLORSPACE_SRGB_LINEAR },
+    };
+    const int width = 301;
+    const int height = 7;
+    int i, x, y;
+
+    for (i = 0; i < SDL_arraysize(conversions); ++i) {
+        SDL_Surface *source = NULL;
+        SDL_Surface *expected = NULL;
+        SDL_Surface *actual = NULL;
+        int mismatches = 0;
+
+        SDLTest_Log("Checking conversion from %s to %s%s%s", SDL_GetPixelFormatName(conversions[i].src_format),
+                    SDL_GetPixelFormatName(conversions[i].dst_format),
+                    conversions[i].tonemap ? " with tonemap " : "", conversions[i].tonemap ? conversions[i].tonemap : "");
+
+        source = CreateFloatConversionSource(width, height, conversions[i].src_format, conversions[i].src_colorspace);
+        SDLTest_AssertCheck(source != NULL, "Verify source surface is not NULL");
+        if (!source) {
+            continue;
+        }
+        if (conversions[i].tonemap) {
+            SDL_PropertiesID props = SDL_GetSurfaceProperties(source);
+            SDL_SetFloatProperty(props, SDL_PROP_SURFACE_HDR_HEADROOM_FLOAT, 4.0f);
+            SDL_SetStringProperty(props, SDL_PROP_SURFACE_TONEMAP_OPERATOR_STRING, conversions[i].tonemap);
+        }
+
+        expected = SDL_CreateSurface(width, height, conversions[i].dst_format);
+        SDLTest_AssertCheck(expected != NULL, "Verify expected surface is not NULL");
+        if (expected) {
+            SDL_SetSurfaceColorspace(expected, conversions[i].dst_colorspace);
+            SDL_SetSurfaceBlendMode(source, SDL_BLENDMODE_BLEND);
+            SDL_BlitSurface(source, NULL, expected, NULL);
+            SDL_SetSurfaceBlendMode(source, SDL_BLENDMODE_NONE);
+        }
+        actual = SDL_ConvertSurfaceAndColorspace(source, conversions[i].dst_format, NULL, conversions[i].dst_colorspace, 0);
+        SDLTest_AssertCheck(actual != NULL, "Verify converted surface is not NULL");
+
+        if (expected && actual) {
+            for (y = 0; y < height; ++y) {
+                const Uint8 *a = (const Uint8 *)expected->pixels + y * expected->pitch;
+                const Uint8 *b = (const Uint8 *)actual->pixels + y * actual->pitch;
+                for (x = 0; x < width * SDL_BYTESPERPIXEL(expected->format); x += 4) {
+                    /* Blending adds 0 to the color, which turns -0.0 into 0.0 */
+                    if (expected->format == SDL_PIXELFORMAT_RGBA128_FLOAT) {
+                        if (*(const float *)(a + x) != *(const float *)(b + x)) {
+                            ++mismatches;
+                        }
+                    } else if (expected->format == SDL_PIXELFORMAT_RGBA64_FLOAT) {
+                        if (((*(const Uint32 *)(a + x) ^ *(const Uint32 *)(b + x)) & 0x7FFF7FFF) != 0) {
+                            ++mismatches;
+                        }
+                    } else if (SDL_ISPIXELFORMAT_10BIT(expected->format)) {
+                        /* The PQ curve is steep enough that the slow path rounds either way near the middle of a step */
+                        const Uint32 pa = *(const Uint32 *)(a + x);
+                        const Uint32 pb = *(const Uint32 *)(b + x);
+                        int shift;
+                        for (shift = 0; shift < 30; shift += 10) {
+                            if (SDL_abs((int)((pa >> shift) & 0x3FF) - (int)((pb >> shift) & 0x3FF)) > 1) {
+                                ++mismatches;
+                            }
+                        }
+                        if ((pa >> 30) != (pb >> 30)) {
+                            ++mismatches;
+                        }
+                    } else if (*(const Uint32 *)(a + x) != *(const Uint32 *)(b + x)) {
+                        ++mismatches;
+                    }
+                }
+            }
+            SDLTest_AssertCheck(mismatches == 0, "Validate the converted pixels match, expected 0 mismatches, got %d", mismatches);
+        }
+        SDL_DestroySurface(source);
+        SDL_DestroySurface(expected);
+        SDL_DestroySurface(actual);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/* Area-average of the source pixels under a destination pixel, computed in floating point */
+static void AreaAveragePixel(SDL_Surface *surface, int dst_w, int dst_h, int x, int y, double rgba[4])
+{
+    const double x0 = (double)x * surface->w / dst_w;
+    const double x1 = (double)(x + 1) * surface->w / dst_w;
+    const double y0 = (double)y * surface->h / dst_h;
+    const double y1 = (double)(y + 1) * surface->h / dst_h;
+    const double area = (x1 - x0) * (y1 - y0);
+    int sx, sy, i;
+
+    rgba[0] = rgba[1] = rgba[2] = rgba[3] = 0.0;
+    for (sy = (int)SDL_floor(y0); sy < (int)SDL_ceil(y1); ++sy) {
+        const double wy = SDL_min(y1, sy + 1.0) - SDL_max(y0, (double)sy);
+        for (sx = (int)SDL_floor(x0); sx < (int)SDL_ceil(x1); ++sx) {
+            const double wx = SDL_min(x1, sx + 1.0) - SDL_max(x0, (double)sx);
+            Uint8 r, g, b, a;
+            SDL_ReadSurfacePixel(surface, sx, sy, &r, &g, &b, &a);
+            rgba[0] += r * wx * wy;
+            rgba[1] += g * wx * wy;
+            rgba[2] += b * wx * wy;
+            rgba[3] += a * wx * wy;
+        }
+    }
+    for (i = 0; i < 4; ++i) {
+        rgba[i] /= area;
+    }
+}
+
+/* Returns the largest channel difference between a scaled surface and the exact area-average of the source */
+static double AreaAverageError(SDL_Surface *surface, SDL_Surface *scaled, double *mean)
+{
+    double max_error = 0.0, total = 0.0;
+    int x, y, i;
+
+    for (y = 0; y < scaled->h; ++y) {
+        for (x = 0; x < scaled->w; ++x) {
+            double expected[4];
+            Uint8 actual[4];
+            AreaAveragePixel(surface, scaled->w, scaled->h, x, y, expected);
+            SDL_ReadSurfacePixel(scaled, x, y, &actual[0], &actual[1], &actual[2], &actual[3]);
+            for (i = 0; i < 4; ++i) {
+                const double error = SDL_fabs(actual[i] - expected[i]);
+                max_error = SDL_max(max_error, error);
+                total += error;
+            }
+        }
+    }
+    if (mean) {
+        *mean = total / (4.0 * scaled->w * scaled->h);
+    }
+    return max_error;
+}
+
+static SDL_Surface *CreateAreaScaleSource(int width, int height)
+{
+    SDL_Surface *surface = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_ARGB8888);
+    int x, y;
+
+    if (surface) {
+        for (y = 0; y < height; ++y) {
+            Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+            for (x = 0; x < width; ++x) {
+                row[x] = (Uint32)((x * 7) ^ (y * 13)) * 0x01010101u + (Uint32)(x * 3 + y) * 0x00010203u;
+            }
+        }
+    }
+    return surface;
+}
+
+static SDL_Surface *ScaleWithThreads(SDL_Surface *surface, int width, int height, const char *threads)
+{
+    SDL_Surface *result;
+
+    SDL_SetHint(SDL_HINT_SURFACE_CONVERT_THREADS, threads);
+    result = SDL_ScaleSurface(surface, width, height, SDL_SCALEMODE_AREA);
+    SDL_ResetHint(SDL_HINT_SURFACE_CONVERT_THREADS);
+    return result;
+}
+
+/**
+ * Tests area-average scaling against a floating point reference, and compares it with repeated halving.
+ */
+static int SDLCALL surface_testAreaScale(void *arg)
+{
+    static const SDL_PixelFormat formats[] = {
+        SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB24,
+        SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_ARGB4444,
+    };
+    static const struct
+    {
+        int w, h;
+    } sizes[] = {
+        { 31, 17 }, { 8, 8 }, { 97, 3 }, { 1, 1 }, { 150, 90 },
+    };
+    static const int large_widths[] = { 1000, 3000, 6000, 12000, 40000 };
+    const Uint32 expected_pixel = 0xFF302010;
+    SDL_Surface *source, *input, *result, *expected;
+    Uint64 start, area_ticks, halving_ticks;
+    double max_error, area_error, halving_error;
+    int i, j, y;
+
+    source = CreateAreaScaleSource(97, 61);
+    SDLTest_AssertCheck(source != NULL, "Verify source surface is not NULL");
+    if (!source) {
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        /* Channels with fewer bits are averaged at their own precision */
+        const double tolerance = (SDL_BYTESPERPIXEL(formats[i]) == 2) ? 10.0 : 1.0;
+
+        input = SDL_ConvertSurface(source, formats[i]);
+        SDLTest_AssertCheck(input != NULL, "Verify %s input surface is not NULL", SDL_GetPixelFormatName(formats[i]));
+        if (!input) {
+            continue;
+        }
+        for (j = 0; j < SDL_arraysize(sizes); ++j) {
+            result = SDL_ScaleSurface(input, sizes[j].w, sizes[j].h, SDL_SCALEMODE_AREA);
+            SDLTest_AssertCheck(result != NULL, "SDL_ScaleSurface(%s, %d, %d, SDL_SCALEMODE_AREA)", SDL_GetPixelFormatName(formats[i]), sizes[j].w, sizes[j].h);
+            if (result) {
+                SDLTest_AssertCheck(result->format == formats[i], "Verify the scaled surface keeps its format");
+                max_error = AreaAverageError(input, result, NULL);
+                SDLTest_AssertCheck(max_error <= tolerance, "Verify %dx%d area-average error, expected <= %.1f, got %.2f", sizes[j].w, sizes[j].h, tolerance, max_error);
+                SDL_DestroySurface(result);
+            }
+        }
+        SDL_DestroySurface(input);
+    }
+    SDL_DestroySurface(source);
+
+    /* A solid color stays exactly the same */
+    source = SDL_CreateSurface(1000, 7, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(source != NULL, "Verify solid surface is not NULL");
+    if (source) {
+        SDL_FillSurfaceRect(source, NULL, 0x80FF0201);
+        result = SDL_ScaleSurface(source, 3, 2, SDL_SCALEMODE_AREA);
+        SDLTest_AssertCheck(result != NULL, "SDL_ScaleSurface(solid, 3, 2, SDL_SCALEMODE_AREA)");
+        if (result) {
+            for (y = 0; y < result->h; ++y) {
+                const Uint32 *row = (const Uint32 *)((const Uint8 *)result->pixels + y * result->pitch);
+                SDLTest_AssertCheck(row[0] == 0x80FF0201 && row[1] == 0x80FF0201 && row[2] == 0x80FF0201,
+                                    "Verify row %d is 0x80FF0201, got 0x%.8" SDL_PRIx32 " 0x%.8" SDL_PRIx32 " 0x%.8" SDL_PRIx32, y, row[0], row[1], row[2]);
+            }
+            SDL_DestroySurface(result);
+        }
+        SDL_DestroySurface(source);
+    }
+
+    /* Large reductions average every source pixel, however many there are */
+    for (i = 0; i < SDL_arraysize(large_widths); ++i) {
+        source = SDL_CreateSurface(large_widths[i], 1, SDL_PIXELFORMAT_ARGB8888);
+        SDLTest_AssertCheck(source != NULL, "Verify %d wide surface is not NULL", large_widths[i]);
+        if (!source) {
+            continue;
+        }
+        SDL_FillSurfaceRect(source, NULL, 0xFF302010);
+        result = SDL_ScaleSurface(source, 1, 1, SDL_SCALEMODE_AREA);
+        SDLTest_AssertCheck(result != NULL, "SDL_ScaleSurface(%d wide, 1, 1, SDL_SCALEMODE_AREA)", large_widths[i]);
+        if (result) {
+            const Uint32 pixel = *(const Uint32 *)result->pixels;
+            SDLTest_AssertCheck(pixel == 0xFF302010, "Verify solid %d wide row is 0xFF302010, got 0x%.8" SDL_PRIx32, large_widths[i], pixel);
+            SDL_DestroySurface(result);
+        }
+
+        *(Uint32 *)source->pixels = 0xFFFFFFFF;
+        result = SDL_ScaleSurface(source, 1, 1, SDL_SCALEMODE_AREA);
+        SDLTest_AssertCheck(result != NULL, "SDL_ScaleSurface(%d wide, 1, 1, SDL_SCALEMODE_AREA)", large_widths[i]);
+        if (result) {
+            const Uint32 pixel = *(const Uint32 *)result->pixels;
+            const Uint8 *expected_bytes = (const Uint8 *)&expected_pixel;
+            const Uint8 *result_bytes = (const Uint8 *)&pixel;
+            for (j = 0; j < 4; ++j) {
+                if (SDL_abs(result_bytes[j] - expected_bytes[j]) > 1) {
+                    break;
+                }
+            }
+            SDLTest_AssertCheck(j == 4, "Verify %d wide row with one white pixel is about 0xFF302010, got 0x%.8" SDL_PRIx32, large_widths[i], pixel);
+            SDL_DestroySurface(result);
+        }
+        SDL_DestroySurface(source);
+    }
+
+    source = SDL_CreateSurface(300, 20000, SDL_PIXELFORMAT_RGB565);
+    SDLTest_AssertCheck(source != NULL, "Verify tall surface is not NULL");
+    if (source) {
+        SDL_FillSurfaceRect(source, NULL, 0x8A52);
+        result = SDL_ScaleSurface(source, 2, 3, SDL_SCALEMODE_AREA);
+        SDLTest_AssertCheck(result != NULL, "SDL_ScaleSurface(300x20000, 2, 3, SDL_SCALEMODE_AREA)");
+        if (result) {
+            for (y = 0; y < result->h; ++y) {
+                const Uint16 *row = (const Uint16 *)((const Uint8 *)result->pixels + y * result->pitch);
+                SDLTest_AssertCheck(row[0] == 0x8A52 && row[1] == 0x8A52, "Verify row %d is 0x8A52, got 0x%.4x 0x%.4x", y, row[0], row[1]);
+            }
+            SDL_DestroySurface(result);
+        }
+        SDL_DestroySurface(source);
+    }
+
+    /* Scaling on several threads gives the same pixels as one thread */
+    source = CreateAreaScaleSource(1024, 768);
+    SDLTest_AssertCheck(source != NULL, "Verify large source surface is not NULL");
+    if (!source) {
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        input = SDL_ConvertSurface(source, formats[i]);
+        SDLTest_AssertCheck(input != NULL, "Verify %s input surface is not NULL", SDL_GetPixelFormatName(formats[i]));
+        if (!input) {
+            continue;
+        }
+        expected = ScaleWithThreads(input, 250, 100, "1");
+        result = ScaleWithThreads(input, 250, 100, "4");
+        SDLTest_AssertCheck(expected != NULL && result != NULL, "Verify scaled surfaces are not NULL");
+        if (expected && result) {
+            for (y = 0; y < expected->h; ++y) {
+                const void *a = (const Uint8 *)expected->pixels + y * expected->pitch;
+                const void *b = (const Uint8 *)result->pixels + y * result->pitch;
+                if (SDL_memcmp(a, b, expected->w * SDL_BYTESPERPIXEL(expected->format)) != 0) {
+                    break;
+                }
+            }
+            SDLTest_AssertCheck(y == expected->h, "Validate %s pixels are identical on several threads, first difference on row: %i", SDL_GetPixelFormatName(formats[i]), (y == expected->h) ? 0 : y);
+        }
+        SDL_DestroySurface(expected);
+        SDL_DestroySurface(result);
+        SDL_DestroySurface(input);
+    }
+    SDL_DestroySurface(source);
+
+    /* Make a thumbnail in one step, and by halving the size with linear filtering until it's close */
+    source = CreateAreaScaleSource(2048, 1536);
+    SDLTest_AssertCheck(source != NULL, "Verify thumbnail source surface is not NULL");
+    if (!source) {
+        return TEST_ABORTED;
+    }
+    start = SDL_GetPerformanceCounter();
+    result = SDL_ScaleSurface(source, 160, 120, SDL_SCALEMODE_AREA);
+    area_ticks = SDL_GetPerformanceCounter() - start;
+    SDLTest_AssertCheck(result != NULL, "SDL_ScaleSurface(2048x1536, 160, 120, SDL_SCALEMODE_AREA)");
+
+    start = SDL_GetPerformanceCounter();
+    expected = SDL_DuplicateSurface(source);
+    while (expected && expected->w / 2 >= 160) {
+        SDL_Surface *half = SDL_ScaleSurface(expected, expected->w / 2, expected->h / 2, SDL_SCALEMODE_LINEAR);
+        SDL_DestroySurface(expected);
+        expected = half;
+    }
+    if (expected) {
+        SDL_Surface *thumbnail = SDL_ScaleSurface(expected, 160, 120, SDL_SCALEMODE_LINEAR);
+        SDL_DestroySurface(expected);
+        expected = thumbnail;
+    }
+    halving_ticks = SDL_GetPerformanceCounter() - start;
+    SDLTest_AssertCheck(expected != NULL, "Verify repeated halving succeeded");
+
+    if (result && expected) {
+        AreaAverageError(source, result, &area_error);
+        AreaAverageError(source, expected, &halving_error);
+        SDLTest_Log("2048x1536 to 160x120, area: %.2f ms, mean error %.2f, repeated halving: %.2f ms, mean error %.2f",
+                    area_ticks * 1000.0 / SDL_GetPerformanceFrequency(), area_error,
+                    halving_ticks * 1000.0 / SDL_GetPerformanceFrequency(), halving_error);
+        SDLTest_AssertCheck(area_error <= halving_error, "Verify area-average is closer to the exact result than repeated halving");
+    }
+    SDL_DestroySurface(result);
+    SDL_DestroySurface(expected);
+    SDL_DestroySurface(source);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests nearest neighbor scaling between YUV layouts in a single pass.
+ */
+static int SDLCALL surface_testYUVStretch(void *arg)
+{
+    const int src_w = 8, src_h = 4, dst_w = 4, dst_h = 2;
+    SDL_Surface *source, *result;
+    const Uint8 *row, *uv;
+    int x, y;
+
+    source = SDL_CreateSurface(src_w, src_h, SDL_PIXELFORMAT_YUY2);
+    SDLTest_AssertCheck(source != NULL, "Verify YUY2 source surface is not NULL");
+    if (!source) {
+        return TEST_ABORTED;
+    }
+    for (y = 0; y < src_h; ++y) {
+        Uint8 *pixels = (Uint8 *)source->pixels + y * source->pitch;
+        for (x = 0; x < src_w; x += 2) {
+            pixels[x * 2 + 0] = (Uint8)(16 + y * src_w + x);
+            pixels[x * 2 + 1] = (Uint8)(100 + y * 4 + x / 2);
+            pixels[x * 2 + 2] = (Uint8)(16 + y * src_w + x + 1);
+            pixels[x * 2 + 3] = (Uint8)(200 + y * 4 + x / 2);
+        }
+    }
+
+    /* YUY2 to a smaller NV12, each output pixel comes from the source pixel under its center */
+    result = SDL_CreateSurface(dst_w, dst_h, SDL_PIXELFORMAT_NV12);
+    SDLTest_AssertCheck(result != NULL, "Verify NV12 result surface is not NULL");
+    if (result) {
+        SDLTest_AssertCheck(SDL_StretchSurface(source, NULL, result, NULL, SDL_SCALEMODE_NEAREST), "SDL_StretchSurface(YUY2 -> NV12)");
+        for (y = 0; y < dst_h; ++y) {
+            row = (const Uint8 *)result->pixels + y * result->pitch;
+            for (x = 0; x < dst_w; ++x) {
+                const int expected = 16 + (2 * y + 1) * src_w + (2 * x + 1);
+                SDLTest_AssertCheck(row[x] == expected, "Verify Y at %d,%d, expected %d, got %d", x, y, expected, row[x]);
+            }
+        }
+        uv = (const Uint8 *)result->pixels + dst_h * result->pitch;
+        for (x = 0; x < dst_w / 2; ++x) {
+            const int expected_u = 100 + 1 * 4 + 2 * x;
+            const int expected_v = 200 + 1 * 4 + 2 * x;
+            SDLTest_AssertCheck(uv[x * 2 + 0] == expected_u && uv[x * 2 + 1] == expected_v,
+                                "Verify UV at %d, expected %d,%d, got %d,%d", x, expected_u, expected_v, uv[x * 2 + 0], uv[x * 2 + 1]);
+        }
+        SDL_DestroySurface(result);
+    }
+
+    /* YUY2 scaled in place keeps one chroma pair per row */
+    result = SDL_ScaleSurface(source, dst_w, dst_h, SDL_SCALEMODE_NEAREST);
+    SDLTest_AssertCheck(result != NULL, "SDL_ScaleSurface(YUY2, %d, %d, SDL_SCALEMODE_NEAREST)", dst_w, dst_h);
+    if (result) {
+        SDLTest_AssertCheck(result->format == SDL_PIXELFORMAT_YUY2, "Verify the scaled surface keeps its format");
+        for (y = 0; y < dst_h; ++y) {
+            row = (const Uint8 *)result->pixels + y * result->pitch;
+            for (x = 0; x < dst_w; ++x) {
+                const int expected = 16 + (2 * y + 1) * src_w + (2 * x + 1);
+                SDLTest_AssertCheck(row[x * 2] == expected, "Verify Y at %d,%d, expected %d, got %d", x, y, expected, row[x * 2]);
+            }
+            for (x = 0; x < dst_w / 2; ++x) {
+                const int expected_u = 100 + (2 * y + 1) * 4 + 2 * x;
+                const int expected_v = 200 + (2 * y + 1) * 4 + 2 * x;
+                SDLTest_AssertCheck(row[x * 4 + 1] == expected_u && row[x * 4 + 3] == expected_v,
+                                    "Verify UV at %d,%d, expected %d,%d, got %d,%d", x, y, expected_u, expected_v, row[x * 4 + 1], row[x * 4 + 3]);
+            }
+        }
+        SDL_DestroySurface(result);
+    }
+
+    SDL_DestroySurface(source);
+    return TEST_COMPLETED;
+}
+
+/**
+ *  Tests saving PNG files with each compression level, filter and number of threads.
+ */
+static int SDLCALL surface_testSavePNGOptions(void *arg)
+{
+    static const char *filters[] = { "none", "sub", "up", "average", "paeth", "adaptive" };
+    static const char *levels[] = { "0", "1", "9" };
+    static const char *threads[] = { "1", "4" };
+    const int width = 600;
+    const int height = 611; /* about six bands of rows */
+    SDL_Surface *surfaces[2];
+    SDL_Palette *palette;
+    int i, j, k, n, x, y;
+
+    surfaces[0] = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_RGBA32);
+    surfaces[1] = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_INDEX8);
+    palette = surfaces[1] ? SDL_CreateSurfacePalette(surfaces[1]) : NULL;
+    SDLTest_AssertCheck(surfaces[0] != NULL && surfaces[1] != NULL && palette != NULL, "Verify source surfaces are not NULL");
+    if (!surfaces[0] || !surfaces[1] || !palette) {
+        SDL_DestroySurface(surfaces[0]);
+        SDL_DestroySurface(surfaces[1]);
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < palette->ncolors; ++i) {
+        palette->colors[i].r = (Uint8)i;
+        palette->colors[i].g = (Uint8)(255 - i);
+        palette->colors[i].b = (Uint8)(i * 7);
+        palette->colors[i].a = (Uint8)(i | 0x80);
+    }
+    for (y = 0; y < height; ++y) {
+        Uint8 *rgba = (Uint8 *)surfaces[0]->pixels + y * surfaces[0]->pitch;
+        Uint8 *index = (Uint8 *)surfaces[1]->pixels + y * surfaces[1]->pitch;
+        for (x = 0; x < width * 4; ++x) {
+            rgba[x] = (Uint8)((x * 3 + y) ^ ((x % 29) == 0 ? y * 11 : 0));
+        }
+        for (x = 0; x < width; ++x) {
+            index[x] = (Uint8)((x * y) >> 6);
+        }
+    }
+
+    for (n = 0; n < SDL_arraysize(surfaces); ++n) {
+        SDL_Surface *surface = surfaces[n];
+        for (i = 0; i < SDL_arraysize(filters); ++i) {
+            for (j = 0; j < SDL_arraysize(levels); ++j) {
+                for (k = 0; k < SDL_arraysize(threads); ++k) {
+                    SDL_IOStream *stream = SDL_IOFromDynamicMem();
+                    SDL_Surface *loaded = NULL;
+                    bool ret;
+
+                    SDLTest_AssertCheck(stream != NULL, "Verify iostream is not NULL");
+                    if (!stream) {
+                        continue;
+                    }
+                    SDL_SetHint(SDL_HINT_PNG_SAVE_FILTER, filters[i]);
+                    SDL_SetHint(SDL_HINT_PNG_SAVE_COMPRESSION_LEVEL, levels[j]);
+                    SDL_SetHint(SDL_HINT_PNG_SAVE_THREADS, threads[k]);
+                    ret = SDL_SavePNG_IO(surface, stream, false);
+                    SDLTest_AssertCheck(ret == true, "Verify SDL_SavePNG_IO() of %s with filter %s, level %s, %s threads, expected: true, got: %i",
+                                        SDL_GetPixelFormatName(surface->format), filters[i], levels[j], threads[k], ret);
+                    if (ret) {
+                        /* The zlib header is at the start of the first IDAT chunk, and FLEVEL should match the level */
+                        const Uint8 *png = (const Uint8 *)SDL_GetPointerProperty(SDL_GetIOProperties(stream), SDL_PROP_IOSTREAM_DYNAMIC_MEMORY_POINTER, NULL);
+                        const int expected_flevel = (SDL_atoi(levels[j]) <= 1) ? 0 : 3;
+                        size_t offset = 8;
+
+                        while (png && offset + 10 <= (size_t)SDL_GetIOSize(stream) && SDL_memcmp(png + offset + 4, "IDAT", 4) != 0) {
+                            offset += 12 + ((Uint32)png[offset] << 24 | (Uint32)png[offset + 1] << 16 | (Uint32)png[offset + 2] << 8 | png[offset + 3]);
+                        }
+                        SDLTest_AssertCheck(png && offset + 10 <= (size_t)SDL_GetIOSize(stream), "Verify the file has an IDAT chunk");
+                        if (png && offset + 10 <= (size_t)SDL_GetIOSize(stream)) {
+                            const Uint8 cmf = png[offset + 8];
+                            const Uint8 flg = png[offset + 9];
+                            SDLTest_AssertCheck(cmf == 0x78 && ((cmf << 8) | flg) % 31 == 0 && (flg >> 6) == expected_flevel,
+                                                "Verify the zlib header for level %s, expected: 78 with FLEVEL %d, got: %.2x %.2x",
+                                                levels[j], expected_flevel, cmf, flg);
+                        }
+
+                        SDL_SeekIO(stream, 0, SDL_IO_SEEK_SET);
+                        loaded = SDL_LoadPNG_IO(stream, false);
+                        SDLTest_AssertCheck(loaded != NULL, "Verify result from SDL_LoadPNG_IO is not NULL");
+                    }
+                    if (loaded && loaded->format != surface->format) {
+                        SDL_Surface *converted = SDL_ConvertSurface(loaded, surface->format);
+                        SDL_DestroySurface(loaded);
+                        loaded = converted;
+                    }
+                    if (loaded) {
+                        for (y = 0; y < height; ++y) {
+                            const void *a = (const Uint8 *)surface->pixels + y * surface->pitch;
+                            const void *b = (const Uint8 *)loaded->pixels + y * loaded->pitch;
+                            if (SDL_memcmp(a, b, width * SDL_BYTESPERPIXEL(surface->format)) != 0) {
+                                break;
+                            }
+                        }
+                        SDLTest_AssertCheck(y == height, "Validate the pixels are identical, first difference on row: %i", (y == height) ? 0 : y);
+                        SDL_DestroySurface(loaded);
+                    }
+                    SDL_CloseIO(stream);
+                }
+            }
+        }
+    }
+
+    SDL_ResetHint(SDL_HINT_PNG_SAVE_FILTER);
+    SDL_ResetHint(SDL_HINT_PNG_SAVE_COMPRESSION_LEVEL);
+    SDL_ResetHint(SDL_HINT_PNG_SAVE_THREADS);
+    SDL_DestroySurface(surfaces[0]);
+    SDL_DestroySurface(surfaces[1]);
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Surface test cases */
@@ -2259,6 +2941,26 @@ static const SDLTest_TestCaseReference surfaceTest16BitTo32Bit = {
     surface_test16BitTo32Bit, "surface_test16BitTo32Bit", "Test conversion from 16-bit to 32-bit pixels.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference surfaceTestConvertThreads = {
+    surface_testConvertThreads, "surface_testConvertThreads", "Test conversion of large surfaces on several threads.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestFloatConversions = {
+    surface_testFloatConversions, "surface_testFloatConversions", "Test the fast paths for colorspace conversions.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestAreaScale = {
+    surface_testAreaScale, "surface_testAreaScale", "Test area-average scaling.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestYUVStretch = {
+    surface_testYUVStretch, "surface_testYUVStretch", "Test scaling between YUV formats in a single pass.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestSavePNGOptions = {
+    surface_testSavePNGOptions, "surface_testSavePNGOptions", "Test saving PNG files with different compression settings.", TEST_ENABLED
+};
+
 /* Sequence of Surface test cases */
 static const SDLTest_TestCaseReference *surfaceTests[] = {
     &surfaceTestInvalidFormat,
@@ -2293,6 +2995,11 @@ static const SDLTest_TestCaseReference *surfaceTests[] = {
     &surfaceTestPremultiplyAlpha,
     &surfaceTestScale,
     &surfaceTest16BitTo32Bit,
+    &surfaceTestConvertThreads,
+    &surfaceTestFloatConversions,
+    &surfaceTestAreaScale,
+    &surfaceTestYUVStretch,
+    &surfaceTestSavePNGOptions,
     NULL
 };
 
@@ -0,0 +1,234 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures how fast the camera subsystem decodes MJPG frames, with a
+ * different number of decode threads each run, without a camera attached.
+ *
+ * The frames come from a recorded MJPG stream played back by the disk camera
+ * driver, for example one made with:
+ *   ffmpeg -i video.mp4 -s 1920x1080 -q:v 3 -f mjpeg recording.mjpg
+ *
+ * Frames have to reach the app in the order they were captured, so the run
+ * fails if a frame's timestamp is older than the one before it.
+ */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define MAX_RUNS 16
+
+typedef struct
+{
+    const char *file;
+    int frames;
+    int fps;
+    SDL_PixelFormat format;
+    int threads[MAX_RUNS];
+    int num_runs;
+} BenchmarkOptions;
+
+static bool ParseThreadCounts(const char *arg, BenchmarkOptions *options)
+{
+    const char *p = arg;
+
+    options->num_runs = 0;
+    while (*p && options->num_runs < MAX_RUNS) {
+        char *end = NULL;
+        const long threads = SDL_strtol(p, &end, 10);
+        if (end == p || threads < 0) {
+            return false;
+        }
+        options->threads[options->num_runs++] = (int)threads;
+        p = end;
+        if (*p == ',') {
+            ++p;
+        }
+    }
+    return options->num_runs > 0 && *p == '\0';
+}
+
+static bool RunBenchmark(SDL_CameraID camera_id, const SDL_CameraSpec *native, int threads, const BenchmarkOptions *options)
+{
+    SDL_CameraSpec spec = *native;
+    SDL_Camera *camera;
+    Uint64 start = 0, last_timestamp = 0, now;
+    int received = 0, warmup, out_of_order = 0;
+    bool result = true;
+
+    spec.format = options->format;
+    camera = SDL_OpenCamera(camera_id, &spec);
+    if (!camera) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't open camera: %s", SDL_GetError());
+        return false;
+    }
+    SDL_SetNumberProperty(SDL_GetCameraProperties(camera), SDL_PROP_CAMERA_DECODE_THREADS_NUMBER, threads);
+
+    /* Skip the frames decoded while the threads started up */
+    warmup = 10;
+    while (received < options->frames + warmup) {
+        Uint64 timestamp = 0;
+        SDL_Surface *frame = SDL_AcquireCameraFrame(camera, &timestamp);
+        if (!frame) {
+            if (SDL_GetCameraPermissionState(camera) == SDL_CAMERA_PERMISSION_STATE_DENIED) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Camera access was denied");
+                result = false;
+                break;
+            }
+            SDL_DelayNS(SDL_NS_PER_MS / 10);
+            continue;
+        }
+        if (timestamp < last_timestamp) {
+            ++out_of_order;
+        }
+        last_timestamp = timestamp;
+        SDL_ReleaseCameraFrame(camera, frame);
+
+        if (++received == warmup) {
+            start = SDL_GetTicksNS();
+        }
+    }
+    now = SDL_GetTicksNS();
+    SDL_CloseCamera(camera);
+
+    if (result) {
+        const double seconds = (double)(now - start) / SDL_NS_PER_SECOND;
+        SDL_Log("%2d decode thread%s  %8.2f frames/sec  %6.2f ms/frame%s", threads, threads == 1 ? " " : "s",
+                options->frames / seconds, (seconds * 1000.0) / options->frames,
+                out_of_order ? "  FRAMES OUT OF ORDER" : "");
+        if (out_of_order) {
+            result = false;
+        }
+    }
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    SDLTest_CommonState *state;
+    BenchmarkOptions options;
+    SDL_CameraID *cameras = NULL;
+    SDL_CameraSpec **specs = NULL;
+    char timescale[32];
+    int num_cameras = 0;
+    int ret = 0;
+    int i;
+
+    SDL_zero(options);
+    options.frames = 300;
+    options.fps = 1000;
+    options.format = SDL_PIXELFORMAT_NV12;
+    options.threads[0] = 1;
+    options.threads[1] = 2;
+    options.threads[2] = 4;
+    options.num_runs = 3;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--frames") == 0 && argv[i + 1]) {
+                options.frames = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--fps") == 0 && argv[i + 1]) {
+                options.fps = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--threads") == 0 && argv[i + 1]) {
+                if (ParseThreadCounts(argv[i + 1], &options)) {
+                    consumed = 2;
+                }
+            } else if (SDL_strcmp(argv[i], "--format") == 0 && argv[i + 1]) {
+                if (SDL_strcasecmp(argv[i + 1], "NV12") == 0) {
+                    options.format = SDL_PIXELFORMAT_NV12;
+                    consumed = 2;
+                } else if (SDL_strcasecmp(argv[i + 1], "IYUV") == 0) {
+                    options.format = SDL_PIXELFORMAT_IYUV;
+                    consumed = 2;
+                } else if (SDL_strcasecmp(argv[i + 1], "YUY2") == 0) {
+                    options.format = SDL_PIXELFORMAT_YUY2;
+                    consumed = 2;
+                } else if (SDL_strcasecmp(argv[i + 1], "XRGB8888") == 0) {
+                    options.format = SDL_PIXELFORMAT_XRGB8888;
+                    consumed = 2;
+                }
+            } else if (!options.file && argv[i][0] != '-') {
+                options.file = argv[i];
+                consumed = 1;
+            }
+        }
+        if (consumed <= 0 || options.frames <= 0 || options.fps <= 0) {
+            static const char *options_usage[] = {
+                "[--frames N]", "[--fps N]", "[--threads N,N,...]", "[--format NV12|IYUV|YUY2|XRGB8888]", "file.mjpg", NULL
+            };
+            SDLTest_CommonLogUsage(state, argv[0], options_usage);
+            ret = 1;
+            goto done;
+        }
+        i += consumed;
+    }
+
+    if (!options.file) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Usage: %s [--frames N] [--fps N] [--threads N,N,...] [--format NV12|IYUV|YUY2|XRGB8888] file.mjpg", argv[0]);
+        ret = 1;
+        goto done;
+    }
+
+    /* The disk camera delivers 30 frames per second at a timescale of 1.0 */
+    SDL_snprintf(timescale, sizeof(timescale), "%f", 30.0 / options.fps);
+    SDL_SetHint(SDL_HINT_CAMERA_DRIVER, "disk");
+    SDL_SetHint(SDL_HINT_CAMERA_DISK_INPUT_FILE, options.file);
+    SDL_SetHint(SDL_HINT_CAMERA_DISK_TIMESCALE, timescale);
+
+    if (!SDL_Init(SDL_INIT_CAMERA)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_Init(SDL_INIT_CAMERA) failed: %s", SDL_GetError());
+        ret = 1;
+        goto done;
+    }
+
+    cameras = SDL_GetCameras(&num_cameras);
+    if (!cameras || num_cameras == 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't load any MJPG frames from '%s'", options.file);
+        ret = 1;
+        goto quit;
+    }
+    specs = SDL_GetCameraSupportedFormats(cameras[0], NULL);
+    if (!specs || !specs[0]) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't get the camera format: %s", SDL_GetError());
+        ret = 1;
+        goto quit;
+    }
+
+    SDL_Log("Decoding %d %dx%d MJPG frames to %s, fed at up to %d frames per second, on %d CPU cores",
+            options.frames, specs[0]->width, specs[0]->height, SDL_GetPixelFormatName(options.format),
+            options.fps, SDL_GetNumLogicalCPUCores());
+
+    for (i = 0; i < options.num_runs; ++i) {
+        if (!RunBenchmark(cameras[0], specs[0], options.threads[i], &options)) {
+            ret = 1;
+            break;
+        }
+    }
+
+quit:
+    SDL_free(specs);
+    SDL_free(cameras);
+    SDL_Quit();
+done:
+    SDLTest_CommonDestroyState(state);
+    return ret;
+}
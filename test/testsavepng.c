@@ -0,0 +1,262 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures how fast SDL_SavePNG_IO() saves a large surface, with different
+ * compression levels, filters and numbers of threads, and checks that every
+ * file loads back to the same pixels.
+ */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define MAX_SETTINGS 16
+
+typedef struct
+{
+    const char *values[MAX_SETTINGS];
+    int count;
+} SettingList;
+
+static char *ParseList(const char *arg, SettingList *list)
+{
+    char *copy = SDL_strdup(arg);
+    char *saveptr = NULL;
+    char *value;
+
+    list->count = 0;
+    if (copy) {
+        for (value = SDL_strtok_r(copy, ",", &saveptr); value && list->count < MAX_SETTINGS; value = SDL_strtok_r(NULL, ",", &saveptr)) {
+            list->values[list->count++] = value;
+        }
+    }
+    return copy;
+}
+
+/* Something like a screenshot: smooth gradients, flat areas and some noise */
+static SDL_Surface *CreateTestImage(int width, int height)
+{
+    SDL_Surface *surface = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_RGBA32);
+    Uint64 seed = 1;
+    int x, y, i;
+
+    if (!surface) {
+        return NULL;
+    }
+
+    for (y = 0; y < height; ++y) {
+        Uint8 *pixel = (Uint8 *)surface->pixels + y * surface->pitch;
+        for (x = 0; x < width; ++x) {
+            pixel[0] = (Uint8)((x * 255) / width);
+            pixel[1] = (Uint8)((y * 255) / height);
+            pixel[2] = (Uint8)(((x + y) * 255) / (width + height));
+            pixel[3] = 255;
+            pixel += 4;
+        }
+    }
+
+    for (i = 0; i < 64; ++i) {
+        SDL_Rect rect;
+        rect.x = SDL_rand_r(&seed, width);
+        rect.y = SDL_rand_r(&seed, height);
+        rect.w = 16 + SDL_rand_r(&seed, width / 4);
+        rect.h = 16 + SDL_rand_r(&seed, height / 4);
+        SDL_FillSurfaceRect(surface, &rect, SDL_MapSurfaceRGB(surface, (Uint8)SDL_rand_r(&seed, 256), (Uint8)SDL_rand_r(&seed, 256), (Uint8)SDL_rand_r(&seed, 256)));
+    }
+
+    for (y = height / 2; y < height / 2 + height / 8; ++y) {
+        Uint8 *pixel = (Uint8 *)surface->pixels + y * surface->pitch;
+        for (x = 0; x < width / 2; ++x) {
+            pixel[0] = (Uint8)SDL_rand_r(&seed, 256);
+            pixel[1] = pixel[0];
+            pixel[2] = (Uint8)(pixel[0] / 2);
+            pixel += 4;
+        }
+    }
+    return surface;
+}
+
+static bool VerifyImage(SDL_Surface *expected, SDL_IOStream *stream)
+{
+    SDL_Surface *loaded;
+    SDL_Surface *converted;
+    bool result = false;
+    int y;
+
+    SDL_SeekIO(stream, 0, SDL_IO_SEEK_SET);
+    loaded = SDL_LoadPNG_IO(stream, false);
+    if (!loaded) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't load the saved PNG: %s", SDL_GetError());
+        return false;
+    }
+    converted = SDL_ConvertSurface(loaded, expected->format);
+    SDL_DestroySurface(loaded);
+    if (!converted) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't convert the loaded PNG: %s", SDL_GetError());
+        return false;
+    }
+
+    if (converted->w == expected->w && converted->h == expected->h) {
+        result = true;
+        for (y = 0; y < expected->h; ++y) {
+            if (SDL_memcmp((Uint8 *)converted->pixels + y * converted->pitch, (Uint8 *)expected->pixels + y * expected->pitch, expected->w * 4) != 0) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Row %d of the saved PNG is different", y);
+                result = false;
+                break;
+            }
+        }
+    } else {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "The saved PNG is %dx%d, expected %dx%d", converted->w, converted->h, expected->w, expected->h);
+    }
+    SDL_DestroySurface(converted);
+    return result;
+}
+
+static bool RunBenchmark(SDL_Surface *surface, const char *level, const char *filter, const char *threads, int iterations)
+{
+    SDL_IOStream *stream = SDL_IOFromDynamicMem();
+    Uint64 start, elapsed;
+    Sint64 size = 0;
+    bool result = true;
+    int i;
+
+    if (!stream) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create memory stream: %s", SDL_GetError());
+        return false;
+    }
+
+    SDL_SetHint(SDL_HINT_PNG_SAVE_COMPRESSION_LEVEL, level);
+    SDL_SetHint(SDL_HINT_PNG_SAVE_FILTER, filter);
+    SDL_SetHint(SDL_HINT_PNG_SAVE_THREADS, threads);
+
+    start = SDL_GetTicksNS();
+    for (i = 0; i < iterations && result; ++i) {
+        SDL_SeekIO(stream, 0, SDL_IO_SEEK_SET);
+        if (!SDL_SavePNG_IO(surface, stream, false)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't save PNG: %s", SDL_GetError());
+            result = false;
+        }
+    }
+    elapsed = SDL_GetTicksNS() - start;
+    size = SDL_TellIO(stream);
+
+    if (result) {
+        const double ms = (double)elapsed / iterations / SDL_NS_PER_MS;
+        const double megabytes = ((double)surface->w * surface->h * 4) / (1024.0 * 1024.0);
+        SDL_Log("level %-2s %-8s threads %-2s  %9.2f ms  %8.2f MiB/s  %10" SDL_PRIs64 " bytes (%5.2f%%)",
+                level, filter, threads, ms, megabytes / (ms / 1000.0), size, (100.0 * size) / (surface->w * surface->h * 4));
+        result = VerifyImage(surface, stream);
+    }
+    SDL_CloseIO(stream);
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    SDLTest_CommonState *state;
+    SDL_Surface *surface = NULL;
+    SettingList levels, filters, threads;
+    char *levels_arg = NULL, *filters_arg = NULL, *threads_arg = NULL;
+    int width = 3840;
+    int height = 2160;
+    int iterations = 3;
+    int ret = 0;
+    int i, j, k;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed && argv[i + 1]) {
+            if (SDL_strcmp(argv[i], "--width") == 0) {
+                width = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--height") == 0) {
+                height = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--iterations") == 0) {
+                iterations = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--levels") == 0) {
+                SDL_free(levels_arg);
+                levels_arg = SDL_strdup(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--filters") == 0) {
+                SDL_free(filters_arg);
+                filters_arg = SDL_strdup(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--threads") == 0) {
+                SDL_free(threads_arg);
+                threads_arg = SDL_strdup(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0 || width <= 0 || height <= 0 || iterations <= 0) {
+            static const char *options[] = {
+                "[--width N]", "[--height N]", "[--iterations N]", "[--levels 0-9,...]",
+                "[--filters none|sub|up|average|paeth|adaptive,...]", "[--threads N,...]", NULL
+            };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            ret = 1;
+            goto done;
+        }
+        i += consumed;
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_Init(0) failed: %s", SDL_GetError());
+        ret = 1;
+        goto done;
+    }
+
+    surface = CreateTestImage(width, height);
+    if (!surface) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create test image: %s", SDL_GetError());
+        ret = 1;
+        goto quit;
+    }
+
+    {
+        char *levels_copy = ParseList(levels_arg ? levels_arg : "1,6", &levels);
+        char *filters_copy = ParseList(filters_arg ? filters_arg : "none,up,adaptive", &filters);
+        char *threads_copy = ParseList(threads_arg ? threads_arg : "1,0", &threads);
+
+        SDL_Log("Saving a %dx%d RGBA image, %d times per setting, on %d CPU cores", width, height, iterations, SDL_GetNumLogicalCPUCores());
+        for (i = 0; i < levels.count && ret == 0; ++i) {
+            for (j = 0; j < filters.count && ret == 0; ++j) {
+                for (k = 0; k < threads.count && ret == 0; ++k) {
+                    if (!RunBenchmark(surface, levels.values[i], filters.values[j], threads.values[k], iterations)) {
+                        ret = 1;
+                    }
+                }
+            }
+        }
+        SDL_free(levels_copy);
+        SDL_free(filters_copy);
+        SDL_free(threads_copy);
+    }
+
+quit:
+    SDL_DestroySurface(surface);
+    SDL_Quit();
+done:
+    SDL_free(levels_arg);
+    SDL_free(filters_arg);
+    SDL_free(threads_arg);
+    SDLTest_CommonDestroyState(state);
+    return ret;
+}
@@ -0,0 +1,275 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures the triangle throughput of SDL_RenderGeometry() with the software
+ * renderer, for flat, gradient and textured triangles in each blend mode.
+ *
+ * A checksum of the last frame is logged for each case, so the output of the
+ * SIMD kernels can be compared with the scalar ones by running this program
+ * again with SDL_CPU_FEATURE_MASK set, e.g. "-sse41,-avx2,-neon".
+ */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define TEXTURE_SIZE 64
+
+typedef struct
+{
+    const char *name;
+    bool textured;
+    bool gradient;
+    SDL_BlendMode blend;
+} GeometryCase;
+
+static const GeometryCase cases[] = {
+    { "solid", false, false, SDL_BLENDMODE_NONE },
+    { "gradient", false, true, SDL_BLENDMODE_NONE },
+    { "gradient blend", false, true, SDL_BLENDMODE_BLEND },
+    { "textured", true, false, SDL_BLENDMODE_NONE },
+    { "textured color", true, true, SDL_BLENDMODE_NONE },
+    { "textured blend", true, false, SDL_BLENDMODE_BLEND },
+    { "textured color blend", true, true, SDL_BLENDMODE_BLEND },
+    { "textured add", true, true, SDL_BLENDMODE_ADD },
+    { "textured mod", true, true, SDL_BLENDMODE_MOD },
+    { "textured mul", true, true, SDL_BLENDMODE_MUL },
+};
+
+typedef struct
+{
+    int width;
+    int height;
+    int frames;
+    int triangles;
+    int size;
+    SDL_PixelFormat format;
+} BenchmarkOptions;
+
+static const char *GetKernelName(void)
+{
+    if (SDL_HasAVX2()) {
+        return "AVX2";
+    } else if (SDL_HasSSE41()) {
+        return "SSE4.1";
+    } else if (SDL_HasNEON()) {
+        return "NEON";
+    }
+    return "scalar";
+}
+
+static SDL_Texture *CreateTexture(SDL_Renderer *renderer)
+{
+    SDL_Surface *surface;
+    SDL_Texture *texture;
+    int x, y;
+
+    // A different layout than the target, so the texels have to be swizzled
+    surface = SDL_CreateSurface(TEXTURE_SIZE, TEXTURE_SIZE, SDL_PIXELFORMAT_ABGR8888);
+    if (!surface) {
+        return NULL;
+    }
+    for (y = 0; y < TEXTURE_SIZE; ++y) {
+        Uint8 *row = (Uint8 *)surface->pixels + y * surface->pitch;
+        for (x = 0; x < TEXTURE_SIZE; ++x) {
+            row[x * 4 + 0] = (Uint8)(x * 4);
+            row[x * 4 + 1] = (Uint8)(y * 4);
+            row[x * 4 + 2] = (Uint8)((x ^ y) * 4);
+            row[x * 4 + 3] = (Uint8)(64 + x + y * 2);
+        }
+    }
+
+    texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_DestroySurface(surface);
+    return texture;
+}
+
+static void DrawTriangles(SDL_Renderer *renderer, SDL_Texture *texture, const GeometryCase *test, const BenchmarkOptions *options, int frame)
+{
+    Uint64 seed = 42;
+    SDL_Vertex verts[3];
+    int i, j;
+
+    for (i = 0; i < options->triangles; ++i) {
+        const float cx = (float)((SDL_rand_r(&seed, options->width) + frame) % options->width);
+        const float cy = (float)SDL_rand_r(&seed, options->height);
+        const float size = (float)(options->size / 4 + SDL_rand_r(&seed, options->size));
+        const float r = (float)SDL_rand_r(&seed, 256) / 255.0f;
+        const float g = (float)SDL_rand_r(&seed, 256) / 255.0f;
+        const float b = (float)SDL_rand_r(&seed, 256) / 255.0f;
+
+        for (j = 0; j < 3; ++j) {
+            const float angle = (float)frame * 0.05f + (float)j * 2.0944f + (float)i;
+            verts[j].position.x = cx + size * SDL_cosf(angle);
+            verts[j].position.y = cy + size * SDL_sinf(angle);
+            if (test->gradient) {
+                verts[j].color.r = (j == 0) ? 1.0f : r;
+                verts[j].color.g = (j == 1) ? 1.0f : g;
+                verts[j].color.b = (j == 2) ? 1.0f : b;
+                verts[j].color.a = (j == 0) ? 1.0f : 0.6f;
+            } else if (test->textured) {
+                verts[j].color.r = 1.0f;
+                verts[j].color.g = 1.0f;
+                verts[j].color.b = 1.0f;
+                verts[j].color.a = 1.0f;
+            } else {
+                verts[j].color.r = r;
+                verts[j].color.g = g;
+                verts[j].color.b = b;
+                verts[j].color.a = 0.75f;
+            }
+            verts[j].tex_coord.x = (j == 1) ? 1.5f : -0.25f;
+            verts[j].tex_coord.y = (j == 2) ? 1.5f : -0.25f;
+        }
+        SDL_RenderGeometry(renderer, test->textured ? texture : NULL, verts, 3, NULL, 0);
+    }
+}
+
+static bool RunCase(const GeometryCase *test, const BenchmarkOptions *options)
+{
+    SDL_Surface *target = NULL;
+    SDL_Renderer *renderer = NULL;
+    SDL_Texture *texture = NULL;
+    Uint64 start, elapsed;
+    Uint32 crc = 0;
+    int i, y;
+    bool result = false;
+
+    target = SDL_CreateSurface(options->width, options->height, options->format);
+    if (!target) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CreateSurface() failed: %s", SDL_GetError());
+        goto done;
+    }
+    renderer = SDL_CreateSoftwareRenderer(target);
+    if (!renderer) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CreateSoftwareRenderer() failed: %s", SDL_GetError());
+        goto done;
+    }
+    texture = CreateTexture(renderer);
+    if (!texture) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create texture: %s", SDL_GetError());
+        goto done;
+    }
+    SDL_SetTextureBlendMode(texture, test->blend);
+    SDL_SetRenderTextureAddressMode(renderer, SDL_TEXTURE_ADDRESS_WRAP, SDL_TEXTURE_ADDRESS_WRAP);
+    SDL_SetRenderDrawBlendMode(renderer, test->blend);
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < options->frames; ++i) {
+        SDL_SetRenderDrawColor(renderer, 0x20, 0x30, 0x40, 0xC0);
+        SDL_RenderClear(renderer);
+        DrawTriangles(renderer, texture, test, options, i);
+        SDL_FlushRenderer(renderer);
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+
+    for (y = 0; y < target->h; ++y) {
+        crc = SDL_crc32(crc, (const Uint8 *)target->pixels + y * target->pitch, target->w * SDL_BYTESPERPIXEL(target->format));
+    }
+
+    SDL_Log("%-22s %10.2f Ktriangles/sec  checksum %08" SDL_PRIx32, test->name,
+            (double)options->triangles * options->frames * SDL_GetPerformanceFrequency() / ((double)elapsed * 1000.0), crc);
+    result = true;
+
+done:
+    SDL_DestroyTexture(texture);
+    SDL_DestroyRenderer(renderer);
+    SDL_DestroySurface(target);
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    SDLTest_CommonState *state;
+    BenchmarkOptions options;
+    int ret = 0;
+    int i;
+
+    options.width = 1280;
+    options.height = 720;
+    options.frames = 20;
+    options.triangles = 5000;
+    options.size = 32;
+    options.format = SDL_PIXELFORMAT_ARGB8888;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--width") == 0 && argv[i + 1]) {
+                options.width = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--height") == 0 && argv[i + 1]) {
+                options.height = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--frames") == 0 && argv[i + 1]) {
+                options.frames = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--triangles") == 0 && argv[i + 1]) {
+                options.triangles = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--size") == 0 && argv[i + 1]) {
+                options.size = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--format") == 0 && argv[i + 1]) {
+                if (SDL_strcasecmp(argv[i + 1], "ARGB8888") == 0) {
+                    options.format = SDL_PIXELFORMAT_ARGB8888;
+                    consumed = 2;
+                } else if (SDL_strcasecmp(argv[i + 1], "XBGR8888") == 0) {
+                    options.format = SDL_PIXELFORMAT_XBGR8888;
+                    consumed = 2;
+                } else if (SDL_strcasecmp(argv[i + 1], "RGB565") == 0) {
+                    options.format = SDL_PIXELFORMAT_RGB565;
+                    consumed = 2;
+                }
+            }
+        }
+        if (consumed <= 0 || options.width <= 0 || options.height <= 0 || options.frames <= 0 ||
+            options.triangles <= 0 || options.size <= 0) {
+            static const char *options_usage[] = {
+                "[--width N]", "[--height N]", "[--frames N]", "[--triangles N]", "[--size N]", "[--format ARGB8888|XBGR8888|RGB565]", NULL
+            };
+            SDLTest_CommonLogUsage(state, argv[0], options_usage);
+            ret = 1;
+            goto done;
+        }
+        i += consumed;
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_Init() failed: %s", SDL_GetError());
+        ret = 1;
+        goto done;
+    }
+
+    SDL_Log("Drawing %d frames of %d triangles of up to %d pixels onto %dx%d %s, using %s kernels",
+            options.frames, options.triangles, options.size * 5 / 4, options.width, options.height,
+            SDL_GetPixelFormatName(options.format), GetKernelName());
+
+    for (i = 0; i < (int)SDL_arraysize(cases); ++i) {
+        if (!RunCase(&cases[i], &options)) {
+            ret = 1;
+            break;
+        }
+    }
+
+    SDL_Quit();
+done:
+    SDLTest_CommonDestroyState(state);
+    return ret;
+}
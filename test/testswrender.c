@@ -0,0 +1,280 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures the frame rate of the software renderer, drawing on the calling
+ * thread and with SDL_HINT_RENDER_SOFTWARE_THREADS, and checks that both
+ * produce the same pixels.
+ *
+ * This uses the dummy video driver unless SDL_VIDEO_DRIVER is set, e.g. to
+ * "offscreen".
+ */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define SPRITE_SIZE 32
+
+typedef struct
+{
+    int width;
+    int height;
+    int frames;
+    int sprites;
+    int triangles;
+} BenchmarkOptions;
+
+typedef void (*DrawSceneFunc)(SDL_Renderer *renderer, SDL_Texture *sprite, const BenchmarkOptions *options, int frame);
+
+static SDL_Texture *CreateSprite(SDL_Renderer *renderer)
+{
+    SDL_Surface *surface;
+    SDL_Texture *texture;
+    int x, y;
+
+    surface = SDL_CreateSurface(SPRITE_SIZE, SPRITE_SIZE, SDL_PIXELFORMAT_ARGB8888);
+    if (!surface) {
+        return NULL;
+    }
+
+    // A ball with a soft edge, so the sprites need blending
+    for (y = 0; y < SPRITE_SIZE; ++y) {
+        Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+        for (x = 0; x < SPRITE_SIZE; ++x) {
+            const float dx = (float)x - SPRITE_SIZE / 2 + 0.5f;
+            const float dy = (float)y - SPRITE_SIZE / 2 + 0.5f;
+            const float d = SDL_sqrtf(dx * dx + dy * dy) / (SPRITE_SIZE / 2);
+            const float alpha = SDL_clamp(2.0f * (1.0f - d), 0.0f, 1.0f);
+            const Uint32 a = (Uint32)(alpha * 255.0f);
+            row[x] = (a << 24) | ((Uint32)(x * 8) << 16) | ((Uint32)(y * 8) << 8) | 0x80;
+        }
+    }
+
+    texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_DestroySurface(surface);
+    return texture;
+}
+
+static void DrawSprites(SDL_Renderer *renderer, SDL_Texture *sprite, const BenchmarkOptions *options, int frame)
+{
+    Uint64 seed = 42;
+    int i;
+
+    for (i = 0; i < options->sprites; ++i) {
+        SDL_FRect dst;
+        const int vx = SDL_rand_r(&seed, 7) - 3;
+        const int vy = SDL_rand_r(&seed, 7) - 3;
+
+        dst.x = (float)((SDL_rand_r(&seed, options->width) + vx * frame) % options->width) - SPRITE_SIZE / 2;
+        dst.y = (float)((SDL_rand_r(&seed, options->height) + vy * frame) % options->height) - SPRITE_SIZE / 2;
+        dst.w = SPRITE_SIZE;
+        dst.h = SPRITE_SIZE;
+        if ((i % 16) == 0) {
+            // A few scaled ones, which can't be clipped to a band
+            dst.w *= 1.5f;
+            dst.h *= 1.5f;
+        }
+        if ((i % 4) == 0) {
+            SDL_SetTextureColorMod(sprite, 255, 128, 128);
+        } else {
+            SDL_SetTextureColorMod(sprite, 255, 255, 255);
+        }
+        SDL_RenderTexture(renderer, sprite, NULL, &dst);
+    }
+}
+
+static void DrawGeometry(SDL_Renderer *renderer, SDL_Texture *sprite, const BenchmarkOptions *options, int frame)
+{
+    Uint64 seed = 42;
+    SDL_Vertex verts[3];
+    int i, j;
+
+    for (i = 0; i < options->triangles; ++i) {
+        const float cx = (float)((SDL_rand_r(&seed, options->width) + frame) % options->width);
+        const float cy = (float)SDL_rand_r(&seed, options->height);
+        const float size = (float)(8 + SDL_rand_r(&seed, 56));
+
+        for (j = 0; j < 3; ++j) {
+            const float angle = (float)frame * 0.05f + (float)j * 2.0944f + (float)i;
+            verts[j].position.x = cx + size * SDL_cosf(angle);
+            verts[j].position.y = cy + size * SDL_sinf(angle);
+            verts[j].color.r = (float)SDL_rand_r(&seed, 256) / 255.0f;
+            verts[j].color.g = (float)SDL_rand_r(&seed, 256) / 255.0f;
+            verts[j].color.b = (float)SDL_rand_r(&seed, 256) / 255.0f;
+            verts[j].color.a = 0.75f;
+            verts[j].tex_coord.x = (j == 1) ? 1.0f : 0.0f;
+            verts[j].tex_coord.y = (j == 2) ? 1.0f : 0.0f;
+        }
+        SDL_RenderGeometry(renderer, (i % 2) ? sprite : NULL, verts, 3, NULL, 0);
+    }
+}
+
+static bool RunScene(const char *name, DrawSceneFunc draw, int threads, const BenchmarkOptions *options, SDL_Surface **result)
+{
+    SDL_Window *window = NULL;
+    SDL_Renderer *renderer = NULL;
+    SDL_Texture *sprite = NULL;
+    char hint[32];
+    Uint64 start, elapsed;
+    int i;
+    bool success = false;
+
+    SDL_snprintf(hint, sizeof(hint), "%d", threads);
+    SDL_SetHintWithPriority(SDL_HINT_RENDER_SOFTWARE_THREADS, hint, SDL_HINT_OVERRIDE);
+
+    window = SDL_CreateWindow("testswrender", options->width, options->height, 0);
+    if (!window) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CreateWindow() failed: %s", SDL_GetError());
+        goto done;
+    }
+    renderer = SDL_CreateRenderer(window, SDL_SOFTWARE_RENDERER);
+    if (!renderer) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CreateRenderer() failed: %s", SDL_GetError());
+        goto done;
+    }
+    sprite = CreateSprite(renderer);
+    if (!sprite) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create sprite: %s", SDL_GetError());
+        goto done;
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < options->frames; ++i) {
+        SDL_SetRenderDrawColor(renderer, 0x20, 0x30, 0x40, 0xFF);
+        SDL_RenderClear(renderer);
+        draw(renderer, sprite, options, i);
+        if (i == options->frames - 1) {
+            *result = SDL_RenderReadPixels(renderer, NULL);
+        }
+        SDL_RenderPresent(renderer);
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+
+    SDL_Log("%-10s %2d thread%s %10.2f frames/sec", name, threads, threads == 1 ? " " : "s",
+            (double)options->frames * SDL_GetPerformanceFrequency() / (double)elapsed);
+    success = (*result != NULL);
+
+done:
+    SDL_DestroyTexture(sprite);
+    SDL_DestroyRenderer(renderer);
+    SDL_DestroyWindow(window);
+    return success;
+}
+
+static bool RunBenchmark(const char *name, DrawSceneFunc draw, int threads, const BenchmarkOptions *options)
+{
+    SDL_Surface *serial = NULL;
+    SDL_Surface *tiled = NULL;
+    bool result = false;
+    int y;
+
+    if (!RunScene(name, draw, 1, options, &serial) ||
+        !RunScene(name, draw, threads, options, &tiled)) {
+        goto done;
+    }
+
+    for (y = 0; y < serial->h; ++y) {
+        const void *a = (const Uint8 *)serial->pixels + y * serial->pitch;
+        const void *b = (const Uint8 *)tiled->pixels + y * tiled->pitch;
+        if (SDL_memcmp(a, b, serial->w * SDL_BYTESPERPIXEL(serial->format)) != 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s: the threaded output differs at row %d", name, y);
+            goto done;
+        }
+    }
+    result = true;
+
+done:
+    SDL_DestroySurface(serial);
+    SDL_DestroySurface(tiled);
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    SDLTest_CommonState *state;
+    BenchmarkOptions options;
+    int threads = 0;
+    int ret = 0;
+    int i;
+
+    options.width = 1280;
+    options.height = 720;
+    options.frames = 100;
+    options.sprites = 5000;
+    options.triangles = 5000;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--width") == 0 && argv[i + 1]) {
+                options.width = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--height") == 0 && argv[i + 1]) {
+                options.height = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--frames") == 0 && argv[i + 1]) {
+                options.frames = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--sprites") == 0 && argv[i + 1]) {
+                options.sprites = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--triangles") == 0 && argv[i + 1]) {
+                options.triangles = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--threads") == 0 && argv[i + 1]) {
+                threads = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0 || options.width <= 0 || options.height <= 0 || options.frames <= 0 ||
+            options.sprites < 0 || options.triangles < 0 || threads < 0) {
+            static const char *options_usage[] = {
+                "[--width N]", "[--height N]", "[--frames N]", "[--sprites N]", "[--triangles N]", "[--threads N]", NULL
+            };
+            SDLTest_CommonLogUsage(state, argv[0], options_usage);
+            ret = 1;
+            goto done;
+        }
+        i += consumed;
+    }
+
+    SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "dummy");
+
+    if (!SDL_Init(SDL_INIT_VIDEO)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_Init() failed: %s", SDL_GetError());
+        ret = 1;
+        goto done;
+    }
+
+    if (threads == 0) {
+        threads = SDL_max(SDL_GetNumLogicalCPUCores(), 2);
+    }
+
+    SDL_Log("Drawing %d frames of %dx%d with the %s video driver", options.frames, options.width, options.height, SDL_GetCurrentVideoDriver());
+
+    if (!RunBenchmark("sprites", DrawSprites, threads, &options) ||
+        !RunBenchmark("geometry", DrawGeometry, threads, &options)) {
+        ret = 1;
+    }
+
+    SDL_Quit();
+done:
+    SDLTest_CommonDestroyState(state);
+    return ret;
+}
@@ -0,0 +1,207 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures how fast SDL_LoadWAV_IO decodes MS and IMA ADPCM files.
+ *
+ * The files are generated in memory with random block data. Each one is
+ * decoded on the calling thread (SDL_WAVE_DECODE_THREADS=1) and then with
+ * the default threading, and the output of both is compared.
+ */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define MS_ADPCM_CODE  0x0002
+#define IMA_ADPCM_CODE 0x0011
+
+static Uint8 *PutLE(Uint8 *dst, Uint32 value, int size)
+{
+    int i;
+    for (i = 0; i < size; ++i) {
+        *(dst++) = (Uint8)(value >> (i * 8));
+    }
+    return dst;
+}
+
+static Uint8 *BuildADPCM(Uint16 encoding, Uint16 channels, Uint16 blockalign, Uint32 numblocks, size_t *length)
+{
+    static const Sint16 coeffs[14] = { 256, 0, 512, -256, 0, 0, 192, 64, 240, 0, 460, -208, 392, -232 };
+    const bool ms = (encoding == MS_ADPCM_CODE);
+    const Uint32 headersize = ms ? 7 * channels : 4 * channels;
+    const Uint32 fmtlength = ms ? 50 : 20;
+    const Uint16 samplesperblock = (Uint16)((blockalign - headersize) * 2 / channels + (ms ? 2 : 1));
+    const Uint32 datalength = blockalign * numblocks;
+    const Uint32 totallength = 12 + 8 + fmtlength + 8 + datalength;
+    Uint8 *wav = (Uint8 *)SDL_malloc(totallength);
+    Uint8 *ptr = wav;
+    Uint32 b, i, c;
+
+    if (!wav) {
+        return NULL;
+    }
+
+    SDL_memcpy(ptr, "RIFF", 4);
+    ptr = PutLE(ptr + 4, totallength - 8, 4);
+    SDL_memcpy(ptr, "WAVEfmt ", 8);
+    ptr = PutLE(ptr + 8, fmtlength, 4);
+    ptr = PutLE(ptr, encoding, 2);
+    ptr = PutLE(ptr, channels, 2);
+    ptr = PutLE(ptr, 44100, 4);
+    ptr = PutLE(ptr, 44100 * blockalign / samplesperblock, 4);
+    ptr = PutLE(ptr, blockalign, 2);
+    ptr = PutLE(ptr, 4, 2);
+    ptr = PutLE(ptr, fmtlength - 18, 2);
+    ptr = PutLE(ptr, samplesperblock, 2);
+    if (ms) {
+        ptr = PutLE(ptr, 7, 2);
+        for (i = 0; i < SDL_arraysize(coeffs); ++i) {
+            ptr = PutLE(ptr, (Uint16)coeffs[i], 2);
+        }
+    }
+    SDL_memcpy(ptr, "data", 4);
+    ptr = PutLE(ptr + 4, datalength, 4);
+
+    for (b = 0; b < numblocks; ++b) {
+        Uint8 *block = ptr + b * blockalign;
+        for (i = 0; i < blockalign; ++i) {
+            block[i] = (Uint8)SDL_rand(256);
+        }
+        for (c = 0; c < channels; ++c) {
+            if (ms) {
+                block[c] = (Uint8)SDL_rand(7);
+                PutLE(block + channels + c * 2, 16 + SDL_rand(512), 2);
+            } else {
+                block[c * 4 + 2] = (Uint8)SDL_rand(89);
+                block[c * 4 + 3] = 0;
+            }
+        }
+    }
+
+    *length = totallength;
+    return wav;
+}
+
+static bool Decode(const Uint8 *wav, size_t length, const char *threads, int iterations, Uint8 **audio_buf, Uint32 *audio_len, double *seconds)
+{
+    Uint64 start;
+    int i;
+
+    SDL_SetHintWithPriority(SDL_HINT_WAVE_DECODE_THREADS, threads, SDL_HINT_OVERRIDE);
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        SDL_AudioSpec spec;
+        SDL_free(*audio_buf);
+        *audio_buf = NULL;
+        if (!SDL_LoadWAV_IO(SDL_IOFromConstMem(wav, length), true, &spec, audio_buf, audio_len)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_LoadWAV_IO() failed: %s", SDL_GetError());
+            return false;
+        }
+    }
+    *seconds = (double)(SDL_GetPerformanceCounter() - start) / (double)SDL_GetPerformanceFrequency();
+    return true;
+}
+
+static bool RunCase(const char *name, Uint16 encoding, Uint16 channels, Uint16 blockalign, Uint32 numblocks, int iterations)
+{
+    Uint8 *wav;
+    Uint8 *serial = NULL;
+    Uint8 *parallel = NULL;
+    Uint32 serial_len = 0, parallel_len = 0;
+    double serial_seconds, parallel_seconds;
+    size_t length;
+    bool result = false;
+
+    wav = BuildADPCM(encoding, channels, blockalign, numblocks, &length);
+    if (!wav) {
+        return false;
+    }
+
+    if (!Decode(wav, length, "1", iterations, &serial, &serial_len, &serial_seconds) ||
+        !Decode(wav, length, "0", iterations, &parallel, &parallel_len, &parallel_seconds)) {
+        goto done;
+    }
+
+    if (serial_len != parallel_len || SDL_memcmp(serial, parallel, serial_len) != 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s: threaded output differs from serial output", name);
+        goto done;
+    }
+
+    SDL_Log("%-14s %8.2f MB/s serial, %8.2f MB/s threaded (%.2fx)", name,
+            ((double)length * iterations) / (serial_seconds * 1000000.0),
+            ((double)length * iterations) / (parallel_seconds * 1000000.0),
+            serial_seconds / parallel_seconds);
+    result = true;
+
+done:
+    SDL_free(serial);
+    SDL_free(parallel);
+    SDL_free(wav);
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    SDLTest_CommonState *state;
+    int blocks = 4096;
+    int iterations = 20;
+    int ret = 0;
+    int i;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--blocks") == 0 && argv[i + 1]) {
+                blocks = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+                iterations = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0 || blocks <= 0 || iterations <= 0) {
+            static const char *options[] = { "[--blocks N]", "[--iterations N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            ret = 1;
+            goto done;
+        }
+        i += consumed;
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_Init() failed: %s", SDL_GetError());
+        ret = 1;
+        goto done;
+    }
+
+    SDL_Log("Decoding %d blocks, %d times, on %d logical cores", blocks, iterations, SDL_GetNumLogicalCPUCores());
+
+    if (!RunCase("MS ADPCM mono", MS_ADPCM_CODE, 1, 512, blocks, iterations) ||
+        !RunCase("MS ADPCM stereo", MS_ADPCM_CODE, 2, 1024, blocks, iterations) ||
+        !RunCase("IMA ADPCM mono", IMA_ADPCM_CODE, 1, 512, blocks, iterations) ||
+        !RunCase("IMA ADPCM stereo", IMA_ADPCM_CODE, 2, 1024, blocks, iterations)) {
+        ret = 1;
+    }
+
+    SDL_Quit();
+done:
+    SDLTest_CommonDestroyState(state);
+    return ret;
+}
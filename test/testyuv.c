@@ -14,6 +14,8 @@
 #include <SDL3/SDL_test.h>
 #include "testyuv_cvt.h"
 #include "testutils.h"
+#include "testyuv_jpg.h"
+#include "testyuv_rgb_jpg.h"
 
 /* 422 (YUY2, etc) and P010 formats are the largest */
 #define MAX_YUV_SURFACE_SIZE(W, H, P) ((H + 1) * ((W + 1) + P) * 4)
@@ -117,6 +119,7 @@ static bool run_automated_tests(int pattern_size, int extra_pitch)
     };
     int i, j;
     SDL_Surface *pattern = generate_test_pattern(pattern_size);
+    SDL_Surface *pattern32 = NULL;
     const int yuv_len = MAX_YUV_SURFACE_SIZE(pattern->w, pattern->h, extra_pitch);
     Uint8 *yuv1 = (Uint8 *)SDL_malloc(yuv_len);
     Uint8 *yuv2 = (Uint8 *)SDL_malloc(yuv_len);
@@ -161,6 +164,24 @@ static bool run_automated_tests(int pattern_size, int extra_pitch)
         }
     }
 
+    /* Verify conversion to YUV formats from a 32-bit RGB format, which doesn't need an intermediate conversion */
+    pattern32 = SDL_ConvertSurface(pattern, SDL_PIXELFORMAT_ABGR8888);
+    if (!pattern32) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't convert pattern to %s: %s", SDL_GetPixelFormatName(SDL_PIXELFORMAT_ABGR8888), SDL_GetError());
+        goto done;
+    }
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        yuv1_pitch = CalculateYUVPitch(formats[i], pattern->w) + extra_pitch;
+        if (!SDL_ConvertPixelsAndColorspace(pattern32->w, pattern32->h, pattern32->format, SDL_COLORSPACE_SRGB, 0, pattern32->pixels, pattern32->pitch, formats[i], colorspace, 0, yuv1, yuv1_pitch)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't convert %s to %s: %s", SDL_GetPixelFormatName(pattern32->format), SDL_GetPixelFormatName(formats[i]), SDL_GetError());
+            goto done;
+        }
+        if (!verify_yuv_data(formats[i], colorspace, yuv1, yuv1_pitch, pattern, tight_tolerance)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed conversion from %s to %s", SDL_GetPixelFormatName(pattern32->format), SDL_GetPixelFormatName(formats[i]));
+            goto done;
+        }
+    }
+
     /* Verify conversion between YUV formats */
     for (i = 0; i < SDL_arraysize(formats); ++i) {
         for (j = 0; j < SDL_arraysize(formats); ++j) {
@@ -235,10 +256,62 @@ static bool run_automated_tests(int pattern_size, int extra_pitch)
 done:
     SDL_free(yuv1);
     SDL_free(yuv2);
+    SDL_DestroySurface(pattern32);
     SDL_DestroySurface(pattern);
     return result;
 }
 
+/* Decode a JPEG with an odd size straight into each YUV format and compare against decoding it to RGB */
+static bool run_mjpg_test(const Uint8 *jpg, int jpg_len)
+{
+    const Uint32 formats[] = {
+        SDL_PIXELFORMAT_YV12,
+        SDL_PIXELFORMAT_IYUV,
+        SDL_PIXELFORMAT_NV12,
+        SDL_PIXELFORMAT_NV21,
+        SDL_PIXELFORMAT_YUY2,
+        SDL_PIXELFORMAT_UYVY,
+        SDL_PIXELFORMAT_YVYU
+    };
+    const int width = 37;
+    const int height = 21;
+    const int extra_pitch = 7;
+    /* The RGB decode interpolates chroma while verify_yuv_data() doesn't */
+    const int tolerance = 333;
+    SDL_Surface *expected = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_RGB24);
+    Uint8 *yuv = (Uint8 *)SDL_malloc(MAX_YUV_SURFACE_SIZE(width, height, extra_pitch));
+    int i;
+    bool result = false;
+
+    if (!expected || !yuv) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't allocate test surfaces");
+        goto done;
+    }
+
+    if (!SDL_ConvertPixels(width, height, SDL_PIXELFORMAT_MJPG, jpg, jpg_len, expected->format, expected->pixels, expected->pitch)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't decode JPEG: %s", SDL_GetError());
+        goto done;
+    }
+
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        const int yuv_pitch = CalculateYUVPitch(formats[i], width) + extra_pitch;
+        if (!SDL_ConvertPixels(width, height, SDL_PIXELFORMAT_MJPG, jpg, jpg_len, formats[i], yuv, yuv_pitch)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't decode JPEG to %s: %s", SDL_GetPixelFormatName(formats[i]), SDL_GetError());
+            goto done;
+        }
+        if (!verify_yuv_data(formats[i], SDL_COLORSPACE_JPEG, yuv, yuv_pitch, expected, tolerance)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed decoding JPEG to %s", SDL_GetPixelFormatName(formats[i]));
+            goto done;
+        }
+    }
+    result = true;
+
+done:
+    SDL_free(yuv);
+    SDL_DestroySurface(expected);
+    return result;
+}
+
 static bool run_colorspace_test(void)
 {
     bool result = false;
@@ -362,6 +435,101 @@ done:
     return result;
 }
 
+/* Time the conversion of a frame between two formats */
+static bool benchmark_conversion(int width, int height,
+                                 SDL_PixelFormat src_format, SDL_Colorspace src_colorspace, const void *src, int src_pitch,
+                                 SDL_PixelFormat dst_format, SDL_Colorspace dst_colorspace, void *dst, int dst_pitch)
+{
+    Uint64 start, elapsed;
+    int frames = 0;
+
+    start = SDL_GetTicksNS();
+    do {
+        if (!SDL_ConvertPixelsAndColorspace(width, height, src_format, src_colorspace, 0, src, src_pitch, dst_format, dst_colorspace, 0, dst, dst_pitch)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't convert %s to %s: %s", SDL_GetPixelFormatName(src_format), SDL_GetPixelFormatName(dst_format), SDL_GetError());
+            return false;
+        }
+        ++frames;
+        elapsed = SDL_GetTicksNS() - start;
+    } while (elapsed < SDL_NS_PER_SECOND / 4);
+
+    SDL_Log("%s -> %s: %.3f ms/frame, %.0f Mpixels/s",
+            SDL_GetPixelFormatName(src_format), SDL_GetPixelFormatName(dst_format),
+            (double)elapsed / frames / SDL_NS_PER_MS,
+            (double)width * height * frames / ((double)elapsed / SDL_NS_PER_SECOND) / 1000000.0);
+    return true;
+}
+
+/* Time the conversion of a frame from each YUV format to each RGB format */
+static bool run_benchmark(int width, int height)
+{
+    const SDL_PixelFormat yuv_formats[] = {
+        SDL_PIXELFORMAT_YV12,
+        SDL_PIXELFORMAT_IYUV,
+        SDL_PIXELFORMAT_NV12,
+        SDL_PIXELFORMAT_NV21,
+        SDL_PIXELFORMAT_YUY2,
+        SDL_PIXELFORMAT_UYVY,
+        SDL_PIXELFORMAT_YVYU
+    };
+    const SDL_PixelFormat rgb_formats[] = {
+        SDL_PIXELFORMAT_RGB565,
+        SDL_PIXELFORMAT_RGB24,
+        SDL_PIXELFORMAT_XRGB8888,
+        SDL_PIXELFORMAT_ABGR8888,
+        SDL_PIXELFORMAT_RGBA8888,
+        SDL_PIXELFORMAT_BGRA8888
+    };
+    const int yuv_len = MAX_YUV_SURFACE_SIZE(width, height, 0);
+    const int rgb_pitch = width * 4;
+    Uint8 *yuv = (Uint8 *)SDL_malloc(yuv_len);
+    Uint8 *rgb = (Uint8 *)SDL_malloc((size_t)rgb_pitch * height);
+    SDL_Colorspace colorspace = SDL_COLORSPACE_BT709_LIMITED;
+    bool result = false;
+    int i, j;
+
+    if (!yuv || !rgb) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't allocate benchmark buffers");
+        goto done;
+    }
+
+    for (i = 0; i < yuv_len; ++i) {
+        yuv[i] = (Uint8)(16 + SDL_rand(220));
+    }
+
+    SDL_Log("Converting %dx%d BT.709 frames", width, height);
+    for (i = 0; i < SDL_arraysize(yuv_formats); ++i) {
+        const int yuv_pitch = CalculateYUVPitch(yuv_formats[i], width);
+        for (j = 0; j < SDL_arraysize(rgb_formats); ++j) {
+            if (!benchmark_conversion(width, height, yuv_formats[i], colorspace, yuv, yuv_pitch, rgb_formats[j], SDL_COLORSPACE_SRGB, rgb, rgb_pitch)) {
+                goto done;
+            }
+        }
+    }
+
+    for (i = 0; i < rgb_pitch * height; ++i) {
+        rgb[i] = (Uint8)SDL_rand(256);
+    }
+
+    for (i = 0; i < SDL_arraysize(rgb_formats); ++i) {
+        for (j = 0; j < SDL_arraysize(yuv_formats); ++j) {
+            const int yuv_pitch = CalculateYUVPitch(yuv_formats[j], width);
+            if (!benchmark_conversion(width, height, rgb_formats[i], SDL_COLORSPACE_SRGB, rgb, rgb_pitch, yuv_formats[j], colorspace, yuv, yuv_pitch)) {
+                goto done;
+            }
+        }
+    }
+    if (!benchmark_conversion(width, height, SDL_PIXELFORMAT_XBGR2101010, SDL_COLORSPACE_BT2020_FULL, rgb, rgb_pitch, SDL_PIXELFORMAT_P010, SDL_COLORSPACE_BT2020_FULL, yuv, CalculateYUVPitch(SDL_PIXELFORMAT_P010, width))) {
+        goto done;
+    }
+    result = true;
+
+done:
+    SDL_free(yuv);
+    SDL_free(rgb);
+    return result;
+}
+
 static bool create_textures(SDL_Renderer *renderer, SDL_Surface *original, SDL_PixelFormat yuv_format, SDL_PixelFormat rgb_format, bool planar, bool monochrome, int luminance, SDL_Texture *output[3])
 {
     SDL_Colorspace rgb_colorspace = SDL_COLORSPACE_SRGB;
@@ -796,6 +964,10 @@ int main(int argc, char **argv)
         /* Test: odd width and height with intrinsics, extra pitch */
         { true, 33, 3 },
         { true, 37, 3 },
+        /* Test: several SIMD blocks per line, with and without extra pitch */
+        { true, 64, 0 },
+        { true, 67, 3 },
+        { true, 131, 0 },
     };
     char *filename = NULL;
     SDL_Surface *original = NULL;
@@ -811,6 +983,7 @@ int main(int argc, char **argv)
     bool should_run_automated_tests = false;
     bool should_run_colorspace_test = false;
     bool should_test_all_formats = false;
+    bool should_run_benchmark = false;
     SDLTest_CommonState *state;
     int result = 0;
 
@@ -898,6 +1071,9 @@ int main(int argc, char **argv)
             } else if (SDL_strcmp(argv[i], "--automated") == 0) {
                 should_run_automated_tests = true;
                 consumed = 1;
+            } else if (SDL_strcmp(argv[i], "--benchmark") == 0) {
+                should_run_benchmark = true;
+                consumed = 1;
             } else if (SDL_strcmp(argv[i], "--colorspace-test") == 0) {
                 should_run_colorspace_test = true;
                 consumed = 1;
@@ -915,7 +1091,7 @@ int main(int argc, char **argv)
                 "[--yv12|--iyuv|--yuy2|--uyvy|--yvyu|--nv12|--nv21]",
                 "[--rgb555|--rgb565|--rgb24|--argb|--abgr|--rgba|--bgra]",
                 "[--monochrome] [--luminance N%] [--planar]",
-                "[--automated] [--colorspace-test] [--renderer NAME]",
+                "[--automated] [--colorspace-test] [--benchmark] [--renderer NAME]",
                 "[sample.png]",
                 NULL,
             };
@@ -938,6 +1114,15 @@ int main(int argc, char **argv)
                 result = 2;
             }
         }
+        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Running automated MJPG decoding test");
+        if (!run_mjpg_test(testyuv_jpg, testyuv_jpg_len)) {
+            result = 2;
+        }
+        /* stb_image can't decode RGB JPEGs (Adobe transform 0) straight to YUV, so these go through RGB */
+        SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Running automated RGB MJPG decoding test");
+        if (!run_mjpg_test(testyuv_rgb_jpg, testyuv_rgb_jpg_len)) {
+            result = 2;
+        }
         goto done;
     }
 
@@ -948,6 +1133,13 @@ int main(int argc, char **argv)
         goto done;
     }
 
+    if (should_run_benchmark) {
+        if (!run_benchmark(1920, 1080) || !run_benchmark(3840, 2160)) {
+            result = 2;
+        }
+        goto done;
+    }
+
     filename = GetResourceFilename(filename, "testyuv.png");
     png = SDL_LoadSurface(filename);
     if (png) {
@@ -0,0 +1,65 @@
+unsigned char testyuv_rgb_jpg[] = {
+  0xff, 0xd8, 0xff, 0xee, 0x00, 0x0e, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x00,
+  0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x03,
+  0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 0x03,
+  0x04, 0x05, 0x08, 0x05, 0x05, 0x04, 0x04, 0x05, 0x0a, 0x07, 0x07, 0x06,
+  0x08, 0x0c, 0x0a, 0x0c, 0x0c, 0x0b, 0x0a, 0x0b, 0x0b, 0x0d, 0x0e, 0x12,
+  0x10, 0x0d, 0x0e, 0x11, 0x0e, 0x0b, 0x0b, 0x10, 0x16, 0x10, 0x11, 0x13,
+  0x14, 0x15, 0x15, 0x15, 0x0c, 0x0f, 0x17, 0x18, 0x16, 0x14, 0x18, 0x12,
+  0x14, 0x15, 0x14, 0xff, 0xc0, 0x00, 0x11, 0x08, 0x00, 0x15, 0x00, 0x25,
+  0x03, 0x52, 0x11, 0x00, 0x47, 0x11, 0x00, 0x42, 0x11, 0x00, 0xff, 0xc4,
+  0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04,
+  0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10,
+  0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04,
+  0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12,
+  0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32,
+  0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0,
+  0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a,
+  0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+  0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55,
+  0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+  0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85,
+  0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98,
+  0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2,
+  0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5,
+  0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8,
+  0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea,
+  0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xda,
+  0x00, 0x0c, 0x03, 0x52, 0x00, 0x47, 0x00, 0x42, 0x00, 0x00, 0x3f, 0x00,
+  0xfc, 0xea, 0xf8, 0x7c, 0xa9, 0xb9, 0x72, 0xa3, 0xf2, 0xaf, 0x88, 0xbf,
+  0xe1, 0x46, 0xb6, 0x07, 0xee, 0x4f, 0xe5, 0x5f, 0x7e, 0x78, 0xb7, 0xc5,
+  0x31, 0x81, 0xd0, 0x62, 0xbe, 0x96, 0xf8, 0x78, 0x10, 0x04, 0xf9, 0x7f,
+  0x4a, 0x4f, 0xf8, 0x51, 0xad, 0x9f, 0xf5, 0x47, 0xf2, 0xaf, 0x1e, 0xf1,
+  0x6f, 0x8a, 0x63, 0xc3, 0x70, 0x3b, 0xf6, 0xaf, 0xa5, 0xfe, 0x1e, 0xaa,
+  0x0d, 0x9f, 0x28, 0xed, 0xda, 0x86, 0xf8, 0x1a, 0xdc, 0x7e, 0xe4, 0xfe,
+  0x55, 0xe3, 0x9e, 0x27, 0xf1, 0x44, 0x65, 0x1b, 0x81, 0xdf, 0xb5, 0x7d,
+  0x2f, 0xf0, 0xf5, 0x10, 0xf9, 0x7f, 0x28, 0x3d, 0x3b, 0x50, 0xdf, 0x03,
+  0x1b, 0x8f, 0xdd, 0x1f, 0xca, 0xbc, 0x87, 0xc5, 0x1e, 0x28, 0x8c, 0x33,
+  0xf0, 0x0f, 0x5a, 0xfa, 0x0b, 0xc3, 0xca, 0x82, 0xc4, 0x65, 0x47, 0xe5,
+  0x47, 0xfc, 0x28, 0xd6, 0xff, 0x00, 0x9e, 0x3f, 0xa5, 0x79, 0x6e, 0xa3,
+  0xe2, 0x94, 0x13, 0x9e, 0x17, 0xa9, 0xed, 0x5f, 0xcd, 0xdf, 0xc3, 0xf2,
+  0x43, 0x2f, 0x15, 0xfa, 0x1d, 0xff, 0x00, 0x0a, 0x28, 0x71, 0xfb, 0x8f,
+  0xfc, 0x76, 0xbf, 0x45, 0xbc, 0x5b, 0xe2, 0xc6, 0x2b, 0xd7, 0xb5, 0x7d,
+  0x2b, 0xf0, 0xf0, 0x92, 0x13, 0x8a, 0x5f, 0xf8, 0x51, 0x40, 0x7f, 0xcb,
+  0x03, 0xff, 0x00, 0x7c, 0xd7, 0x90, 0x78, 0xb7, 0xc5, 0x8d, 0xf3, 0x73,
+  0xeb, 0x5f, 0x4c, 0x7c, 0x3c, 0xc9, 0x29, 0xc5, 0x23, 0x7c, 0x09, 0x1f,
+  0xf3, 0xc3, 0xff, 0x00, 0x1d, 0xaf, 0x1d, 0xf1, 0x3f, 0x8a, 0xd8, 0x23,
+  0xf3, 0xeb, 0x5f, 0x4b, 0xfc, 0x3c, 0x24, 0x6c, 0xe2, 0x86, 0xf8, 0x16,
+  0x07, 0xfc, 0xb0, 0xff, 0x00, 0xc7, 0x6b, 0xc7, 0xbc, 0x53, 0xe2, 0xc2,
+  0x59, 0xf9, 0xf5, 0xef, 0x5f, 0x42, 0x78, 0x78, 0x31, 0xb1, 0x18, 0x03,
+  0xb5, 0x28, 0xf8, 0x15, 0xc7, 0xfa, 0x8f, 0xfc, 0x76, 0xbc, 0xbf, 0x50,
+  0xf1, 0x61, 0x33, 0x75, 0xf5, 0xaf, 0xe6, 0xf3, 0xe1, 0xf5, 0xba, 0xee,
+  0x5e, 0x4d, 0x7d, 0xe2, 0x7c, 0x01, 0xa6, 0xf1, 0xf2, 0xff, 0x00, 0xe3,
+  0xb5, 0xfa, 0x3d, 0xe2, 0x6d, 0x5e, 0xe0, 0xc4, 0x7e, 0x6e, 0xc6, 0xbe,
+  0x97, 0xf8, 0x79, 0x6c, 0xa1, 0x50, 0xe4, 0xf6, 0xa5, 0x3f, 0x0f, 0xf4,
+  0xdf, 0x4f, 0xfc, 0x76, 0xbc, 0x73, 0xc5, 0x3a, 0xbd, 0xc6, 0xf7, 0xf9,
+  0x8f, 0x7a, 0xfa, 0x4b, 0xe1, 0xe8, 0x39, 0x41, 0x9a, 0x73, 0x7c, 0x3c,
+  0xd3, 0x38, 0xf9, 0x3f, 0x4a, 0xf1, 0xef, 0x13, 0xea, 0xf7, 0x1b, 0x1f,
+  0xe6, 0xf5, 0xaf, 0xa5, 0xfe, 0x1e, 0x83, 0x88, 0xf9, 0xf4, 0xa1, 0xbe,
+  0x1e, 0x69, 0x67, 0x1f, 0x27, 0xe9, 0x5e, 0x3f, 0xe2, 0x8d, 0x5e, 0x70,
+  0xed, 0xf3, 0x7a, 0xf7, 0xaf, 0xa0, 0xfc, 0x3a, 0x0f, 0xd8, 0x47, 0x26,
+  0x9c, 0xbf, 0x0f, 0x74, 0xbc, 0x7d, 0xcf, 0xd2, 0xbc, 0xaf, 0x55, 0xd5,
+  0xee, 0x3e, 0xd1, 0xf7, 0xbb, 0x9e, 0xf5, 0xff, 0xd9
+};
+unsigned int testyuv_rgb_jpg_len = 741;